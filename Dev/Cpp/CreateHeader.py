@@ -65,6 +65,12 @@ effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Int4_SSE.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Bridge_Gen.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Bridge_NEON.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Bridge_SSE.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Float8_Gen.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Float8_AVX2.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Int8_Gen.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Int8_AVX2.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Bridge8.h')
+effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Kernels.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Vec2f.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Vec3f.h')
 effekseerSimdHeader.readLines('Effekseer/Effekseer/SIMD/Vec4f.h')
@@ -95,6 +101,7 @@ effekseerModulesHeader.readLines('Effekseer/Effekseer/Model/Model.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.Curve.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.CurveLoader.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Sound/Effekseer.SoundPlayer.h')
+effekseerModulesHeader.readLines('Effekseer/Effekseer/Sound/Effekseer.SoundVoiceManager.h')
 effekseerModulesHeader.readLines('Effekseer/Effekseer/Effekseer.SoundLoader.h')
 effekseerModulesHeader.output('Effekseer/Effekseer.Modules.h')
 
@@ -151,6 +151,19 @@ public:
 	{
 	}
 
+	/**
+		@brief
+		\~English	Render instances in a node at once. Rendering is called for each instance by default.
+		\~Japanese	ノードのインスタンスをまとめて描画する。デフォルトでは各インスタンスに対してRenderingが呼ばれる。
+	*/
+	virtual void Rendering(const NodeParameter& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering(parameter, instanceParameters[i], userData);
+		}
+	}
+
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
@@ -258,6 +271,19 @@ public:
 	{
 	}
 
+	/**
+		@brief
+		\~English	Render instances in a node at once. Rendering is called for each instance by default.
+		\~Japanese	ノードのインスタンスをまとめて描画する。デフォルトでは各インスタンスに対してRenderingが呼ばれる。
+	*/
+	virtual void Rendering(const NodeParameter& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering(parameter, instanceParameters[i], userData);
+		}
+	}
+
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
@@ -373,6 +399,19 @@ public:
 	{
 	}
 
+	/**
+		@brief
+		\~English	Render instances in a node at once. Rendering is called for each instance by default.
+		\~Japanese	ノードのインスタンスをまとめて描画する。デフォルトでは各インスタンスに対してRenderingが呼ばれる。
+	*/
+	virtual void Rendering(const NodeParameter& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering(parameter, instanceParameters[i], userData);
+		}
+	}
+
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
@@ -477,6 +516,19 @@ public:
 	{
 	}
 
+	/**
+		@brief
+		\~English	Render instances in a node at once. Rendering is called for each instance by default.
+		\~Japanese	ノードのインスタンスをまとめて描画する。デフォルトでは各インスタンスに対してRenderingが呼ばれる。
+	*/
+	virtual void Rendering(const NodeParameter& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering(parameter, instanceParameters[i], userData);
+		}
+	}
+
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
@@ -597,6 +649,19 @@ public:
 	{
 	}
 
+	/**
+		@brief
+		\~English	Render instances in a node at once. Rendering is called for each instance by default.
+		\~Japanese	ノードのインスタンスをまとめて描画する。デフォルトでは各インスタンスに対してRenderingが呼ばれる。
+	*/
+	virtual void Rendering(const NodeParameter& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering(parameter, instanceParameters[i], userData);
+		}
+	}
+
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
@@ -761,6 +826,34 @@ public:
 		return nullptr;
 	}
 
+	/**
+		@brief
+		\~English	a function called when textures which are used in an effect are loaded
+		\~Japanese	エフェクトで使用されるテクスチャが読み込まれるときに呼ばれる関数
+		@param	paths
+		\~English	paths of textures
+		\~Japanese	テクスチャのパス
+		@param	textureTypes
+		\~English	kinds of textures
+		\~Japanese	テクスチャの種類
+		@param	count
+		\~English	the number of textures
+		\~Japanese	テクスチャの数
+		@param	textures
+		\~English	loaded textures are written into it
+		\~Japanese	読み込まれたテクスチャが書き込まれる
+		@note
+		\~English	Textures are loaded one by one by default. Override it to decode textures in parallel.
+		\~Japanese	デフォルトでは1つずつ読み込まれる。並列に展開する場合はオーバーライドする。
+	*/
+	virtual void Load(const char16_t* const* paths, const TextureType* textureTypes, int32_t count, TextureRef* textures)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			textures[i] = Load(paths[i], textureTypes[i]);
+		}
+	}
+
 	/**
 		@brief	テクスチャを破棄する。
 		@param	data	[in]	テクスチャ
@@ -845,6 +938,11 @@ protected:
 	bool isBufferStoredOnGPU_ = false;
 	bool isWireIndexBufferGenerated_ = false;
 
+	//! the maximum distance from the origin to vertexes in all frames
+	float boundingRadius_ = 0.0f;
+
+	void CalculateBoundingRadius();
+
 public:
 	Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces);
 
@@ -868,6 +966,13 @@ public:
 
 	int32_t GetFrameCount() const;
 
+	/**
+		@brief
+		\~English	Get the maximum distance from the origin to vertexes in all frames
+		\~Japanese	全てのフレームの頂点の原点からの最大距離を取得する。
+	*/
+	float GetBoundingRadius() const;
+
 	Emitter GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
 
 	Emitter GetEmitterFromVertex(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
@@ -1105,6 +1210,11 @@ protected:
 	bool isBufferStoredOnGPU_ = false;
 	bool isWireIndexBufferGenerated_ = false;
 
+	//! the maximum distance from the origin to vertexes in all frames
+	float boundingRadius_ = 0.0f;
+
+	void CalculateBoundingRadius();
+
 public:
 	Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces);
 
@@ -1128,6 +1238,13 @@ public:
 
 	int32_t GetFrameCount() const;
 
+	/**
+		@brief
+		\~English	Get the maximum distance from the origin to vertexes in all frames
+		\~Japanese	全てのフレームの頂点の原点からの最大距離を取得する。
+	*/
+	float GetBoundingRadius() const;
+
 	Emitter GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
 
 	Emitter GetEmitterFromVertex(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
@@ -1564,6 +1681,191 @@ public:
 //----------------------------------------------------------------------------------
 #endif	// __EFFEKSEER_SOUND_PLAYER_H__
 
+#ifndef __EFFEKSEER_SOUND_VOICE_MANAGER_H__
+#define __EFFEKSEER_SOUND_VOICE_MANAGER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include <mutex>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+
+/**
+	@brief
+	\~English	A class which limits voices played by a sound player
+	\~Japanese	サウンド再生機能で再生されるボイスを制限するクラス
+	@note
+	\~English	Voices which exceed limits or are too quiet become virtual. Virtual voices are not mixed and resume when they can be played again.
+	Nothing is limited by default. Limits are applied to sounds which are played after they are specified.
+	\~Japanese	制限を超えるか音量が小さすぎるボイスは仮想ボイスになる。仮想ボイスはミックスされず、再び再生できるようになると再開される。
+	デフォルトでは何も制限されない。制限は指定された後に再生されるサウンドに適用される。
+*/
+class SoundVoiceManager : public ReferenceObject
+{
+public:
+	/**
+		@brief
+		\~English	A parameter which is specified for each sound data
+		\~Japanese	サウンドデータごとに指定されるパラメーター
+	*/
+	struct DataParameter
+	{
+		//! the maximum number of voices which play the data at the same time. 0 means unlimited.
+		int32_t MaxVoiceCount = 0;
+
+		//! voices which have a higher priority are played first
+		int32_t Priority = 0;
+	};
+
+private:
+	struct Voice
+	{
+		SoundTag Tag;
+		SoundPlayer::InstanceParameter Parameter;
+		SoundHandle Handle;
+		int32_t Priority;
+		float Audibility;
+		float VirtualFrame;
+		uint64_t Sequence;
+		bool IsStarted;
+		bool IsVirtual;
+	};
+
+	struct DataEntry
+	{
+		SoundDataRef Data;
+		DataParameter Parameter;
+	};
+
+	SoundPlayerRef player_;
+	CustomVector<Voice> voices_;
+	CustomVector<int32_t> sortedVoices_;
+	CustomUnorderedMap<const SoundData*, DataEntry> dataParameters_;
+	CustomUnorderedMap<const SoundData*, int32_t> dataVoiceCounts_;
+	DataParameter defaultDataParameter_;
+	Vector3D listenerPosition_;
+	int32_t maxVoiceCount_ = 0;
+	float audibleVolume_ = 0.0f;
+	float virtualVoiceLifetime_ = 60.0f;
+	uint64_t sequence_ = 0;
+	std::mutex mutex_;
+
+	bool IsLimited() const;
+
+	const DataParameter& GetDataParameter(const SoundData* data) const;
+
+	float CalculateAudibility(const SoundPlayer::InstanceParameter& parameter) const;
+
+public:
+	SoundVoiceManager() = default;
+	virtual ~SoundVoiceManager() = default;
+
+	/**
+		@brief
+		\~English	Specify a sound player which plays voices actually
+		\~Japanese	実際にボイスを再生するサウンド再生機能を指定する。
+	*/
+	void SetSoundPlayer(SoundPlayerRef player);
+
+	/**
+		@brief
+		\~English	Specify the maximum number of voices which are played at the same time. 0 means unlimited.
+		\~Japanese	同時に再生されるボイスの最大数を指定する。0は無制限を意味する。
+	*/
+	void SetMaxVoiceCount(int32_t count);
+
+	int32_t GetMaxVoiceCount() const
+	{
+		return maxVoiceCount_;
+	}
+
+	/**
+		@brief
+		\~English	Specify a parameter for a sound data
+		\~Japanese	サウンドデータのパラメーターを指定する。
+	*/
+	void SetDataParameter(const SoundDataRef& data, const DataParameter& parameter);
+
+	/**
+		@brief
+		\~English	Specify a parameter for sound data whose parameter is not specified
+		\~Japanese	パラメーターが指定されていないサウンドデータのパラメーターを指定する。
+	*/
+	void SetDefaultDataParameter(const DataParameter& parameter);
+
+	/**
+		@brief
+		\~English	Specify the position of a listener to calculate volumes of 3D sounds. It should be same as a position which is specified to a sound player.
+		\~Japanese	3Dサウンドの音量を計算するためのリスナーの位置を指定する。サウンド再生機能に指定された位置と同じであるべきである。
+	*/
+	void SetListener(const Vector3D& position);
+
+	/**
+		@brief
+		\~English	Specify the minimum volume which is audible. Quieter voices including distant 3D sounds become virtual.
+		\~Japanese	聞こえる最小の音量を指定する。離れた3Dサウンドを含む、より小さいボイスは仮想ボイスになる。
+	*/
+	void SetAudibleVolume(float volume);
+
+	/**
+		@brief
+		\~English	Specify frames while virtual voices are kept. Virtual voices are stopped after it.
+		\~Japanese	仮想ボイスが保持されるフレーム数を指定する。その後、仮想ボイスは停止される。
+	*/
+	void SetVirtualVoiceLifetime(float frames);
+
+	/**
+		@brief
+		\~English	Get the number of voices which are tracked. It includes virtual voices.
+		\~Japanese	追跡されているボイスの数を取得する。仮想ボイスを含む。
+	*/
+	int32_t GetVoiceCount();
+
+	/**
+		@brief
+		\~English	Get the number of virtual voices
+		\~Japanese	仮想ボイスの数を取得する。
+	*/
+	int32_t GetVirtualVoiceCount();
+
+	/**
+		@brief
+		\~English	Request to play a sound. It is called by a manager.
+		\~Japanese	サウンドの再生を要求する。マネージャーから呼ばれる。
+	*/
+	void Play(SoundTag tag, const SoundPlayer::InstanceParameter& parameter);
+
+	/**
+		@brief
+		\~English	Update voices. It is called by a manager.
+		\~Japanese	ボイスを更新する。マネージャーから呼ばれる。
+	*/
+	void Update(float deltaFrame);
+
+	void StopTag(SoundTag tag);
+
+	bool CheckPlayingTag(SoundTag tag);
+
+	void StopAll();
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEER_SOUND_VOICE_MANAGER_H__
+
 #ifndef __EFFEKSEER_SOUNDLOADER_H__
 #define __EFFEKSEER_SOUNDLOADER_H__
 
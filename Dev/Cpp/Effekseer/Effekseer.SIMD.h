@@ -2960,6 +2960,1028 @@ inline Float4 Int4::Cast4f() const { return _mm_castsi128_ps(s); }
 
 #endif // __EFFEKSEER_SIMD_BRIDGE_SSE_H__
 
+#ifndef __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+#define __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+
+
+#if !defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Int8;
+
+/**
+	@brief	simd class for 8 lanes which consists of two Float4
+*/
+struct alignas(16) Float8
+{
+	Float4 s[2];
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(const Float4& low, const Float4& high) { s[0] = low; s[1] = high; }
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7)
+	{
+		s[0] = Float4(x0, x1, x2, x3);
+		s[1] = Float4(x4, x5, x6, x7);
+	}
+	Float8(float i) { s[0] = Float4(i); s[1] = Float4(i); }
+
+	Float4 GetLow() const { return s[0]; }
+	Float4 GetHigh() const { return s[1]; }
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+	static Float8 IsZero(const Float8& in, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] + rhs.s[0], lhs.s[1] + rhs.s[1]};
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] - rhs.s[0], lhs.s[1] - rhs.s[1]};
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] * rhs.s[0], lhs.s[1] * rhs.s[1]};
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	return Float8{lhs.s[0] * rhs, lhs.s[1] * rhs};
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] / rhs.s[0], lhs.s[1] / rhs.s[1]};
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	return Float8{lhs.s[0] / rhs, lhs.s[1] / rhs};
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] & rhs.s[0], lhs.s[1] & rhs.s[1]};
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] | rhs.s[0], lhs.s[1] | rhs.s[1]};
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] ^ rhs.s[0], lhs.s[1] ^ rhs.s[1]};
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	return Float8{Float4::Load4(mem), Float4::Load4((const float*)mem + 4)};
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	Float4::Store4(mem, i.s[0]);
+	Float4::Store4((float*)mem + 4, i.s[1]);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return Float8{Float4::SetZero(), Float4::SetZero()};
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	return Float8{Float4::Sqrt(in.s[0]), Float4::Sqrt(in.s[1])};
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	return Float8{Float4::Rsqrt(in.s[0]), Float4::Rsqrt(in.s[1])};
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	return Float8{Float4::Abs(in.s[0]), Float4::Abs(in.s[1])};
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::Min(lhs.s[0], rhs.s[0]), Float4::Min(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::Max(lhs.s[0], rhs.s[0]), Float4::Max(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	return Float8{Float4::Floor(in.s[0]), Float4::Floor(in.s[1])};
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	return Float8{Float4::Ceil(in.s[0]), Float4::Ceil(in.s[1])};
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+	return Float8{Float4::MulAdd(a.s[0], b.s[0], c.s[0]), Float4::MulAdd(a.s[1], b.s[1], c.s[1])};
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+	return Float8{Float4::MulSub(a.s[0], b.s[0], c.s[0]), Float4::MulSub(a.s[1], b.s[1], c.s[1])};
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	return Float4::MoveMask(in.s[0]) | (Float4::MoveMask(in.s[1]) << 4);
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	return Float8{Float4::Select(mask.s[0], sel1.s[0], sel2.s[0]), Float4::Select(mask.s[1], sel1.s[1], sel2.s[1])};
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::Equal(lhs.s[0], rhs.s[0]), Float4::Equal(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::NotEqual(lhs.s[0], rhs.s[0]), Float4::NotEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::LessThan(lhs.s[0], rhs.s[0]), Float4::LessThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::LessEqual(lhs.s[0], rhs.s[0]), Float4::LessEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::GreaterThan(lhs.s[0], rhs.s[0]), Float4::GreaterThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::GreaterEqual(lhs.s[0], rhs.s[0]), Float4::GreaterEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	return LessEqual(Abs(lhs - rhs), Float8(epsilon));
+}
+
+inline Float8 Float8::IsZero(const Float8& in, float epsilon)
+{
+	return LessEqual(Abs(in), Float8(epsilon));
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+
+#ifndef __EFFEKSEER_SIMD_FLOAT8_AVX2_H__
+#define __EFFEKSEER_SIMD_FLOAT8_AVX2_H__
+
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Int8;
+
+/**
+	@brief	simd class for avx2
+*/
+struct alignas(32) Float8
+{
+	__m256 s;
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(__m256 rhs) { s = rhs; }
+	Float8(__m256i rhs) { s = _mm256_castsi256_ps(rhs); }
+	Float8(const Float4& low, const Float4& high) { s = _mm256_insertf128_ps(_mm256_castps128_ps256(low.s), high.s, 1); }
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7) { s = _mm256_setr_ps(x0, x1, x2, x3, x4, x5, x6, x7); }
+	Float8(float i) { s = _mm256_set1_ps(i); }
+
+	Float4 GetLow() const { return _mm256_castps256_ps128(s); }
+	Float4 GetHigh() const { return _mm256_extractf128_ps(s, 1); }
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+	static Float8 IsZero(const Float8& in, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_add_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_sub_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_mul_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	return Float8{_mm256_mul_ps(lhs.s, _mm256_set1_ps(rhs))};
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_div_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	return Float8{_mm256_div_ps(lhs.s, _mm256_set1_ps(rhs))};
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_and_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_or_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_xor_ps(lhs.s, rhs.s)};
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	return _mm256_loadu_ps((const float*)mem);
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	_mm256_storeu_ps((float*)mem, i.s);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return _mm256_setzero_ps();
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	return Float8{_mm256_sqrt_ps(in.s)};
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	return Float8{_mm256_rsqrt_ps(in.s)};
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), in.s);
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_min_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_max_ps(lhs.s, rhs.s)};
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	return _mm256_floor_ps(in.s);
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	return _mm256_ceil_ps(in.s);
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+	return Float8{_mm256_fmadd_ps(b.s, c.s, a.s)};
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+	return Float8{_mm256_fnmadd_ps(b.s, c.s, a.s)};
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	return (uint32_t)_mm256_movemask_ps(in.s);
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	return _mm256_blendv_ps(sel2.s, sel1.s, mask.s);
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_EQ_OQ)};
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_NEQ_UQ)};
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_LT_OQ)};
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_LE_OQ)};
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_GT_OQ)};
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{_mm256_cmp_ps(lhs.s, rhs.s, _CMP_GE_OQ)};
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	return LessEqual(Abs(lhs - rhs), Float8(epsilon));
+}
+
+inline Float8 Float8::IsZero(const Float8& in, float epsilon)
+{
+	return LessEqual(Abs(in), Float8(epsilon));
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_AVX2_H__
+
+#ifndef __EFFEKSEER_SIMD_INT8_GEN_H__
+#define __EFFEKSEER_SIMD_INT8_GEN_H__
+
+
+#if !defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Float8;
+
+/**
+	@brief	simd class for 8 lanes which consists of two Int4
+*/
+struct alignas(16) Int8
+{
+	Int4 s[2];
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(const Int4& low, const Int4& high) { s[0] = low; s[1] = high; }
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7)
+	{
+		s[0] = Int4(x0, x1, x2, x3);
+		s[1] = Int4(x4, x5, x6, x7);
+	}
+	Int8(int32_t i) { s[0] = Int4(i); s[1] = Int4(i); }
+
+	Int4 GetLow() const { return s[0]; }
+	Int4 GetHigh() const { return s[1]; }
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] + rhs.s[0], lhs.s[1] + rhs.s[1]};
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] - rhs.s[0], lhs.s[1] - rhs.s[1]};
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] * rhs.s[0], lhs.s[1] * rhs.s[1]};
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] & rhs.s[0], lhs.s[1] & rhs.s[1]};
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] | rhs.s[0], lhs.s[1] | rhs.s[1]};
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * Int8(rhs); }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	return Int8{Int4::Load4(mem), Int4::Load4((const int32_t*)mem + 4)};
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	Int4::Store4(mem, i.s[0]);
+	Int4::Store4((int32_t*)mem + 4, i.s[1]);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return Int8{Int4::SetZero(), Int4::SetZero()};
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	return Int8{Int4::Abs(in.s[0]), Int4::Abs(in.s[1])};
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::Min(lhs.s[0], rhs.s[0]), Int4::Min(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::Max(lhs.s[0], rhs.s[0]), Int4::Max(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	return Int8{Int4::ShiftL<COUNT>(lhs.s[0]), Int4::ShiftL<COUNT>(lhs.s[1])};
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	return Int8{Int4::ShiftR<COUNT>(lhs.s[0]), Int4::ShiftR<COUNT>(lhs.s[1])};
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	return Int8{Int4::ShiftRA<COUNT>(lhs.s[0]), Int4::ShiftRA<COUNT>(lhs.s[1])};
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	return Int4::MoveMask(in.s[0]) | (Int4::MoveMask(in.s[1]) << 4);
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::Equal(lhs.s[0], rhs.s[0]), Int4::Equal(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::NotEqual(lhs.s[0], rhs.s[0]), Int4::NotEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::LessThan(lhs.s[0], rhs.s[0]), Int4::LessThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::LessEqual(lhs.s[0], rhs.s[0]), Int4::LessEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::GreaterThan(lhs.s[0], rhs.s[0]), Int4::GreaterThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::GreaterEqual(lhs.s[0], rhs.s[0]), Int4::GreaterEqual(lhs.s[1], rhs.s[1])};
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_GEN_H__
+
+#ifndef __EFFEKSEER_SIMD_INT8_AVX2_H__
+#define __EFFEKSEER_SIMD_INT8_AVX2_H__
+
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Float8;
+
+/**
+	@brief	simd class for avx2
+*/
+struct alignas(32) Int8
+{
+	__m256i s;
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(__m256i rhs) { s = rhs; }
+	Int8(__m256 rhs) { s = _mm256_castps_si256(rhs); }
+	Int8(const Int4& low, const Int4& high) { s = _mm256_inserti128_si256(_mm256_castsi128_si256(low.s), high.s, 1); }
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7) { s = _mm256_setr_epi32(x0, x1, x2, x3, x4, x5, x6, x7); }
+	Int8(int32_t i) { s = _mm256_set1_epi32(i); }
+
+	Int4 GetLow() const { return _mm256_castsi256_si128(s); }
+	Int4 GetHigh() const { return _mm256_extracti128_si256(s, 1); }
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_add_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_sub_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_mullo_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_and_si256(lhs.s, rhs.s)};
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_or_si256(lhs.s, rhs.s)};
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * Int8(rhs); }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	return _mm256_loadu_si256((const __m256i*)mem);
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	_mm256_storeu_si256((__m256i*)mem, i.s);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return _mm256_setzero_si256();
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	return _mm256_abs_epi32(in.s);
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	return _mm256_min_epi32(lhs.s, rhs.s);
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	return _mm256_max_epi32(lhs.s, rhs.s);
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	return _mm256_slli_epi32(lhs.s, COUNT);
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	return _mm256_srli_epi32(lhs.s, COUNT);
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	return _mm256_srai_epi32(lhs.s, COUNT);
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(in.s));
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpeq_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpeq_epi32(lhs.s, rhs.s), _mm256_set1_epi32(-1))};
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpgt_epi32(rhs.s, lhs.s)};
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpgt_epi32(lhs.s, rhs.s), _mm256_set1_epi32(-1))};
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpgt_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpgt_epi32(rhs.s, lhs.s), _mm256_set1_epi32(-1))};
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_AVX2_H__
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_H__
+
+#include <cstdint>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+#if defined(EFK_SIMD_AVX2)
+
+inline Int8 Float8::Convert8i() const { return _mm256_cvtps_epi32(s); }
+
+inline Int8 Float8::Cast8i() const { return _mm256_castps_si256(s); }
+
+inline Float8 Int8::Convert8f() const { return _mm256_cvtepi32_ps(s); }
+
+inline Float8 Int8::Cast8f() const { return _mm256_castsi256_ps(s); }
+
+#else
+
+inline Int8 Float8::Convert8i() const { return Int8{s[0].Convert4i(), s[1].Convert4i()}; }
+
+inline Int8 Float8::Cast8i() const { return Int8{s[0].Cast4i(), s[1].Cast4i()}; }
+
+inline Float8 Int8::Convert8f() const { return Float8{s[0].Convert4f(), s[1].Convert4f()}; }
+
+inline Float8 Int8::Cast8f() const { return Float8{s[0].Cast4f(), s[1].Cast4f()}; }
+
+#endif
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_H__
+
+#ifndef __EFFEKSEER_SIMD_KERNELS_H__
+#define __EFFEKSEER_SIMD_KERNELS_H__
+
+#include <cstdint>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+/**
+	@brief	instruction sets which kernels are implemented with
+*/
+enum class InstructionSet : int32_t
+{
+	//! the instruction set which is selected at compile time
+	Generic,
+
+	//! x86-64 AVX2 which is selected at runtime
+	AVX2,
+};
+
+/**
+	@brief	hot loops which process many elements at once
+	@note
+	Vectors are stored as 4 floats (x, y, z, unused) like Vec3f.
+	Matrices are stored as 12 floats like Mat43f (rows X, Y and Z).
+	Kernels don't use FMA, so results are same as Float4 and Mat43f built without AVX2.
+*/
+struct Kernels
+{
+	InstructionSet Set;
+
+	//! dst[i] = lhs[i] * rhs[i]. dst may be same as lhs or rhs
+	void (*MultiplyMat43)(float* dst, const float* lhs, const float* rhs, int32_t count);
+
+	//! dst[i] = location[i] + velocity[i] * time[i] + acceleration[i] * time[i] * time[i] * 0.5
+	void (*IntegratePVA)(float* dst, const float* location, const float* velocity, const float* acceleration, const float* time, int32_t count);
+
+	//! dst[i] = PerlinNoise::OctaveNoise(octaves, positions[i]) with a permutation table which has 512 elements
+	void (*OctaveNoise)(float* dst, const float* positions, int32_t count, int32_t octaves, const int32_t* permutation);
+};
+
+/**
+	@brief	whether kernels with the instruction set can be run on this CPU
+*/
+bool IsSupported(InstructionSet set);
+
+/**
+	@brief	get kernels with the instruction set. nullptr is returned if they can't be run on this CPU
+*/
+const Kernels* GetKernels(InstructionSet set);
+
+/**
+	@brief	get kernels with the best instruction set on this CPU
+	@note
+	The instruction set is detected with CPUID at the first call.
+*/
+const Kernels& GetKernels();
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_SIMD_KERNELS_H__
+
 #ifndef __EFFEKSEER_SIMD_VEC2F_H__
 #define __EFFEKSEER_SIMD_VEC2F_H__
 
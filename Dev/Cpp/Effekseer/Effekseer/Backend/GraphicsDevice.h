@@ -58,6 +58,20 @@ enum class TextureFormatType
 	BC1_SRGB,
 	BC2_SRGB,
 	BC3_SRGB,
+	BC4,
+	BC5,
+	BC7,
+	BC7_SRGB,
+	ETC2_RGB8,
+	ETC2_RGB8_SRGB,
+	ETC2_RGBA8,
+	ETC2_RGBA8_SRGB,
+	ASTC_4x4,
+	ASTC_4x4_SRGB,
+	ASTC_6x6,
+	ASTC_6x6_SRGB,
+	ASTC_8x8,
+	ASTC_8x8_SRGB,
 
 	//! You don't need to implement DepthTexture for a runtime
 	D32,
@@ -77,6 +91,108 @@ inline bool IsDepthTextureFormat(TextureFormatType format)
 		   format == TextureFormatType::D32;
 }
 
+/**
+	@brief	Get a size of a block. A block of an uncompressed format is a pixel.
+	@return	false if the format is unknown
+*/
+inline bool GetTextureFormatBlockSize(TextureFormatType format, int32_t& blockWidth, int32_t& blockHeight, int32_t& blockBytes)
+{
+	blockWidth = 1;
+	blockHeight = 1;
+
+	switch (format)
+	{
+	case TextureFormatType::R8G8B8A8_UNORM:
+	case TextureFormatType::B8G8R8A8_UNORM:
+	case TextureFormatType::R8G8B8A8_UNORM_SRGB:
+	case TextureFormatType::B8G8R8A8_UNORM_SRGB:
+	case TextureFormatType::R32_FLOAT:
+	case TextureFormatType::R16G16_FLOAT:
+	case TextureFormatType::D32:
+	case TextureFormatType::D24S8:
+		blockBytes = 4;
+		return true;
+	case TextureFormatType::R8_UNORM:
+		blockBytes = 1;
+		return true;
+	case TextureFormatType::R16_FLOAT:
+		blockBytes = 2;
+		return true;
+	case TextureFormatType::R16G16B16A16_FLOAT:
+	case TextureFormatType::D32S8:
+		blockBytes = 8;
+		return true;
+	case TextureFormatType::R32G32B32A32_FLOAT:
+		blockBytes = 16;
+		return true;
+	case TextureFormatType::BC1:
+	case TextureFormatType::BC1_SRGB:
+	case TextureFormatType::BC4:
+	case TextureFormatType::ETC2_RGB8:
+	case TextureFormatType::ETC2_RGB8_SRGB:
+		blockWidth = 4;
+		blockHeight = 4;
+		blockBytes = 8;
+		return true;
+	case TextureFormatType::BC2:
+	case TextureFormatType::BC2_SRGB:
+	case TextureFormatType::BC3:
+	case TextureFormatType::BC3_SRGB:
+	case TextureFormatType::BC5:
+	case TextureFormatType::BC7:
+	case TextureFormatType::BC7_SRGB:
+	case TextureFormatType::ETC2_RGBA8:
+	case TextureFormatType::ETC2_RGBA8_SRGB:
+	case TextureFormatType::ASTC_4x4:
+	case TextureFormatType::ASTC_4x4_SRGB:
+		blockWidth = 4;
+		blockHeight = 4;
+		blockBytes = 16;
+		return true;
+	case TextureFormatType::ASTC_6x6:
+	case TextureFormatType::ASTC_6x6_SRGB:
+		blockWidth = 6;
+		blockHeight = 6;
+		blockBytes = 16;
+		return true;
+	case TextureFormatType::ASTC_8x8:
+	case TextureFormatType::ASTC_8x8_SRGB:
+		blockWidth = 8;
+		blockHeight = 8;
+		blockBytes = 16;
+		return true;
+	default:
+		blockBytes = 0;
+		return false;
+	}
+}
+
+inline bool IsCompressedTextureFormat(TextureFormatType format)
+{
+	int32_t blockWidth = 0;
+	int32_t blockHeight = 0;
+	int32_t blockBytes = 0;
+	return GetTextureFormatBlockSize(format, blockWidth, blockHeight, blockBytes) && blockWidth > 1;
+}
+
+/**
+	@brief	Get a size of a mip level in bytes
+*/
+inline int32_t GetTextureMipLevelSize(TextureFormatType format, int32_t width, int32_t height, int32_t level)
+{
+	int32_t blockWidth = 0;
+	int32_t blockHeight = 0;
+	int32_t blockBytes = 0;
+	GetTextureFormatBlockSize(format, blockWidth, blockHeight, blockBytes);
+
+	width = width >> level;
+	height = height >> level;
+	width = width > 0 ? width : 1;
+	height = height > 0 ? height : 1;
+
+	return ((width + blockWidth - 1) / blockWidth) * ((height + blockHeight - 1) / blockHeight) * blockBytes;
+}
+
 enum class IndexBufferStrideType
 {
 	Stride2,
@@ -219,6 +335,12 @@ struct TextureParameter
 	TextureFormatType Format = TextureFormatType::R8G8B8A8_UNORM;
 	int32_t Dimension = 2;
 	std::array<int32_t, 3> Size = {1, 1, 1};
+
+	/**
+		@brief	The number of mip levels. 0 means that all levels are generated from the first level.
+		@note
+		If initial data contains all levels which are arranged from the first level, they are used instead of generating them.
+	*/
 	int32_t MipLevelCount = 1;
 
 	//! You don't need to implement SampleCount for a runtime
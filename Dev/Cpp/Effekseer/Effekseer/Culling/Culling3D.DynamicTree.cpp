@@ -0,0 +1,432 @@
+﻿
+#include "Culling3D.DynamicTree.h"
+#include "../SIMD/Float4.h"
+
+#include <algorithm>
+
+namespace Culling3D
+{
+using Effekseer::SIMD::Float4;
+
+AABB::AABB(const Vector3DF& min_, const Vector3DF& max_)
+	: Min(min_)
+	, Max(max_)
+{
+}
+
+bool AABB::Contains(const AABB& o) const
+{
+	return Min.X <= o.Min.X && Min.Y <= o.Min.Y && Min.Z <= o.Min.Z && o.Max.X <= Max.X && o.Max.Y <= Max.Y && o.Max.Z <= Max.Z;
+}
+
+bool AABB::Overlaps(const AABB& o) const
+{
+	return Min.X <= o.Max.X && Min.Y <= o.Max.Y && Min.Z <= o.Max.Z && o.Min.X <= Max.X && o.Min.Y <= Max.Y && o.Min.Z <= Max.Z;
+}
+
+float AABB::GetPerimeter() const
+{
+	const auto size = Max - Min;
+	return size.X * size.Y + size.Y * size.Z + size.Z * size.X;
+}
+
+AABB AABB::Combine(const AABB& a, const AABB& b)
+{
+	return AABB(Vector3DF(std::min(a.Min.X, b.Min.X), std::min(a.Min.Y, b.Min.Y), std::min(a.Min.Z, b.Min.Z)),
+				Vector3DF(std::max(a.Max.X, b.Max.X), std::max(a.Max.Y, b.Max.Y), std::max(a.Max.Z, b.Max.Z)));
+}
+
+FrustumPlanes::FrustumPlanes(const Vector3DF facePositions[6], const Vector3DF faceDir[6])
+{
+	// unused planes have zero normals, so that they never cull anything
+	for (int32_t i = 0; i < 8; i++)
+	{
+		const bool isUsed = i < 6;
+		NormalX[i] = isUsed ? faceDir[i].X : 0.0f;
+		NormalY[i] = isUsed ? faceDir[i].Y : 0.0f;
+		NormalZ[i] = isUsed ? faceDir[i].Z : 0.0f;
+		Distance[i] = isUsed ? Vector3DF::Dot(facePositions[i], faceDir[i]) : 0.0f;
+	}
+}
+
+bool FrustumPlanes::IsOutside(const AABB& aabb) const
+{
+	const Float4 cx((aabb.Min.X + aabb.Max.X) * 0.5f);
+	const Float4 cy((aabb.Min.Y + aabb.Max.Y) * 0.5f);
+	const Float4 cz((aabb.Min.Z + aabb.Max.Z) * 0.5f);
+	const Float4 ex((aabb.Max.X - aabb.Min.X) * 0.5f);
+	const Float4 ey((aabb.Max.Y - aabb.Min.Y) * 0.5f);
+	const Float4 ez((aabb.Max.Z - aabb.Min.Z) * 0.5f);
+
+	for (int32_t i = 0; i < 8; i += 4)
+	{
+		const auto nx = Float4::Load4(NormalX + i);
+		const auto ny = Float4::Load4(NormalY + i);
+		const auto nz = Float4::Load4(NormalZ + i);
+
+		// the distance from planes to the nearest corner of the box
+		const auto distance = (nx * cx + ny * cy + nz * cz) - Float4::Load4(Distance + i);
+		const auto radius = Float4::Abs(nx) * ex + Float4::Abs(ny) * ey + Float4::Abs(nz) * ez;
+
+		if (Float4::MoveMask(Float4::GreaterThan(distance - radius, Float4::SetZero())) != 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+DynamicTree::DynamicTree(float margin)
+	: margin(margin)
+{
+}
+
+int32_t DynamicTree::AllocateNode()
+{
+	if (freeList == NullNode)
+	{
+		nodes.emplace_back();
+		freeList = static_cast<int32_t>(nodes.size()) - 1;
+		nodes[freeList].Parent = NullNode;
+	}
+
+	const auto node = freeList;
+	freeList = nodes[node].Parent;
+
+	nodes[node].Obj = nullptr;
+	nodes[node].Parent = NullNode;
+	nodes[node].Child1 = NullNode;
+	nodes[node].Child2 = NullNode;
+	nodes[node].Height = 0;
+	return node;
+}
+
+void DynamicTree::FreeNode(int32_t node)
+{
+	nodes[node].Obj = nullptr;
+	nodes[node].Parent = freeList;
+	nodes[node].Height = -1;
+	freeList = node;
+}
+
+int32_t DynamicTree::CreateProxy(const AABB& aabb, Object* o)
+{
+	const auto proxy = AllocateNode();
+	const Vector3DF extension(margin, margin, margin);
+
+	nodes[proxy].Bounds = AABB(aabb.Min - extension, aabb.Max + extension);
+	nodes[proxy].Obj = o;
+
+	InsertLeaf(proxy);
+	return proxy;
+}
+
+void DynamicTree::DestroyProxy(int32_t proxy)
+{
+	assert(nodes[proxy].IsLeaf());
+
+	RemoveLeaf(proxy);
+	FreeNode(proxy);
+}
+
+bool DynamicTree::MoveProxy(int32_t proxy, const AABB& aabb)
+{
+	assert(nodes[proxy].IsLeaf());
+
+	if (nodes[proxy].Bounds.Contains(aabb))
+	{
+		return false;
+	}
+
+	RemoveLeaf(proxy);
+
+	const Vector3DF extension(margin, margin, margin);
+	nodes[proxy].Bounds = AABB(aabb.Min - extension, aabb.Max + extension);
+
+	InsertLeaf(proxy);
+	return true;
+}
+
+void DynamicTree::InsertLeaf(int32_t leaf)
+{
+	if (root == NullNode)
+	{
+		root = leaf;
+		nodes[root].Parent = NullNode;
+		return;
+	}
+
+	// find the best sibling with the surface area heuristic
+	const auto leafBounds = nodes[leaf].Bounds;
+	auto index = root;
+
+	while (!nodes[index].IsLeaf())
+	{
+		const auto child1 = nodes[index].Child1;
+		const auto child2 = nodes[index].Child2;
+
+		const auto area = nodes[index].Bounds.GetPerimeter();
+		const auto combinedArea = AABB::Combine(nodes[index].Bounds, leafBounds).GetPerimeter();
+
+		// the cost of creating a new parent for this node and the new leaf
+		const auto cost = 2.0f * combinedArea;
+
+		// the minimum cost of pushing the leaf further down the tree
+		const auto inheritanceCost = 2.0f * (combinedArea - area);
+
+		auto getCost = [&](int32_t child) {
+			const auto childArea = AABB::Combine(leafBounds, nodes[child].Bounds).GetPerimeter();
+			if (nodes[child].IsLeaf())
+			{
+				return childArea + inheritanceCost;
+			}
+			return childArea - nodes[child].Bounds.GetPerimeter() + inheritanceCost;
+		};
+
+		const auto cost1 = getCost(child1);
+		const auto cost2 = getCost(child2);
+
+		if (cost < cost1 && cost < cost2)
+		{
+			break;
+		}
+
+		index = cost1 < cost2 ? child1 : child2;
+	}
+
+	const auto sibling = index;
+
+	// create a new parent
+	const auto oldParent = nodes[sibling].Parent;
+	const auto newParent = AllocateNode();
+	nodes[newParent].Parent = oldParent;
+	nodes[newParent].Bounds = AABB::Combine(leafBounds, nodes[sibling].Bounds);
+	nodes[newParent].Height = nodes[sibling].Height + 1;
+	nodes[newParent].Child1 = sibling;
+	nodes[newParent].Child2 = leaf;
+	nodes[sibling].Parent = newParent;
+	nodes[leaf].Parent = newParent;
+
+	if (oldParent != NullNode)
+	{
+		if (nodes[oldParent].Child1 == sibling)
+		{
+			nodes[oldParent].Child1 = newParent;
+		}
+		else
+		{
+			nodes[oldParent].Child2 = newParent;
+		}
+	}
+	else
+	{
+		root = newParent;
+	}
+
+	Refit(nodes[leaf].Parent);
+}
+
+void DynamicTree::RemoveLeaf(int32_t leaf)
+{
+	if (leaf == root)
+	{
+		root = NullNode;
+		return;
+	}
+
+	const auto parent = nodes[leaf].Parent;
+	const auto grandParent = nodes[parent].Parent;
+	const auto sibling = nodes[parent].Child1 == leaf ? nodes[parent].Child2 : nodes[parent].Child1;
+
+	if (grandParent != NullNode)
+	{
+		// connect the sibling to the grand parent and destroy the parent
+		if (nodes[grandParent].Child1 == parent)
+		{
+			nodes[grandParent].Child1 = sibling;
+		}
+		else
+		{
+			nodes[grandParent].Child2 = sibling;
+		}
+		nodes[sibling].Parent = grandParent;
+		FreeNode(parent);
+
+		Refit(grandParent);
+	}
+	else
+	{
+		root = sibling;
+		nodes[sibling].Parent = NullNode;
+		FreeNode(parent);
+	}
+}
+
+void DynamicTree::Refit(int32_t node)
+{
+	auto index = node;
+
+	while (index != NullNode)
+	{
+		index = Balance(index);
+
+		const auto child1 = nodes[index].Child1;
+		const auto child2 = nodes[index].Child2;
+
+		nodes[index].Height = 1 + std::max(nodes[child1].Height, nodes[child2].Height);
+		nodes[index].Bounds = AABB::Combine(nodes[child1].Bounds, nodes[child2].Bounds);
+
+		index = nodes[index].Parent;
+	}
+}
+
+int32_t DynamicTree::Balance(int32_t iA)
+{
+	auto& a = nodes[iA];
+	if (a.IsLeaf() || a.Height < 2)
+	{
+		return iA;
+	}
+
+	const auto iB = a.Child1;
+	const auto iC = a.Child2;
+	const auto balance = nodes[iC].Height - nodes[iB].Height;
+
+	// rotate a higher child up
+	auto rotate = [&](int32_t iUp, int32_t iDown, bool isUpChild2) {
+		auto& up = nodes[iUp];
+		const auto iF = up.Child1;
+		const auto iG = up.Child2;
+
+		// swap A and Up
+		up.Child1 = iA;
+		up.Parent = nodes[iA].Parent;
+		nodes[iA].Parent = iUp;
+
+		if (up.Parent != NullNode)
+		{
+			if (nodes[up.Parent].Child1 == iA)
+			{
+				nodes[up.Parent].Child1 = iUp;
+			}
+			else
+			{
+				nodes[up.Parent].Child2 = iUp;
+			}
+		}
+		else
+		{
+			root = iUp;
+		}
+
+		// keep a higher grandchild under Up and move a lower one under A
+		auto iHigh = iF;
+		auto iLow = iG;
+		if (nodes[iF].Height < nodes[iG].Height)
+		{
+			std::swap(iHigh, iLow);
+		}
+
+		up.Child2 = iHigh;
+
+		if (isUpChild2)
+		{
+			nodes[iA].Child2 = iLow;
+		}
+		else
+		{
+			nodes[iA].Child1 = iLow;
+		}
+		nodes[iLow].Parent = iA;
+
+		nodes[iA].Bounds = AABB::Combine(nodes[iDown].Bounds, nodes[iLow].Bounds);
+		nodes[iA].Height = 1 + std::max(nodes[iDown].Height, nodes[iLow].Height);
+
+		up.Bounds = AABB::Combine(nodes[iA].Bounds, nodes[iHigh].Bounds);
+		up.Height = 1 + std::max(nodes[iA].Height, nodes[iHigh].Height);
+
+		return iUp;
+	};
+
+	if (balance > 1)
+	{
+		return rotate(iC, iB, true);
+	}
+
+	if (balance < -1)
+	{
+		return rotate(iB, iC, false);
+	}
+
+	return iA;
+}
+
+void DynamicTree::QueryFrustum(const FrustumPlanes& planes, std::vector<Object*>& objects)
+{
+	if (root == NullNode)
+	{
+		return;
+	}
+
+	stack.clear();
+	stack.push_back(root);
+
+	while (!stack.empty())
+	{
+		const auto index = stack.back();
+		stack.pop_back();
+
+		const auto& node = nodes[index];
+
+		if (planes.IsOutside(node.Bounds))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			objects.push_back(node.Obj);
+		}
+		else
+		{
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+	}
+}
+
+void DynamicTree::QueryAABB(const AABB& aabb, std::vector<Object*>& objects)
+{
+	if (root == NullNode)
+	{
+		return;
+	}
+
+	stack.clear();
+	stack.push_back(root);
+
+	while (!stack.empty())
+	{
+		const auto index = stack.back();
+		stack.pop_back();
+
+		const auto& node = nodes[index];
+
+		if (!node.Bounds.Overlaps(aabb))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			objects.push_back(node.Obj);
+		}
+		else
+		{
+			stack.push_back(node.Child1);
+			stack.push_back(node.Child2);
+		}
+	}
+}
+} // namespace Culling3D
@@ -0,0 +1,135 @@
+﻿
+#pragma once
+
+#include "Culling3D.h"
+
+#include <vector>
+
+namespace Culling3D
+{
+struct AABB
+{
+	Vector3DF Min;
+	Vector3DF Max;
+
+	AABB() = default;
+	AABB(const Vector3DF& min_, const Vector3DF& max_);
+
+	bool Contains(const AABB& o) const;
+	bool Overlaps(const AABB& o) const;
+
+	//! a half of a surface area which is used as a cost of a node
+	float GetPerimeter() const;
+
+	static AABB Combine(const AABB& a, const AABB& b);
+};
+
+/**
+@brief	planes of a view frustum which are stored to test 4 planes at once
+*/
+struct alignas(16) FrustumPlanes
+{
+	float NormalX[8];
+	float NormalY[8];
+	float NormalZ[8];
+	float Distance[8];
+
+	FrustumPlanes(const Vector3DF facePositions[6], const Vector3DF faceDir[6]);
+
+	//! whether is a box behind any plane
+	bool IsOutside(const AABB& aabb) const;
+};
+
+/**
+@brief	a dynamic bounding volume tree
+@note
+Leaves have fat bounds which are extended by a margin, so that a leaf is not reinserted while an object moves inside it.
+The tree is balanced with rotations like an AVL tree when a leaf is inserted or removed.
+*/
+class DynamicTree
+{
+public:
+	static const int32_t NullNode = -1;
+
+private:
+	struct Node
+	{
+		AABB Bounds;
+		Object* Obj;
+
+		//! a next free node while this node is free
+		int32_t Parent;
+
+		int32_t Child1;
+		int32_t Child2;
+
+		//! 0 is a leaf. -1 is a free node
+		int32_t Height;
+
+		bool IsLeaf() const
+		{
+			return Child1 == NullNode;
+		}
+	};
+
+	std::vector<Node> nodes;
+	int32_t root = NullNode;
+	int32_t freeList = NullNode;
+	float margin;
+
+	std::vector<int32_t> stack;
+
+	int32_t AllocateNode();
+	void FreeNode(int32_t node);
+
+	void InsertLeaf(int32_t leaf);
+	void RemoveLeaf(int32_t leaf);
+
+	//! refit bounds and heights of ancestors with rotations
+	void Refit(int32_t node);
+
+	int32_t Balance(int32_t node);
+
+public:
+	DynamicTree(float margin);
+
+	/**
+	@brief	add a leaf and returns an index of it
+	*/
+	int32_t CreateProxy(const AABB& aabb, Object* o);
+
+	void DestroyProxy(int32_t proxy);
+
+	/**
+	@brief	move a leaf. it is reinserted only when bounds are out of the fat bounds
+	@return	whether is it reinserted
+	*/
+	bool MoveProxy(int32_t proxy, const AABB& aabb);
+
+	Object* GetObject(int32_t proxy) const
+	{
+		return nodes[proxy].Obj;
+	}
+
+	const AABB& GetFatAABB(int32_t proxy) const
+	{
+		return nodes[proxy].Bounds;
+	}
+
+	int32_t GetHeight() const
+	{
+		return root == NullNode ? 0 : nodes[root].Height;
+	}
+
+	/**
+	@brief	collect objects of leaves which may be inside a frustum
+	*/
+	void QueryFrustum(const FrustumPlanes& planes, std::vector<Object*>& objects);
+
+	/**
+	@brief	collect objects of leaves which overlap a box
+	*/
+	void QueryAABB(const AABB& aabb, std::vector<Object*>& objects);
+
+};
+} // namespace Culling3D
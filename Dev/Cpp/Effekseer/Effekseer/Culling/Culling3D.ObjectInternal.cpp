@@ -1,6 +1,5 @@
 ﻿
 #include "Culling3D.ObjectInternal.h"
-#include "Culling3D.WorldInternal.h"
 
 namespace Culling3D
 {
@@ -38,9 +37,7 @@ void ObjectInternal::SetPosition(Vector3DF pos)
 
 	if (world != nullptr)
 	{
-		WorldInternal* w = (WorldInternal*)world;
-		w->RemoveObjectInternal(this);
-		w->AddObjectInternal(this);
+		world->UpdateObjectInternal(this);
 	}
 
 	currentStatus = nextStatus;
@@ -53,9 +50,7 @@ void ObjectInternal::ChangeIntoAll()
 
 	if (world != nullptr)
 	{
-		WorldInternal* w = (WorldInternal*)world;
-		w->RemoveObjectInternal(this);
-		w->AddObjectInternal(this);
+		world->UpdateObjectInternal(this);
 	}
 
 	currentStatus = nextStatus;
@@ -69,9 +64,7 @@ void ObjectInternal::ChangeIntoSphere(float radius)
 
 	if (world != nullptr)
 	{
-		WorldInternal* w = (WorldInternal*)world;
-		w->RemoveObjectInternal(this);
-		w->AddObjectInternal(this);
+		world->UpdateObjectInternal(this);
 	}
 
 	currentStatus = nextStatus;
@@ -87,9 +80,7 @@ void ObjectInternal::ChangeIntoCuboid(Vector3DF size)
 
 	if (world != nullptr)
 	{
-		WorldInternal* w = (WorldInternal*)world;
-		w->RemoveObjectInternal(this);
-		w->AddObjectInternal(this);
+		world->UpdateObjectInternal(this);
 	}
 
 	currentStatus = nextStatus;
@@ -105,7 +96,7 @@ void ObjectInternal::SetUserData(void* userData_)
 	this->userData = userData_;
 }
 
-void ObjectInternal::SetWorld(World* world_)
+void ObjectInternal::SetWorld(ObjectContainer* world_)
 {
 	this->world = world_;
 }
@@ -6,6 +6,22 @@
 
 namespace Culling3D
 {
+class ObjectInternal;
+
+/**
+@brief	a world which is notified when a status of a contained object is changed
+*/
+class ObjectContainer
+{
+public:
+	virtual ~ObjectContainer() = default;
+
+	/**
+	@brief	update an object whose next status is changed. a current status is still an old status while it is called
+	*/
+	virtual void UpdateObjectInternal(ObjectInternal* o) = 0;
+};
+
 class ObjectInternal : public Object, public ReferenceObject
 {
 public:
@@ -50,7 +66,7 @@ public:
 
 private:
 	void* userData;
-	World* world;
+	ObjectContainer* world;
 
 	Status currentStatus;
 	Status nextStatus;
@@ -71,7 +87,7 @@ public:
 	void* GetUserData() override;
 	void SetUserData(void* userData_) override;
 
-	void SetWorld(World* world_);
+	void SetWorld(ObjectContainer* world_);
 
 	Status GetCurrentStatus()
 	{
@@ -82,6 +98,7 @@ public:
 		return nextStatus;
 	}
 
+	//! an index in a grid or a node in a tree which contains this object
 	int32_t ObjectIndex;
 
 	virtual int32_t GetRef() override
@@ -0,0 +1,177 @@
+﻿
+#include "Culling3D.TreeWorldInternal.h"
+#include "Culling3D.WorldInternal.h"
+
+namespace Culling3D
+{
+World* World::CreateDynamicTree(float margin)
+{
+	return new TreeWorldInternal(margin);
+}
+
+TreeWorldInternal::TreeWorldInternal(float margin)
+	: tree(margin)
+{
+}
+
+TreeWorldInternal::~TreeWorldInternal()
+{
+	for (std::set<Object*>::iterator it = containedObjects.begin(); it != containedObjects.end(); it++)
+	{
+		(*it)->Release();
+	}
+}
+
+AABB TreeWorldInternal::GetAABB(ObjectInternal* o)
+{
+	const auto position = o->GetNextStatus().Position;
+	const auto radius = o->GetNextStatus().GetRadius();
+	const Vector3DF extent(radius, radius, radius);
+	return AABB(position - extent, position + extent);
+}
+
+void TreeWorldInternal::AddObject(Object* o)
+{
+	SafeAddRef(o);
+	containedObjects.insert(o);
+	AddObjectInternal(o);
+}
+
+void TreeWorldInternal::RemoveObject(Object* o)
+{
+	RemoveObjectInternal(o);
+	containedObjects.erase(o);
+	SafeRelease(o);
+}
+
+void TreeWorldInternal::AddObjectInternal(Object* o)
+{
+	assert(o != nullptr);
+
+	ObjectInternal* o_ = (ObjectInternal*)o;
+
+	if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL)
+	{
+		allObjects.AddObject(o);
+	}
+	else
+	{
+		assert(o_->ObjectIndex == -1);
+		o_->ObjectIndex = tree.CreateProxy(GetAABB(o_), o);
+	}
+
+	o_->SetWorld(this);
+}
+
+void TreeWorldInternal::RemoveObjectInternal(Object* o)
+{
+	assert(o != nullptr);
+
+	ObjectInternal* o_ = (ObjectInternal*)o;
+
+	if (o_->GetCurrentStatus().Type == OBJECT_SHAPE_TYPE_ALL)
+	{
+		allObjects.RemoveObject(o);
+	}
+	else
+	{
+		assert(o_->ObjectIndex != -1);
+		tree.DestroyProxy(o_->ObjectIndex);
+		o_->ObjectIndex = -1;
+	}
+
+	o_->SetWorld(nullptr);
+}
+
+void TreeWorldInternal::UpdateObjectInternal(ObjectInternal* o)
+{
+	const bool isAll = o->GetCurrentStatus().Type == OBJECT_SHAPE_TYPE_ALL;
+	const bool isNextAll = o->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL;
+
+	if (isAll || isNextAll)
+	{
+		if (isAll != isNextAll)
+		{
+			RemoveObjectInternal(o);
+			AddObjectInternal(o);
+		}
+		return;
+	}
+
+	// the tree is refitted only when the object moves out of fat bounds
+	tree.MoveProxy(o->ObjectIndex, GetAABB(o));
+}
+
+void TreeWorldInternal::CastRay(Vector3DF from, Vector3DF to)
+{
+	objs.clear();
+	candidates.clear();
+
+	const AABB aabb(Vector3DF(Min(from.X, to.X), Min(from.Y, to.Y), Min(from.Z, to.Z)),
+					Vector3DF(Max(from.X, to.X), Max(from.Y, to.Y), Max(from.Z, to.Z)));
+
+	tree.QueryAABB(aabb, candidates);
+
+	auto ray_dir = (to - from);
+	auto ray_len = ray_dir.GetLength();
+	ray_dir.Normalize();
+
+	for (auto o : allObjects.GetObjects())
+	{
+		objs.push_back(o);
+	}
+
+	for (auto o : candidates)
+	{
+		if (IsHitByRay((ObjectInternal*)o, from, ray_dir, ray_len))
+		{
+			objs.push_back(o);
+		}
+	}
+}
+
+void TreeWorldInternal::Culling(const Matrix44& cameraProjMat, bool isOpenGL, bool isRightHand)
+{
+	objs.clear();
+
+	for (auto o : allObjects.GetObjects())
+	{
+		objs.push_back(o);
+	}
+
+	if (!IsCullingEnabled(cameraProjMat))
+	{
+		return;
+	}
+
+	Vector3DF eyebox[8];
+	Vector3DF facePositions[6];
+	Vector3DF faceDir[6];
+	CalculateViewFrustum(cameraProjMat, isOpenGL, isRightHand, eyebox, facePositions, faceDir);
+
+	candidates.clear();
+	tree.QueryFrustum(FrustumPlanes(facePositions, faceDir), candidates);
+
+	for (auto o : candidates)
+	{
+		ObjectInternal* o_ = (ObjectInternal*)o;
+
+		if (IsInView(o_->GetPosition(), o_->GetNextStatus().GetRadius(), facePositions, faceDir))
+		{
+			objs.push_back(o);
+		}
+	}
+}
+
+bool TreeWorldInternal::Reassign()
+{
+	// the tree is updated incrementally
+	return false;
+}
+
+void TreeWorldInternal::Dump(const char* path, const Matrix44& cameraProjMat, bool isOpenGL)
+{
+	// a tree world has no debug output, so that only culling is done
+	Culling(cameraProjMat, isOpenGL, true);
+}
+} // namespace Culling3D
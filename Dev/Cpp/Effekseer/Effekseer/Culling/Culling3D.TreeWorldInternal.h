@@ -0,0 +1,77 @@
+﻿
+#pragma once
+
+#include "Culling3D.ReferenceObject.h"
+#include "Culling3D.h"
+
+#include "Culling3D.DynamicTree.h"
+#include "Culling3D.Grid.h"
+#include "Culling3D.ObjectInternal.h"
+
+#include <set>
+
+namespace Culling3D
+{
+/**
+@brief	a world which contains objects with a dynamic bounding volume tree
+@note
+It doesn't have a size of a space, so that it is not needed to be reassigned even if objects move far away.
+*/
+class TreeWorldInternal : public World, public ReferenceObject, public ObjectContainer
+{
+private:
+	DynamicTree tree;
+
+	Grid allObjects;
+
+	std::vector<Object*> objs;
+
+	std::vector<Object*> candidates;
+
+	std::set<Object*> containedObjects;
+
+	static AABB GetAABB(ObjectInternal* o);
+
+public:
+	TreeWorldInternal(float margin);
+	virtual ~TreeWorldInternal();
+
+	void AddObject(Object* o) override;
+	void RemoveObject(Object* o) override;
+
+	void AddObjectInternal(Object* o);
+	void RemoveObjectInternal(Object* o);
+
+	void UpdateObjectInternal(ObjectInternal* o) override;
+
+	void CastRay(Vector3DF from, Vector3DF to) override;
+
+	void Culling(const Matrix44& cameraProjMat, bool isOpenGL, bool isRightHand) override;
+
+	bool Reassign() override;
+
+	void Dump(const char* path, const Matrix44& cameraProjMat, bool isOpenGL) override;
+
+	int32_t GetObjectCount() override
+	{
+		return (int32_t)objs.size();
+	}
+	Object* GetObject(int32_t index) override
+	{
+		return objs[index];
+	}
+
+	virtual int32_t GetRef() override
+	{
+		return ReferenceObject::GetRef();
+	}
+	virtual int32_t AddRef() override
+	{
+		return ReferenceObject::AddRef();
+	}
+	virtual int32_t Release() override
+	{
+		return ReferenceObject::Release();
+	}
+};
+} // namespace Culling3D
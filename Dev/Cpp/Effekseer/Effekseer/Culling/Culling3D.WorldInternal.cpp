@@ -27,6 +27,178 @@ bool IsInView(Vector3DF position, float radius, Vector3DF facePositions[6], Vect
 	return true;
 }
 
+bool IsCullingEnabled(const Matrix44& cameraProjMat)
+{
+	return !std::isinf(cameraProjMat.Values[2][2]) && cameraProjMat.Values[0][0] != 0.0f && cameraProjMat.Values[1][1] != 0.0f;
+}
+
+void CalculateViewFrustum(const Matrix44& cameraProjMat, bool isOpenGL, bool isRightHand, Vector3DF eyebox[8], Vector3DF facePositions[6], Vector3DF faceDir[6])
+{
+	Matrix44 cameraProjMatInv = cameraProjMat;
+	cameraProjMatInv.SetInverted();
+
+	float maxx = 1.0f;
+	float minx = -1.0f;
+
+	float maxy = 1.0f;
+	float miny = -1.0f;
+
+	float maxz = 1.0f;
+	float minz = 0.0f;
+	if (isOpenGL)
+		minz = -1.0f;
+
+	eyebox[0 + 0] = Vector3DF(minx, miny, maxz);
+	eyebox[1 + 0] = Vector3DF(maxx, miny, maxz);
+	eyebox[2 + 0] = Vector3DF(minx, maxy, maxz);
+	eyebox[3 + 0] = Vector3DF(maxx, maxy, maxz);
+
+	eyebox[0 + 4] = Vector3DF(minx, miny, minz);
+	eyebox[1 + 4] = Vector3DF(maxx, miny, minz);
+	eyebox[2 + 4] = Vector3DF(minx, maxy, minz);
+	eyebox[3 + 4] = Vector3DF(maxx, maxy, minz);
+
+	for (int32_t i = 0; i < 8; i++)
+	{
+		eyebox[i] = cameraProjMatInv.Transform3D(eyebox[i]);
+	}
+
+	// 0-right 1-left 2-top 3-bottom 4-front 5-back
+	facePositions[0] = eyebox[5];
+	facePositions[1] = eyebox[4];
+	facePositions[2] = eyebox[6];
+	facePositions[3] = eyebox[4];
+	facePositions[4] = eyebox[4];
+	facePositions[5] = eyebox[0];
+
+	if (isRightHand)
+	{
+		faceDir[0] = Vector3DF::Cross(eyebox[1] - eyebox[5], eyebox[7] - eyebox[5]);
+		faceDir[1] = Vector3DF::Cross(eyebox[6] - eyebox[4], eyebox[0] - eyebox[4]);
+
+		faceDir[2] = Vector3DF::Cross(eyebox[7] - eyebox[6], eyebox[2] - eyebox[6]);
+		faceDir[3] = Vector3DF::Cross(eyebox[0] - eyebox[4], eyebox[5] - eyebox[4]);
+
+		faceDir[4] = Vector3DF::Cross(eyebox[5] - eyebox[4], eyebox[6] - eyebox[4]);
+		faceDir[5] = Vector3DF::Cross(eyebox[2] - eyebox[0], eyebox[1] - eyebox[5]);
+	}
+	else
+	{
+		faceDir[0] = -Vector3DF::Cross(eyebox[1] - eyebox[5], eyebox[7] - eyebox[5]);
+		faceDir[1] = -Vector3DF::Cross(eyebox[6] - eyebox[4], eyebox[0] - eyebox[4]);
+
+		faceDir[2] = -Vector3DF::Cross(eyebox[7] - eyebox[6], eyebox[2] - eyebox[6]);
+		faceDir[3] = -Vector3DF::Cross(eyebox[0] - eyebox[4], eyebox[5] - eyebox[4]);
+
+		faceDir[4] = -Vector3DF::Cross(eyebox[5] - eyebox[4], eyebox[6] - eyebox[4]);
+		faceDir[5] = -Vector3DF::Cross(eyebox[2] - eyebox[0], eyebox[1] - eyebox[5]);
+	}
+
+	for (int32_t i = 0; i < 6; i++)
+	{
+		faceDir[i].Normalize();
+	}
+}
+
+bool IsHitByRay(ObjectInternal* o_, const Vector3DF& from, const Vector3DF& ray_dir, float ray_len)
+{
+	if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL)
+	{
+		return true;
+	}
+
+	// 球線分判定
+	{
+		auto radius = o_->GetNextStatus().GetRadius();
+		auto pos = o_->GetNextStatus().Position;
+
+		auto from2pos = pos - from;
+		auto from2nearLen = Vector3DF::Dot(from2pos, ray_dir);
+		auto pos2ray = from2pos - ray_dir * from2nearLen;
+
+		if (pos2ray.GetLength() > radius)
+			return false;
+		if (from2nearLen < 0 || from2nearLen > ray_len)
+			return false;
+	}
+
+	if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_SPHERE)
+	{
+		return true;
+	}
+
+	// AABB判定
+	// 参考：http://marupeke296.com/COL_3D_No18_LineAndAABB.html
+
+	if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_CUBOID)
+	{
+		// 交差判定
+		float p[3], d[3], min[3], max[3];
+		auto pos = o_->GetCurrentStatus().Position;
+		memcpy(p, &from, sizeof(Vector3DF));
+		memcpy(d, &ray_dir, sizeof(Vector3DF));
+		memcpy(min, &pos, sizeof(Vector3DF));
+		memcpy(max, &pos, sizeof(Vector3DF));
+
+		min[0] -= o_->GetNextStatus().Data.Cuboid.X / 2.0f;
+		min[1] -= o_->GetNextStatus().Data.Cuboid.Y / 2.0f;
+		min[2] -= o_->GetNextStatus().Data.Cuboid.Z / 2.0f;
+
+		max[0] += o_->GetNextStatus().Data.Cuboid.X / 2.0f;
+		max[1] += o_->GetNextStatus().Data.Cuboid.Y / 2.0f;
+		max[2] += o_->GetNextStatus().Data.Cuboid.Z / 2.0f;
+
+		float t = -FLT_MAX;
+		float t_max = FLT_MAX;
+
+		for (int k = 0; k < 3; ++k)
+		{
+			if (std::abs(d[k]) < FLT_EPSILON)
+			{
+				if (p[k] < min[k] || p[k] > max[k])
+				{
+					// 交差していない
+					continue;
+				}
+			}
+			else
+			{
+				// スラブとの距離を算出
+				// t1が近スラブ、t2が遠スラブとの距離
+				float odd = 1.0f / d[k];
+				float t1 = (min[k] - p[k]) * odd;
+				float t2 = (max[k] - p[k]) * odd;
+				if (t1 > t2)
+				{
+					float tmp = t1;
+					t1 = t2;
+					t2 = tmp;
+				}
+
+				if (t1 > t)
+					t = t1;
+				if (t2 < t_max)
+					t_max = t2;
+
+				// スラブ交差チェック
+				if (t >= t_max)
+				{
+					// 交差していない
+					continue;
+				}
+			}
+		}
+
+		// 交差している
+		if (0 <= t && t <= ray_len)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
 World* World::Create(float xSize, float ySize, float zSize, int32_t layerCount)
 {
 	return new WorldInternal(xSize, ySize, zSize, layerCount);
@@ -212,6 +384,12 @@ void WorldInternal::RemoveObjectInternal(Object* o)
 	}
 }
 
+void WorldInternal::UpdateObjectInternal(ObjectInternal* o)
+{
+	RemoveObjectInternal(o);
+	AddObjectInternal(o);
+}
+
 void WorldInternal::CastRay(Vector3DF from, Vector3DF to)
 {
 	objs.clear();
@@ -249,103 +427,10 @@ void WorldInternal::CastRay(Vector3DF from, Vector3DF to)
 		for (size_t j = 0; j < grids[i]->GetObjects().size(); j++)
 		{
 			Object* o = grids[i]->GetObjects()[j];
-			ObjectInternal* o_ = (ObjectInternal*)o;
-
-			if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_ALL)
-			{
-				objs.push_back(o);
-				continue;
-			}
-
-			// 球線分判定
-			{
-				auto radius = o_->GetNextStatus().GetRadius();
-				auto pos = o_->GetNextStatus().Position;
-
-				auto from2pos = pos - from;
-				auto from2nearLen = Vector3DF::Dot(from2pos, ray_dir);
-				auto pos2ray = from2pos - ray_dir * from2nearLen;
-
-				if (pos2ray.GetLength() > radius)
-					continue;
-				if (from2nearLen < 0 || from2nearLen > ray_len)
-					continue;
-			}
 
-			if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_SPHERE)
+			if (IsHitByRay((ObjectInternal*)o, from, ray_dir, ray_len))
 			{
 				objs.push_back(o);
-				continue;
-			}
-
-			// AABB判定
-			// 参考：http://marupeke296.com/COL_3D_No18_LineAndAABB.html
-
-			if (o_->GetNextStatus().Type == OBJECT_SHAPE_TYPE_CUBOID)
-			{
-				// 交差判定
-				float p[3], d[3], min[3], max[3];
-				auto pos = o_->GetCurrentStatus().Position;
-				memcpy(p, &from, sizeof(Vector3DF));
-				memcpy(d, &ray_dir, sizeof(Vector3DF));
-				memcpy(min, &pos, sizeof(Vector3DF));
-				memcpy(max, &pos, sizeof(Vector3DF));
-
-				min[0] -= o_->GetNextStatus().Data.Cuboid.X / 2.0f;
-				min[1] -= o_->GetNextStatus().Data.Cuboid.Y / 2.0f;
-				min[2] -= o_->GetNextStatus().Data.Cuboid.Z / 2.0f;
-
-				max[0] += o_->GetNextStatus().Data.Cuboid.X / 2.0f;
-				max[1] += o_->GetNextStatus().Data.Cuboid.Y / 2.0f;
-				max[2] += o_->GetNextStatus().Data.Cuboid.Z / 2.0f;
-
-				float t = -FLT_MAX;
-				float t_max = FLT_MAX;
-
-				for (int k = 0; k < 3; ++k)
-				{
-					if (std::abs(d[k]) < FLT_EPSILON)
-					{
-						if (p[k] < min[k] || p[k] > max[k])
-						{
-							// 交差していない
-							continue;
-						}
-					}
-					else
-					{
-						// スラブとの距離を算出
-						// t1が近スラブ、t2が遠スラブとの距離
-						float odd = 1.0f / d[k];
-						float t1 = (min[k] - p[k]) * odd;
-						float t2 = (max[k] - p[k]) * odd;
-						if (t1 > t2)
-						{
-							float tmp = t1;
-							t1 = t2;
-							t2 = tmp;
-						}
-
-						if (t1 > t)
-							t = t1;
-						if (t2 < t_max)
-							t_max = t2;
-
-						// スラブ交差チェック
-						if (t >= t_max)
-						{
-							// 交差していない
-							continue;
-						}
-					}
-				}
-
-				// 交差している
-				if (0 <= t && t <= ray_len)
-				{
-					objs.push_back(o);
-					continue;
-				}
 			}
 		}
 	}
@@ -363,78 +448,13 @@ void WorldInternal::Culling(const Matrix44& cameraProjMat, bool isOpenGL, bool i
 {
 	objs.clear();
 
-	if (!std::isinf(cameraProjMat.Values[2][2]) && cameraProjMat.Values[0][0] != 0.0f && cameraProjMat.Values[1][1] != 0.0f)
+	if (IsCullingEnabled(cameraProjMat))
 	{
 
-		Matrix44 cameraProjMatInv = cameraProjMat;
-		cameraProjMatInv.SetInverted();
-
-		float maxx = 1.0f;
-		float minx = -1.0f;
-
-		float maxy = 1.0f;
-		float miny = -1.0f;
-
-		float maxz = 1.0f;
-		float minz = 0.0f;
-		if (isOpenGL)
-			minz = -1.0f;
-
 		Vector3DF eyebox[8];
-
-		eyebox[0 + 0] = Vector3DF(minx, miny, maxz);
-		eyebox[1 + 0] = Vector3DF(maxx, miny, maxz);
-		eyebox[2 + 0] = Vector3DF(minx, maxy, maxz);
-		eyebox[3 + 0] = Vector3DF(maxx, maxy, maxz);
-
-		eyebox[0 + 4] = Vector3DF(minx, miny, minz);
-		eyebox[1 + 4] = Vector3DF(maxx, miny, minz);
-		eyebox[2 + 4] = Vector3DF(minx, maxy, minz);
-		eyebox[3 + 4] = Vector3DF(maxx, maxy, minz);
-
-		for (int32_t i = 0; i < 8; i++)
-		{
-			eyebox[i] = cameraProjMatInv.Transform3D(eyebox[i]);
-		}
-
-		// 0-right 1-left 2-top 3-bottom 4-front 5-back
 		Vector3DF facePositions[6];
-		facePositions[0] = eyebox[5];
-		facePositions[1] = eyebox[4];
-		facePositions[2] = eyebox[6];
-		facePositions[3] = eyebox[4];
-		facePositions[4] = eyebox[4];
-		facePositions[5] = eyebox[0];
-
 		Vector3DF faceDir[6];
-
-		if (isRightHand)
-		{
-			faceDir[0] = Vector3DF::Cross(eyebox[1] - eyebox[5], eyebox[7] - eyebox[5]);
-			faceDir[1] = Vector3DF::Cross(eyebox[6] - eyebox[4], eyebox[0] - eyebox[4]);
-
-			faceDir[2] = Vector3DF::Cross(eyebox[7] - eyebox[6], eyebox[2] - eyebox[6]);
-			faceDir[3] = Vector3DF::Cross(eyebox[0] - eyebox[4], eyebox[5] - eyebox[4]);
-
-			faceDir[4] = Vector3DF::Cross(eyebox[5] - eyebox[4], eyebox[6] - eyebox[4]);
-			faceDir[5] = Vector3DF::Cross(eyebox[2] - eyebox[0], eyebox[1] - eyebox[5]);
-		}
-		else
-		{
-			faceDir[0] = -Vector3DF::Cross(eyebox[1] - eyebox[5], eyebox[7] - eyebox[5]);
-			faceDir[1] = -Vector3DF::Cross(eyebox[6] - eyebox[4], eyebox[0] - eyebox[4]);
-
-			faceDir[2] = -Vector3DF::Cross(eyebox[7] - eyebox[6], eyebox[2] - eyebox[6]);
-			faceDir[3] = -Vector3DF::Cross(eyebox[0] - eyebox[4], eyebox[5] - eyebox[4]);
-
-			faceDir[4] = -Vector3DF::Cross(eyebox[5] - eyebox[4], eyebox[6] - eyebox[4]);
-			faceDir[5] = -Vector3DF::Cross(eyebox[2] - eyebox[0], eyebox[1] - eyebox[5]);
-		}
-
-		for (int32_t i = 0; i < 6; i++)
-		{
-			faceDir[i].Normalize();
-		}
+		CalculateViewFrustum(cameraProjMat, isOpenGL, isRightHand, eyebox, facePositions, faceDir);
 
 		for (int32_t z = 0; z < viewCullingZDiv; z++)
 		{
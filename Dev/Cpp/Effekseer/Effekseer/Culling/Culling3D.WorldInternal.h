@@ -6,12 +6,35 @@
 
 #include "Culling3D.Grid.h"
 #include "Culling3D.Layer.h"
+#include "Culling3D.ObjectInternal.h"
 
 #include <set>
 
 namespace Culling3D
 {
-class WorldInternal : public World, public ReferenceObject
+/**
+@brief	whether is a sphere in front of all faces
+*/
+bool IsInView(Vector3DF position, float radius, Vector3DF facePositions[6], Vector3DF faceDir[6]);
+
+/**
+@brief	whether is a projection matrix valid to cull objects
+*/
+bool IsCullingEnabled(const Matrix44& cameraProjMat);
+
+/**
+@brief	calculate the corners and the faces of a view frustum
+@note
+faces are ordered as right, left, top, bottom, front and back. face directions point outside.
+*/
+void CalculateViewFrustum(const Matrix44& cameraProjMat, bool isOpenGL, bool isRightHand, Vector3DF eyebox[8], Vector3DF facePositions[6], Vector3DF faceDir[6]);
+
+/**
+@brief	whether does a line segment hit an object
+*/
+bool IsHitByRay(ObjectInternal* o, const Vector3DF& from, const Vector3DF& rayDir, float rayLength);
+
+class WorldInternal : public World, public ReferenceObject, public ObjectContainer
 {
 private:
 	float xSize;
@@ -43,6 +66,8 @@ public:
 	void AddObjectInternal(Object* o);
 	void RemoveObjectInternal(Object* o);
 
+	void UpdateObjectInternal(ObjectInternal* o) override;
+
 	void CastRay(Vector3DF from, Vector3DF to) override;
 
 	void Culling(const Matrix44& cameraProjMat, bool isOpenGL, bool isRightHand) override;
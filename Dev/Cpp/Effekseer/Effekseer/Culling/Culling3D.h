@@ -342,6 +342,14 @@ public:
 	virtual void Dump(const char* path, const Matrix44& cameraProjMat, bool isOpenGL) = 0;
 
 	static World* Create(float xSize, float ySize, float zSize, int32_t layerCount);
+
+	/**
+	@brief	ダイナミックなAABBツリーでオブジェクトを管理する空間を生成する。
+	@param	margin	オブジェクトの範囲を拡張する幅(拡張された範囲の外に移動した時のみツリーを更新する)
+	@note
+	空間の大きさが必要なく、オブジェクトが遠くに移動してもReassignする必要がない。
+	*/
+	static World* CreateDynamicTree(float margin);
 };
 
 class Object : public IReference
@@ -84,6 +84,7 @@ class CurveLoader;
 class Texture;
 class SoundData;
 class SoundPlayer;
+class SoundVoiceManager;
 class Model;
 struct ProceduralModelParameter;
 class ProceduralModelGenerator;
@@ -759,6 +760,7 @@ using RingRendererRef = RefPtr<RingRenderer>;
 using ModelRendererRef = RefPtr<ModelRenderer>;
 using TrackRendererRef = RefPtr<TrackRenderer>;
 using SoundPlayerRef = RefPtr<SoundPlayer>;
+using SoundVoiceManagerRef = RefPtr<SoundVoiceManager>;
 
 using EffectLoaderRef = RefPtr<EffectLoader>;
 using TextureLoaderRef = RefPtr<TextureLoader>;
@@ -867,6 +869,50 @@ void SetLogger(const std::function<void(LogType, const std::string&)>& logger);
 
 void Log(LogType logType, const std::string& message);
 
+/**
+	@brief
+	\~English	Specify whether blocks of updating, drawing and loading are recorded into a built-in tracer
+	\~Japanese	更新、描画、読み込みの区間を内蔵のトレーサーに記録するか設定する。
+	@param	enabled
+	\~English	Whether blocks are recorded. Recorded blocks are discarded when it is enabled again.
+	\~Japanese	記録するか。再度有効にした時に記録済みの区間は破棄される。
+	@param	maxEventCountPerThread
+	\~English	The maximum number of blocks recorded on a thread. Blocks over it are dropped.
+	\~Japanese	1スレッドで記録する区間の最大数。超えた区間は破棄される。
+	@note
+	\~English	It must not be enabled while managers are updated or drawn on other threads.
+	Buffers of threads are kept after it is disabled so that recorded blocks can be exported. They are released with ReleaseTracingBuffers.
+	The tracer is disabled when Effekseer is built with easy_profiler or __EFFEKSEER_TRACER_DISABLED__.
+	\~Japanese	他のスレッドでマネージャーが更新、描画されている間に有効にしてはいけない。
+	記録された区間を出力できるように、無効にした後もスレッドのバッファは保持される。バッファはReleaseTracingBuffersで解放される。
+	easy_profilerもしくは__EFFEKSEER_TRACER_DISABLED__でビルドした場合、トレーサーは無効である。
+*/
+void SetTracingEnabled(bool enabled, int32_t maxEventCountPerThread = 65536);
+
+/**
+	@brief
+	\~English	Get whether blocks are recorded into a built-in tracer
+	\~Japanese	内蔵のトレーサーに区間を記録しているか取得する。
+*/
+bool GetTracingEnabled();
+
+/**
+	@brief
+	\~English	Export recorded blocks as JSON in Chrome trace event format which can be opened in chrome://tracing or Perfetto
+	\~Japanese	記録された区間をchrome://tracingやPerfettoで開けるChrome trace event形式のJSONとして出力する。
+*/
+std::string ExportChromeTrace();
+
+/**
+	@brief
+	\~English	Release buffers of threads of a built-in tracer and recorded blocks
+	\~Japanese	内蔵のトレーサーのスレッドのバッファと記録された区間を解放する。
+	@note
+	\~English	It does nothing while tracing is enabled. It must not be called while managers are updated or drawn on other threads.
+	\~Japanese	記録中は何もしない。他のスレッドでマネージャーが更新、描画されている間に呼んではいけない。
+*/
+void ReleaseTracingBuffers();
+
 enum class ColorSpaceType : int32_t
 {
 	Gamma,
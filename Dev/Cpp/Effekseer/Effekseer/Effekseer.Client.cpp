@@ -5,6 +5,7 @@
 #include "Effekseer.Client.h"
 #include "Effekseer.ClientImplemented.h"
 
+#include "Effekseer.EffectDataDelta.h"
 #include "Effekseer.EffectLoader.h"
 #include "Effekseer.Manager.h"
 
@@ -23,15 +24,48 @@ void ClientImplemented::RecvAsync(void* data)
 		restSize = 4;
 		while (restSize > 0)
 		{
-			auto recvSize = ::recv(client->m_socket, (char*)(&size), restSize, 0);
+			auto recvSize = ::recv(client->m_socket, (char*)(&size) + (4 - restSize), restSize, 0);
+
+			if (recvSize == 0 || recvSize == -1)
+			{
+				client->StopInternal();
+				return;
+			}
+
 			restSize -= recvSize;
+		}
+
+		std::vector<uint8_t> buf(size);
+		restSize = size;
+		while (restSize > 0)
+		{
+			auto recvSize = ::recv(client->m_socket, (char*)(buf.data() + (size - restSize)), restSize, 0);
 
 			if (recvSize == 0 || recvSize == -1)
 			{
 				client->StopInternal();
 				return;
 			}
+
+			restSize -= recvSize;
+		}
+
+		// a server requests whole data of a key (key length, key)
+		int32_t keylen = 0;
+		if (size < static_cast<int32_t>(sizeof(int32_t)))
+		{
+			continue;
+		}
+
+		memcpy(&keylen, buf.data(), sizeof(int32_t));
+		if (keylen < 0 || size < static_cast<int32_t>(sizeof(int32_t) + sizeof(char16_t) * keylen))
+		{
+			continue;
 		}
+
+		std::u16string key(keylen, u'\0');
+		memcpy(&key[0], buf.data() + sizeof(int32_t), sizeof(char16_t) * keylen);
+		client->OnWholeDataRequested(key);
 	}
 }
 
@@ -126,6 +160,12 @@ bool ClientImplemented::Start(char* host, uint16_t port)
 	// to stop thread
 	Stop();
 
+	// a new server doesn't have data to apply deltas
+	{
+		std::lock_guard<std::mutex> lock(mutexSentData);
+		m_sentData.clear();
+	}
+
 	SOCKADDR_IN sockAddr;
 
 	// create a socket
@@ -187,6 +227,8 @@ void ClientImplemented::Stop()
 
 bool ClientImplemented::Send(void* data, int32_t datasize)
 {
+	std::lock_guard<std::mutex> lock(mutexSend);
+
 	if (!m_running)
 		return false;
 
@@ -207,7 +249,8 @@ bool ClientImplemented::Send(void* data, int32_t datasize)
 		auto ret = ::send(m_socket, (const char*)(&(m_sendBuffer[m_sendBuffer.size() - size])), size, 0);
 		if (ret == 0 || ret < 0)
 		{
-			Stop();
+			// the receiving thread is joined in Stop because it may be sending
+			StopInternal();
 			return false;
 		}
 		size -= ret;
@@ -216,7 +259,7 @@ bool ClientImplemented::Send(void* data, int32_t datasize)
 	return true;
 }
 
-void ClientImplemented::Reload(const char16_t* key, void* data, int32_t size)
+bool ClientImplemented::SendWithKey(const char16_t* key, const void* data, int32_t size)
 {
 	int32_t keylen = 0;
 	for (;; keylen++)
@@ -239,10 +282,70 @@ void ClientImplemented::Reload(const char16_t* key, void* data, int32_t size)
 
 	for (int32_t i = 0; i < size; i++)
 	{
-		buf.push_back(((uint8_t*)(data))[i]);
+		buf.push_back(((const uint8_t*)(data))[i]);
+	}
+
+	return Send(&(buf[0]), (int32_t)buf.size());
+}
+
+void ClientImplemented::SendWholeData(const char16_t* key, const void* data, int32_t size)
+{
+	if (SendWithKey(key, data, size))
+	{
+		auto bytes = static_cast<const uint8_t*>(data);
+		m_sentData[key].assign(bytes, bytes + size);
+	}
+}
+
+void ClientImplemented::OnWholeDataRequested(const std::u16string& key)
+{
+	std::lock_guard<std::mutex> lock(mutexSentData);
+
+	// the latest data is sent because deltas after the failed delta also cannot be applied
+	auto found = m_sentData.find(key);
+	if (found == m_sentData.end())
+	{
+		return;
+	}
+
+	SendWithKey(key.c_str(), found->second.data(), static_cast<int32_t>(found->second.size()));
+}
+
+void ClientImplemented::Reload(const char16_t* key, void* data, int32_t size)
+{
+	std::lock_guard<std::mutex> lock(mutexSentData);
+	SendWholeData(key, data, size);
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ClientImplemented::ReloadDelta(const char16_t* key, void* data, int32_t size)
+{
+	std::lock_guard<std::mutex> lock(mutexSentData);
+
+	auto found = m_sentData.find(key);
+	if (found == m_sentData.end())
+	{
+		SendWholeData(key, data, size);
+		return;
 	}
 
-	Send(&(buf[0]), (int32_t)buf.size());
+	std::vector<uint8_t> delta;
+	EffectDataDelta::Encode(found->second, data, size, delta);
+
+	// send whole data if most of bytes are changed
+	if (static_cast<int32_t>(delta.size()) >= size)
+	{
+		SendWholeData(key, data, size);
+		return;
+	}
+
+	if (SendWithKey(key, delta.data(), static_cast<int32_t>(delta.size())))
+	{
+		auto bytes = static_cast<const uint8_t*>(data);
+		found->second.assign(bytes, bytes + size);
+	}
 }
 
 //----------------------------------------------------------------------------------
@@ -35,6 +35,13 @@ public:
 
 	virtual void Reload(const char16_t* key, void* data, int32_t size) = 0;
 	virtual void Reload(ManagerRef manager, const char16_t* path, const char16_t* key) = 0;
+
+	/**
+		@brief
+		\~English	Send only bytes changed from data sent previously with the key. Playing instances are not restarted if possible.
+		\~Japanese	以前にキーで送信したデータから変更されたバイトのみを送信する。可能な場合、再生中のインスタンスは再起動されない。
+	*/
+	virtual void ReloadDelta(const char16_t* key, void* data, int32_t size) = 0;
 	virtual bool IsConnected() = 0;
 };
 
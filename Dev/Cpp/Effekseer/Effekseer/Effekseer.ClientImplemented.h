@@ -12,7 +12,9 @@
 #include "Effekseer.Client.h"
 
 #include "Effekseer.Socket.h"
+#include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 //----------------------------------------------------------------------------------
@@ -36,8 +38,23 @@ private:
 	bool m_running = false;
 	std::mutex mutexStop;
 
+	//! data is sent from the main thread and the receiving thread
+	std::mutex mutexSend;
+
+	//! data sent last to calculate a delta
+	std::map<std::u16string, std::vector<uint8_t>> m_sentData;
+	std::mutex mutexSentData;
+
 	bool GetAddr(const char* host, IN_ADDR* addr);
 
+	bool SendWithKey(const char16_t* key, const void* data, int32_t size);
+
+	//! send whole data and keep it to calculate a delta. mutexSentData must be locked
+	void SendWholeData(const char16_t* key, const void* data, int32_t size);
+
+	//! send whole data again because a server could not apply a delta
+	void OnWholeDataRequested(const std::u16string& key);
+
 	static void RecvAsync(void* data);
 	void StopInternal();
 
@@ -53,6 +70,8 @@ public:
 	void Reload(const char16_t* key, void* data, int32_t size);
 	void Reload(ManagerRef manager, const char16_t* path, const char16_t* key);
 
+	void ReloadDelta(const char16_t* key, void* data, int32_t size);
+
 	bool IsConnected();
 };
 
@@ -0,0 +1,112 @@
+﻿#include "Effekseer.DepthPyramid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Effekseer
+{
+
+void DepthPyramid::Build(const float* depths, int32_t width, int32_t height)
+{
+	levelCount_ = 0;
+
+	if (depths == nullptr || width <= 0 || height <= 0)
+	{
+		return;
+	}
+
+	while (true)
+	{
+		if (static_cast<int32_t>(levels_.size()) <= levelCount_)
+		{
+			levels_.resize(levelCount_ + 1);
+		}
+
+		auto& level = levels_[levelCount_];
+		level.Width = width;
+		level.Height = height;
+		level.Depths.resize(width * height);
+
+		if (levelCount_ == 0)
+		{
+			memcpy(level.Depths.data(), depths, sizeof(float) * width * height);
+		}
+		else
+		{
+			// the last row and column of a lower level with odd size are merged into the last texel
+			const auto& lower = levels_[levelCount_ - 1];
+
+			for (int32_t y = 0; y < height; y++)
+			{
+				const auto y0 = y * 2;
+				const auto y1 = std::min(y0 + 1, lower.Height - 1);
+
+				for (int32_t x = 0; x < width; x++)
+				{
+					const auto x0 = x * 2;
+					const auto x1 = std::min(x0 + 1, lower.Width - 1);
+
+					const auto d0 = std::max(lower.Depths[x0 + y0 * lower.Width], lower.Depths[x1 + y0 * lower.Width]);
+					const auto d1 = std::max(lower.Depths[x0 + y1 * lower.Width], lower.Depths[x1 + y1 * lower.Width]);
+					level.Depths[x + y * width] = std::max(d0, d1);
+				}
+			}
+		}
+
+		levelCount_++;
+
+		if (width == 1 && height == 1)
+		{
+			break;
+		}
+
+		width = (width + 1) / 2;
+		height = (height + 1) / 2;
+	}
+}
+
+bool DepthPyramid::IsOccluded(float left, float top, float right, float bottom, float depth) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	const auto& base = levels_[0];
+	auto x0 = std::max(static_cast<int32_t>(std::floor(left * base.Width)), 0);
+	auto y0 = std::max(static_cast<int32_t>(std::floor(top * base.Height)), 0);
+	auto x1 = std::min(static_cast<int32_t>(std::ceil(right * base.Width)) - 1, base.Width - 1);
+	auto y1 = std::min(static_cast<int32_t>(std::ceil(bottom * base.Height)) - 1, base.Height - 1);
+
+	if (x0 > x1 || y0 > y1)
+	{
+		return false;
+	}
+
+	// select a level where the rectangle covers at most 2x2 texels
+	int32_t levelIndex = 0;
+	while (levelIndex + 1 < levelCount_ && (x1 - x0 > 1 || y1 - y0 > 1))
+	{
+		x0 /= 2;
+		y0 /= 2;
+		x1 /= 2;
+		y1 /= 2;
+		levelIndex++;
+	}
+
+	const auto& level = levels_[levelIndex];
+
+	for (int32_t y = y0; y <= y1; y++)
+	{
+		for (int32_t x = x0; x <= x1; x++)
+		{
+			if (depth <= level.Depths[x + y * level.Width])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+} // namespace Effekseer
@@ -0,0 +1,55 @@
+﻿
+#ifndef __EFFEKSEER_DEPTHPYRAMID_H__
+#define __EFFEKSEER_DEPTHPYRAMID_H__
+
+#include "Effekseer.Base.h"
+#include "Utils/Effekseer.CustomAllocator.h"
+
+namespace Effekseer
+{
+
+/**
+	@brief	a pyramid of depth buffers whose texels have the farthest depth of four texels in a lower level
+	@note
+	it is used to test whether bounding boxes are behind depths which are written by a host with a few texels
+*/
+class DepthPyramid
+{
+	struct Level
+	{
+		int32_t Width = 0;
+		int32_t Height = 0;
+		CustomVector<float> Depths;
+	};
+
+	CustomVector<Level> levels_;
+	int32_t levelCount_ = 0;
+
+public:
+	/**
+		@brief	build a pyramid from a depth buffer
+		@param	depths	depths from the top left texel. if it is nullptr, the pyramid is cleared
+		@note
+		memories are reused if a size of the depth buffer is not changed
+	*/
+	void Build(const float* depths, int32_t width, int32_t height);
+
+	bool IsValid() const
+	{
+		return levelCount_ > 0;
+	}
+
+	/**
+		@brief	whether a rectangle is behind all depths in it
+		@param	left	a left position from 0 to 1
+		@param	top		a top position from 0 to 1
+		@param	right	a right position from 0 to 1
+		@param	bottom	a bottom position from 0 to 1
+		@param	depth	the nearest depth in the rectangle
+	*/
+	bool IsOccluded(float left, float top, float right, float bottom, float depth) const;
+};
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_DEPTHPYRAMID_H__
@@ -22,7 +22,9 @@
 #include "Model/ProceduralModelGenerator.h"
 #include "Model/ProceduralModelParameter.h"
 #include "Utils/Effekseer.BinaryReader.h"
+#include "Utils/Profiler.h"
 
+#include <algorithm>
 #include <array>
 #include <functional>
 
@@ -211,31 +213,54 @@ void EffectFactory::OnLoadingResource(Effect* effect, const void* data, int32_t
 {
 	auto resourceMgr = effect->GetSetting()->GetResourceManager();
 
-	for (auto i = 0; i < effect->GetColorImageCount(); i++)
+	// all textures are loaded at once so that they are decoded in parallel
 	{
-		char16_t fullPath[512];
-		PathCombine(fullPath, materialPath, effect->GetColorImagePath(i));
+		const int32_t textureCount = effect->GetColorImageCount() + effect->GetNormalImageCount() + effect->GetDistortionImageCount();
 
-		auto resource = resourceMgr->LoadTexture(fullPath, TextureType::Color);
-		SetTexture(effect, i, TextureType::Color, resource);
-	}
+		CustomVector<CustomVector<char16_t>> fullPaths(textureCount, CustomVector<char16_t>(512));
+		CustomVector<const char16_t*> paths(textureCount);
+		CustomVector<TextureType> textureTypes(textureCount);
+		CustomVector<TextureRef> textures(textureCount);
 
-	for (auto i = 0; i < effect->GetNormalImageCount(); i++)
-	{
-		char16_t fullPath[512];
-		PathCombine(fullPath, materialPath, effect->GetNormalImagePath(i));
+		auto addPath = [&](int32_t index, const char16_t* path, TextureType textureType) {
+			PathCombine(fullPaths[index].data(), materialPath, path);
+			paths[index] = fullPaths[index].data();
+			textureTypes[index] = textureType;
+		};
 
-		auto resource = resourceMgr->LoadTexture(fullPath, TextureType::Normal);
-		SetTexture(effect, i, TextureType::Normal, resource);
-	}
+		int32_t offset = 0;
+		for (auto i = 0; i < effect->GetColorImageCount(); i++)
+		{
+			addPath(offset++, effect->GetColorImagePath(i), TextureType::Color);
+		}
 
-	for (auto i = 0; i < effect->GetDistortionImageCount(); i++)
-	{
-		char16_t fullPath[512];
-		PathCombine(fullPath, materialPath, effect->GetDistortionImagePath(i));
+		for (auto i = 0; i < effect->GetNormalImageCount(); i++)
+		{
+			addPath(offset++, effect->GetNormalImagePath(i), TextureType::Normal);
+		}
 
-		auto resource = resourceMgr->LoadTexture(fullPath, TextureType::Distortion);
-		SetTexture(effect, i, TextureType::Distortion, resource);
+		for (auto i = 0; i < effect->GetDistortionImageCount(); i++)
+		{
+			addPath(offset++, effect->GetDistortionImagePath(i), TextureType::Distortion);
+		}
+
+		resourceMgr->LoadTextures(paths.data(), textureTypes.data(), textureCount, textures.data());
+
+		offset = 0;
+		for (auto i = 0; i < effect->GetColorImageCount(); i++)
+		{
+			SetTexture(effect, i, TextureType::Color, textures[offset++]);
+		}
+
+		for (auto i = 0; i < effect->GetNormalImageCount(); i++)
+		{
+			SetTexture(effect, i, TextureType::Normal, textures[offset++]);
+		}
+
+		for (auto i = 0; i < effect->GetDistortionImageCount(); i++)
+		{
+			SetTexture(effect, i, TextureType::Distortion, textures[offset++]);
+		}
 	}
 
 	for (auto i = 0; i < effect->GetWaveCount(); i++)
@@ -374,8 +399,12 @@ EffectRef Effect::Create(const ManagerRef& manager, const char16_t* path, float
 	void* data = nullptr;
 	int32_t size = 0;
 
-	if (!eLoader->Load(path, data, size))
-		return nullptr;
+	{
+		PROFILER_BLOCK("Effect::LoadFile", profiler::colors::Green);
+
+		if (!eLoader->Load(path, data, size))
+			return nullptr;
+	}
 
 	char16_t parentDir[512];
 	if (materialPath == nullptr)
@@ -769,8 +798,12 @@ EffectRef Effect::Create(const SettingRef& setting, const char16_t* path, float
 	void* data = nullptr;
 	int32_t size = 0;
 
-	if (!eLoader->Load(path, data, size))
-		return nullptr;
+	{
+		PROFILER_BLOCK("Effect::LoadFile", profiler::colors::Green);
+
+		if (!eLoader->Load(path, data, size))
+			return nullptr;
+	}
 
 	char16_t parentDir[512];
 	if (materialPath == nullptr)
@@ -867,6 +900,8 @@ float EffectImplemented::GetMaginification() const
 //----------------------------------------------------------------------------------
 bool EffectImplemented::Load(const void* pData, int size, float mag, const char16_t* materialPath, ReloadingThreadType reloadingThreadType)
 {
+	PROFILER_BLOCK("Effect::Load", profiler::colors::Green);
+
 	factory.Reset();
 
 	if (m_setting != nullptr)
@@ -1381,11 +1416,150 @@ bool EffectImplemented::Reload(
 	return true;
 }
 
+static bool IsSamePaths(const CustomVector<std::unique_ptr<char16_t[]>>& lhs, const CustomVector<std::unique_ptr<char16_t[]>>& rhs)
+{
+	if (lhs.size() != rhs.size())
+		return false;
+
+	for (size_t i = 0; i < lhs.size(); i++)
+	{
+		if (std::u16string(lhs[i].get()) != std::u16string(rhs[i].get()))
+			return false;
+	}
+
+	return true;
+}
+
+//! whether values which playing instances keep are still valid with a reloaded node
+static bool IsInstanceCompatible(const EffectNodeImplemented* lhs, const EffectNodeImplemented* rhs)
+{
+	if (lhs->GetType() != rhs->GetType() || lhs->GetChildrenCount() != rhs->GetChildrenCount())
+		return false;
+
+	if (lhs->TranslationType != rhs->TranslationType || lhs->RotationType != rhs->RotationType || lhs->ScalingType != rhs->ScalingType)
+		return false;
+
+	if (lhs->AlphaCutoff.Type != rhs->AlphaCutoff.Type)
+		return false;
+
+	if (lhs->RendererCommon.CustomData1.Type != rhs->RendererCommon.CustomData1.Type ||
+		lhs->RendererCommon.CustomData2.Type != rhs->RendererCommon.CustomData2.Type)
+		return false;
+
+	for (int32_t i = 0; i < ParameterRendererCommon::UVParameterNum; i++)
+	{
+		if (lhs->RendererCommon.UVTypes[i] != rhs->RendererCommon.UVTypes[i])
+			return false;
+	}
+
+	return true;
+}
+
+bool EffectImplemented::ReloadParameters(ManagerRef* managers, int32_t managersCount, const void* data, int32_t size)
+{
+	if (factory == nullptr || !factory->OnCheckIsReloadSupported() || m_pRoot == nullptr)
+		return false;
+
+	// load parameters into a temporal effect without resources to compare them with current parameters
+	auto reloaded = MakeRefPtr<EffectImplemented>(m_setting, data, size);
+	if (!reloaded->LoadBody(static_cast<const uint8_t*>(data), size, GetMaginification()) || reloaded->m_pRoot == nullptr)
+		return false;
+
+	if (reloaded->m_version != m_version)
+		return false;
+
+	// resources are not reloaded
+	if (!IsSamePaths(m_ImagePaths, reloaded->m_ImagePaths) || !IsSamePaths(m_normalImagePaths, reloaded->m_normalImagePaths) ||
+		!IsSamePaths(m_distortionImagePaths, reloaded->m_distortionImagePaths) || !IsSamePaths(m_WavePaths, reloaded->m_WavePaths) ||
+		!IsSamePaths(modelPaths_, reloaded->modelPaths_) || !IsSamePaths(materialPaths_, reloaded->materialPaths_) ||
+		!IsSamePaths(curvePaths_, reloaded->curvePaths_))
+	{
+		return false;
+	}
+
+	if (proceduralModelParameters_.size() != reloaded->proceduralModelParameters_.size())
+		return false;
+
+	for (size_t i = 0; i < proceduralModelParameters_.size(); i++)
+	{
+		const auto& lhs = proceduralModelParameters_[i];
+		const auto& rhs = reloaded->proceduralModelParameters_[i];
+		if (lhs < rhs || rhs < lhs)
+			return false;
+	}
+
+	CustomVector<EffectNodeImplemented*> currentNodes;
+	CustomVector<EffectNodeImplemented*> reloadedNodes;
+
+	static_cast<EffectNodeImplemented*>(m_pRoot)->Traverse([&](EffectNodeImplemented* node) -> bool {
+		currentNodes.push_back(node);
+		return true;
+	});
+
+	static_cast<EffectNodeImplemented*>(reloaded->m_pRoot)->Traverse([&](EffectNodeImplemented* node) -> bool {
+		reloadedNodes.push_back(node);
+		return true;
+	});
+
+	if (currentNodes.size() != reloadedNodes.size())
+		return false;
+
+	CustomMap<EffectNodeImplemented*, EffectNodeImplemented*> replacedNodes;
+
+	for (size_t i = 0; i < currentNodes.size(); i++)
+	{
+		if (!IsInstanceCompatible(currentNodes[i], reloadedNodes[i]))
+			return false;
+
+		replacedNodes[currentNodes[i]] = reloadedNodes[i];
+	}
+
+	CustomVector<ManagerImplemented*> lockedManagers;
+	for (int32_t i = 0; i < managersCount; i++)
+	{
+		auto manager = managers[i]->GetImplemented();
+		if (std::find(lockedManagers.begin(), lockedManagers.end(), manager) != lockedManagers.end())
+			continue;
+
+		manager->LockRendering();
+		lockedManagers.push_back(manager);
+	}
+
+	for (size_t i = 0; i < currentNodes.size(); i++)
+	{
+		reloadedNodes[i]->m_effect = this;
+		reloadedNodes[i]->renderingUserData_ = currentNodes[i]->renderingUserData_;
+	}
+
+	for (auto manager : lockedManagers)
+	{
+		manager->ReplaceEffectNodes(EffectRef::FromPinned(this), replacedNodes);
+	}
+
+	// old nodes are disposed with the temporal effect
+	std::swap(m_pRoot, reloaded->m_pRoot);
+	std::swap(dynamicEquation, reloaded->dynamicEquation);
+	defaultDynamicInputs = reloaded->defaultDynamicInputs;
+	renderingNodesCount = reloaded->renderingNodesCount;
+	renderingNodesThreshold = reloaded->renderingNodesThreshold;
+	m_defaultRandomSeed = reloaded->m_defaultRandomSeed;
+	Culling = reloaded->Culling;
+
+	for (auto manager : lockedManagers)
+	{
+		manager->UnlockRendering();
+	}
+
+	return true;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
 void EffectImplemented::ReloadResources(const void* data, int32_t size, const char16_t* materialPath)
 {
+	PROFILER_BLOCK("Effect::ReloadResources", profiler::colors::Green);
+
 	UnloadResources();
 
 	const char16_t* matPath = materialPath != nullptr ? materialPath : materialPath_.c_str();
@@ -580,6 +580,35 @@ public:
 						const char16_t* materialPath = nullptr,
 						ReloadingThreadType reloadingThreadType = ReloadingThreadType::Main) = 0;
 
+	/**
+		@brief
+		\~English	Reload parameters of nodes without restarting playing instances
+		\~Japanese	再生中のインスタンスを再起動せずにノードのパラメーターを再読み込みする。
+		@param	managers
+		\~English	An array of manager instances
+		\~Japanese	マネージャーの配列
+		@param	managersCount
+		\~English	Length of array
+		\~Japanese	マネージャーの個数
+		@param	data
+		\~English	An effect's data
+		\~Japanese	エフェクトのデータ
+		@param	size
+		\~English	An effect's size
+		\~Japanese	エフェクトのデータサイズ
+		@return
+		\~English	False if the data cannot be applied in place. Call Reload in this case.
+		\~Japanese	データを適用できなかった場合はfalse。この場合はReloadを呼ぶ。
+		@note
+		\~English
+		The data is applied in place only if resources, the node tree and types of movement are not changed.
+		Playing instances refer to the new parameters from the next update.
+		\~Japanese
+		リソース、ノードの構造、移動等の種類が変更されていない場合のみ適用される。
+		再生中のインスタンスは次の更新から新しいパラメーターを参照する。
+	*/
+	virtual bool ReloadParameters(ManagerRef* managers, int32_t managersCount, const void* data, int32_t size) = 0;
+
 	/**
 		@brief	画像等リソースの再読み込みを行う。
 	*/
@@ -693,6 +722,22 @@ struct EffectModelParameter
 	bool Lighting;
 };
 
+/**
+@brief
+	\~English	A type of a node
+	\~Japanese	ノードの種類
+*/
+enum class EffectNodeType : int32_t
+{
+	Root = -1,
+	NoneType = 0,
+	Sprite = 2,
+	Ribbon = 3,
+	Ring = 4,
+	Model = 5,
+	Track = 6,
+};
+
 /**
 @brief	ノードインスタンス生成クラス
 @note
@@ -747,6 +792,20 @@ public:
 	*/
 	virtual EffectModelParameter GetEffectModelParameter() = 0;
 
+	/**
+	@brief
+	\~English	Get a type of the node
+	\~Japanese	ノードの種類を取得する。
+	*/
+	virtual EffectNodeType GetNodeType() const = 0;
+
+	/**
+	@brief
+	\~English	Get parameters which are passed into a renderer
+	\~Japanese	レンダラーに渡されるパラメーターを取得する。
+	*/
+	virtual const NodeRendererBasicParameter& GetNodeRendererBasicParameter() const = 0;
+
 	/**
 	@brief
 	\~English	Calculate a term of instances where instances exists
@@ -0,0 +1,176 @@
+﻿#include "Effekseer.EffectDataDelta.h"
+
+#include <stddef.h>
+#include <string.h>
+
+namespace Effekseer
+{
+
+namespace
+{
+
+const char EffectDataDeltaHeader[4] = {'E', 'F', 'K', 'D'};
+
+//! equal bytes shorter than it between changed bytes are sent instead of splitting a chunk
+const int32_t EffectDataDeltaChunkGap = 16;
+
+uint64_t CalculateHash(const uint8_t* data, size_t size)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+template <typename T>
+void Write(std::vector<uint8_t>& dst, const T& value)
+{
+	auto p = reinterpret_cast<const uint8_t*>(&value);
+	dst.insert(dst.end(), p, p + sizeof(T));
+}
+
+template <typename T>
+bool Read(const uint8_t*& p, const uint8_t* end, T& value)
+{
+	if (end - p < static_cast<ptrdiff_t>(sizeof(T)))
+		return false;
+
+	memcpy(&value, p, sizeof(T));
+	p += sizeof(T);
+	return true;
+}
+
+struct Chunk
+{
+	int32_t Offset;
+	int32_t RemovedSize;
+	int32_t InsertedSize;
+};
+
+} // namespace
+
+bool EffectDataDelta::IsDelta(const void* data, int32_t size)
+{
+	return size >= static_cast<int32_t>(sizeof(EffectDataDeltaHeader)) && memcmp(data, EffectDataDeltaHeader, sizeof(EffectDataDeltaHeader)) == 0;
+}
+
+void EffectDataDelta::Encode(const std::vector<uint8_t>& base, const void* data, int32_t size, std::vector<uint8_t>& dst)
+{
+	auto bytes = static_cast<const uint8_t*>(data);
+	const auto baseSize = static_cast<int32_t>(base.size());
+
+	// trim bytes which are not changed
+	int32_t prefix = 0;
+	while (prefix < baseSize && prefix < size && base[prefix] == bytes[prefix])
+	{
+		prefix++;
+	}
+
+	int32_t suffix = 0;
+	while (suffix < baseSize - prefix && suffix < size - prefix && base[baseSize - 1 - suffix] == bytes[size - 1 - suffix])
+	{
+		suffix++;
+	}
+
+	std::vector<Chunk> chunks;
+	const int32_t removedSize = baseSize - prefix - suffix;
+	const int32_t insertedSize = size - prefix - suffix;
+
+	if (removedSize == insertedSize)
+	{
+		// a size is not changed, so changed parameters are sent separately
+		int32_t offset = prefix;
+		while (offset < prefix + removedSize)
+		{
+			if (base[offset] == bytes[offset])
+			{
+				offset++;
+				continue;
+			}
+
+			int32_t last = offset;
+			int32_t current = offset + 1;
+			while (current < prefix + removedSize && current - last <= EffectDataDeltaChunkGap)
+			{
+				if (base[current] != bytes[current])
+				{
+					last = current;
+				}
+				current++;
+			}
+
+			const int32_t chunkSize = last - offset + 1;
+			chunks.push_back({offset, chunkSize, chunkSize});
+			offset = last + 1;
+		}
+	}
+	else
+	{
+		chunks.push_back({prefix, removedSize, insertedSize});
+	}
+
+	dst.clear();
+	dst.insert(dst.end(), EffectDataDeltaHeader, EffectDataDeltaHeader + sizeof(EffectDataDeltaHeader));
+	Write(dst, baseSize);
+	Write(dst, CalculateHash(base.data(), base.size()));
+	Write(dst, static_cast<int32_t>(chunks.size()));
+
+	for (const auto& chunk : chunks)
+	{
+		Write(dst, chunk.Offset);
+		Write(dst, chunk.RemovedSize);
+		Write(dst, chunk.InsertedSize);
+		dst.insert(dst.end(), bytes + chunk.Offset, bytes + chunk.Offset + chunk.InsertedSize);
+	}
+}
+
+bool EffectDataDelta::Decode(const std::vector<uint8_t>& base, const void* delta, int32_t size, std::vector<uint8_t>& dst)
+{
+	if (!IsDelta(delta, size))
+		return false;
+
+	auto p = static_cast<const uint8_t*>(delta) + sizeof(EffectDataDeltaHeader);
+	auto end = static_cast<const uint8_t*>(delta) + size;
+
+	int32_t baseSize = 0;
+	uint64_t baseHash = 0;
+	int32_t chunkCount = 0;
+
+	if (!Read(p, end, baseSize) || !Read(p, end, baseHash) || !Read(p, end, chunkCount))
+		return false;
+
+	if (baseSize != static_cast<int32_t>(base.size()) || baseHash != CalculateHash(base.data(), base.size()) || chunkCount < 0)
+		return false;
+
+	dst.clear();
+	dst.reserve(base.size());
+
+	int32_t copied = 0;
+	for (int32_t i = 0; i < chunkCount; i++)
+	{
+		int32_t offset = 0;
+		int32_t removedSize = 0;
+		int32_t insertedSize = 0;
+
+		if (!Read(p, end, offset) || !Read(p, end, removedSize) || !Read(p, end, insertedSize))
+			return false;
+
+		if (offset < copied || removedSize < 0 || insertedSize < 0 || offset + removedSize > baseSize || end - p < insertedSize)
+			return false;
+
+		dst.insert(dst.end(), base.begin() + copied, base.begin() + offset);
+		dst.insert(dst.end(), p, p + insertedSize);
+		p += insertedSize;
+		copied = offset + removedSize;
+	}
+
+	dst.insert(dst.end(), base.begin() + copied, base.end());
+
+	return p == end;
+}
+
+} // namespace Effekseer
@@ -0,0 +1,51 @@
+﻿
+#ifndef __EFFEKSEER_EFFECT_DATA_DELTA_H__
+#define __EFFEKSEER_EFFECT_DATA_DELTA_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include <stdint.h>
+#include <vector>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+
+/**
+	@brief
+	\~English	A payload which contains only changed bytes of an effect from data sent previously
+	\~Japanese	以前に送信したデータからエフェクトの変更されたバイトのみを含むデータ
+	@note
+	\~English
+	Parameters of nodes are serialized in order, so editing parameters changes only bytes of their nodes.
+	Format : "EFKD", base size, base hash, chunk count, chunks (offset in base, removed size, inserted size, inserted bytes)
+	\~Japanese
+	ノードのパラメーターは順番に保存されているため、パラメーターを編集するとそのノードのバイトのみが変更される。
+*/
+class EffectDataDelta
+{
+public:
+	//! whether data is a delta payload
+	static bool IsDelta(const void* data, int32_t size);
+
+	//! create a delta payload to convert base into data
+	static void Encode(const std::vector<uint8_t>& base, const void* data, int32_t size, std::vector<uint8_t>& dst);
+
+	//! apply a delta payload to base. return false if base is not the data the payload was created from
+	static bool Decode(const std::vector<uint8_t>& base, const void* delta, int32_t size, std::vector<uint8_t>& dst);
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEER_EFFECT_DATA_DELTA_H__
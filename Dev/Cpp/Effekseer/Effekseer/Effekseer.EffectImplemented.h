@@ -312,6 +312,8 @@ public:
 				const char16_t* materialPath,
 				ReloadingThreadType reloadingThreadType) override;
 
+	bool ReloadParameters(ManagerRef* managers, int32_t managersCount, const void* data, int32_t size) override;
+
 	void ReloadResources(const void* data, int32_t size, const char16_t* materialPath) override;
 
 	void UnloadResources(const char16_t* materialPath);
@@ -997,6 +997,16 @@ EffectModelParameter EffectNodeImplemented::GetEffectModelParameter()
 	return param;
 }
 
+EffectNodeType EffectNodeImplemented::GetNodeType() const
+{
+	return static_cast<EffectNodeType>(GetType());
+}
+
+const NodeRendererBasicParameter& EffectNodeImplemented::GetNodeRendererBasicParameter() const
+{
+	return RendererCommon.BasicParameter;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -1030,7 +1040,7 @@ void EffectNodeImplemented::EndRenderingGroup(InstanceGroup* group, Manager* man
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-void EffectNodeImplemented::Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData)
+void EffectNodeImplemented::Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData)
 {
 }
 
@@ -1093,6 +1103,34 @@ float EffectNodeImplemented::GetFadeAlpha(const Instance& instance)
 	return Clamp(alpha, 1.0f, 0.0f);
 }
 
+float EffectNodeImplemented::GetRenderedRadius() const
+{
+	return -1.0f;
+}
+
+int32_t EffectNodeImplemented::EstimateRenderedVertexCount(int32_t instanceCount) const
+{
+	return 0;
+}
+
+bool EffectNodeImplemented::IsRenderedPositionMoved() const
+{
+	const auto& depth = DepthValues.DepthParameter;
+	if (depth.DepthOffset != 0.0f || depth.IsDepthOffsetScaledWithCamera || depth.SuppressionOfScalingByDepth != 1.0f)
+	{
+		return true;
+	}
+
+	// instances are drawn in front of the camera
+	if (TranslationType == ParameterTranslationType_ViewOffset)
+	{
+		return true;
+	}
+
+	// a material file can offset vertices in its shader
+	return RendererCommon.MaterialType == RendererMaterialType::File;
+}
+
 EffectInstanceTerm EffectNodeImplemented::CalculateInstanceTerm(EffectInstanceTerm& parentTerm) const
 {
 	EffectInstanceTerm ret;
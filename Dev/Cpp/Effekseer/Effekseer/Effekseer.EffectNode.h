@@ -1536,6 +1536,10 @@ public:
 
 	EffectModelParameter GetEffectModelParameter() override;
 
+	EffectNodeType GetNodeType() const override;
+
+	const NodeRendererBasicParameter& GetNodeRendererBasicParameter() const override;
+
 	virtual void LoadRendererParameter(unsigned char*& pos, const SettingRef& setting);
 
 	/**
@@ -1552,8 +1556,10 @@ public:
 
 	/**
 	@brief	描画
+	@param	instances	グループ内の有効なインスタンス(描画順)
+	@param	count	インスタンスの個数
 	*/
-	virtual void Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData);
+	virtual void Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData);
 
 	/**
 	@brief	描画終了
@@ -1580,6 +1586,22 @@ public:
 	*/
 	virtual float GetFadeAlpha(const Instance& instance);
 
+	/**
+		@brief
+		\~English	Get the radius of a sphere which contains a rendered instance whose scale is 1
+		\~Japanese	拡大率が1のインスタンスの描画範囲を含む球の半径を取得する。
+		@note
+		\~English	A negative value means that the radius is unknown and instances must not be culled.
+		\~Japanese	負の値は半径が不明でインスタンスをカリングしてはいけないことを意味する。
+	*/
+	virtual float GetRenderedRadius() const;
+
+	//! whether rendered positions are moved from instances' positions by depth parameters, a view offset or a material
+	bool IsRenderedPositionMoved() const;
+
+	//! estimate the number of vertices which a renderer emits for instances of a group to profile
+	virtual int32_t EstimateRenderedVertexCount(int32_t instanceCount) const;
+
 	EffectInstanceTerm CalculateInstanceTerm(EffectInstanceTerm& parentTerm) const override;
 
 	/**
@@ -4,6 +4,7 @@
 #include "Effekseer.EffectNode.h"
 #include "Effekseer.Manager.h"
 #include "Effekseer.Vector3D.h"
+#include "Model/Model.h"
 #include "SIMD/Utils.h"
 
 #include "Effekseer.Instance.h"
@@ -156,9 +157,8 @@ void EffectNodeModel::BeginRendering(int32_t count, Manager* manager, void* user
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-void EffectNodeModel::Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData)
+void EffectNodeModel::Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData)
 {
-	const InstanceValues& instValues = instance.rendererValues.model;
 	ModelRendererRef renderer = manager->GetModelRenderer();
 	if (renderer != nullptr)
 	{
@@ -188,48 +188,56 @@ void EffectNodeModel::Rendering(const Instance& instance, const Instance* next_i
 
 		nodeParameter.IsProceduralMode = Mode == ModelReferenceType::Procedural;
 
-		ModelRenderer::InstanceParameter instanceParameter;
-		instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
-		instanceParameter.Time = (int32_t)instance.m_LivingTime;
+		instanceParameters_.resize(count);
 
-		instanceParameter.UV = instance.GetUV(0);
-		instanceParameter.AlphaUV = instance.GetUV(1);
-		instanceParameter.UVDistortionUV = instance.GetUV(2);
-		instanceParameter.BlendUV = instance.GetUV(3);
-		instanceParameter.BlendAlphaUV = instance.GetUV(4);
-		instanceParameter.BlendUVDistortionUV = instance.GetUV(5);
-
-		instanceParameter.FlipbookIndexAndNextRate = instance.m_flipbookIndexAndNextRate;
-
-		instanceParameter.AlphaThreshold = instance.m_AlphaThreshold;
-
-		if (nodeParameter.EnableViewOffset == true)
+		for (int32_t i = 0; i < count; i++)
 		{
-			instanceParameter.ViewOffsetDistance = instance.translation_values.view_offset.distance;
-		}
-
-		CalcCustomData(&instance, instanceParameter.CustomData1, instanceParameter.CustomData2);
-
-		Color _color;
-		if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
-		{
-			_color = Color::Mul(instValues._original, instance.ColorParent);
-		}
-		else
-		{
-			_color = instValues._original;
-		}
-		instanceParameter.AllColor = _color;
-
-		if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
-		{
-			instanceParameter.AllColor = Color::Mul(instanceParameter.AllColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
+			const Instance& instance = *instances[i];
+			const InstanceValues& instValues = instance.rendererValues.model;
+			ModelRenderer::InstanceParameter& instanceParameter = instanceParameters_[i];
+
+			instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
+			instanceParameter.Time = (int32_t)instance.m_LivingTime;
+
+			instanceParameter.UV = instance.GetUV(0);
+			instanceParameter.AlphaUV = instance.GetUV(1);
+			instanceParameter.UVDistortionUV = instance.GetUV(2);
+			instanceParameter.BlendUV = instance.GetUV(3);
+			instanceParameter.BlendAlphaUV = instance.GetUV(4);
+			instanceParameter.BlendUVDistortionUV = instance.GetUV(5);
+
+			instanceParameter.FlipbookIndexAndNextRate = instance.m_flipbookIndexAndNextRate;
+
+			instanceParameter.AlphaThreshold = instance.m_AlphaThreshold;
+
+			if (nodeParameter.EnableViewOffset == true)
+			{
+				instanceParameter.ViewOffsetDistance = instance.translation_values.view_offset.distance;
+			}
+
+			CalcCustomData(&instance, instanceParameter.CustomData1, instanceParameter.CustomData2);
+
+			Color _color;
+			if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
+			{
+				_color = Color::Mul(instValues._original, instance.ColorParent);
+			}
+			else
+			{
+				_color = instValues._original;
+			}
+			instanceParameter.AllColor = _color;
+
+			if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
+			{
+				instanceParameter.AllColor = Color::Mul(instanceParameter.AllColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
+			}
 		}
 
 		nodeParameter.BasicParameterPtr = &RendererCommon.BasicParameter;
 		nodeParameter.UserData = GetRenderingUserData();
 
-		renderer->Rendering(nodeParameter, instanceParameter, userData);
+		renderer->Rendering(nodeParameter, instanceParameters_.data(), count, userData);
 	}
 }
 
@@ -373,6 +381,39 @@ void EffectNodeModel::UpdateRenderedInstance(Instance& instance, InstanceGroup&
 	instance.ColorInheritance = instValues._color;
 }
 
+float EffectNodeModel::GetRenderedRadius() const
+{
+	// a procedural model can be replaced at any time
+	if (Mode != ModelReferenceType::File || IsRenderedPositionMoved())
+	{
+		return -1.0f;
+	}
+
+	auto model = m_effect->GetModel(ModelIndex);
+	if (model == nullptr)
+	{
+		return -1.0f;
+	}
+
+	return model->GetBoundingRadius() * m_effect->GetMaginification();
+}
+
+int32_t EffectNodeModel::EstimateRenderedVertexCount(int32_t instanceCount) const
+{
+	if (Mode != ModelReferenceType::File)
+	{
+		return 0;
+	}
+
+	auto model = m_effect->GetModel(ModelIndex);
+	if (model == nullptr)
+	{
+		return 0;
+	}
+
+	return instanceCount * model->GetVertexCount();
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
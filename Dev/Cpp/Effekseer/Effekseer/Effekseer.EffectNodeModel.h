@@ -78,6 +78,8 @@ public:
 
 	ModelReferenceType Mode = ModelReferenceType::File;
 
+	CustomAlignedVector<ModelRenderer::InstanceParameter> instanceParameters_;
+
 	EffectNodeModel(Effect* effect, unsigned char*& pos)
 		: EffectNodeImplemented(effect, pos)
 	{
@@ -91,7 +93,7 @@ public:
 
 	void BeginRendering(int32_t count, Manager* manager, void* userData) override;
 
-	void Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData) override;
+	void Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData) override;
 
 	void EndRendering(Manager* manager, void* userData) override;
 
@@ -99,6 +101,10 @@ public:
 
 	void UpdateRenderedInstance(Instance& instance, InstanceGroup& instanceGroup, Manager* manager) override;
 
+	float GetRenderedRadius() const override;
+
+	int32_t EstimateRenderedVertexCount(int32_t instanceCount) const override;
+
 	eEffectNodeType GetType() const override
 	{
 		return EFFECT_NODE_TYPE_MODEL;
@@ -208,86 +208,97 @@ void EffectNodeRibbon::EndRenderingGroup(InstanceGroup* group, Manager* manager,
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-void EffectNodeRibbon::Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData)
+void EffectNodeRibbon::Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData)
 {
-	const InstanceValues& instValues = instance.rendererValues.ribbon;
 	RibbonRendererRef renderer = manager->GetRibbonRenderer();
 	if (renderer != nullptr)
 	{
-		Color _color;
-		if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
-		{
-			_color = Color::Mul(instValues._original, instance.ColorParent);
-		}
-		else
-		{
-			_color = instValues._original;
-		}
-
-		m_instanceParameter.AllColor = _color;
-		m_instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
+		instanceParameters_.resize(count);
 
-		Color color_l = _color;
-		Color color_r = _color;
-		Color color_nl = _color;
-		Color color_nr = _color;
-
-		if (next_instance != nullptr)
+		for (int32_t i = 0; i < count; i++)
 		{
-			const InstanceValues& instValues_next = next_instance->rendererValues.ribbon;
-			Color _color_next;
+			const Instance& instance = *instances[i];
+			const Instance* next_instance = i + 1 < count ? instances[i + 1] : nullptr;
+			const InstanceValues& instValues = instance.rendererValues.ribbon;
+			RibbonRenderer::InstanceParameter& instanceParameter = instanceParameters_[i];
+			instanceParameter = m_instanceParameter;
+			instanceParameter.InstanceIndex += i;
+
+			Color _color;
 			if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
 			{
-				_color_next = Color::Mul(instValues_next._original, next_instance->ColorParent);
+				_color = Color::Mul(instValues._original, instance.ColorParent);
 			}
 			else
 			{
-				_color_next = instValues_next._original;
+				_color = instValues._original;
 			}
 
-			color_nl = _color_next;
-			color_nr = _color_next;
-		}
+			instanceParameter.AllColor = _color;
+			instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
 
-		if (RibbonColor.type == RibbonColorParameter::Default)
-		{
-		}
-		else if (RibbonColor.type == RibbonColorParameter::Fixed)
-		{
-			color_l = Color::Mul(color_l, RibbonColor.fixed.l);
-			color_r = Color::Mul(color_r, RibbonColor.fixed.r);
-			color_nl = Color::Mul(color_nl, RibbonColor.fixed.l);
-			color_nr = Color::Mul(color_nr, RibbonColor.fixed.r);
-		}
+			Color color_l = _color;
+			Color color_r = _color;
+			Color color_nl = _color;
+			Color color_nr = _color;
 
-		m_instanceParameter.Colors[0] = color_l;
-		m_instanceParameter.Colors[1] = color_r;
-		m_instanceParameter.Colors[2] = color_nl;
-		m_instanceParameter.Colors[3] = color_nr;
+			if (next_instance != nullptr)
+			{
+				const InstanceValues& instValues_next = next_instance->rendererValues.ribbon;
+				Color _color_next;
+				if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
+				{
+					_color_next = Color::Mul(instValues_next._original, next_instance->ColorParent);
+				}
+				else
+				{
+					_color_next = instValues_next._original;
+				}
+
+				color_nl = _color_next;
+				color_nr = _color_next;
+			}
 
-		// Apply global Color
-		if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
-		{
-			m_instanceParameter.Colors[0] =
-				Color::Mul(m_instanceParameter.Colors[0], instance.m_pContainer->GetRootInstance()->GlobalColor);
-			m_instanceParameter.Colors[1] =
-				Color::Mul(m_instanceParameter.Colors[1], instance.m_pContainer->GetRootInstance()->GlobalColor);
-		}
+			if (RibbonColor.type == RibbonColorParameter::Default)
+			{
+			}
+			else if (RibbonColor.type == RibbonColorParameter::Fixed)
+			{
+				color_l = Color::Mul(color_l, RibbonColor.fixed.l);
+				color_r = Color::Mul(color_r, RibbonColor.fixed.r);
+				color_nl = Color::Mul(color_nl, RibbonColor.fixed.l);
+				color_nr = Color::Mul(color_nr, RibbonColor.fixed.r);
+			}
 
-		if (RibbonPosition.type == RibbonPositionParameter::Default)
-		{
-			m_instanceParameter.Positions[0] = -0.5f;
-			m_instanceParameter.Positions[1] = 0.5f;
-		}
-		else if (RibbonPosition.type == RibbonPositionParameter::Fixed)
-		{
-			m_instanceParameter.Positions[0] = RibbonPosition.fixed.l;
-			m_instanceParameter.Positions[1] = RibbonPosition.fixed.r;
+			instanceParameter.Colors[0] = color_l;
+			instanceParameter.Colors[1] = color_r;
+			instanceParameter.Colors[2] = color_nl;
+			instanceParameter.Colors[3] = color_nr;
+
+			// Apply global Color
+			if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
+			{
+				instanceParameter.Colors[0] =
+					Color::Mul(instanceParameter.Colors[0], instance.m_pContainer->GetRootInstance()->GlobalColor);
+				instanceParameter.Colors[1] =
+					Color::Mul(instanceParameter.Colors[1], instance.m_pContainer->GetRootInstance()->GlobalColor);
+			}
+
+			if (RibbonPosition.type == RibbonPositionParameter::Default)
+			{
+				instanceParameter.Positions[0] = -0.5f;
+				instanceParameter.Positions[1] = 0.5f;
+			}
+			else if (RibbonPosition.type == RibbonPositionParameter::Fixed)
+			{
+				instanceParameter.Positions[0] = RibbonPosition.fixed.l;
+				instanceParameter.Positions[1] = RibbonPosition.fixed.r;
+			}
 		}
 
-		renderer->Rendering(m_nodeParameter, m_instanceParameter, userData);
+		renderer->Rendering(m_nodeParameter, instanceParameters_.data(), count, userData);
 
-		m_instanceParameter.InstanceIndex++;
+		m_instanceParameter.InstanceIndex += count;
 	}
 }
 
@@ -380,6 +391,11 @@ void EffectNodeRibbon::UpdateRenderedInstance(Instance& instance, InstanceGroup&
 	instance.ColorInheritance = instValues._color;
 }
 
+int32_t EffectNodeRibbon::EstimateRenderedVertexCount(int32_t instanceCount) const
+{
+	return std::max(instanceCount - 1, 0) * SplineDivision * 4;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
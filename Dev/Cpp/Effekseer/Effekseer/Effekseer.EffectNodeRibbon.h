@@ -142,6 +142,7 @@ public:
 
 	RibbonRenderer::NodeParameter m_nodeParameter;
 	RibbonRenderer::InstanceParameter m_instanceParameter;
+	CustomAlignedVector<RibbonRenderer::InstanceParameter> instanceParameters_;
 
 public:
 	AlphaBlendType AlphaBlend;
@@ -176,7 +177,7 @@ public:
 
 	void EndRenderingGroup(InstanceGroup* group, Manager* manager, void* userData) override;
 
-	void Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData) override;
+	void Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData) override;
 
 	void EndRendering(Manager* manager, void* userData) override;
 
@@ -184,6 +185,8 @@ public:
 
 	void UpdateRenderedInstance(Instance& instance, InstanceGroup& instanceGroup, Manager* manager) override;
 
+	int32_t EstimateRenderedVertexCount(int32_t instanceCount) const override;
+
 	eEffectNodeType GetType() const override
 	{
 		return EFFECT_NODE_TYPE_RIBBON;
@@ -266,9 +266,8 @@ void EffectNodeRing::BeginRendering(int32_t count, Manager* manager, void* userD
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-void EffectNodeRing::Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData)
+void EffectNodeRing::Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData)
 {
-	const InstanceValues& instValues = instance.rendererValues.ring;
 	RingRendererRef renderer = manager->GetRingRenderer();
 	if (renderer != nullptr)
 	{
@@ -286,67 +285,75 @@ void EffectNodeRing::Rendering(const Instance& instance, const Instance* next_in
 
 		nodeParameter.EnableViewOffset = (TranslationType == ParameterTranslationType_ViewOffset);
 
-		Color _outerColor;
-		Color _centerColor;
-		Color _innerColor;
+		instanceParameters_.resize(count);
 
-		if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
+		for (int32_t i = 0; i < count; i++)
 		{
-			_outerColor = Color::Mul(instValues.outerColor.original, instance.ColorParent);
-			_centerColor = Color::Mul(instValues.centerColor.original, instance.ColorParent);
-			_innerColor = Color::Mul(instValues.innerColor.original, instance.ColorParent);
-		}
-		else
-		{
-			_outerColor = instValues.outerColor.original;
-			_centerColor = instValues.centerColor.original;
-			_innerColor = instValues.innerColor.original;
-		}
+			const Instance& instance = *instances[i];
+			const InstanceValues& instValues = instance.rendererValues.ring;
+			RingRenderer::InstanceParameter& instanceParameter = instanceParameters_[i];
 
-		RingRenderer::InstanceParameter instanceParameter;
-		instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
+			Color _outerColor;
+			Color _centerColor;
+			Color _innerColor;
 
-		instanceParameter.ViewingAngleStart = instValues.startingAngle.current;
-		instanceParameter.ViewingAngleEnd = instValues.endingAngle.current;
+			if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
+			{
+				_outerColor = Color::Mul(instValues.outerColor.original, instance.ColorParent);
+				_centerColor = Color::Mul(instValues.centerColor.original, instance.ColorParent);
+				_innerColor = Color::Mul(instValues.innerColor.original, instance.ColorParent);
+			}
+			else
+			{
+				_outerColor = instValues.outerColor.original;
+				_centerColor = instValues.centerColor.original;
+				_innerColor = instValues.innerColor.original;
+			}
 
-		instanceParameter.OuterLocation = instValues.outerLocation.current;
-		instanceParameter.InnerLocation = instValues.innerLocation.current;
+			instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
 
-		instanceParameter.CenterRatio = instValues.centerRatio.current;
+			instanceParameter.ViewingAngleStart = instValues.startingAngle.current;
+			instanceParameter.ViewingAngleEnd = instValues.endingAngle.current;
 
-		// Apply global Color
-		if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
-		{
-			_outerColor = Color::Mul(_outerColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
-			_centerColor = Color::Mul(_centerColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
-			_innerColor = Color::Mul(_innerColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
-		}
+			instanceParameter.OuterLocation = instValues.outerLocation.current;
+			instanceParameter.InnerLocation = instValues.innerLocation.current;
 
-		instanceParameter.OuterColor = _outerColor;
-		instanceParameter.CenterColor = _centerColor;
-		instanceParameter.InnerColor = _innerColor;
+			instanceParameter.CenterRatio = instValues.centerRatio.current;
 
-		instanceParameter.UV = instance.GetUV(0);
-		instanceParameter.AlphaUV = instance.GetUV(1);
-		instanceParameter.UVDistortionUV = instance.GetUV(2);
-		instanceParameter.BlendUV = instance.GetUV(3);
-		instanceParameter.BlendAlphaUV = instance.GetUV(4);
-		instanceParameter.BlendUVDistortionUV = instance.GetUV(5);
+			// Apply global Color
+			if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
+			{
+				_outerColor = Color::Mul(_outerColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
+				_centerColor = Color::Mul(_centerColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
+				_innerColor = Color::Mul(_innerColor, instance.m_pContainer->GetRootInstance()->GlobalColor);
+			}
 
-		instanceParameter.FlipbookIndexAndNextRate = instance.m_flipbookIndexAndNextRate;
+			instanceParameter.OuterColor = _outerColor;
+			instanceParameter.CenterColor = _centerColor;
+			instanceParameter.InnerColor = _innerColor;
 
-		instanceParameter.AlphaThreshold = instance.m_AlphaThreshold;
+			instanceParameter.UV = instance.GetUV(0);
+			instanceParameter.AlphaUV = instance.GetUV(1);
+			instanceParameter.UVDistortionUV = instance.GetUV(2);
+			instanceParameter.BlendUV = instance.GetUV(3);
+			instanceParameter.BlendAlphaUV = instance.GetUV(4);
+			instanceParameter.BlendUVDistortionUV = instance.GetUV(5);
 
-		if (instance.m_pEffectNode->TranslationType == ParameterTranslationType_ViewOffset)
-		{
-			instanceParameter.ViewOffsetDistance = instance.translation_values.view_offset.distance;
-		}
+			instanceParameter.FlipbookIndexAndNextRate = instance.m_flipbookIndexAndNextRate;
+
+			instanceParameter.AlphaThreshold = instance.m_AlphaThreshold;
+
+			if (instance.m_pEffectNode->TranslationType == ParameterTranslationType_ViewOffset)
+			{
+				instanceParameter.ViewOffsetDistance = instance.translation_values.view_offset.distance;
+			}
 
-		CalcCustomData(&instance, instanceParameter.CustomData1, instanceParameter.CustomData2);
+			CalcCustomData(&instance, instanceParameter.CustomData1, instanceParameter.CustomData2);
+		}
 
 		nodeParameter.UserData = GetRenderingUserData();
 
-		renderer->Rendering(nodeParameter, instanceParameter, userData);
+		renderer->Rendering(nodeParameter, instanceParameters_.data(), count, userData);
 	}
 }
 
@@ -635,6 +642,11 @@ void EffectNodeRing::UpdateColorValues(Instance& instance, const RingColorParame
 	}
 }
 
+int32_t EffectNodeRing::EstimateRenderedVertexCount(int32_t instanceCount) const
+{
+	return instanceCount * VertexCount * 8;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
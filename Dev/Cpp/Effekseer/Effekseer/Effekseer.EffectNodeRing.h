@@ -229,6 +229,8 @@ public:
 
 	RingRenderer::NodeParameter nodeParameter;
 
+	CustomAlignedVector<RingRenderer::InstanceParameter> instanceParameters_;
+
 	EffectNodeRing(Effect* effect, unsigned char*& pos)
 		: EffectNodeImplemented(effect, pos)
 	{
@@ -242,7 +244,7 @@ public:
 
 	void BeginRendering(int32_t count, Manager* manager, void* userData) override;
 
-	void Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData) override;
+	void Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData) override;
 
 	void EndRendering(Manager* manager, void* userData) override;
 
@@ -250,6 +252,8 @@ public:
 
 	void UpdateRenderedInstance(Instance& instance, InstanceGroup& instanceGroup, Manager* manager) override;
 
+	int32_t EstimateRenderedVertexCount(int32_t instanceCount) const override;
+
 	eEffectNodeType GetType() const override
 	{
 		return EFFECT_NODE_TYPE_RING;
@@ -177,9 +177,8 @@ void EffectNodeSprite::BeginRendering(int32_t count, Manager* manager, void* use
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
-void EffectNodeSprite::Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData)
+void EffectNodeSprite::Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData)
 {
-	const InstanceValues& instValues = instance.rendererValues.sprite;
 	SpriteRendererRef renderer = manager->GetSpriteRenderer();
 	if (renderer != nullptr)
 	{
@@ -200,88 +199,96 @@ void EffectNodeSprite::Rendering(const Instance& instance, const Instance* next_
 		nodeParameter.EnableViewOffset = (TranslationType == ParameterTranslationType_ViewOffset);
 		nodeParameter.Maginification = GetEffect()->GetMaginification();
 
-		SpriteRenderer::InstanceParameter instanceParameter;
-		instanceParameter.AllColor = instValues._color;
+		instanceParameters_.resize(count);
 
-		instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
-
-		// Inherit Color
-		Color _color;
-		if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
-		{
-			_color = Color::Mul(instValues._originalColor, instance.ColorParent);
-		}
-		else
-		{
-			_color = instValues._originalColor;
-		}
-
-		Color color_ll = _color;
-		Color color_lr = _color;
-		Color color_ul = _color;
-		Color color_ur = _color;
-
-		if (SpriteColor.type == SpriteColorParameter::Default)
-		{
-		}
-		else if (SpriteColor.type == SpriteColorParameter::Fixed)
-		{
-			color_ll = Color::Mul(color_ll, SpriteColor.fixed.ll);
-			color_lr = Color::Mul(color_lr, SpriteColor.fixed.lr);
-			color_ul = Color::Mul(color_ul, SpriteColor.fixed.ul);
-			color_ur = Color::Mul(color_ur, SpriteColor.fixed.ur);
-		}
-
-		instanceParameter.Colors[0] = color_ll;
-		instanceParameter.Colors[1] = color_lr;
-		instanceParameter.Colors[2] = color_ul;
-		instanceParameter.Colors[3] = color_ur;
-
-		// Apply global Color
-		if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
-		{
-			instanceParameter.Colors[0] = Color::Mul(instanceParameter.Colors[0], instance.m_pContainer->GetRootInstance()->GlobalColor);
-			instanceParameter.Colors[1] = Color::Mul(instanceParameter.Colors[1], instance.m_pContainer->GetRootInstance()->GlobalColor);
-			instanceParameter.Colors[2] = Color::Mul(instanceParameter.Colors[2], instance.m_pContainer->GetRootInstance()->GlobalColor);
-			instanceParameter.Colors[3] = Color::Mul(instanceParameter.Colors[3], instance.m_pContainer->GetRootInstance()->GlobalColor);
-		}
-
-		if (SpritePosition.type == SpritePosition.Default)
-		{
-			instanceParameter.Positions[0] = {-0.5f, -0.5f};
-			instanceParameter.Positions[1] = {0.5f, -0.5f};
-			instanceParameter.Positions[2] = {-0.5f, 0.5f};
-			instanceParameter.Positions[3] = {0.5f, 0.5f};
-		}
-		else if (SpritePosition.type == SpritePosition.Fixed)
+		for (int32_t i = 0; i < count; i++)
 		{
-			instanceParameter.Positions[0] = SpritePosition.fixed.ll;
-			instanceParameter.Positions[1] = SpritePosition.fixed.lr;
-			instanceParameter.Positions[2] = SpritePosition.fixed.ul;
-			instanceParameter.Positions[3] = SpritePosition.fixed.ur;
+			const Instance& instance = *instances[i];
+			const InstanceValues& instValues = instance.rendererValues.sprite;
+			SpriteRenderer::InstanceParameter& instanceParameter = instanceParameters_[i];
+
+			instanceParameter.AllColor = instValues._color;
+
+			instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
+
+			// Inherit Color
+			Color _color;
+			if (RendererCommon.ColorBindType == BindType::Always || RendererCommon.ColorBindType == BindType::WhenCreating)
+			{
+				_color = Color::Mul(instValues._originalColor, instance.ColorParent);
+			}
+			else
+			{
+				_color = instValues._originalColor;
+			}
+
+			Color color_ll = _color;
+			Color color_lr = _color;
+			Color color_ul = _color;
+			Color color_ur = _color;
+
+			if (SpriteColor.type == SpriteColorParameter::Default)
+			{
+			}
+			else if (SpriteColor.type == SpriteColorParameter::Fixed)
+			{
+				color_ll = Color::Mul(color_ll, SpriteColor.fixed.ll);
+				color_lr = Color::Mul(color_lr, SpriteColor.fixed.lr);
+				color_ul = Color::Mul(color_ul, SpriteColor.fixed.ul);
+				color_ur = Color::Mul(color_ur, SpriteColor.fixed.ur);
+			}
+
+			instanceParameter.Colors[0] = color_ll;
+			instanceParameter.Colors[1] = color_lr;
+			instanceParameter.Colors[2] = color_ul;
+			instanceParameter.Colors[3] = color_ur;
+
+			// Apply global Color
+			if (instance.m_pContainer->GetRootInstance()->IsGlobalColorSet)
+			{
+				instanceParameter.Colors[0] = Color::Mul(instanceParameter.Colors[0], instance.m_pContainer->GetRootInstance()->GlobalColor);
+				instanceParameter.Colors[1] = Color::Mul(instanceParameter.Colors[1], instance.m_pContainer->GetRootInstance()->GlobalColor);
+				instanceParameter.Colors[2] = Color::Mul(instanceParameter.Colors[2], instance.m_pContainer->GetRootInstance()->GlobalColor);
+				instanceParameter.Colors[3] = Color::Mul(instanceParameter.Colors[3], instance.m_pContainer->GetRootInstance()->GlobalColor);
+			}
+
+			if (SpritePosition.type == SpritePosition.Default)
+			{
+				instanceParameter.Positions[0] = {-0.5f, -0.5f};
+				instanceParameter.Positions[1] = {0.5f, -0.5f};
+				instanceParameter.Positions[2] = {-0.5f, 0.5f};
+				instanceParameter.Positions[3] = {0.5f, 0.5f};
+			}
+			else if (SpritePosition.type == SpritePosition.Fixed)
+			{
+				instanceParameter.Positions[0] = SpritePosition.fixed.ll;
+				instanceParameter.Positions[1] = SpritePosition.fixed.lr;
+				instanceParameter.Positions[2] = SpritePosition.fixed.ul;
+				instanceParameter.Positions[3] = SpritePosition.fixed.ur;
+			}
+
+			instanceParameter.UV = instance.GetUV(0);
+			instanceParameter.AlphaUV = instance.GetUV(1);
+			instanceParameter.UVDistortionUV = instance.GetUV(2);
+			instanceParameter.BlendUV = instance.GetUV(3);
+			instanceParameter.BlendAlphaUV = instance.GetUV(4);
+			instanceParameter.BlendUVDistortionUV = instance.GetUV(5);
+
+			instanceParameter.FlipbookIndexAndNextRate = instance.m_flipbookIndexAndNextRate;
+
+			instanceParameter.AlphaThreshold = instance.m_AlphaThreshold;
+
+			if (nodeParameter.EnableViewOffset)
+			{
+				instanceParameter.ViewOffsetDistance = instance.translation_values.view_offset.distance;
+			}
+
+			CalcCustomData(&instance, instanceParameter.CustomData1, instanceParameter.CustomData2);
 		}
 
-		instanceParameter.UV = instance.GetUV(0);
-		instanceParameter.AlphaUV = instance.GetUV(1);
-		instanceParameter.UVDistortionUV = instance.GetUV(2);
-		instanceParameter.BlendUV = instance.GetUV(3);
-		instanceParameter.BlendAlphaUV = instance.GetUV(4);
-		instanceParameter.BlendUVDistortionUV = instance.GetUV(5);
-
-		instanceParameter.FlipbookIndexAndNextRate = instance.m_flipbookIndexAndNextRate;
-
-		instanceParameter.AlphaThreshold = instance.m_AlphaThreshold;
-
-		if (nodeParameter.EnableViewOffset)
-		{
-			instanceParameter.ViewOffsetDistance = instance.translation_values.view_offset.distance;
-		}
-
-		CalcCustomData(&instance, instanceParameter.CustomData1, instanceParameter.CustomData2);
-
 		nodeParameter.UserData = GetRenderingUserData();
 
-		renderer->Rendering(nodeParameter, instanceParameter, userData);
+		renderer->Rendering(nodeParameter, instanceParameters_.data(), count, userData);
 	}
 }
 
@@ -413,6 +420,32 @@ void EffectNodeSprite::UpdateRenderedInstance(Instance& instance, InstanceGroup&
 	instance.ColorInheritance = instValues._color;
 }
 
+float EffectNodeSprite::GetRenderedRadius() const
+{
+	if (IsRenderedPositionMoved())
+	{
+		return -1.0f;
+	}
+
+	if (SpritePosition.type == SpritePosition.Fixed)
+	{
+		float squaredRadius = 0.0f;
+		for (const auto& v : {SpritePosition.fixed.ll, SpritePosition.fixed.lr, SpritePosition.fixed.ul, SpritePosition.fixed.ur})
+		{
+			squaredRadius = std::max(squaredRadius, v.GetX() * v.GetX() + v.GetY() * v.GetY());
+		}
+		return std::sqrt(squaredRadius);
+	}
+
+	// a quad from -0.5 to 0.5
+	return std::sqrt(0.5f);
+}
+
+int32_t EffectNodeSprite::EstimateRenderedVertexCount(int32_t instanceCount) const
+{
+	return instanceCount * 4;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 // Include
 //----------------------------------------------------------------------------------
 #include "Effekseer.EffectNode.h"
+#include "Renderer/Effekseer.SpriteRenderer.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -131,6 +132,8 @@ public:
 
 	int SpriteTexture;
 
+	CustomAlignedVector<SpriteRenderer::InstanceParameter> instanceParameters_;
+
 	EffectNodeSprite(Effect* effect, unsigned char*& pos)
 		: EffectNodeImplemented(effect, pos)
 	{
@@ -140,7 +143,7 @@ public:
 
 	void BeginRendering(int32_t count, Manager* manager, void* userData) override;
 
-	void Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData) override;
+	void Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData) override;
 
 	void EndRendering(Manager* manager, void* userData) override;
 
@@ -148,6 +151,10 @@ public:
 
 	void UpdateRenderedInstance(Instance& instance, InstanceGroup& instanceGroup, Manager* manager) override;
 
+	float GetRenderedRadius() const override;
+
+	int32_t EstimateRenderedVertexCount(int32_t instanceCount) const override;
+
 	eEffectNodeType GetType() const override
 	{
 		return EFFECT_NODE_TYPE_SPRITE;
@@ -153,38 +153,48 @@ void EffectNodeTrack::EndRenderingGroup(InstanceGroup* group, Manager* manager,
 	}
 }
 
-void EffectNodeTrack::Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData)
+void EffectNodeTrack::Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData)
 {
 	TrackRendererRef renderer = manager->GetTrackRenderer();
 	if (renderer != nullptr)
 	{
-		float t = (float)instance.m_LivingTime / (float)instance.m_LivedTime;
-		int32_t time = (int32_t)instance.m_LivingTime;
-		int32_t livedTime = (int32_t)instance.m_LivedTime;
-
-		SetValues(m_instanceParameter.ColorLeft, instance, m_currentGroupValues.ColorLeft, TrackColorLeft, time, livedTime);
-		SetValues(m_instanceParameter.ColorCenter, instance, m_currentGroupValues.ColorCenter, TrackColorCenter, time, livedTime);
-		SetValues(m_instanceParameter.ColorRight, instance, m_currentGroupValues.ColorRight, TrackColorRight, time, livedTime);
-
-		SetValues(
-			m_instanceParameter.ColorLeftMiddle, instance, m_currentGroupValues.ColorLeftMiddle, TrackColorLeftMiddle, time, livedTime);
-		SetValues(m_instanceParameter.ColorCenterMiddle,
-				  instance,
-				  m_currentGroupValues.ColorCenterMiddle,
-				  TrackColorCenterMiddle,
-				  time,
-				  livedTime);
-		SetValues(
-			m_instanceParameter.ColorRightMiddle, instance, m_currentGroupValues.ColorRightMiddle, TrackColorRightMiddle, time, livedTime);
-
-		SetValues(m_instanceParameter.SizeFor, m_currentGroupValues.SizeFor, TrackSizeFor, t);
-		SetValues(m_instanceParameter.SizeMiddle, m_currentGroupValues.SizeMiddle, TrackSizeMiddle, t);
-		SetValues(m_instanceParameter.SizeBack, m_currentGroupValues.SizeBack, TrackSizeBack, t);
-
-		m_instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
-
-		renderer->Rendering(m_nodeParameter, m_instanceParameter, userData);
-		m_instanceParameter.InstanceIndex++;
+		instanceParameters_.resize(count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			const Instance& instance = *instances[i];
+			TrackRenderer::InstanceParameter& instanceParameter = instanceParameters_[i];
+			instanceParameter = m_instanceParameter;
+			instanceParameter.InstanceIndex += i;
+
+			float t = (float)instance.m_LivingTime / (float)instance.m_LivedTime;
+			int32_t time = (int32_t)instance.m_LivingTime;
+			int32_t livedTime = (int32_t)instance.m_LivedTime;
+
+			SetValues(instanceParameter.ColorLeft, instance, m_currentGroupValues.ColorLeft, TrackColorLeft, time, livedTime);
+			SetValues(instanceParameter.ColorCenter, instance, m_currentGroupValues.ColorCenter, TrackColorCenter, time, livedTime);
+			SetValues(instanceParameter.ColorRight, instance, m_currentGroupValues.ColorRight, TrackColorRight, time, livedTime);
+
+			SetValues(
+				instanceParameter.ColorLeftMiddle, instance, m_currentGroupValues.ColorLeftMiddle, TrackColorLeftMiddle, time, livedTime);
+			SetValues(instanceParameter.ColorCenterMiddle,
+					  instance,
+					  m_currentGroupValues.ColorCenterMiddle,
+					  TrackColorCenterMiddle,
+					  time,
+					  livedTime);
+			SetValues(
+				instanceParameter.ColorRightMiddle, instance, m_currentGroupValues.ColorRightMiddle, TrackColorRightMiddle, time, livedTime);
+
+			SetValues(instanceParameter.SizeFor, m_currentGroupValues.SizeFor, TrackSizeFor, t);
+			SetValues(instanceParameter.SizeMiddle, m_currentGroupValues.SizeMiddle, TrackSizeMiddle, t);
+			SetValues(instanceParameter.SizeBack, m_currentGroupValues.SizeBack, TrackSizeBack, t);
+
+			instanceParameter.SRTMatrix43 = instance.GetGlobalMatrix43();
+		}
+
+		renderer->Rendering(m_nodeParameter, instanceParameters_.data(), count, userData);
+		m_instanceParameter.InstanceIndex += count;
 	}
 }
 
@@ -367,6 +377,11 @@ void EffectNodeTrack::LoadValues(TrackSizeParameter& param, unsigned char*& pos)
 	}
 }
 
+int32_t EffectNodeTrack::EstimateRenderedVertexCount(int32_t instanceCount) const
+{
+	return std::max(instanceCount - 1, 0) * SplineDivision * 8;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -119,6 +119,7 @@ public:
 
 	TrackRenderer::NodeParameter m_nodeParameter;
 	TrackRenderer::InstanceParameter m_instanceParameter;
+	CustomAlignedVector<TrackRenderer::InstanceParameter> instanceParameters_;
 
 	InstanceGroupValues m_currentGroupValues;
 
@@ -161,7 +162,7 @@ public:
 
 	void EndRenderingGroup(InstanceGroup* group, Manager* manager, void* userData) override;
 
-	void Rendering(const Instance& instance, const Instance* next_instance, Manager* manager, void* userData) override;
+	void Rendering(const Instance* const* instances, int32_t count, Manager* manager, void* userData) override;
 
 	void EndRendering(Manager* manager, void* userData) override;
 
@@ -171,6 +172,8 @@ public:
 
 	void UpdateRenderedInstance(Instance& instance, InstanceGroup& instanceGroup, Manager* manager) override;
 
+	int32_t EstimateRenderedVertexCount(int32_t instanceCount) const override;
+
 	eEffectNodeType GetType() const override
 	{
 		return EFFECT_NODE_TYPE_TRACK;
@@ -891,6 +891,23 @@ void Instance::FirstUpdate()
 //
 //----------------------------------------------------------------------------------
 void Instance::Update(float deltaFrame, bool shown)
+{
+	BeginUpdate(deltaFrame);
+
+	if (shown)
+	{
+		CalculateMatrix(deltaFrame);
+	}
+	else if (m_pEffectNode->LocalForceField.HasValue)
+	{
+		// If attraction forces are not default, updating is needed in each frame.
+		CalculateMatrix(deltaFrame);
+	}
+
+	EndUpdate(deltaFrame);
+}
+
+void Instance::BeginUpdate(float deltaFrame)
 {
 	assert(this->m_pContainer != nullptr);
 
@@ -903,7 +920,10 @@ void Instance::Update(float deltaFrame, bool shown)
 	m_GlobalMatrix43Calculated = false;
 	m_ParentMatrix43Calculated = false;
 
-	if (is_time_step_allowed && m_pEffectNode->GetType() != EFFECT_NODE_TYPE_ROOT)
+	// sounds, UVs and alpha cutoffs are skipped while fast-forwarding, but matrices and colors are needed to spawn children
+	const bool isPrewarming = m_pContainer->GetRootInstance()->IsPrewarming;
+
+	if (is_time_step_allowed && m_pEffectNode->GetType() != EFFECT_NODE_TYPE_ROOT && !isPrewarming)
 	{
 		/* 音の更新(現状放置) */
 		if (m_pEffectNode->SoundType == ParameterSoundType_Use)
@@ -925,16 +945,11 @@ void Instance::Update(float deltaFrame, bool shown)
 	{
 		m_LivingTime += deltaFrame;
 	}
+}
 
-	if (shown)
-	{
-		CalculateMatrix(deltaFrame);
-	}
-	else if (m_pEffectNode->LocalForceField.HasValue)
-	{
-		// If attraction forces are not default, updating is needed in each frame.
-		CalculateMatrix(deltaFrame);
-	}
+void Instance::EndUpdate(float deltaFrame)
+{
+	const bool isPrewarming = m_pContainer->GetRootInstance()->IsPrewarming;
 
 	// Get parent color.
 	if (m_pParent != nullptr)
@@ -990,6 +1005,7 @@ void Instance::Update(float deltaFrame, bool shown)
 		}
 	}
 
+	if (!isPrewarming)
 	{
 		auto& CommonValue = m_pEffectNode->RendererCommon;
 		auto& UV = CommonValue.UVs[0];
@@ -1040,7 +1056,7 @@ void Instance::Update(float deltaFrame, bool shown)
 		}
 	}
 
-	if (m_pEffectNode->m_effect->GetVersion() >= 1600)
+	if (m_pEffectNode->m_effect->GetVersion() >= 1600 && !isPrewarming)
 	{
 		auto effect = this->m_pEffectNode->m_effect;
 		auto instanceGlobal = this->m_pContainer->GetRootInstance();
@@ -1456,6 +1472,307 @@ void Instance::CalculateMatrix(float deltaFrame)
 	m_GlobalMatrix43Calculated = true;
 }
 
+//! the number of instances which are calculated in InstanceMatrixBatch at once
+static const int32_t MatrixBatchMax = 16;
+
+template <ParameterTranslationType TranslationType, ParameterRotationType RotationType, ParameterScalingType ScalingType>
+struct InstanceMatrixBatch
+{
+	//! the same as CalculateMatrix with the types for instances of the same node
+	static void Calculate(Instance* const* instances, const float* deltaFrames, int32_t count)
+	{
+		assert(count <= MatrixBatchMax);
+
+		const auto& kernels = instances[0]->m_pManager->GetKernels();
+		const auto sequenceNumber = instances[0]->m_pManager->GetSequenceNumber();
+
+		std::array<float, MatrixBatchMax> times;
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			auto instance = instances[i];
+			instance->m_sequenceNumber = sequenceNumber;
+
+			if (instance->m_pParent != nullptr)
+			{
+				instance->CalculateParentMatrix(deltaFrames[i]);
+			}
+
+			times[i] = instance->m_LivingTime;
+		}
+
+		// gather values of all instances and integrate PVA at once
+		std::array<SIMD::Vec3f, MatrixBatchMax> positions;
+		std::array<SIMD::Vec3f, MatrixBatchMax> angles;
+		std::array<SIMD::Vec3f, MatrixBatchMax> scales;
+		std::array<SIMD::Vec3f, MatrixBatchMax> velocities;
+		std::array<SIMD::Vec3f, MatrixBatchMax> accelerations;
+
+		if (TranslationType == ParameterTranslationType_Fixed)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				instances[i]->ApplyDynamicParameterToFixedLocation();
+				positions[i] = instances[i]->translation_values.fixed.location;
+			}
+		}
+		else if (TranslationType == ParameterTranslationType_PVA)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				positions[i] = instances[i]->translation_values.random.location;
+				velocities[i] = instances[i]->translation_values.random.velocity;
+				accelerations[i] = instances[i]->translation_values.random.acceleration;
+			}
+
+			IntegratePVA(kernels, positions, velocities, accelerations, times, count);
+		}
+		else
+		{
+			std::fill(positions.begin(), positions.begin() + count, SIMD::Vec3f(0, 0, 0));
+		}
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			instances[i]->prevPosition_ = positions[i];
+			positions[i] += instances[i]->m_GenerationLocation.GetTranslation();
+		}
+
+		if (RotationType == ParameterRotationType_Fixed)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				instances[i]->ApplyDynamicParameterToFixedRotation();
+				angles[i] = instances[i]->rotation_values.fixed.rotation;
+			}
+		}
+		else if (RotationType == ParameterRotationType_PVA)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				angles[i] = instances[i]->rotation_values.random.rotation;
+				velocities[i] = instances[i]->rotation_values.random.velocity;
+				accelerations[i] = instances[i]->rotation_values.random.acceleration;
+			}
+
+			IntegratePVA(kernels, angles, velocities, accelerations, times, count);
+		}
+
+		if (ScalingType == ParameterScalingType_Fixed)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				instances[i]->ApplyDynamicParameterToFixedScaling();
+				scales[i] = instances[i]->scaling_values.fixed.scale;
+			}
+		}
+		else if (ScalingType == ParameterScalingType_PVA)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				scales[i] = instances[i]->scaling_values.random.scale;
+				velocities[i] = instances[i]->scaling_values.random.velocity;
+				accelerations[i] = instances[i]->scaling_values.random.acceleration;
+			}
+
+			IntegratePVA(kernels, scales, velocities, accelerations, times, count);
+		}
+		else if (ScalingType == ParameterScalingType_SinglePVA)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				const auto& values = instances[i]->scaling_values.single_random;
+				const float t = times[i];
+				const float s = values.scale + values.velocity * t + values.acceleration * t * t * 0.5f;
+				scales[i] = {s, s, s};
+			}
+		}
+		else
+		{
+			std::fill(scales.begin(), scales.begin() + count, SIMD::Vec3f(1.0f, 1.0f, 1.0f));
+		}
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			instances[i]->m_pEffectNode->UpdateRenderedInstance(*instances[i], *instances[i]->ownGroup_, instances[i]->m_pManager);
+		}
+
+		// compose local matrices and multiply them with parent matrices at once
+		std::array<SIMD::Mat43f, MatrixBatchMax> matrices;
+		std::array<SIMD::Mat43f, MatrixBatchMax> parentMatrices;
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			auto instance = instances[i];
+			positions[i] += instance->forceField_.ModifyLocation;
+
+			if (RotationType == ParameterRotationType_None)
+			{
+				matrices[i] = SIMD::Mat43f::SRT(scales[i], SIMD::Mat43f::Identity, positions[i]);
+			}
+			else
+			{
+				const auto rotation = SIMD::Mat43f::RotationZXY(angles[i].GetZ(), angles[i].GetX(), angles[i].GetY());
+				matrices[i] = SIMD::Mat43f::SRT(scales[i], rotation, positions[i]);
+			}
+			assert(matrices[i].IsValid());
+
+			parentMatrices[i] = instance->m_ParentMatrix;
+		}
+
+		kernels.MultiplyMat43(reinterpret_cast<float*>(matrices.data()), reinterpret_cast<const float*>(matrices.data()), reinterpret_cast<const float*>(parentMatrices.data()), count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			auto instance = instances[i];
+			instance->m_GlobalMatrix43 = matrices[i];
+			assert(instance->m_GlobalMatrix43.IsValid());
+
+			instance->prevGlobalPosition_ = instance->m_GlobalMatrix43.GetTranslation();
+			instance->m_GlobalMatrix43Calculated = true;
+		}
+	}
+
+	static void IntegratePVA(const SIMD::Kernels& kernels,
+							 std::array<SIMD::Vec3f, MatrixBatchMax>& values,
+							 const std::array<SIMD::Vec3f, MatrixBatchMax>& velocities,
+							 const std::array<SIMD::Vec3f, MatrixBatchMax>& accelerations,
+							 const std::array<float, MatrixBatchMax>& times,
+							 int32_t count)
+	{
+		static_assert(sizeof(SIMD::Vec3f) == sizeof(float) * 4, "Vec3f must be 4 floats for kernels");
+
+		kernels.IntegratePVA(reinterpret_cast<float*>(values.data()),
+							 reinterpret_cast<const float*>(values.data()),
+							 reinterpret_cast<const float*>(velocities.data()),
+							 reinterpret_cast<const float*>(accelerations.data()),
+							 times.data(),
+							 count);
+	}
+};
+
+using MatrixBatchFunc = void (*)(Instance* const* instances, const float* deltaFrames, int32_t count);
+
+template <ParameterTranslationType TranslationType, ParameterRotationType RotationType>
+static MatrixBatchFunc SelectMatrixBatch(ParameterScalingType scalingType)
+{
+	switch (scalingType)
+	{
+	case ParameterScalingType_None:
+		return InstanceMatrixBatch<TranslationType, RotationType, ParameterScalingType_None>::Calculate;
+	case ParameterScalingType_Fixed:
+		return InstanceMatrixBatch<TranslationType, RotationType, ParameterScalingType_Fixed>::Calculate;
+	case ParameterScalingType_PVA:
+		return InstanceMatrixBatch<TranslationType, RotationType, ParameterScalingType_PVA>::Calculate;
+	case ParameterScalingType_SinglePVA:
+		return InstanceMatrixBatch<TranslationType, RotationType, ParameterScalingType_SinglePVA>::Calculate;
+	default:
+		return nullptr;
+	}
+}
+
+template <ParameterTranslationType TranslationType>
+static MatrixBatchFunc SelectMatrixBatch(ParameterRotationType rotationType, ParameterScalingType scalingType)
+{
+	switch (rotationType)
+	{
+	case ParameterRotationType_None:
+		return SelectMatrixBatch<TranslationType, ParameterRotationType_None>(scalingType);
+	case ParameterRotationType_Fixed:
+		return SelectMatrixBatch<TranslationType, ParameterRotationType_Fixed>(scalingType);
+	case ParameterRotationType_PVA:
+		return SelectMatrixBatch<TranslationType, ParameterRotationType_PVA>(scalingType);
+	default:
+		return nullptr;
+	}
+}
+
+//! get a function for the types of parameters of the node. nullptr is returned if it is not supported
+static MatrixBatchFunc SelectMatrixBatch(const EffectNodeImplemented* node)
+{
+	switch (node->TranslationType)
+	{
+	case ParameterTranslationType_None:
+		return SelectMatrixBatch<ParameterTranslationType_None>(node->RotationType, node->ScalingType);
+	case ParameterTranslationType_Fixed:
+		return SelectMatrixBatch<ParameterTranslationType_Fixed>(node->RotationType, node->ScalingType);
+	case ParameterTranslationType_PVA:
+		return SelectMatrixBatch<ParameterTranslationType_PVA>(node->RotationType, node->ScalingType);
+	default:
+		return nullptr;
+	}
+}
+
+bool Instance::IsMatrixBatchable() const
+{
+	if (IsFirstTime())
+	{
+		return false;
+	}
+
+	const auto node = m_pEffectNode;
+	const auto nodeType = node->GetType();
+
+	// ribbons and tracks refer times of other instances
+	if (nodeType == EFFECT_NODE_TYPE_ROOT || nodeType == EFFECT_NODE_TYPE_RIBBON || nodeType == EFFECT_NODE_TYPE_TRACK)
+	{
+		return false;
+	}
+
+	if (node->LocalForceField.HasValue || node->LocalForceField.IsGlobalEnabled || node->GenerationLocation.EffectsRotation)
+	{
+		return false;
+	}
+
+	if (node->CommonValues.TranslationBindType == TranslationParentBindType::NotBind_FollowParent ||
+		node->CommonValues.TranslationBindType == TranslationParentBindType::WhenCreating_FollowParent)
+	{
+		return false;
+	}
+
+	return SelectMatrixBatch(node) != nullptr;
+}
+
+void Instance::CalculateMatrices(Instance* const* instances, const float* deltaFrames, int32_t count)
+{
+	std::array<Instance*, MatrixBatchMax> nodeInstances;
+	std::array<float, MatrixBatchMax> nodeDeltaFrames;
+	std::array<bool, MatrixBatchMax> processed;
+	processed.fill(false);
+
+	for (int32_t offset = 0; offset < count; offset += MatrixBatchMax)
+	{
+		const int32_t blockCount = std::min(count - offset, MatrixBatchMax);
+
+		// calculate instances of the same node together
+		for (int32_t i = 0; i < blockCount; i++)
+		{
+			if (processed[i])
+			{
+				continue;
+			}
+
+			const auto node = instances[offset + i]->m_pEffectNode;
+			int32_t nodeCount = 0;
+
+			for (int32_t j = i; j < blockCount; j++)
+			{
+				if (!processed[j] && instances[offset + j]->m_pEffectNode == node)
+				{
+					nodeInstances[nodeCount] = instances[offset + j];
+					nodeDeltaFrames[nodeCount] = deltaFrames[offset + j];
+					nodeCount++;
+					processed[j] = true;
+				}
+			}
+
+			SelectMatrixBatch(node)(nodeInstances.data(), nodeDeltaFrames.data(), nodeCount);
+		}
+
+		processed.fill(false);
+	}
+}
+
 void Instance::CalculateParentMatrix(float deltaFrame)
 {
 	// 計算済なら終了
@@ -1510,6 +1827,117 @@ void Instance::CalculateParentMatrix(float deltaFrame)
 	m_ParentMatrix43Calculated = true;
 }
 
+void Instance::ReplaceEffectNode(EffectNodeImplemented* effectNode)
+{
+	m_pEffectNode = effectNode;
+
+	if (m_pEffectNode->TranslationType == ParameterTranslationType_Fixed)
+	{
+		translation_values.fixed.location = m_pEffectNode->TranslationFixed.Position;
+		ApplyDynamicParameterToFixedLocation();
+	}
+
+	if (m_pEffectNode->RotationType == ParameterRotationType_Fixed)
+	{
+		rotation_values.fixed.rotation = m_pEffectNode->RotationFixed.Position;
+		ApplyDynamicParameterToFixedRotation();
+	}
+
+	if (m_pEffectNode->ScalingType == ParameterScalingType_Fixed)
+	{
+		scaling_values.fixed.scale = m_pEffectNode->ScalingFixed.Position;
+		ApplyDynamicParameterToFixedScaling();
+	}
+
+	m_pEffectNode->InitializeRenderedInstance(*this, *ownGroup_, m_pManager);
+}
+
+void Instance::SaveState(State& state) const
+{
+	state.CustomDataValues1 = customDataValues1;
+	state.CustomDataValues2 = customDataValues2;
+	state.PrevPosition = prevPosition_;
+	state.PrevGlobalPosition = prevGlobalPosition_;
+	state.ParentPosition = parentPosition_;
+	state.SteeringVec = steeringVec_;
+	state.RandomSeed = m_randObject.GetSeed();
+	state.ForceField = forceField_;
+	state.ColorInheritance = ColorInheritance;
+	state.ColorParent = ColorParent;
+	state.FollowParentParam = followParentParam;
+	state.TranslationValues = translation_values;
+	state.RotationValues = rotation_values;
+	state.ScalingValues = scaling_values;
+	state.RendererValues = rendererValues;
+	state.SoundValues = soundValues;
+	state.InstanceState = m_State;
+	state.LivedTime = m_LivedTime;
+	state.LivingTime = m_LivingTime;
+
+	for (int32_t i = 0; i < ParameterRendererCommon::UVParameterNum; i++)
+	{
+		state.UVTimeOffsets[i] = uvTimeOffsets[i];
+		state.UVAreaOffsets[i] = uvAreaOffsets[i];
+		state.UVScrollSpeeds[i] = uvScrollSpeeds[i];
+	}
+
+	state.GenerationLocation = m_GenerationLocation;
+	state.GlobalMatrix43 = m_GlobalMatrix43;
+	state.ParentMatrix = m_ParentMatrix;
+	state.IsFirstTime = m_IsFirstTime;
+	state.GlobalMatrix43Calculated = m_GlobalMatrix43Calculated;
+	state.ParentMatrix43Calculated = m_ParentMatrix43Calculated;
+	state.IsTimeStepAllowed = is_time_step_allowed;
+	state.InstanceNumber = m_InstanceNumber;
+	state.SequenceNumber = m_sequenceNumber;
+	state.FlipbookIndexAndNextRate = m_flipbookIndexAndNextRate;
+	state.AlphaCutoffValues = alpha_cutoff_values;
+	state.AlphaThreshold = m_AlphaThreshold;
+}
+
+void Instance::LoadState(const State& state)
+{
+	customDataValues1 = state.CustomDataValues1;
+	customDataValues2 = state.CustomDataValues2;
+	prevPosition_ = state.PrevPosition;
+	prevGlobalPosition_ = state.PrevGlobalPosition;
+	parentPosition_ = state.ParentPosition;
+	steeringVec_ = state.SteeringVec;
+	m_randObject.SetSeed(state.RandomSeed);
+	forceField_ = state.ForceField;
+	ColorInheritance = state.ColorInheritance;
+	ColorParent = state.ColorParent;
+	followParentParam = state.FollowParentParam;
+	translation_values = state.TranslationValues;
+	rotation_values = state.RotationValues;
+	scaling_values = state.ScalingValues;
+	rendererValues = state.RendererValues;
+	soundValues = state.SoundValues;
+	m_State = state.InstanceState;
+	m_LivedTime = state.LivedTime;
+	m_LivingTime = state.LivingTime;
+
+	for (int32_t i = 0; i < ParameterRendererCommon::UVParameterNum; i++)
+	{
+		uvTimeOffsets[i] = state.UVTimeOffsets[i];
+		uvAreaOffsets[i] = state.UVAreaOffsets[i];
+		uvScrollSpeeds[i] = state.UVScrollSpeeds[i];
+	}
+
+	m_GenerationLocation = state.GenerationLocation;
+	m_GlobalMatrix43 = state.GlobalMatrix43;
+	m_ParentMatrix = state.ParentMatrix;
+	m_IsFirstTime = state.IsFirstTime;
+	m_GlobalMatrix43Calculated = state.GlobalMatrix43Calculated;
+	m_ParentMatrix43Calculated = state.ParentMatrix43Calculated;
+	is_time_step_allowed = state.IsTimeStepAllowed;
+	m_InstanceNumber = state.InstanceNumber;
+	m_sequenceNumber = state.SequenceNumber;
+	m_flipbookIndexAndNextRate = state.FlipbookIndexAndNextRate;
+	alpha_cutoff_values = state.AlphaCutoffValues;
+	m_AlphaThreshold = state.AlphaThreshold;
+}
+
 void Instance::ApplyDynamicParameterToFixedLocation()
 {
 	if (m_pEffectNode->TranslationFixed.RefEq >= 0)
@@ -1555,24 +1983,6 @@ void Instance::ApplyDynamicParameterToFixedScaling()
 	}
 }
 
-//----------------------------------------------------------------------------------
-//
-//----------------------------------------------------------------------------------
-void Instance::Draw(Instance* next, void* userData)
-{
-	assert(m_pEffectNode != nullptr);
-
-	if (!m_pEffectNode->IsRendered)
-		return;
-
-	if (m_sequenceNumber != ((ManagerImplemented*)m_pManager)->GetSequenceNumber())
-	{
-		CalculateMatrix(0);
-	}
-
-	m_pEffectNode->Rendering(*this, next, m_pManager, userData);
-}
-
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
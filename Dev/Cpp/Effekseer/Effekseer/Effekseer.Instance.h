@@ -59,6 +59,9 @@ struct InstanceCustomData
 	};
 };
 
+template <ParameterTranslationType TranslationType, ParameterRotationType RotationType, ParameterScalingType ScalingType>
+struct InstanceMatrixBatch;
+
 /**
 	@brief	エフェクトの実体
 */
@@ -67,6 +70,9 @@ class alignas(16) Instance : public IntrusiveList<Instance>::Node
 	friend class Manager;
 	friend class InstanceContainer;
 
+	template <ParameterTranslationType TranslationType, ParameterRotationType RotationType, ParameterScalingType ScalingType>
+	friend struct InstanceMatrixBatch;
+
 protected:
 	//! custom data
 	InstanceCustomData customDataValues1;
@@ -335,6 +341,45 @@ public:
 
 	float m_AlphaThreshold;
 
+	//! a state saved in a snapshot. it has no pointer, so it is restored into an instance created with the constructor
+	struct State
+	{
+		InstanceCustomData CustomDataValues1;
+		InstanceCustomData CustomDataValues2;
+		SIMD::Vec3f PrevPosition;
+		SIMD::Vec3f PrevGlobalPosition;
+		SIMD::Vec3f ParentPosition;
+		SIMD::Vec3f SteeringVec;
+		int32_t RandomSeed;
+		LocalForceFieldInstance ForceField;
+		Color ColorInheritance;
+		Color ColorParent;
+		decltype(followParentParam) FollowParentParam;
+		decltype(translation_values) TranslationValues;
+		decltype(rotation_values) RotationValues;
+		decltype(scaling_values) ScalingValues;
+		decltype(rendererValues) RendererValues;
+		decltype(soundValues) SoundValues;
+		eInstanceState InstanceState;
+		float LivedTime;
+		float LivingTime;
+		std::array<int32_t, ParameterRendererCommon::UVParameterNum> UVTimeOffsets;
+		std::array<RectF, ParameterRendererCommon::UVParameterNum> UVAreaOffsets;
+		std::array<SIMD::Vec2f, ParameterRendererCommon::UVParameterNum> UVScrollSpeeds;
+		SIMD::Mat43f GenerationLocation;
+		SIMD::Mat43f GlobalMatrix43;
+		SIMD::Mat43f ParentMatrix;
+		bool IsFirstTime;
+		bool GlobalMatrix43Calculated;
+		bool ParentMatrix43Calculated;
+		bool IsTimeStepAllowed;
+		int32_t InstanceNumber;
+		uint32_t SequenceNumber;
+		float FlipbookIndexAndNextRate;
+		decltype(alpha_cutoff_values) AlphaCutoffValues;
+		float AlphaThreshold;
+	};
+
 	// コンストラクタ
 	Instance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup);
 
@@ -378,10 +423,22 @@ public:
 	*/
 	void Update(float deltaFrame, bool shown);
 
+	//! the first part of Update before a matrix is calculated
+	void BeginUpdate(float deltaFrame);
+
+	//! the last part of Update after a matrix is calculated
+	void EndUpdate(float deltaFrame);
+
+	//! whether a matrix in this frame can be calculated with CalculateMatrices. It must be checked before BeginUpdate
+	bool IsMatrixBatchable() const;
+
 	/**
-		@brief	Draw instance
+		@brief	calculate matrices of batchable instances at once instead of CalculateMatrix
+		@note
+		Translations, rotations and scales of instances of the same node are gathered into arrays
+		and the matrices are composed with SIMD::Kernels in a function specialized for the types of parameters.
 	*/
-	void Draw(Instance* next, void* userData);
+	static void CalculateMatrices(Instance* const* instances, const float* deltaFrames, int32_t count);
 
 	/**
 		@brief	破棄
@@ -404,6 +461,15 @@ public:
 
 	bool AreChildrenActive() const;
 
+	//! replace a node with a reloaded node and apply values which are decided when the instance is generated
+	void ReplaceEffectNode(EffectNodeImplemented* effectNode);
+
+	//! save values except pointers
+	void SaveState(State& state) const;
+
+	//! restore values saved with SaveState. pointers are assigned by the constructor or a caller
+	void LoadState(const State& state);
+
 private:
 	/**
 		@brief	行列の更新
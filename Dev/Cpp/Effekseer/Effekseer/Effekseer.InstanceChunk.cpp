@@ -1,12 +1,21 @@
 ﻿
 
 #include "Effekseer.InstanceChunk.h"
+#include "Effekseer.InstanceContainer.h"
 #include "Effekseer.InstanceGlobal.h"
+#include "Effekseer.ManagerImplemented.h"
 #include <assert.h>
+#include <chrono>
 
 namespace Effekseer
 {
 
+//! get a time in nanoseconds to profile updates of instances
+static int64_t GetProfilingTime()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 InstanceChunk::InstanceChunk()
 {
 	std::fill(instancesAlive_.begin(), instancesAlive_.end(), false);
@@ -17,64 +26,149 @@ InstanceChunk::~InstanceChunk()
 }
 
 void InstanceChunk::UpdateInstances()
+{
+	UpdateInstancesInternal(nullptr);
+}
+
+void InstanceChunk::GenerateChildrenInRequired()
 {
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
 		if (instancesAlive_[i])
 		{
-			Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
-
-			if (instance->m_State == INSTANCE_STATE_ACTIVE)
-			{
-				auto deltaTime = instance->GetInstanceGlobal()->GetNextDeltaFrame();
+			auto instance = reinterpret_cast<Instance*>(instances_[i]);
 
-				instance->Update(deltaTime, true);
-			}
-			else if (instance->m_State == INSTANCE_STATE_REMOVING)
-			{
-				// start to remove
-				instance->m_State = INSTANCE_STATE_REMOVED;
-			}
-			else if (instance->m_State == INSTANCE_STATE_REMOVED)
-			{
-				instance->~Instance();
-				instancesAlive_[i] = false;
-				aliveCount_--;
-			}
+			instance->GenerateChildrenInRequired();
 		}
 	}
 }
 
-void InstanceChunk::GenerateChildrenInRequired()
+void InstanceChunk::UpdateInstancesByInstanceGlobal(const InstanceGlobal* global)
+{
+	UpdateInstancesInternal(global);
+}
+
+void InstanceChunk::GenerateChildrenInRequiredByInstanceGlobal(const InstanceGlobal* global)
 {
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
 		if (instancesAlive_[i])
 		{
-			auto instance = reinterpret_cast<Instance*>(instances_[i]);
+			Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
+
+			if (global != instance->GetInstanceGlobal())
+			{
+				continue;
+			}
 
 			instance->GenerateChildrenInRequired();
 		}
 	}
 }
 
-void InstanceChunk::UpdateInstancesByInstanceGlobal(const InstanceGlobal* global)
+void InstanceChunk::UpdateInstancesInternal(const InstanceGlobal* global)
 {
+	std::array<Instance*, InstancesOfChunk> batchedInstances;
+	std::array<float, InstancesOfChunk> batchedDeltaFrames;
+	std::array<bool, InstancesOfChunk> batched;
+	int32_t batchedCount = 0;
+	bool isProfiling = false;
+
+	// calculate matrices of instances which can be batched at once
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
 	{
+		batched[i] = false;
+
+		if (!instancesAlive_[i])
+		{
+			continue;
+		}
+
+		Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
+
+		if (global != nullptr && global != instance->GetInstanceGlobal())
+		{
+			continue;
+		}
+
+		isProfiling = instance->m_pManager->GetProfilingEnabled();
+
+		if (instance->m_State == INSTANCE_STATE_ACTIVE && instance->IsMatrixBatchable())
+		{
+			const auto beginTime = isProfiling ? GetProfilingTime() : 0;
+
+			auto deltaTime = instance->GetInstanceGlobal()->GetNextDeltaFrame();
+			instance->BeginUpdate(deltaTime);
+
+			if (isProfiling)
+			{
+				instance->m_pContainer->AddProfiledUpdateTime(GetProfilingTime() - beginTime);
+			}
+
+			batchedInstances[batchedCount] = instance;
+			batchedDeltaFrames[batchedCount] = deltaTime;
+			batchedCount++;
+			batched[i] = true;
+		}
+	}
+
+	if (batchedCount > 0)
+	{
+		const auto beginTime = isProfiling ? GetProfilingTime() : 0;
+
+		Instance::CalculateMatrices(batchedInstances.data(), batchedDeltaFrames.data(), batchedCount);
+
+		// a time of the batch is divided by instances equally
+		if (isProfiling)
+		{
+			const auto time = (GetProfilingTime() - beginTime) / batchedCount;
+			for (int32_t i = 0; i < batchedCount; i++)
+			{
+				batchedInstances[i]->m_pContainer->AddProfiledUpdateTime(time);
+			}
+		}
+	}
+
+	int32_t batchedIndex = 0;
+
+	for (int32_t i = 0; i < InstancesOfChunk; i++)
+	{
+		if (batched[i])
+		{
+			const auto beginTime = isProfiling ? GetProfilingTime() : 0;
+
+			auto instance = batchedInstances[batchedIndex];
+			instance->EndUpdate(batchedDeltaFrames[batchedIndex]);
+			batchedIndex++;
+
+			if (isProfiling)
+			{
+				instance->m_pContainer->AddProfiledUpdateTime(GetProfilingTime() - beginTime);
+			}
+			continue;
+		}
+
 		if (instancesAlive_[i])
 		{
 			Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
 
-			if (global != instance->GetInstanceGlobal())
+			if (global != nullptr && global != instance->GetInstanceGlobal())
 			{
 				continue;
 			}
 
 			if (instance->m_State == INSTANCE_STATE_ACTIVE)
 			{
-				auto deltaTime = global->GetNextDeltaFrame();
+				const auto beginTime = isProfiling ? GetProfilingTime() : 0;
+
+				auto deltaTime = instance->GetInstanceGlobal()->GetNextDeltaFrame();
+
 				instance->Update(deltaTime, true);
+
+				if (isProfiling)
+				{
+					instance->m_pContainer->AddProfiledUpdateTime(GetProfilingTime() - beginTime);
+				}
 			}
 			else if (instance->m_State == INSTANCE_STATE_REMOVING)
 			{
@@ -91,24 +185,6 @@ void InstanceChunk::UpdateInstancesByInstanceGlobal(const InstanceGlobal* global
 	}
 }
 
-void InstanceChunk::GenerateChildrenInRequiredByInstanceGlobal(const InstanceGlobal* global)
-{
-	for (int32_t i = 0; i < InstancesOfChunk; i++)
-	{
-		if (instancesAlive_[i])
-		{
-			Instance* instance = reinterpret_cast<Instance*>(instances_[i]);
-
-			if (global != instance->GetInstanceGlobal())
-			{
-				continue;
-			}
-
-			instance->GenerateChildrenInRequired();
-		}
-	}
-}
-
 Instance* InstanceChunk::CreateInstance(ManagerImplemented* pManager, EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup)
 {
 	for (int32_t i = 0; i < InstancesOfChunk; i++)
@@ -44,6 +44,9 @@ public:
 	}
 
 private:
+	//! update instances. if global is nullptr, all instances are updated
+	void UpdateInstancesInternal(const InstanceGlobal* global);
+
 	std::array<uint8_t[sizeof(Instance)], InstancesOfChunk> instances_;
 
 	//! flags whether are instances alive
@@ -13,6 +13,7 @@
 #include "Effekseer.EffectNode.h"
 
 #include "Renderer/Effekseer.SpriteRenderer.h"
+#include "Utils/Profiler.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -162,6 +163,8 @@ void InstanceContainer::Update(bool recursive, bool shown)
 	// 破棄
 	RemoveInvalidGroups();
 
+	CalculateBounds();
+
 	if (recursive)
 	{
 		for (auto child : m_Children)
@@ -171,6 +174,63 @@ void InstanceContainer::Update(bool recursive, bool shown)
 	}
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void InstanceContainer::CalculateBounds()
+{
+	hasBounds_ = false;
+	isBoundsUnknown_ = false;
+	renderedRadius_ = -1.0f;
+
+	if (m_pEffectNode->GetType() == EFFECT_NODE_TYPE_ROOT || m_pEffectNode->GetType() == EFFECT_NODE_TYPE_NONE || !m_pEffectNode->IsRendered)
+	{
+		return;
+	}
+
+	renderedRadius_ = m_pEffectNode->GetRenderedRadius();
+	if (renderedRadius_ < 0.0f)
+	{
+		isBoundsUnknown_ = true;
+		return;
+	}
+
+	const auto sequenceNumber = m_pManager->GetSequenceNumber();
+
+	for (InstanceGroup* group = m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+	{
+		for (auto instance : group->m_instances)
+		{
+			// matrices of instances which are not updated in this frame are calculated and added in drawing
+			if (instance->m_State == INSTANCE_STATE_ACTIVE && instance->m_sequenceNumber == sequenceNumber)
+			{
+				AddInstanceToBounds(instance);
+			}
+		}
+	}
+}
+
+void InstanceContainer::AddInstanceToBounds(const Instance* instance)
+{
+	const auto& mat = instance->GetGlobalMatrix43();
+	const auto scale = mat.GetScale();
+	const auto radius = renderedRadius_ * std::max(std::max(scale.GetX(), scale.GetY()), scale.GetZ());
+	const auto center = mat.GetTranslation();
+	const auto extent = SIMD::Vec3f(radius, radius, radius);
+
+	if (hasBounds_)
+	{
+		boundsMin_ = SIMD::Vec3f::Min(boundsMin_, center - extent);
+		boundsMax_ = SIMD::Vec3f::Max(boundsMax_, center + extent);
+	}
+	else
+	{
+		boundsMin_ = center - extent;
+		boundsMax_ = center + extent;
+		hasBounds_ = true;
+	}
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -182,6 +242,28 @@ void InstanceContainer::SetBaseMatrix(bool recursive, const SIMD::Mat43f& mat)
 		{
 			group->SetBaseMatrix(mat);
 		}
+
+		if (hasBounds_)
+		{
+			// transform the bounding box and calculate a bounding box which contains it
+			const auto center = (boundsMin_ + boundsMax_) * 0.5f;
+			const auto extent = (boundsMax_ - boundsMin_) * 0.5f;
+
+			SIMD::Float4 s0 = mat.X;
+			SIMD::Float4 s1 = mat.Y;
+			SIMD::Float4 s2 = mat.Z;
+			SIMD::Float4 s3 = SIMD::Float4::SetZero();
+			SIMD::Float4::Transpose(s0, s1, s2, s3);
+
+			SIMD::Float4 transformedExtent = SIMD::Float4::SetZero();
+			transformedExtent = SIMD::Float4::MulAddLane<0>(transformedExtent, SIMD::Float4::Abs(s0), extent.s);
+			transformedExtent = SIMD::Float4::MulAddLane<1>(transformedExtent, SIMD::Float4::Abs(s1), extent.s);
+			transformedExtent = SIMD::Float4::MulAddLane<2>(transformedExtent, SIMD::Float4::Abs(s2), extent.s);
+
+			const auto transformedCenter = SIMD::Vec3f::Transform(center, mat);
+			boundsMin_ = transformedCenter - SIMD::Vec3f{transformedExtent};
+			boundsMax_ = transformedCenter + SIMD::Vec3f{transformedExtent};
+		}
 	}
 
 	if (recursive)
@@ -220,80 +302,79 @@ void InstanceContainer::RemoveForcibly(bool recursive)
 //----------------------------------------------------------------------------------
 void InstanceContainer::Draw(bool recursive)
 {
-	if (m_pEffectNode->GetType() != EFFECT_NODE_TYPE_ROOT && m_pEffectNode->GetType() != EFFECT_NODE_TYPE_NONE)
+	if (m_pEffectNode->GetType() != EFFECT_NODE_TYPE_ROOT && m_pEffectNode->GetType() != EFFECT_NODE_TYPE_NONE && m_pEffectNode->IsRendered)
 	{
-		/* 個数計測 */
-		int32_t count = 0;
+		// collect active instances in rendering order to pass them to the node at once
+		auto& instances = m_pManager->renderingInstances_;
+		auto& groupEnds = m_pManager->renderingGroupEnds_;
+		instances.clear();
+		groupEnds.clear();
+
+		for (InstanceGroup* group = m_headGroups; group != nullptr; group = group->NextUsedByContainer)
 		{
-			for (InstanceGroup* group = m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+			if (m_pEffectNode->RenderingOrder == RenderingOrder_FirstCreatedInstanceIsFirst)
+			{
+				for (auto it = group->m_instances.begin(); it != group->m_instances.end(); it++)
+				{
+					if ((*it)->m_State == INSTANCE_STATE_ACTIVE)
+					{
+						instances.push_back(*it);
+					}
+				}
+			}
+			else
 			{
-				for (auto instance : group->m_instances)
+				for (auto it = group->m_instances.rbegin(); it != group->m_instances.rend(); it++)
 				{
-					if (instance->m_State == INSTANCE_STATE_ACTIVE)
+					if ((*it)->m_State == INSTANCE_STATE_ACTIVE)
 					{
-						count++;
+						instances.push_back(*it);
 					}
 				}
 			}
+
+			groupEnds.push_back(static_cast<int32_t>(instances.size()));
 		}
 
-		if (count > 0 && m_pEffectNode->IsRendered)
+		const auto count = static_cast<int32_t>(instances.size());
+
+		CalculateLazyMatrices(false);
+
+		// skip rendering if all instances are outside of a camera frustum
+		const bool isCulled = hasBounds_ && m_pManager->IsCulledWithRenderingFrustum(boundsMin_, boundsMax_);
+
+		if (count > 0 && !isCulled)
 		{
+			PROFILER_BLOCK("InstanceContainer::Rendering", profiler::colors::Blue200);
+
 			void* userData = m_pGlobal->GetUserData();
 
+			if (m_pManager->GetProfilingEnabled())
+			{
+				int32_t groupOffset = 0;
+				for (auto groupEnd : groupEnds)
+				{
+					profiledVertexCount_ += m_pEffectNode->EstimateRenderedVertexCount(groupEnd - groupOffset);
+					groupOffset = groupEnd;
+				}
+				profiledDrawCallCount_++;
+			}
+
 			m_pEffectNode->BeginRendering(count, m_pManager, userData);
 
+			int32_t groupIndex = 0;
+			int32_t offset = 0;
 			for (InstanceGroup* group = m_headGroups; group != nullptr; group = group->NextUsedByContainer)
 			{
 				m_pEffectNode->BeginRenderingGroup(group, m_pManager, userData);
 
-				if (m_pEffectNode->RenderingOrder == RenderingOrder_FirstCreatedInstanceIsFirst)
-				{
-					auto it = group->m_instances.begin();
-
-					while (it != group->m_instances.end())
-					{
-						if ((*it)->m_State == INSTANCE_STATE_ACTIVE)
-						{
-							auto it_temp = it;
-							it_temp++;
-
-							if (it_temp != group->m_instances.end())
-							{
-								(*it)->Draw((*it_temp), userData);
-							}
-							else
-							{
-								(*it)->Draw(nullptr, userData);
-							}
-						}
-
-						it++;
-					}
-				}
-				else
+				const auto groupEnd = groupEnds[groupIndex];
+				if (groupEnd > offset)
 				{
-					auto it = group->m_instances.rbegin();
-
-					while (it != group->m_instances.rend())
-					{
-						if ((*it)->m_State == INSTANCE_STATE_ACTIVE)
-						{
-							auto it_temp = it;
-							it_temp++;
-
-							if (it_temp != group->m_instances.rend())
-							{
-								(*it)->Draw((*it_temp), userData);
-							}
-							else
-							{
-								(*it)->Draw(nullptr, userData);
-							}
-						}
-						it++;
-					}
+					m_pEffectNode->Rendering(instances.data() + offset, groupEnd - offset, m_pManager, userData);
 				}
+				offset = groupEnd;
+				groupIndex++;
 
 				m_pEffectNode->EndRenderingGroup(group, m_pManager, userData);
 			}
@@ -311,6 +392,69 @@ void InstanceContainer::Draw(bool recursive)
 	}
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void InstanceContainer::CalculateLazyMatrices(bool recursive)
+{
+	const auto sequenceNumber = m_pManager->GetSequenceNumber();
+
+	for (InstanceGroup* group = m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+	{
+		for (auto instance : group->m_instances)
+		{
+			if (instance->m_State == INSTANCE_STATE_ACTIVE && instance->m_sequenceNumber != sequenceNumber)
+			{
+				instance->CalculateMatrix(0);
+
+				if (renderedRadius_ >= 0.0f)
+				{
+					AddInstanceToBounds(instance);
+				}
+			}
+		}
+	}
+
+	if (recursive)
+	{
+		for (auto child : m_Children)
+		{
+			child->CalculateLazyMatrices(recursive);
+		}
+	}
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+bool InstanceContainer::ExtendBounds(bool recursive, SIMD::Vec3f& min, SIMD::Vec3f& max, bool& hasBounds) const
+{
+	if (isBoundsUnknown_)
+	{
+		return false;
+	}
+
+	if (hasBounds_)
+	{
+		min = hasBounds ? SIMD::Vec3f::Min(min, boundsMin_) : boundsMin_;
+		max = hasBounds ? SIMD::Vec3f::Max(max, boundsMax_) : boundsMax_;
+		hasBounds = true;
+	}
+
+	if (recursive)
+	{
+		for (auto child : m_Children)
+		{
+			if (!child->ExtendBounds(recursive, min, max, hasBounds))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -330,6 +474,39 @@ void InstanceContainer::KillAllInstances(bool recursive)
 	}
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void InstanceContainer::ReplaceEffectNodes(const CustomMap<EffectNodeImplemented*, EffectNodeImplemented*>& effectNodes)
+{
+	auto found = effectNodes.find(m_pEffectNode);
+	if (found != effectNodes.end())
+	{
+		m_pEffectNode = found->second;
+
+		for (InstanceGroup* group = m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+		{
+			group->m_effectNode = m_pEffectNode;
+			m_pEffectNode->InitializeRenderedInstanceGroup(*group, m_pManager);
+
+			for (auto instance : group->m_instances)
+			{
+				instance->ReplaceEffectNode(m_pEffectNode);
+			}
+
+			for (auto instance : group->m_removingInstances)
+			{
+				instance->m_pEffectNode = m_pEffectNode;
+			}
+		}
+	}
+
+	for (auto child : m_Children)
+	{
+		child->ReplaceEffectNodes(effectNodes);
+	}
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -8,6 +8,9 @@
 #include "Effekseer.Base.h"
 #include "Effekseer.IntrusiveList.h"
 #include "SIMD/Mat43f.h"
+#include "SIMD/Vec3f.h"
+#include "Utils/Effekseer.CustomAllocator.h"
+#include <atomic>
 
 //----------------------------------------------------------------------------------
 //
@@ -46,6 +49,26 @@ private:
 	// グループの連結リストの最後
 	InstanceGroup* m_tailGroups;
 
+	//! an axis aligned bounding box which contains rendered instances
+	SIMD::Vec3f boundsMin_;
+	SIMD::Vec3f boundsMax_;
+
+	//! whether the bounding box is valid. it is invalid if there are no instances or the node doesn't know its size
+	bool hasBounds_ = false;
+
+	//! whether instances may be rendered out of the bounding box because the node doesn't know its size
+	bool isBoundsUnknown_ = true;
+
+	//! the radius of a rendered instance whose scale is 1. it is updated in CalculateBounds
+	float renderedRadius_ = -1.0f;
+
+	//! values for profiling which are accumulated until a frame is recorded. the time is added from worker threads
+	std::atomic<int64_t> profiledUpdateTime_{0};
+	int32_t profiledSpawnedCount_ = 0;
+	int32_t profiledKilledCount_ = 0;
+	int32_t profiledVertexCount_ = 0;
+	int32_t profiledDrawCallCount_ = 0;
+
 	// コンストラクタ
 	InstanceContainer(ManagerImplemented* pManager, EffectNode* pEffectNode, InstanceGlobal* pGlobal);
 
@@ -55,6 +78,12 @@ private:
 	// 無効なグループの破棄
 	void RemoveInvalidGroups();
 
+	//! calculate the bounding box from matrices of active instances
+	void CalculateBounds();
+
+	//! extend the bounding box with a sphere which contains a rendered instance
+	void AddInstanceToBounds(const Instance* instance);
+
 public:
 	/**
 		@brief	グループの作成
@@ -74,8 +103,41 @@ public:
 
 	void Draw(bool recursive);
 
+	//! calculate matrices of active instances which are not updated in this frame, such as spawned children, and add them to the bounding box
+	void CalculateLazyMatrices(bool recursive);
+
 	void KillAllInstances(bool recursive);
 
+	/**
+		@brief	extend a bounding box with bounding boxes of containers
+		@param	hasBounds	whether min and max are valid. it becomes true if they are extended
+		@return	false if containers may render instances whose size is unknown
+	*/
+	bool ExtendBounds(bool recursive, SIMD::Vec3f& min, SIMD::Vec3f& max, bool& hasBounds) const;
+
+	//! add a time to update an instance in nanoseconds for profiling
+	void AddProfiledUpdateTime(int64_t time)
+	{
+		profiledUpdateTime_ += time;
+	}
+
+	void AddProfiledSpawn()
+	{
+		profiledSpawnedCount_++;
+	}
+
+	void AddProfiledKill()
+	{
+		profiledKilledCount_++;
+	}
+
+	/**
+		@brief
+		\~English	Replace nodes which this container and instances refer to with reloaded nodes
+		\~Japanese	このコンテナとインスタンスが参照するノードを再読み込みされたノードに置き換える。
+	*/
+	void ReplaceEffectNodes(const CustomMap<EffectNodeImplemented*, EffectNodeImplemented*>& effectNodes);
+
 	InstanceGlobal* GetRootInstance();
 
 	void AddChild(InstanceContainer* pContainter);
@@ -68,6 +68,15 @@ public:
 	bool IsGlobalColorSet = false;
 	Color GlobalColor = Color(255, 255, 255, 255);
 
+	//! whether an effect is fast-forwarded. values only for rendering and sounds are not updated
+	bool IsPrewarming = false;
+
+	//! a rate from 0 to 1 to spawn instances with a budget
+	float SpawnRate = 1.0f;
+
+	//! the number of instances which were not spawned
+	int32_t DroppedSpawnCount = 0;
+
 	std::array<std::array<float, 4>, 16> dynamicEqResults;
 
 	std::vector<InstanceContainer*> RenderedInstanceContainers;
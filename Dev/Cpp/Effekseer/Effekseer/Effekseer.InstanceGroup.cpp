@@ -87,13 +87,27 @@ void InstanceGroup::GenerateInstancesInRequirred(float localTime, RandObject& ra
 		if (m_maxGenerationCount > m_generatedCount && localTime >= m_nextGenerationTime)
 		{
 			// Create a particle
-			auto instance = m_manager->CreateInstance(m_effectNode, m_container, this);
+			Instance* instance = nullptr;
+			if (!m_manager->IsSpawnThrottled(m_global, spawnCredit_))
+			{
+				instance = m_manager->CreateInstance(m_effectNode, m_container, this);
+			}
+
 			if (instance != nullptr)
 			{
 				m_instances.push_back(instance);
 				m_global->IncInstanceCount();
 
 				instance->Initialize(parent, m_generatedCount, SIMD::Mat43f::Identity);
+
+				if (m_manager->GetProfilingEnabled())
+				{
+					m_container->AddProfiledSpawn();
+				}
+			}
+			else
+			{
+				m_manager->AddDroppedSpawn(m_global);
 			}
 
 			m_generatedCount++;
@@ -141,6 +155,11 @@ void InstanceGroup::Update(bool shown)
 		{
 			it = m_instances.erase(it);
 			NotfyEraseInstance();
+
+			if (m_manager->GetProfilingEnabled())
+			{
+				m_container->AddProfiledKill();
+			}
 		}
 		else
 		{
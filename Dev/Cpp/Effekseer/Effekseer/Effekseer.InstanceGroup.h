@@ -46,6 +46,9 @@ private:
 	// The time to generate next instance.
 	float m_nextGenerationTime = 0.0f;
 
+	//! a credit accumulated with a rate to spawn instances with a budget
+	float spawnCredit_ = 0.0f;
+
 	SIMD::Mat43f parentMatrix_;
 	SIMD::Mat43f parentRotation_;
 	SIMD::Vec3f parentTranslation_;
@@ -27,12 +27,15 @@
 
 #include "Effekseer.SoundLoader.h"
 #include "Sound/Effekseer.SoundPlayer.h"
+#include "Sound/Effekseer.SoundVoiceManager.h"
 
 #include "Effekseer.CurveLoader.h"
 #include "Model/ModelLoader.h"
+#include "Utils/Effekseer.BinaryReader.h"
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 
 #include "Utils/Profiler.h"
 
@@ -65,11 +68,20 @@ Manager::DrawParameter::DrawParameter()
 	CameraCullingMask = 1;
 }
 
+Manager::PrewarmParameter::PrewarmParameter()
+{
+}
+
 ManagerRef Manager::Create(int instance_max, bool autoFlip)
 {
 	return MakeRefPtr<ManagerImplemented>(instance_max, autoFlip);
 }
 
+ManagerRef Manager::Create(const MemoryParameter& parameter, bool autoFlip)
+{
+	return MakeRefPtr<ManagerImplemented>(parameter, autoFlip);
+}
+
 SIMD::Mat43f* ManagerImplemented::DrawSet::GetEnabledGlobalMatrix()
 {
 	if (IsPreupdated)
@@ -166,7 +178,7 @@ void ManagerImplemented::StopStoppingEffects()
 					if (!pRootInstance->AreChildrenActive())
 					{
 						// when a sound is not playing.
-						if (m_soundPlayer == nullptr || !m_soundPlayer->CheckPlayingTag(draw_set.GlobalPointer))
+						if (m_soundPlayer == nullptr || !soundVoiceManager_->CheckPlayingTag(draw_set.GlobalPointer))
 						{
 							isRemoving = true;
 						}
@@ -184,6 +196,8 @@ void ManagerImplemented::StopStoppingEffects()
 
 void ManagerImplemented::GCDrawSet(bool isRemovingManager)
 {
+	PROFILER_BLOCK("Manager::GCDrawSet", profiler::colors::Red);
+
 	// dispose instance groups
 	{
 		auto it = m_RemovingDrawSets[1].begin();
@@ -270,12 +284,11 @@ void ManagerImplemented::GCDrawSet(bool isRemovingManager)
 InstanceContainer* ManagerImplemented::CreateInstanceContainer(
 	EffectNode* pEffectNode, InstanceGlobal* pGlobal, bool isRoot, const SIMD::Mat43f& rootMatrix, Instance* pParent)
 {
-	if (pooledContainers_.empty())
+	InstanceContainer* memory = pooledContainers_.Pop();
+	if (memory == nullptr)
 	{
 		return nullptr;
 	}
-	InstanceContainer* memory = pooledContainers_.front();
-	pooledContainers_.pop();
 	InstanceContainer* pContainer = new (memory) InstanceContainer(this, pEffectNode, pGlobal);
 
 	for (int i = 0; i < pEffectNode->GetChildrenCount(); i++)
@@ -322,7 +335,7 @@ InstanceContainer* ManagerImplemented::CreateInstanceContainer(
 void ManagerImplemented::ReleaseInstanceContainer(InstanceContainer* container)
 {
 	container->~InstanceContainer();
-	pooledContainers_.push(container);
+	pooledContainers_.Push(container);
 }
 
 void* EFK_STDCALL ManagerImplemented::Malloc(unsigned int size)
@@ -355,10 +368,7 @@ void ManagerImplemented::ExecuteEvents()
 			}
 
 			ds.second.IsRemoving = true;
-			if (GetSoundPlayer() != nullptr)
-			{
-				GetSoundPlayer()->StopTag(ds.second.GlobalPointer);
-			}
+			soundVoiceManager_->StopTag(ds.second.GlobalPointer);
 		}
 
 		if (ds.second.GoingToStopRoot)
@@ -403,10 +413,39 @@ void ManagerImplemented::StoreSortingDrawSets(const Manager::DrawParameter& draw
 	}
 }
 
+static Manager::MemoryParameter GetFixedMemoryParameter(int instance_max)
+{
+	Manager::MemoryParameter parameter;
+	parameter.InitialInstanceCount = instance_max;
+	parameter.MaxInstanceCount = instance_max;
+	return parameter;
+}
+
+static void InitializeInstanceChunks(InstanceChunk* chunks, int32_t count)
+{
+	for (int32_t i = 0; i < count; i++)
+	{
+		new (&chunks[i]) InstanceChunk();
+	}
+}
+
+static void FinalizeInstanceChunks(InstanceChunk* chunks, int32_t count)
+{
+	for (int32_t i = 0; i < count; i++)
+	{
+		chunks[i].~InstanceChunk();
+	}
+}
+
 ManagerImplemented::ManagerImplemented(int instance_max, bool autoFlip)
+	: ManagerImplemented(GetFixedMemoryParameter(instance_max), autoFlip)
+{
+}
+
+ManagerImplemented::ManagerImplemented(const MemoryParameter& parameter, bool autoFlip)
 	: m_autoFlip(autoFlip)
 	, m_NextHandle(0)
-	, m_instance_max(instance_max)
+	, m_instance_max(std::max(parameter.InitialInstanceCount, 1))
 	, m_setting(nullptr)
 	, m_sequenceNumber(0)
 
@@ -427,6 +466,10 @@ ManagerImplemented::ManagerImplemented(int instance_max, bool autoFlip)
 	, m_randMax(0)
 {
 	m_setting = Setting::Create();
+	soundVoiceManager_ = MakeRefPtr<SoundVoiceManager>();
+
+	// select kernels with CPUID here not to detect it while updating
+	kernels_ = &SIMD::GetKernels();
 
 	SetMallocFunc(Malloc);
 	SetFreeFunc(Free);
@@ -435,12 +478,24 @@ ManagerImplemented::ManagerImplemented(int instance_max, bool autoFlip)
 
 	m_renderingDrawSets.reserve(64);
 
-	int chunk_max = (m_instance_max + InstanceChunk::InstancesOfChunk - 1) / InstanceChunk::InstancesOfChunk;
-	reservedChunksBuffer_.resize(chunk_max);
-	for (auto& chunk : reservedChunksBuffer_)
+	// segments are added by m_instance_max instances
+	int32_t segmentCountMax = FreeList<InstanceChunk>::SegmentsMax;
+	if (parameter.MaxInstanceCount > 0)
 	{
-		pooledChunks_.push(&chunk);
+		segmentCountMax = std::max(1, (parameter.MaxInstanceCount + m_instance_max - 1) / m_instance_max);
+
+		if (segmentCountMax > FreeList<InstanceChunk>::SegmentsMax)
+		{
+			Log(LogType::Warning,
+				"Manager : MaxInstanceCount is limited to " + std::to_string(m_instance_max * FreeList<InstanceChunk>::SegmentsMax) +
+					" because memory is added up to " + std::to_string(FreeList<InstanceChunk>::SegmentsMax) + " times InitialInstanceCount.");
+		}
 	}
+	shrinkFrameCount_ = parameter.ShrinkFrameCount;
+	idleFrameCounts_.fill(0);
+
+	int chunk_max = (m_instance_max + InstanceChunk::InstancesOfChunk - 1) / InstanceChunk::InstancesOfChunk;
+	pooledChunks_.Reset(chunk_max, 1, segmentCountMax, InitializeInstanceChunks, FinalizeInstanceChunks);
 	for (auto& chunks : instanceChunks_)
 	{
 		chunks.reserve(chunk_max);
@@ -448,18 +503,10 @@ ManagerImplemented::ManagerImplemented(int instance_max, bool autoFlip)
 	std::fill(creatableChunkOffsets_.begin(), creatableChunkOffsets_.end(), 0);
 
 	// Pooling InstanceGroup
-	reservedGroupBuffer_.resize(instance_max * sizeof(InstanceGroup));
-	for (int i = 0; i < instance_max; i++)
-	{
-		pooledGroups_.push((InstanceGroup*)&reservedGroupBuffer_[i * sizeof(InstanceGroup)]);
-	}
+	pooledGroups_.Reset(m_instance_max, 1, segmentCountMax);
 
-	// Pooling InstanceGroup
-	reservedContainerBuffer_.resize(instance_max * sizeof(InstanceContainer));
-	for (int i = 0; i < instance_max; i++)
-	{
-		pooledContainers_.push((InstanceContainer*)&reservedContainerBuffer_[i * sizeof(InstanceContainer)]);
-	}
+	// Pooling InstanceContainer
+	pooledContainers_.Reset(m_instance_max, 1, segmentCountMax);
 
 	m_setting->SetEffectLoader(Effect::CreateEffectLoader());
 	EffekseerPrintDebug("*** Create : Manager\n");
@@ -487,9 +534,8 @@ ManagerImplemented::~ManagerImplemented()
 	Culling3D::SafeRelease(m_cullingWorld);
 }
 
-Instance* ManagerImplemented::CreateInstance(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup)
+InstanceChunk* ManagerImplemented::GetCreatableChunk(int32_t generationNumber)
 {
-	int32_t generationNumber = pEffectNode->GetGeneration();
 	assert(generationNumber < GenerationsMax);
 
 	auto& chunks = instanceChunks_[generationNumber];
@@ -502,36 +548,45 @@ Instance* ManagerImplemented::CreateInstance(EffectNodeImplemented* pEffectNode,
 
 	if (it != chunks.end())
 	{
-		auto chunk = *it;
-		return chunk->CreateInstance(this, pEffectNode, pContainer, pGroup);
+		return *it;
 	}
 
-	if (!pooledChunks_.empty())
+	auto chunk = pooledChunks_.Pop();
+	if (chunk != nullptr)
 	{
-		auto chunk = pooledChunks_.front();
-		pooledChunks_.pop();
 		chunks.push_back(chunk);
-		return chunk->CreateInstance(this, pEffectNode, pContainer, pGroup);
 	}
 
-	return nullptr;
+	return chunk;
+}
+
+Instance* ManagerImplemented::CreateInstance(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup)
+{
+	auto chunk = GetCreatableChunk(pEffectNode->GetGeneration());
+	if (chunk == nullptr)
+	{
+		return nullptr;
+	}
+
+	budgetedInstanceCount_++;
+
+	return chunk->CreateInstance(this, pEffectNode, pContainer, pGroup);
 }
 
 InstanceGroup* ManagerImplemented::CreateInstanceGroup(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGlobal* pGlobal)
 {
-	if (pooledGroups_.empty())
+	InstanceGroup* memory = pooledGroups_.Pop();
+	if (memory == nullptr)
 	{
 		return nullptr;
 	}
-	InstanceGroup* memory = pooledGroups_.front();
-	pooledGroups_.pop();
 	return new (memory) InstanceGroup(this, pEffectNode, pContainer, pGlobal);
 }
 
 void ManagerImplemented::ReleaseGroup(InstanceGroup* group)
 {
 	group->~InstanceGroup();
-	pooledGroups_.push(group);
+	pooledGroups_.Push(group);
 }
 
 void ManagerImplemented::LaunchWorkerThreads(uint32_t threadCount)
@@ -666,6 +721,12 @@ SoundPlayerRef ManagerImplemented::GetSoundPlayer()
 void ManagerImplemented::SetSoundPlayer(SoundPlayerRef soundPlayer)
 {
 	m_soundPlayer = soundPlayer;
+	soundVoiceManager_->SetSoundPlayer(soundPlayer);
+}
+
+SoundVoiceManagerRef ManagerImplemented::GetSoundVoiceManager()
+{
+	return soundVoiceManager_;
 }
 
 const SettingRef& ManagerImplemented::GetSetting() const
@@ -1148,6 +1209,40 @@ void ManagerImplemented::SetGroupMask(Handle handle, int64_t groupmask)
 	}
 }
 
+float ManagerImplemented::GetSpawnPriority(Handle handle) const
+{
+	auto it = m_DrawSets.find(handle);
+
+	if (it != m_DrawSets.end())
+	{
+		return it->second.SpawnPriority;
+	}
+
+	return 0.0f;
+}
+
+void ManagerImplemented::SetSpawnPriority(Handle handle, float priority)
+{
+	auto it = m_DrawSets.find(handle);
+
+	if (it != m_DrawSets.end())
+	{
+		it->second.SpawnPriority = Clamp(priority, 1.0f, 0.0f);
+	}
+}
+
+int32_t ManagerImplemented::GetDroppedSpawnCount(Handle handle) const
+{
+	auto it = m_DrawSets.find(handle);
+
+	if (it != m_DrawSets.end())
+	{
+		return it->second.GlobalPointer->DroppedSpawnCount;
+	}
+
+	return 0;
+}
+
 float ManagerImplemented::GetSpeed(Handle handle) const
 {
 	auto it = m_DrawSets.find(handle);
@@ -1224,14 +1319,22 @@ void ManagerImplemented::Flip()
 	}
 
 	// execute preupdate
-	for (auto& drawSet : m_DrawSets)
 	{
-		Preupdate(drawSet.second);
+		PROFILER_BLOCK("Flip::Preupdate", profiler::colors::Red100);
+
+		for (auto& drawSet : m_DrawSets)
+		{
+			Preupdate(drawSet.second);
+		}
 	}
 
-	StopStoppingEffects();
+	{
+		PROFILER_BLOCK("Flip::ExecuteEvents", profiler::colors::Red200);
+
+		StopStoppingEffects();
 
-	ExecuteEvents();
+		ExecuteEvents();
+	}
 
 	GCDrawSet(false);
 
@@ -1240,7 +1343,8 @@ void ManagerImplemented::Flip()
 
 	// Generate culling
 	if (cullingNext.SizeX != cullingCurrent.SizeX || cullingNext.SizeY != cullingCurrent.SizeY ||
-		cullingNext.SizeZ != cullingCurrent.SizeZ || cullingNext.LayerCount != cullingCurrent.LayerCount)
+		cullingNext.SizeZ != cullingCurrent.SizeZ || cullingNext.LayerCount != cullingCurrent.LayerCount ||
+		cullingNext.IsTree != cullingCurrent.IsTree || cullingNext.Margin != cullingCurrent.Margin)
 	{
 		Culling3D::SafeRelease(m_cullingWorld);
 
@@ -1250,12 +1354,21 @@ void ManagerImplemented::Flip()
 			Culling3D::SafeRelease(ds.CullingObjectPointer);
 		}
 
-		m_cullingWorld = Culling3D::World::Create(cullingNext.SizeX, cullingNext.SizeY, cullingNext.SizeZ, cullingNext.LayerCount);
+		if (cullingNext.IsTree)
+		{
+			m_cullingWorld = Culling3D::World::CreateDynamicTree(cullingNext.Margin);
+		}
+		else
+		{
+			m_cullingWorld = Culling3D::World::Create(cullingNext.SizeX, cullingNext.SizeY, cullingNext.SizeZ, cullingNext.LayerCount);
+		}
 
 		cullingCurrent = cullingNext;
 	}
 
 	{
+		PROFILER_BLOCK("Flip::CopyDrawSets", profiler::colors::Red300);
+
 		for (auto& it : m_DrawSets)
 		{
 			DrawSet& ds = it.second;
@@ -1385,7 +1498,7 @@ void ManagerImplemented::Update(const UpdateParameter& parameter)
 		}
 	}
 
-	ExecuteSounds();
+	ExecuteSounds(parameter.DeltaFrame);
 }
 
 void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
@@ -1429,6 +1542,23 @@ void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
 
 	BeginUpdate();
 
+	if (isProfilingEnabled_)
+	{
+		RecordProfiledFrame();
+	}
+
+	{
+		PROFILER_BLOCK("DoUpdate::Prewarm", profiler::colors::Red700);
+		for (auto& drawSet : m_DrawSets)
+		{
+			if (drawSet.second.PrewarmFrame < 0.0f)
+				continue;
+
+			FastForward(drawSet.second, drawSet.second.PrewarmFrame, drawSet.second.PrewarmStepFrame);
+			drawSet.second.PrewarmFrame = -1.0f;
+		}
+	}
+
 	for (int32_t t = 0; t < times; t++)
 	{
 		// specify delta frames
@@ -1456,6 +1586,8 @@ void ManagerImplemented::DoUpdate(const UpdateParameter& parameter)
 			}
 		}
 
+		UpdateSpawnRates();
+
 		for (auto& chunks : instanceChunks_)
 		{
 			// wakeup threads and wait to complete threads are hevery, so multithread the updates if you have a large number of instances.
@@ -1538,6 +1670,12 @@ void ManagerImplemented::BeginUpdate()
 		Flip();
 	}
 
+	// instances are counted once in a frame because UpdateHandle only follows a difference of an effect
+	if (spawnBudget_.MaxInstanceCount > 0)
+	{
+		budgetedInstanceCount_ = GetTotalInstanceCount();
+	}
+
 	m_sequenceNumber++;
 }
 
@@ -1552,7 +1690,7 @@ void ManagerImplemented::EndUpdate()
 			auto it = std::find_if(first, last, [](const InstanceChunk* chunk) { return chunk->GetAliveCount() == 0; });
 			if (it != last)
 			{
-				pooledChunks_.push(*it);
+				pooledChunks_.Push(*it);
 				if (it != last - 1)
 					*it = *(last - 1);
 				last--;
@@ -1563,10 +1701,43 @@ void ManagerImplemented::EndUpdate()
 	}
 	std::fill(creatableChunkOffsets_.begin(), creatableChunkOffsets_.end(), 0);
 
+	ShrinkPools();
+
 	m_renderingMutex.unlock();
 	m_isLockedWithRenderingMutex = false;
 }
 
+template <typename T>
+static void ShrinkPool(FreeList<T>& pool, int32_t& idleFrameCount, int32_t shrinkFrameCount)
+{
+	// the last segment may be unused only if unused elements are more than a segment
+	if (pool.GetCount() < pool.GetSegmentSize() || pool.GetCapacity() <= pool.GetSegmentSize())
+	{
+		idleFrameCount = 0;
+		return;
+	}
+
+	idleFrameCount++;
+
+	if (idleFrameCount >= shrinkFrameCount)
+	{
+		pool.ShrinkLastSegment();
+		idleFrameCount = 0;
+	}
+}
+
+void ManagerImplemented::ShrinkPools()
+{
+	if (shrinkFrameCount_ <= 0)
+	{
+		return;
+	}
+
+	ShrinkPool(pooledChunks_, idleFrameCounts_[0], shrinkFrameCount_);
+	ShrinkPool(pooledGroups_, idleFrameCounts_[1], shrinkFrameCount_);
+	ShrinkPool(pooledContainers_, idleFrameCounts_[2], shrinkFrameCount_);
+}
+
 void ManagerImplemented::UpdateHandle(Handle handle, float deltaFrame)
 {
 	{
@@ -1583,13 +1754,24 @@ void ManagerImplemented::UpdateHandle(Handle handle, float deltaFrame)
 				drawSet.NextUpdateFrame = 0.0f;
 			}
 
+			// only a rate of this effect is calculated so that updating all handles one by one is not quadratic
+			const auto budgetedInstanceCount = budgetedInstanceCount_;
+			const auto instanceCount = drawSet.GlobalPointer->GetInstanceCount();
+
+			if (spawnBudget_.MaxInstanceCount > 0)
+			{
+				UpdateSpawnRate(drawSet);
+			}
+
 			UpdateInstancesByInstanceGlobal(drawSet);
 
 			UpdateHandleInternal(drawSet);
+
+			budgetedInstanceCount_ = budgetedInstanceCount + drawSet.GlobalPointer->GetInstanceCount() - instanceCount;
 		}
 	}
 
-	ExecuteSounds();
+	ExecuteSounds(deltaFrame);
 }
 
 void ManagerImplemented::UpdateHandleToMoveToFrame(Handle handle, float frame)
@@ -1617,6 +1799,26 @@ void ManagerImplemented::UpdateHandleToMoveToFrame(Handle handle, float frame)
 	}
 }
 
+void ManagerImplemented::PrewarmHandle(Handle handle, float frame, const PrewarmParameter& parameter)
+{
+	auto it = m_DrawSets.find(handle);
+	if (it == m_DrawSets.end())
+	{
+		return;
+	}
+
+	DrawSet& drawSet = it->second;
+
+	if (parameter.IsDeferred)
+	{
+		drawSet.PrewarmFrame = frame;
+		drawSet.PrewarmStepFrame = parameter.StepFrame;
+		return;
+	}
+
+	FastForward(drawSet, frame, parameter.StepFrame);
+}
+
 void ManagerImplemented::UpdateInstancesByInstanceGlobal(const DrawSet& drawSet)
 {
 	for (auto& chunks : instanceChunks_)
@@ -1720,99 +1922,1000 @@ bool ManagerImplemented::IsClippedWithDepth(DrawSet& drawSet, InstanceContainer*
 	}
 }
 
-void ManagerImplemented::StopWithoutRemoveDrawSet(DrawSet& drawSet)
+void ManagerImplemented::SetRenderingFrustum(const Manager::DrawParameter& drawParameter)
 {
-	drawSet.InstanceContainerPointer->KillAllInstances(true);
-	drawSet.InstanceContainerPointer->RemoveForcibly(true);
-	ReleaseInstanceContainer(drawSet.InstanceContainerPointer);
-	drawSet.InstanceContainerPointer = nullptr;
-	ES_SAFE_RELEASE(drawSet.CullingObjectPointer);
+	isRenderingFrustumEnabled_ = drawParameter.IsInstanceCullingEnabled;
+	if (!isRenderingFrustumEnabled_)
+	{
+		return;
+	}
+
+	// extract planes from columns of a matrix with row vectors
+	// a near plane is w + z >= 0, which contains z >= 0 of DirectX
+	// Matrix44 is packed, so its values are not referred as floats directly
+	const auto& m = drawParameter.ViewProjectionMatrix;
+	const std::array<float, 6> signs = {1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f};
+	const std::array<int32_t, 6> columns = {0, 0, 1, 1, 2, 2};
+
+	for (size_t i = 0; i < renderingFrustumPlanes_.size(); i++)
+	{
+		for (int32_t r = 0; r < 4; r++)
+		{
+			renderingFrustumPlanes_[i][r] = m.Values[r][3] + signs[i] * m.Values[r][columns[i]];
+		}
+	}
 }
 
-void ManagerImplemented::ResetAndPlayWithDataSet(DrawSet& drawSet, float frame)
+bool ManagerImplemented::IsCulledWithRenderingFrustum(const SIMD::Vec3f& min, const SIMD::Vec3f& max) const
 {
-	assert(drawSet.ParameterPointer != nullptr);
-	auto effect = drawSet.ParameterPointer->GetRoot();
-	assert(effect != nullptr);
-
-	auto pGlobal = drawSet.GlobalPointer;
-	auto e = static_cast<EffectImplemented*>(drawSet.ParameterPointer.Get());
+	if (!isRenderingFrustumEnabled_)
+	{
+		return false;
+	}
 
-	// reallocate
-	pGlobal->GetRandObject().SetSeed(drawSet.RandomSeed);
+	std::array<float, 4> center;
+	std::array<float, 4> extent;
+	SIMD::Vec3f::Store(center.data(), (min + max) * 0.5f);
+	SIMD::Vec3f::Store(extent.data(), (max - min) * 0.5f);
 
-	pGlobal->RenderedInstanceContainers.resize(e->renderingNodesCount);
-	for (size_t i = 0; i < pGlobal->RenderedInstanceContainers.size(); i++)
+	for (const auto& plane : renderingFrustumPlanes_)
 	{
-		pGlobal->RenderedInstanceContainers[i] = nullptr;
+		const auto distance = plane[0] * center[0] + plane[1] * center[1] + plane[2] * center[2] + plane[3];
+		const auto radius = std::abs(plane[0]) * extent[0] + std::abs(plane[1]) * extent[1] + std::abs(plane[2]) * extent[2];
+
+		if (distance + radius < 0.0f)
+		{
+			return true;
+		}
 	}
 
-	drawSet.IsPreupdated = false;
-	drawSet.IsParameterChanged = true;
-	drawSet.StartFrame = 0;
-	drawSet.GoingToStop = false;
-	drawSet.GoingToStopRoot = false;
-	drawSet.IsRemoving = false;
-	pGlobal->ResetUpdatedFrame();
+	return false;
+}
 
-	// Create an instance through a container
-	//drawSet.InstanceContainerPointer = CreateInstanceContainer(e->GetRoot(), drawSet.GlobalPointer, true, drawSet.GlobalMatrix, nullptr);
+bool ManagerImplemented::CalculateDrawSetBounds(DrawSet& drawSet, SIMD::Vec3f& min, SIMD::Vec3f& max)
+{
+	// use bounding boxes of containers which are calculated in an update
+	// instances which are spawned after they are updated are added with matrices which would be calculated in drawing
+	bool isBoundsKnown = true;
+	bool hasBounds = false;
 
-	auto isShown = drawSet.IsShown;
-	drawSet.IsShown = false;
+	if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
+	{
+		for (auto c : drawSet.GlobalPointer->RenderedInstanceContainers)
+		{
+			if (c == nullptr)
+			{
+				continue;
+			}
 
-	// skip
-	Preupdate(drawSet);
+			c->CalculateLazyMatrices(false);
 
-	for (float f = 0; f < frame - 1; f += 1.0f)
+			if (!c->ExtendBounds(false, min, max, hasBounds))
+			{
+				isBoundsKnown = false;
+				break;
+			}
+		}
+	}
+	else
 	{
-		drawSet.GlobalPointer->BeginDeltaFrame(1.0f);
+		drawSet.InstanceContainerPointer->CalculateLazyMatrices(true);
+		isBoundsKnown = drawSet.InstanceContainerPointer->ExtendBounds(true, min, max, hasBounds);
+	}
 
-		UpdateInstancesByInstanceGlobal(drawSet);
-		UpdateHandleInternal(drawSet);
-		//drawSet.InstanceContainerPointer->Update(true, false);
-		drawSet.GlobalPointer->EndDeltaFrame();
+	if (isBoundsKnown)
+	{
+		return hasBounds;
 	}
 
-	drawSet.IsShown = isShown;
+	// use a culling sphere which is specified in an effect
+	auto effect = static_cast<EffectImplemented*>(drawSet.ParameterPointer.Get());
+	if (effect->Culling.Shape != CullingShape::Sphere)
+	{
+		return false;
+	}
 
-	drawSet.GlobalPointer->BeginDeltaFrame(1.0f);
+	float radius = effect->Culling.Sphere.Radius;
+	SIMD::Vec3f center = SIMD::Vec3f(effect->Culling.Location);
 
-	UpdateInstancesByInstanceGlobal(drawSet);
-	UpdateHandleInternal(drawSet);
+	auto mat = drawSet.GetEnabledGlobalMatrix();
+	if (mat != nullptr)
+	{
+		radius *= mat->GetScale().GetLength();
+		center = SIMD::Vec3f::Transform(center, *mat);
+	}
 
-	//drawSet.InstanceContainerPointer->Update(true, drawSet.IsShown);
-	drawSet.GlobalPointer->EndDeltaFrame();
+	if (drawSet.DoUseBaseMatrix)
+	{
+		radius *= drawSet.BaseMatrix.GetScale().GetLength();
+		center = SIMD::Vec3f::Transform(center, drawSet.BaseMatrix);
+	}
+
+	min = center - SIMD::Vec3f(radius, radius, radius);
+	max = center + SIMD::Vec3f(radius, radius, radius);
+	return true;
 }
 
-void ManagerImplemented::Draw(const Manager::DrawParameter& drawParameter)
+bool ManagerImplemented::IsSkippedWithScreenCoverage(DrawSet& drawSet, const Manager::DrawParameter& drawParameter)
 {
-	PROFILER_BLOCK("Manager::Draw", profiler::colors::Blue);
+	const bool isCoverageEnabled = drawParameter.MinimumScreenCoverage > 0.0f && drawParameter.ViewportWidth > 0 && drawParameter.ViewportHeight > 0;
+	const bool isOcclusionEnabled = occlusionDepthPyramid_.IsValid();
 
-	if (m_WorkerThreads.size() > 0)
+	if (!isCoverageEnabled && !isOcclusionEnabled)
 	{
-		m_WorkerThreads[0].WaitForComplete();
+		return false;
 	}
 
-	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
+	SIMD::Vec3f min;
+	SIMD::Vec3f max;
+	if (!CalculateDrawSetBounds(drawSet, min, max))
+	{
+		return false;
+	}
 
-	// start to record a time
-	int64_t beginTime = ::Effekseer::GetTime();
+	std::array<float, 4> minValues;
+	std::array<float, 4> maxValues;
+	SIMD::Vec3f::Store(minValues.data(), min);
+	SIMD::Vec3f::Store(maxValues.data(), max);
 
-	const auto render = [this, &drawParameter](DrawSet& drawSet) -> void {
-		if (drawSet.InstanceContainerPointer == nullptr)
+	// project corners of the bounding box into a screen
+	// Matrix44 is packed, so its values are not referred as floats directly
+	const auto& m = drawParameter.ViewProjectionMatrix;
+	float left = FLT_MAX;
+	float right = -FLT_MAX;
+	float bottom = FLT_MAX;
+	float top = -FLT_MAX;
+	float nearest = FLT_MAX;
+
+	for (int32_t i = 0; i < 8; i++)
+	{
+		const float x = (i & 1) ? maxValues[0] : minValues[0];
+		const float y = (i & 2) ? maxValues[1] : minValues[1];
+		const float z = (i & 4) ? maxValues[2] : minValues[2];
+
+		const float w = x * m.Values[0][3] + y * m.Values[1][3] + z * m.Values[2][3] + m.Values[3][3];
+
+		// the box crosses a plane of the camera
+		if (w <= FLT_EPSILON)
 		{
-			return;
+			return false;
 		}
 
-		if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
-		{
-			if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
-			{
-				for (auto& c : drawSet.GlobalPointer->RenderedInstanceContainers)
-				{
-					if (IsClippedWithDepth(drawSet, c, drawParameter))
-						continue;
+		const float sx = (x * m.Values[0][0] + y * m.Values[1][0] + z * m.Values[2][0] + m.Values[3][0]) / w;
+		const float sy = (x * m.Values[0][1] + y * m.Values[1][1] + z * m.Values[2][1] + m.Values[3][1]) / w;
+		const float sz = (x * m.Values[0][2] + y * m.Values[1][2] + z * m.Values[2][2] + m.Values[3][2]) / w;
+
+		left = std::min(left, sx);
+		right = std::max(right, sx);
+		bottom = std::min(bottom, sy);
+		top = std::max(top, sy);
+		nearest = std::min(nearest, sz);
+	}
+
+	if (isCoverageEnabled)
+	{
+		const auto width = std::max(std::min(right, 1.0f) - std::max(left, -1.0f), 0.0f) * 0.5f * drawParameter.ViewportWidth;
+		const auto height = std::max(std::min(top, 1.0f) - std::max(bottom, -1.0f), 0.0f) * 0.5f * drawParameter.ViewportHeight;
+
+		if (width * height < drawParameter.MinimumScreenCoverage)
+		{
+			return true;
+		}
+	}
+
+	if (isOcclusionEnabled)
+	{
+		// the origin of the depth buffer is top left
+		if (occlusionDepthPyramid_.IsOccluded((left + 1.0f) * 0.5f, (1.0f - top) * 0.5f, (right + 1.0f) * 0.5f, (1.0f - bottom) * 0.5f, nearest))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ManagerImplemented::StopWithoutRemoveDrawSet(DrawSet& drawSet)
+{
+	drawSet.InstanceContainerPointer->KillAllInstances(true);
+	drawSet.InstanceContainerPointer->RemoveForcibly(true);
+	ReleaseInstanceContainer(drawSet.InstanceContainerPointer);
+	drawSet.InstanceContainerPointer = nullptr;
+	ES_SAFE_RELEASE(drawSet.CullingObjectPointer);
+}
+
+void ManagerImplemented::ResetDrawSet(DrawSet& drawSet)
+{
+	auto pGlobal = drawSet.GlobalPointer;
+	auto e = static_cast<EffectImplemented*>(drawSet.ParameterPointer.Get());
+
+	// reallocate
+	pGlobal->GetRandObject().SetSeed(drawSet.RandomSeed);
+
+	pGlobal->RenderedInstanceContainers.resize(e->renderingNodesCount);
+	for (size_t i = 0; i < pGlobal->RenderedInstanceContainers.size(); i++)
+	{
+		pGlobal->RenderedInstanceContainers[i] = nullptr;
+	}
+
+	drawSet.IsPreupdated = false;
+	drawSet.IsParameterChanged = true;
+	drawSet.StartFrame = 0;
+	drawSet.GoingToStop = false;
+	drawSet.GoingToStopRoot = false;
+	drawSet.IsRemoving = false;
+	pGlobal->ResetUpdatedFrame();
+}
+
+void ManagerImplemented::ResetAndPlayWithDataSet(DrawSet& drawSet, float frame)
+{
+	assert(drawSet.ParameterPointer != nullptr);
+	auto effect = drawSet.ParameterPointer->GetRoot();
+	assert(effect != nullptr);
+
+	ResetDrawSet(drawSet);
+
+	// Create an instance through a container
+	//drawSet.InstanceContainerPointer = CreateInstanceContainer(e->GetRoot(), drawSet.GlobalPointer, true, drawSet.GlobalMatrix, nullptr);
+
+	auto isShown = drawSet.IsShown;
+	drawSet.IsShown = false;
+
+	// skip
+	Preupdate(drawSet);
+
+	for (float f = 0; f < frame - 1; f += 1.0f)
+	{
+		drawSet.GlobalPointer->BeginDeltaFrame(1.0f);
+
+		UpdateInstancesByInstanceGlobal(drawSet);
+		UpdateHandleInternal(drawSet);
+		//drawSet.InstanceContainerPointer->Update(true, false);
+		drawSet.GlobalPointer->EndDeltaFrame();
+	}
+
+	drawSet.IsShown = isShown;
+
+	drawSet.GlobalPointer->BeginDeltaFrame(1.0f);
+
+	UpdateInstancesByInstanceGlobal(drawSet);
+	UpdateHandleInternal(drawSet);
+
+	//drawSet.InstanceContainerPointer->Update(true, drawSet.IsShown);
+	drawSet.GlobalPointer->EndDeltaFrame();
+}
+
+void ManagerImplemented::FastForward(DrawSet& drawSet, float frame, float stepFrame)
+{
+	assert(drawSet.ParameterPointer != nullptr);
+
+	if (frame < drawSet.GlobalPointer->GetUpdatedFrame())
+	{
+		if (drawSet.InstanceContainerPointer != nullptr)
+		{
+			StopWithoutRemoveDrawSet(drawSet);
+		}
+
+		ResetDrawSet(drawSet);
+	}
+
+	stepFrame = std::max(stepFrame, 1.0f);
+
+	drawSet.GlobalPointer->IsPrewarming = true;
+
+	Preupdate(drawSet);
+
+	// the last frame is updated normally to calculate values for rendering
+	while (!drawSet.IsRemoving && frame - drawSet.GlobalPointer->GetUpdatedFrame() > 1.0f)
+	{
+		const auto deltaFrame = std::min(stepFrame, frame - drawSet.GlobalPointer->GetUpdatedFrame() - 1.0f);
+		drawSet.GlobalPointer->BeginDeltaFrame(deltaFrame);
+
+		UpdateInstancesByInstanceGlobal(drawSet);
+		UpdateHandleInternal(drawSet);
+	}
+
+	drawSet.GlobalPointer->IsPrewarming = false;
+
+	if (!drawSet.IsRemoving && frame > drawSet.GlobalPointer->GetUpdatedFrame())
+	{
+		drawSet.GlobalPointer->BeginDeltaFrame(frame - drawSet.GlobalPointer->GetUpdatedFrame());
+
+		UpdateInstancesByInstanceGlobal(drawSet);
+		UpdateHandleInternal(drawSet);
+	}
+}
+
+//! a header of Manager::Snapshot::Data
+struct SnapshotHeader
+{
+	std::array<char, 4> Magic;
+	int32_t Version;
+	int32_t DrawSetCount;
+};
+
+static const std::array<char, 4> SnapshotMagic = {'E', 'F', 'K', 'S'};
+static const int32_t SnapshotVersion = 1;
+
+//! a state of a draw set and an InstanceGlobal. node types, groups and instances follow it
+struct SnapshotDrawSet
+{
+	Handle Self;
+	int32_t EffectIndex;
+	int32_t NodeCount;
+	int32_t GroupCount;
+	int32_t InstanceCount;
+	int32_t RandomSeed;
+	int32_t StartFrame;
+	int32_t Layer;
+	int64_t GroupMask;
+	float Speed;
+	float NextUpdateFrame;
+	float TimeScale;
+	float PrewarmFrame;
+	float PrewarmStepFrame;
+	bool IsPaused;
+	bool IsShown;
+	bool IsAutoDrawing;
+	bool DoUseBaseMatrix;
+	bool GoingToStop;
+	bool GoingToStopRoot;
+	bool IsPreupdated;
+	EffectInstanceRemovingCallback RemovingCallback;
+	Matrix43 Rotation;
+	Vector3D Scaling;
+	SIMD::Mat43f BaseMatrix;
+	SIMD::Mat43f GlobalMatrix;
+
+	float UpdatedFrame;
+	float NextDeltaFrame;
+	int32_t GlobalRandomSeed;
+	SIMD::Vec3f TargetLocation;
+	std::array<float, 4> DynamicInputParameters;
+	std::array<std::array<float, 4>, 16> DynamicEqResults;
+	bool IsGlobalColorSet;
+	Color GlobalColor;
+	void* UserData;
+};
+
+//! a state of an instance group. pointers are replaced with indexes
+struct SnapshotGroup
+{
+	int32_t ContainerIndex;
+	int32_t NextUsedByInstance;
+	int32_t GeneratedCount;
+	int32_t MaxGenerationCount;
+	float NextGenerationTime;
+	bool IsReferencedFromInstance;
+	SIMD::Mat43f ParentMatrix;
+	SIMD::Mat43f ParentRotation;
+	SIMD::Vec3f ParentTranslation;
+	SIMD::Vec3f ParentScale;
+	decltype(InstanceGroup::rendererValues) RendererValues;
+};
+
+//! a state of an instance. pointers are replaced with indexes
+struct SnapshotInstance
+{
+	int32_t GroupIndex;
+	int32_t ParentIndex;
+	int32_t ChildrenGroupIndex;
+	Instance::State State;
+};
+
+template <typename T>
+static void WriteSnapshotValue(CustomVector<uint8_t>& dst, const T& value)
+{
+	const auto p = reinterpret_cast<const uint8_t*>(&value);
+	dst.insert(dst.end(), p, p + sizeof(T));
+}
+
+static void CollectEffectNodes(EffectNode* node, CustomVector<EffectNode*>& nodes)
+{
+	nodes.push_back(node);
+
+	for (int i = 0; i < node->GetChildrenCount(); i++)
+	{
+		CollectEffectNodes(node->GetChild(i), nodes);
+	}
+}
+
+//! validate a snapshot and get offsets of draw sets in it
+static bool GetSnapshotDrawSetOffsets(const Manager::Snapshot& snapshot, CustomVector<size_t>& offsets)
+{
+	BinaryReader<true> reader(const_cast<uint8_t*>(snapshot.Data.data()), snapshot.Data.size());
+
+	SnapshotHeader header;
+	if (!reader.Read(header) || header.Magic != SnapshotMagic || header.Version != SnapshotVersion || header.DrawSetCount < 0)
+	{
+		Log(LogType::Warning, "Snapshot : Invalid header");
+		return false;
+	}
+
+	CustomVector<EffectNode*> nodes;
+	CustomVector<SnapshotGroup> groups;
+
+	for (int32_t i = 0; i < header.DrawSetCount; i++)
+	{
+		offsets.push_back(reader.GetOffset());
+
+		SnapshotDrawSet record;
+		if (!reader.Read(record) || record.EffectIndex < 0 || record.EffectIndex >= static_cast<int32_t>(snapshot.Effects.size()) ||
+			snapshot.Effects[record.EffectIndex] == nullptr)
+		{
+			Log(LogType::Warning, "Snapshot : Invalid effect");
+			return false;
+		}
+
+		// an effect may be reloaded after saving
+		nodes.clear();
+		CollectEffectNodes(snapshot.Effects[record.EffectIndex]->GetRoot(), nodes);
+
+		if (record.NodeCount != static_cast<int32_t>(nodes.size()))
+		{
+			Log(LogType::Warning, "Snapshot : Nodes are changed");
+			return false;
+		}
+
+		for (auto node : nodes)
+		{
+			int32_t nodeType = 0;
+			if (!reader.Read(nodeType) || nodeType != static_cast<int32_t>(node->GetNodeType()))
+			{
+				Log(LogType::Warning, "Snapshot : Nodes are changed");
+				return false;
+			}
+		}
+
+		if (!reader.Read(groups, record.GroupCount))
+		{
+			Log(LogType::Warning, "Snapshot : Invalid groups");
+			return false;
+		}
+
+		for (const auto& group : groups)
+		{
+			if (group.ContainerIndex < 0 || group.ContainerIndex >= record.NodeCount || group.NextUsedByInstance < -1 ||
+				group.NextUsedByInstance >= record.GroupCount)
+			{
+				Log(LogType::Warning, "Snapshot : Invalid groups");
+				return false;
+			}
+		}
+
+		for (int32_t j = 0; j < record.InstanceCount; j++)
+		{
+			SnapshotInstance instance;
+			if (!reader.Read(instance) || instance.GroupIndex < 0 || instance.GroupIndex >= record.GroupCount || instance.ParentIndex < -1 ||
+				instance.ParentIndex >= record.InstanceCount || instance.ChildrenGroupIndex < -1 || instance.ChildrenGroupIndex >= record.GroupCount)
+			{
+				Log(LogType::Warning, "Snapshot : Invalid instances");
+				return false;
+			}
+		}
+	}
+
+	return reader.GetStatus() == BinaryReaderStatus::Complete;
+}
+
+void ManagerImplemented::CollectInstanceContainers(InstanceContainer* container, CustomVector<InstanceContainer*>& containers)
+{
+	containers.push_back(container);
+
+	for (auto child : container->m_Children)
+	{
+		CollectInstanceContainers(child, containers);
+	}
+}
+
+bool ManagerImplemented::WriteSnapshot(const DrawSet& drawSet, Snapshot& snapshot)
+{
+	auto effectIt = std::find(snapshot.Effects.begin(), snapshot.Effects.end(), drawSet.ParameterPointer);
+	const auto effectIndex = static_cast<int32_t>(std::distance(snapshot.Effects.begin(), effectIt));
+	if (effectIt == snapshot.Effects.end())
+	{
+		snapshot.Effects.push_back(drawSet.ParameterPointer);
+	}
+
+	CustomVector<EffectNode*> nodes;
+	CollectEffectNodes(drawSet.ParameterPointer->GetRoot(), nodes);
+
+	CustomVector<InstanceContainer*> containers;
+	if (drawSet.InstanceContainerPointer != nullptr)
+	{
+		CollectInstanceContainers(drawSet.InstanceContainerPointer, containers);
+	}
+
+	// groups and instances are saved in the order of lists to restore the order
+	CustomVector<SnapshotGroup> groups;
+	CustomVector<Instance*> instances;
+	CustomUnorderedMap<const InstanceGroup*, int32_t> groupIndexes;
+	CustomUnorderedMap<const Instance*, int32_t> instanceIndexes;
+
+	for (size_t i = 0; i < containers.size(); i++)
+	{
+		for (auto group = containers[i]->m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+		{
+			groupIndexes[group] = static_cast<int32_t>(groups.size());
+
+			SnapshotGroup record = SnapshotGroup();
+			record.ContainerIndex = static_cast<int32_t>(i);
+			record.GeneratedCount = group->m_generatedCount;
+			record.MaxGenerationCount = group->m_maxGenerationCount;
+			record.NextGenerationTime = group->m_nextGenerationTime;
+			record.IsReferencedFromInstance = group->IsReferencedFromInstance;
+			record.ParentMatrix = group->parentMatrix_;
+			record.ParentRotation = group->parentRotation_;
+			record.ParentTranslation = group->parentTranslation_;
+			record.ParentScale = group->parentScale_;
+			record.RendererValues = group->rendererValues;
+			groups.push_back(record);
+
+			for (auto instance : group->m_instances)
+			{
+				instanceIndexes[instance] = static_cast<int32_t>(instances.size());
+				instances.push_back(instance);
+			}
+		}
+	}
+
+	auto getGroupIndex = [&groupIndexes](const InstanceGroup* group) -> int32_t {
+		auto it = groupIndexes.find(group);
+		return it != groupIndexes.end() ? it->second : -1;
+	};
+
+	for (size_t i = 0; i < containers.size(); i++)
+	{
+		for (auto group = containers[i]->m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+		{
+			groups[groupIndexes[group]].NextUsedByInstance = getGroupIndex(group->NextUsedByInstance);
+		}
+	}
+
+	const auto pGlobal = drawSet.GlobalPointer;
+
+	SnapshotDrawSet record = SnapshotDrawSet();
+	record.Self = drawSet.Self;
+	record.EffectIndex = effectIndex;
+	record.NodeCount = static_cast<int32_t>(nodes.size());
+	record.GroupCount = static_cast<int32_t>(groups.size());
+	record.InstanceCount = static_cast<int32_t>(instances.size());
+	record.RandomSeed = drawSet.RandomSeed;
+	record.StartFrame = drawSet.StartFrame;
+	record.Layer = drawSet.Layer;
+	record.GroupMask = drawSet.GroupMask;
+	record.Speed = drawSet.Speed;
+	record.NextUpdateFrame = drawSet.NextUpdateFrame;
+	record.TimeScale = drawSet.TimeScale;
+	record.PrewarmFrame = drawSet.PrewarmFrame;
+	record.PrewarmStepFrame = drawSet.PrewarmStepFrame;
+	record.IsPaused = drawSet.IsPaused;
+	record.IsShown = drawSet.IsShown;
+	record.IsAutoDrawing = drawSet.IsAutoDrawing;
+	record.DoUseBaseMatrix = drawSet.DoUseBaseMatrix;
+	record.GoingToStop = drawSet.GoingToStop;
+	record.GoingToStopRoot = drawSet.GoingToStopRoot;
+	record.IsPreupdated = drawSet.IsPreupdated && drawSet.InstanceContainerPointer != nullptr;
+	record.RemovingCallback = drawSet.RemovingCallback;
+	record.Rotation = drawSet.Rotation;
+	record.Scaling = drawSet.Scaling;
+	record.BaseMatrix = drawSet.BaseMatrix;
+	record.GlobalMatrix = drawSet.GlobalMatrix;
+	record.UpdatedFrame = pGlobal->m_updatedFrame;
+	record.NextDeltaFrame = pGlobal->nextDeltaFrame_;
+	record.GlobalRandomSeed = pGlobal->m_randObjects.GetSeed();
+	record.TargetLocation = pGlobal->m_targetLocation;
+	record.DynamicInputParameters = pGlobal->dynamicInputParameters;
+	record.DynamicEqResults = pGlobal->dynamicEqResults;
+	record.IsGlobalColorSet = pGlobal->IsGlobalColorSet;
+	record.GlobalColor = pGlobal->GlobalColor;
+	record.UserData = pGlobal->m_userData;
+
+	auto& data = snapshot.Data;
+	data.reserve(data.size() + sizeof(SnapshotDrawSet) + sizeof(int32_t) * nodes.size() + sizeof(SnapshotGroup) * groups.size() +
+				 sizeof(SnapshotInstance) * instances.size());
+
+	WriteSnapshotValue(data, record);
+
+	for (auto node : nodes)
+	{
+		WriteSnapshotValue(data, static_cast<int32_t>(node->GetNodeType()));
+	}
+
+	for (const auto& group : groups)
+	{
+		WriteSnapshotValue(data, group);
+	}
+
+	for (auto instance : instances)
+	{
+		auto parentIt = instanceIndexes.find(instance->m_pParent);
+
+		SnapshotInstance instanceRecord = SnapshotInstance();
+		instanceRecord.GroupIndex = getGroupIndex(instance->ownGroup_);
+		instanceRecord.ParentIndex = parentIt != instanceIndexes.end() ? parentIt->second : -1;
+		instanceRecord.ChildrenGroupIndex = getGroupIndex(instance->childrenGroups_);
+		instance->SaveState(instanceRecord.State);
+		WriteSnapshotValue(data, instanceRecord);
+	}
+
+	return true;
+}
+
+bool ManagerImplemented::ReadSnapshot(DrawSet& drawSet, const Snapshot& snapshot, size_t offset, bool isCreated)
+{
+	// the snapshot must be validated with GetSnapshotDrawSetOffsets
+	BinaryReader<false> reader(const_cast<uint8_t*>(snapshot.Data.data()), snapshot.Data.size());
+	reader.AddOffset(offset);
+
+	SnapshotDrawSet record;
+	reader.Read(record);
+	reader.AddOffset(sizeof(int32_t) * record.NodeCount);
+
+	if (drawSet.InstanceContainerPointer != nullptr)
+	{
+		drawSet.InstanceContainerPointer->KillAllInstances(true);
+		drawSet.InstanceContainerPointer->RemoveForcibly(true);
+		ReleaseInstanceContainer(drawSet.InstanceContainerPointer);
+		drawSet.InstanceContainerPointer = nullptr;
+	}
+
+	const auto& effect = snapshot.Effects[record.EffectIndex];
+	auto pGlobal = drawSet.GlobalPointer;
+
+	drawSet.ParameterPointer = effect;
+	drawSet.RandomSeed = record.RandomSeed;
+	drawSet.StartFrame = record.StartFrame;
+	drawSet.Layer = record.Layer;
+	drawSet.GroupMask = record.GroupMask;
+	drawSet.Speed = record.Speed;
+	drawSet.NextUpdateFrame = record.NextUpdateFrame;
+	drawSet.TimeScale = record.TimeScale;
+	drawSet.PrewarmFrame = record.PrewarmFrame;
+	drawSet.PrewarmStepFrame = record.PrewarmStepFrame;
+	drawSet.IsPaused = record.IsPaused;
+	drawSet.IsShown = record.IsShown;
+	drawSet.IsAutoDrawing = record.IsAutoDrawing;
+	drawSet.DoUseBaseMatrix = record.DoUseBaseMatrix;
+	drawSet.GoingToStop = record.GoingToStop;
+	drawSet.GoingToStopRoot = record.GoingToStopRoot;
+	drawSet.IsPreupdated = record.IsPreupdated;
+	drawSet.IsRemoving = false;
+	drawSet.IsParameterChanged = true;
+	drawSet.Rotation = record.Rotation;
+	drawSet.Scaling = record.Scaling;
+	drawSet.BaseMatrix = record.BaseMatrix;
+	drawSet.GlobalMatrix = record.GlobalMatrix;
+
+	if (isCreated)
+	{
+		drawSet.RemovingCallback = record.RemovingCallback;
+		pGlobal->m_userData = record.UserData;
+	}
+
+	pGlobal->m_instanceCount = 0;
+	pGlobal->m_rootContainer = nullptr;
+	pGlobal->RenderedInstanceContainers.resize(effect->GetImplemented()->renderingNodesCount);
+	for (size_t i = 0; i < pGlobal->RenderedInstanceContainers.size(); i++)
+	{
+		pGlobal->RenderedInstanceContainers[i] = nullptr;
+	}
+
+	bool result = true;
+
+	if (record.IsPreupdated)
+	{
+		drawSet.InstanceContainerPointer = CreateInstanceContainer(effect->GetRoot(), pGlobal, false, SIMD::Mat43f::Identity, nullptr);
+
+		if (drawSet.InstanceContainerPointer != nullptr)
+		{
+			pGlobal->SetRootContainer(drawSet.InstanceContainerPointer);
+
+			CustomVector<InstanceContainer*> containers;
+			CollectInstanceContainers(drawSet.InstanceContainerPointer, containers);
+
+			// if the pool is exhausted, groups and instances are lacked as well as when they are generated, and false is returned
+			CustomVector<SnapshotGroup> groupRecords;
+			reader.Read(groupRecords, record.GroupCount);
+
+			// groups of children are created by the constructors of instances, and other groups are created when they are required
+			CustomVector<InstanceGroup*> groups;
+			CustomVector<bool> isCreatedByInstance;
+			groups.resize(groupRecords.size(), nullptr);
+			isCreatedByInstance.resize(groupRecords.size(), false);
+
+			auto getGroup = [&](int32_t index) -> InstanceGroup* {
+				if (groups[index] == nullptr)
+				{
+					groups[index] = containers[groupRecords[index].ContainerIndex]->CreateInstanceGroup();
+				}
+				return groups[index];
+			};
+
+			CustomVector<Instance*> instances;
+			CustomVector<int32_t> parentIndexes;
+			instances.reserve(record.InstanceCount);
+			parentIndexes.reserve(record.InstanceCount);
+
+			for (int32_t i = 0; i < record.InstanceCount; i++)
+			{
+				SnapshotInstance instanceRecord;
+				reader.Read(instanceRecord);
+
+				auto group = getGroup(instanceRecord.GroupIndex);
+				auto instance = group != nullptr ? CreateInstance(group->m_effectNode, group->m_container, group) : nullptr;
+
+				if (instance != nullptr)
+				{
+					instance->LoadState(instanceRecord.State);
+
+					// a parent is saved before children because containers are saved from the root
+					auto childGroup = instance->childrenGroups_;
+					for (auto index = instanceRecord.ChildrenGroupIndex; index >= 0 && childGroup != nullptr; index = groupRecords[index].NextUsedByInstance)
+					{
+						if (groups[index] != nullptr)
+						{
+							break;
+						}
+
+						groups[index] = childGroup;
+						isCreatedByInstance[index] = true;
+						childGroup = childGroup->NextUsedByInstance;
+					}
+
+					group->m_instances.push_back(instance);
+					pGlobal->IncInstanceCount();
+				}
+				else
+				{
+					result = false;
+				}
+
+				instances.push_back(instance);
+				parentIndexes.push_back(instanceRecord.ParentIndex);
+			}
+
+			for (size_t i = 0; i < instances.size(); i++)
+			{
+				if (instances[i] != nullptr && parentIndexes[i] >= 0)
+				{
+					instances[i]->m_pParent = instances[parentIndexes[i]];
+				}
+			}
+
+			CustomUnorderedMap<const InstanceGroup*, int32_t> groupOrders;
+
+			for (size_t i = 0; i < groups.size(); i++)
+			{
+				const auto& groupRecord = groupRecords[i];
+				auto group = getGroup(static_cast<int32_t>(i));
+				if (group == nullptr)
+				{
+					result = false;
+					continue;
+				}
+
+				group->m_generatedCount = groupRecord.GeneratedCount;
+				group->m_maxGenerationCount = groupRecord.MaxGenerationCount;
+				group->m_nextGenerationTime = groupRecord.NextGenerationTime;
+				group->IsReferencedFromInstance = groupRecord.IsReferencedFromInstance;
+				group->parentMatrix_ = groupRecord.ParentMatrix;
+				group->parentRotation_ = groupRecord.ParentRotation;
+				group->parentTranslation_ = groupRecord.ParentTranslation;
+				group->parentScale_ = groupRecord.ParentScale;
+				group->rendererValues = groupRecord.RendererValues;
+
+				if (!isCreatedByInstance[i])
+				{
+					const auto next = groupRecord.NextUsedByInstance;
+					group->NextUsedByInstance = next >= 0 ? groups[next] : nullptr;
+				}
+
+				groupOrders[group] = static_cast<int32_t>(i);
+			}
+
+			// groups of children are created in the order of parents, so lists of containers are sorted in the saved order
+			auto getGroupOrder = [&groupOrders](const InstanceGroup* group) -> int32_t {
+				auto it = groupOrders.find(group);
+				return it != groupOrders.end() ? it->second : std::numeric_limits<int32_t>::max();
+			};
+
+			for (auto container : containers)
+			{
+				CustomVector<InstanceGroup*> containerGroups;
+				for (auto group = container->m_headGroups; group != nullptr; group = group->NextUsedByContainer)
+				{
+					containerGroups.push_back(group);
+				}
+
+				std::stable_sort(containerGroups.begin(), containerGroups.end(), [&getGroupOrder](const InstanceGroup* a, const InstanceGroup* b) {
+					return getGroupOrder(a) < getGroupOrder(b);
+				});
+
+				container->m_headGroups = nullptr;
+				container->m_tailGroups = nullptr;
+
+				for (auto group : containerGroups)
+				{
+					group->NextUsedByContainer = nullptr;
+
+					if (container->m_tailGroups != nullptr)
+					{
+						container->m_tailGroups->NextUsedByContainer = group;
+					}
+					else
+					{
+						container->m_headGroups = group;
+					}
+					container->m_tailGroups = group;
+				}
+			}
+		}
+		else
+		{
+			drawSet.IsRemoving = true;
+			result = false;
+		}
+	}
+
+	// groups consume random numbers while initializing, so the generator is restored after it
+	pGlobal->m_updatedFrame = record.UpdatedFrame;
+	pGlobal->nextDeltaFrame_ = record.NextDeltaFrame;
+	pGlobal->m_randObjects.SetSeed(record.GlobalRandomSeed);
+	pGlobal->m_targetLocation = record.TargetLocation;
+	pGlobal->dynamicInputParameters = record.DynamicInputParameters;
+	pGlobal->dynamicEqResults = record.DynamicEqResults;
+	pGlobal->IsGlobalColorSet = record.IsGlobalColorSet;
+	pGlobal->GlobalColor = record.GlobalColor;
+
+	return result;
+}
+
+bool ManagerImplemented::SaveSnapshot(Handle handle, Snapshot& snapshot)
+{
+	snapshot.Data.clear();
+	snapshot.Effects.clear();
+
+	auto it = m_DrawSets.find(handle);
+	if (it == m_DrawSets.end() || it->second.IsRemoving)
+	{
+		return false;
+	}
+
+	SnapshotHeader header;
+	header.Magic = SnapshotMagic;
+	header.Version = SnapshotVersion;
+	header.DrawSetCount = 1;
+	WriteSnapshotValue(snapshot.Data, header);
+
+	return WriteSnapshot(it->second, snapshot);
+}
+
+bool ManagerImplemented::SaveSnapshot(Snapshot& snapshot)
+{
+	snapshot.Data.clear();
+	snapshot.Effects.clear();
+
+	SnapshotHeader header;
+	header.Magic = SnapshotMagic;
+	header.Version = SnapshotVersion;
+	header.DrawSetCount = static_cast<int32_t>(std::count_if(m_DrawSets.begin(), m_DrawSets.end(), [](const std::pair<const Handle, DrawSet>& v) { return !v.second.IsRemoving; }));
+	WriteSnapshotValue(snapshot.Data, header);
+
+	for (const auto& it : m_DrawSets)
+	{
+		if (it.second.IsRemoving)
+		{
+			continue;
+		}
+
+		if (!WriteSnapshot(it.second, snapshot))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ManagerImplemented::LoadSnapshot(Handle handle, const Snapshot& snapshot)
+{
+	auto it = m_DrawSets.find(handle);
+	if (it == m_DrawSets.end())
+	{
+		return false;
+	}
+
+	CustomVector<size_t> offsets;
+	if (!GetSnapshotDrawSetOffsets(snapshot, offsets) || offsets.size() != 1)
+	{
+		return false;
+	}
+
+	return ReadSnapshot(it->second, snapshot, offsets[0], false);
+}
+
+bool ManagerImplemented::LoadSnapshot(const Snapshot& snapshot)
+{
+	CustomVector<size_t> offsets;
+	if (!GetSnapshotDrawSetOffsets(snapshot, offsets))
+	{
+		return false;
+	}
+
+	bool result = true;
+	CustomSet<Handle> restoredHandles;
+
+	for (auto offset : offsets)
+	{
+		SnapshotDrawSet record;
+		memcpy(&record, snapshot.Data.data() + offset, sizeof(SnapshotDrawSet));
+
+		restoredHandles.insert(record.Self);
+
+		auto it = m_DrawSets.find(record.Self);
+		if (it != m_DrawSets.end())
+		{
+			result &= ReadSnapshot(it->second, snapshot, offset, false);
+		}
+		else
+		{
+			// a draw set of a removed handle is disposed in GCDrawSet with other maps, so the handle can be reused
+			DrawSet drawSet(snapshot.Effects[record.EffectIndex], nullptr, new InstanceGlobal());
+			drawSet.Self = record.Self;
+			m_DrawSets[record.Self] = drawSet;
+
+			result &= ReadSnapshot(m_DrawSets[record.Self], snapshot, offset, true);
+		}
+	}
+
+	for (auto& it : m_DrawSets)
+	{
+		if (restoredHandles.count(it.first) == 0)
+		{
+			StopEffect(it.first);
+		}
+	}
+
+	return result;
+}
+
+void ManagerImplemented::Draw(const Manager::DrawParameter& drawParameter)
+{
+	PROFILER_BLOCK("Manager::Draw", profiler::colors::Blue);
+
+	if (m_WorkerThreads.size() > 0)
+	{
+		m_WorkerThreads[0].WaitForComplete();
+	}
+
+	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
+
+	SetRenderingFrustum(drawParameter);
+	occlusionDepthPyramid_.Build(drawParameter.OcclusionDepth, drawParameter.OcclusionDepthWidth, drawParameter.OcclusionDepthHeight);
+
+	// start to record a time
+	int64_t beginTime = ::Effekseer::GetTime();
+
+	const auto render = [this, &drawParameter](DrawSet& drawSet) -> void {
+		if (drawSet.InstanceContainerPointer == nullptr)
+		{
+			return;
+		}
+
+		if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
+		{
+			if (IsSkippedWithScreenCoverage(drawSet, drawParameter))
+			{
+				return;
+			}
+
+			if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
+			{
+				for (auto& c : drawSet.GlobalPointer->RenderedInstanceContainers)
+				{
+					if (IsClippedWithDepth(drawSet, c, drawParameter))
+						continue;
 
 					c->Draw(false);
 				}
@@ -1857,8 +2960,13 @@ void ManagerImplemented::Draw(const Manager::DrawParameter& drawParameter)
 
 void ManagerImplemented::DrawBack(const Manager::DrawParameter& drawParameter)
 {
+	PROFILER_BLOCK("Manager::DrawBack", profiler::colors::Blue);
+
 	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
 
+	SetRenderingFrustum(drawParameter);
+	occlusionDepthPyramid_.Build(drawParameter.OcclusionDepth, drawParameter.OcclusionDepthWidth, drawParameter.OcclusionDepthHeight);
+
 	// start to record a time
 	int64_t beginTime = ::Effekseer::GetTime();
 
@@ -1870,6 +2978,11 @@ void ManagerImplemented::DrawBack(const Manager::DrawParameter& drawParameter)
 
 		if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
 		{
+			if (IsSkippedWithScreenCoverage(drawSet, drawParameter))
+			{
+				return;
+			}
+
 			auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
 			for (int32_t j = 0; j < e->renderingNodesThreshold; j++)
 			{
@@ -1914,8 +3027,13 @@ void ManagerImplemented::DrawBack(const Manager::DrawParameter& drawParameter)
 
 void ManagerImplemented::DrawFront(const Manager::DrawParameter& drawParameter)
 {
+	PROFILER_BLOCK("Manager::DrawFront", profiler::colors::Blue);
+
 	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
 
+	SetRenderingFrustum(drawParameter);
+	occlusionDepthPyramid_.Build(drawParameter.OcclusionDepth, drawParameter.OcclusionDepthWidth, drawParameter.OcclusionDepthHeight);
+
 	// start to record a time
 	int64_t beginTime = ::Effekseer::GetTime();
 
@@ -1927,6 +3045,11 @@ void ManagerImplemented::DrawFront(const Manager::DrawParameter& drawParameter)
 
 		if (drawSet.IsShown && drawSet.IsAutoDrawing && ((drawParameter.CameraCullingMask & (1 << drawSet.Layer)) != 0))
 		{
+			if (IsSkippedWithScreenCoverage(drawSet, drawParameter))
+			{
+				return;
+			}
+
 			if (drawSet.GlobalPointer->RenderedInstanceContainers.size() > 0)
 			{
 				auto e = (EffectImplemented*)drawSet.ParameterPointer.Get();
@@ -2041,6 +3164,8 @@ int ManagerImplemented::GetCameraCullingMaskToShowAllEffects()
 
 void ManagerImplemented::DrawHandle(Handle handle, const Manager::DrawParameter& drawParameter)
 {
+	PROFILER_BLOCK("Manager::DrawHandle", profiler::colors::Blue);
+
 	if (m_WorkerThreads.size() > 0)
 	{
 		m_WorkerThreads[0].WaitForComplete();
@@ -2048,6 +3173,8 @@ void ManagerImplemented::DrawHandle(Handle handle, const Manager::DrawParameter&
 
 	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
 
+	SetRenderingFrustum(drawParameter);
+
 	auto it = m_renderingDrawSetMaps.find(handle);
 	if (it != m_renderingDrawSetMaps.end())
 	{
@@ -2106,6 +3233,8 @@ void ManagerImplemented::DrawHandle(Handle handle, const Manager::DrawParameter&
 
 void ManagerImplemented::DrawHandleBack(Handle handle, const Manager::DrawParameter& drawParameter)
 {
+	PROFILER_BLOCK("Manager::DrawHandleBack", profiler::colors::Blue);
+
 	if (m_WorkerThreads.size() > 0)
 	{
 		m_WorkerThreads[0].WaitForComplete();
@@ -2113,6 +3242,8 @@ void ManagerImplemented::DrawHandleBack(Handle handle, const Manager::DrawParame
 
 	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
 
+	SetRenderingFrustum(drawParameter);
+
 	std::map<Handle, DrawSet>::iterator it = m_renderingDrawSetMaps.find(handle);
 	if (it != m_renderingDrawSetMaps.end())
 	{
@@ -2153,6 +3284,8 @@ void ManagerImplemented::DrawHandleBack(Handle handle, const Manager::DrawParame
 
 void ManagerImplemented::DrawHandleFront(Handle handle, const Manager::DrawParameter& drawParameter)
 {
+	PROFILER_BLOCK("Manager::DrawHandleFront", profiler::colors::Blue);
+
 	if (m_WorkerThreads.size() > 0)
 	{
 		m_WorkerThreads[0].WaitForComplete();
@@ -2160,6 +3293,8 @@ void ManagerImplemented::DrawHandleFront(Handle handle, const Manager::DrawParam
 
 	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
 
+	SetRenderingFrustum(drawParameter);
+
 	std::map<Handle, DrawSet>::iterator it = m_renderingDrawSetMaps.find(handle);
 	if (it != m_renderingDrawSetMaps.end())
 	{
@@ -2229,7 +3364,203 @@ int ManagerImplemented::GetDrawTime() const
 
 int32_t ManagerImplemented::GetRestInstancesCount() const
 {
-	return static_cast<int32_t>(pooledChunks_.size()) * InstanceChunk::InstancesOfChunk;
+	return (pooledChunks_.GetCount() + pooledChunks_.GetGrowableCount()) * InstanceChunk::InstancesOfChunk;
+}
+
+void ManagerImplemented::SetSpawnBudget(const SpawnBudgetParameter& parameter)
+{
+	spawnBudget_ = parameter;
+	spawnBudget_.ThrottlingRatio = Clamp(spawnBudget_.ThrottlingRatio, 1.0f, 0.0f);
+
+	if (spawnBudget_.MaxInstanceCount <= 0)
+	{
+		for (auto& it : m_DrawSets)
+		{
+			it.second.GlobalPointer->SpawnRate = 1.0f;
+		}
+	}
+}
+
+int32_t ManagerImplemented::GetTotalDroppedSpawnCount() const
+{
+	return droppedSpawnCount_;
+}
+
+void ManagerImplemented::UpdateSpawnRates()
+{
+	if (spawnBudget_.MaxInstanceCount <= 0)
+	{
+		return;
+	}
+
+	budgetedInstanceCount_ = GetTotalInstanceCount();
+
+	for (auto& it : m_DrawSets)
+	{
+		UpdateSpawnRate(it.second);
+	}
+}
+
+void ManagerImplemented::UpdateSpawnRate(DrawSet& drawSet)
+{
+	const auto fill = static_cast<float>(budgetedInstanceCount_) / static_cast<float>(spawnBudget_.MaxInstanceCount);
+	const auto start = spawnBudget_.ThrottlingRatio;
+	const auto halvingDistance = spawnBudget_.PriorityHalvingDistance;
+	auto priority = drawSet.SpawnPriority;
+
+	if (halvingDistance > 0.0f)
+	{
+		const auto distance = (drawSet.GlobalMatrix.GetTranslation() - SIMD::Vec3f(spawnBudget_.ViewerPosition)).GetLength();
+		priority *= halvingDistance / (halvingDistance + distance);
+	}
+
+	// spawning is throttled linearly from start to a limit which depends on the priority
+	const auto limit = start + (1.0f - start) * priority;
+
+	if (limit - start > FLT_EPSILON)
+	{
+		drawSet.GlobalPointer->SpawnRate = Clamp((limit - fill) / (limit - start), 1.0f, 0.0f);
+	}
+	else
+	{
+		drawSet.GlobalPointer->SpawnRate = fill < start ? 1.0f : 0.0f;
+	}
+}
+
+bool ManagerImplemented::IsSpawnThrottled(const InstanceGlobal* global, float& spawnCredit)
+{
+	if (spawnBudget_.MaxInstanceCount <= 0)
+	{
+		return false;
+	}
+
+	if (budgetedInstanceCount_ >= spawnBudget_.MaxInstanceCount)
+	{
+		return true;
+	}
+
+	if (global->SpawnRate >= 1.0f)
+	{
+		return false;
+	}
+
+	// spawn instances at the rate evenly
+	spawnCredit += global->SpawnRate;
+	if (spawnCredit >= 1.0f)
+	{
+		spawnCredit -= 1.0f;
+		return false;
+	}
+
+	return true;
+}
+
+void ManagerImplemented::AddDroppedSpawn(InstanceGlobal* global)
+{
+	global->DroppedSpawnCount++;
+	droppedSpawnCount_++;
+}
+
+void ManagerImplemented::SetProfilingEnabled(bool enabled, int32_t frameCount)
+{
+	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
+
+	isProfilingEnabled_ = enabled;
+	nextProfiledFrameIndex_ = 0;
+	profiledFrameCount_ = 0;
+	profiledFrames_.clear();
+
+	if (enabled)
+	{
+		profiledFrames_.resize(std::max(frameCount, 1));
+	}
+}
+
+int32_t ManagerImplemented::GetProfiledFrameCount() const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
+	return profiledFrameCount_;
+}
+
+bool ManagerImplemented::GetProfiledFrame(int32_t index, ProfiledFrame& frame) const
+{
+	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
+
+	if (index < 0 || index >= profiledFrameCount_)
+	{
+		return false;
+	}
+
+	const auto size = static_cast<int32_t>(profiledFrames_.size());
+	frame = profiledFrames_[(nextProfiledFrameIndex_ - 1 - index + size) % size];
+	return true;
+}
+
+void ManagerImplemented::RecordProfiledFrame()
+{
+	// it is already locked in BeginUpdate, but it is locked again because the ring buffer may be resized on another thread
+	std::lock_guard<std::recursive_mutex> lock(m_renderingMutex);
+
+	auto& frame = profiledFrames_[nextProfiledFrameIndex_];
+	frame.UpdateTime = m_updateTime;
+	frame.DrawTime = m_drawTime;
+	frame.Handles.clear();
+	frame.Nodes.clear();
+
+	for (auto& it : m_DrawSets)
+	{
+		auto& drawSet = it.second;
+		if (drawSet.InstanceContainerPointer == nullptr)
+		{
+			continue;
+		}
+
+		ProfiledHandle handleValues;
+		handleValues.EffectHandle = it.first;
+		handleValues.Effect = drawSet.ParameterPointer;
+
+		CollectProfiledNodes(drawSet.InstanceContainerPointer, it.first, frame, handleValues);
+		frame.Handles.emplace_back(handleValues);
+	}
+
+	nextProfiledFrameIndex_ = (nextProfiledFrameIndex_ + 1) % static_cast<int32_t>(profiledFrames_.size());
+	profiledFrameCount_ = std::min(profiledFrameCount_ + 1, static_cast<int32_t>(profiledFrames_.size()));
+}
+
+void ManagerImplemented::CollectProfiledNodes(InstanceContainer* container, Handle handle, ProfiledFrame& frame, ProfiledHandle& handleValues)
+{
+	ProfiledNode node;
+	node.EffectHandle = handle;
+	node.Node = container->m_pEffectNode;
+	node.UpdateTime = container->profiledUpdateTime_.exchange(0) / 1000.0f;
+	node.SpawnedCount = container->profiledSpawnedCount_;
+	node.KilledCount = container->profiledKilledCount_;
+	node.VertexCount = container->profiledVertexCount_;
+	node.DrawCallCount = container->profiledDrawCallCount_;
+
+	for (auto group = container->GetFirstGroup(); group != nullptr; group = group->NextUsedByContainer)
+	{
+		node.InstanceCount += group->GetInstanceCount();
+	}
+
+	container->profiledSpawnedCount_ = 0;
+	container->profiledKilledCount_ = 0;
+	container->profiledVertexCount_ = 0;
+	container->profiledDrawCallCount_ = 0;
+
+	handleValues.UpdateTime += node.UpdateTime;
+	handleValues.InstanceCount += node.InstanceCount;
+	handleValues.SpawnedCount += node.SpawnedCount;
+	handleValues.KilledCount += node.KilledCount;
+	handleValues.VertexCount += node.VertexCount;
+	handleValues.DrawCallCount += node.DrawCallCount;
+
+	frame.Nodes.emplace_back(node);
+
+	for (auto child : container->m_Children)
+	{
+		CollectProfiledNodes(child, handle, frame, handleValues);
+	}
 }
 
 void ManagerImplemented::BeginReloadEffect(const EffectRef& effect, bool doLockThread)
@@ -2281,12 +3612,48 @@ void ManagerImplemented::EndReloadEffect(const EffectRef& effect, bool doLockThr
 	}
 }
 
+void ManagerImplemented::ReplaceEffectNodes(const EffectRef& effect, const CustomMap<EffectNodeImplemented*, EffectNodeImplemented*>& effectNodes)
+{
+	auto replace = [&](DrawSet& ds) {
+		if (ds.ParameterPointer != effect || ds.InstanceContainerPointer == nullptr)
+			return;
+
+		ds.InstanceContainerPointer->ReplaceEffectNodes(effectNodes);
+	};
+
+	for (auto& it : m_DrawSets)
+	{
+		replace(it.second);
+	}
+
+	// instances are still updated while removing
+	for (auto& removingDrawSets : m_RemovingDrawSets)
+	{
+		for (auto& it : removingDrawSets)
+		{
+			replace(it.second);
+		}
+	}
+}
+
 void ManagerImplemented::CreateCullingWorld(float xsize, float ysize, float zsize, int32_t layerCount)
 {
 	cullingNext.SizeX = xsize;
 	cullingNext.SizeY = ysize;
 	cullingNext.SizeZ = zsize;
 	cullingNext.LayerCount = layerCount;
+	cullingNext.IsTree = false;
+	cullingNext.Margin = 0.0f;
+}
+
+void ManagerImplemented::CreateCullingWorldWithTree(float margin)
+{
+	cullingNext.SizeX = 0.0f;
+	cullingNext.SizeY = 0.0f;
+	cullingNext.SizeZ = 0.0f;
+	cullingNext.LayerCount = 0;
+	cullingNext.IsTree = true;
+	cullingNext.Margin = margin;
 }
 
 void ManagerImplemented::CalcCulling(const Matrix44& cameraProjMat, bool isOpenGL)
@@ -2371,32 +3738,21 @@ void ManagerImplemented::RequestToPlaySound(Instance* instance, const EffectNode
 	}
 }
 
-void ManagerImplemented::ExecuteSounds()
+void ManagerImplemented::ExecuteSounds(float deltaFrame)
 {
-	if (m_requestedSounds.empty())
 	{
-		return;
-	}
-
-	std::lock_guard<std::mutex> lock(m_soundMutex);
+		std::lock_guard<std::mutex> lock(m_soundMutex);
 
-	auto player = GetSoundPlayer();
-	if (player != nullptr)
-	{
-		while (!m_requestedSounds.empty())
-		{
-			auto sound = m_requestedSounds.back();
-			player->Play(sound.first, sound.second);
-			m_requestedSounds.pop();
-		}
-	}
-	else
-	{
+		// requests are passed to the voice manager which limits voices
 		while (!m_requestedSounds.empty())
 		{
+			const auto& sound = m_requestedSounds.front();
+			soundVoiceManager_->Play(sound.first, sound.second);
 			m_requestedSounds.pop();
 		}
 	}
+
+	soundVoiceManager_->Update(deltaFrame);
 }
 
 } // namespace Effekseer
@@ -6,7 +6,9 @@
 // Include
 //----------------------------------------------------------------------------------
 #include "Effekseer.Base.h"
+#include "Effekseer.Matrix44.h"
 #include "Effekseer.Vector3D.h"
+#include "Utils/Effekseer.CustomAllocator.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -58,6 +60,208 @@ public:
 		bool SyncUpdate = true;
 	};
 
+	/**
+		@brief
+		\~English Parameters when an effect is fast-forwarded with Manager::PrewarmHandle
+		\~Japanese Manager::PrewarmHandleでエフェクトを早送りするときのパラメーター
+	*/
+	struct PrewarmParameter
+	{
+		/**
+			@brief
+			\~English Frames which are advanced at once
+			\~Japanese 一度に進めるフレーム数
+			@note
+			\~English Larger steps are faster but make movements and spawning timings less accurate.
+			\~Japanese 大きいほど高速だが、移動や生成のタイミングの精度が下がる。
+		*/
+		float StepFrame = 4.0f;
+
+		/**
+			@brief
+			\~English Fast-forward in the next Update instead of this call
+			\~Japanese この呼び出しではなく次のUpdateで早送りする
+			@note
+			\~English If Update is performed asynchronously, the effect is fast-forwarded on a worker thread.
+			\~Japanese Updateが非同期に実行される場合、エフェクトはワーカースレッドで早送りされる。
+		*/
+		bool IsDeferred = false;
+
+		PrewarmParameter();
+	};
+
+	/**
+		@brief
+		\~English States of playing effects which are saved with Manager::SaveSnapshot
+		\~Japanese Manager::SaveSnapshotで保存された再生中のエフェクトの状態
+		@note
+		\~English Data has values of instances instead of their memory, so it can be copied with memcpy. But a removing callback and user data in it are valid only in the process which has saved it.
+		\~Japanese Dataはインスタンスのメモリではなく値を持つため、memcpyでコピーできる。ただし、含まれる削除時のコールバックとユーザーデータは保存したプロセス内でのみ有効である。
+	*/
+	struct Snapshot
+	{
+		/**
+			@brief
+			\~English States of instances, instance groups and handles
+			\~Japanese インスタンス、インスタンスグループ、ハンドルの状態
+		*/
+		CustomVector<uint8_t> Data;
+
+		/**
+			@brief
+			\~English Effects which are referred from Data. They are kept alive while the snapshot exists.
+			\~Japanese Dataから参照されるエフェクト。スナップショットが存在する間は解放されない。
+		*/
+		CustomVector<EffectRef> Effects;
+	};
+
+	/**
+		@brief
+		\~English Parameters of memory for instances when a manager is created
+		\~Japanese マネージャーを生成するときのインスタンス用のメモリのパラメーター
+	*/
+	struct MemoryParameter
+	{
+		/**
+			@brief
+			\~English The number of instances which are allocated when a manager is created
+			\~Japanese マネージャーの生成時に確保されるインスタンス数
+		*/
+		int32_t InitialInstanceCount = 2048;
+
+		/**
+			@brief
+			\~English The maximum number of instances. Memory is added on demand with InitialInstanceCount instances at once until it reaches this value or 64 times InitialInstanceCount. If it is 0 or less, only the latter limit is applied. A warning is logged if it exceeds the latter limit.
+			\~Japanese 最大インスタンス数。この値かInitialInstanceCountの64倍に達するまで、InitialInstanceCount個のインスタンスずつ必要に応じてメモリが追加される。0以下の場合、後者の制限のみ適用される。後者の制限を超える場合は警告が出力される。
+		*/
+		int32_t MaxInstanceCount = 0;
+
+		/**
+			@brief
+			\~English The number of updates after which added memory is released if it is not used. If it is 0 or less, memory is not released.
+			\~Japanese 追加されたメモリが使われていない場合に解放されるまでの更新回数。0以下の場合、メモリは解放されない。
+		*/
+		int32_t ShrinkFrameCount = 0;
+	};
+
+	/**
+		@brief
+		\~English Parameters to throttle spawning instances before the number of instances reaches a budget
+		\~Japanese インスタンス数が予算に達する前にインスタンスの生成を抑制するためのパラメーター
+	*/
+	struct SpawnBudgetParameter
+	{
+		/**
+			@brief
+			\~English The maximum number of instances of all effects. If it is 0 or less, spawning is not throttled.
+			\~Japanese 全てのエフェクトのインスタンスの最大数。0以下の場合、生成は抑制されない。
+		*/
+		int32_t MaxInstanceCount = 0;
+
+		/**
+			@brief
+			\~English A ratio of MaxInstanceCount where spawning of effects with the lowest priority is stopped
+			\~Japanese 最も優先度が低いエフェクトの生成が停止されるMaxInstanceCountに対する割合
+			@note
+			\~English Spawning of an effect is throttled from this ratio to a ratio between this and 1 which depends on its priority.
+			\~Japanese エフェクトの生成は、この割合から、優先度に応じたこの値と1の間の割合までに抑制される。
+		*/
+		float ThrottlingRatio = 0.5f;
+
+		/**
+			@brief
+			\~English A position of a viewer to decrease priorities of distant effects
+			\~Japanese 遠くのエフェクトの優先度を下げるための視点の位置
+		*/
+		Vector3D ViewerPosition;
+
+		/**
+			@brief
+			\~English A distance where a priority of an effect is halved. If it is 0 or less, distances are ignored.
+			\~Japanese エフェクトの優先度が半分になる距離。0以下の場合、距離は無視される。
+		*/
+		float PriorityHalvingDistance = 0.0f;
+	};
+
+	/**
+		@brief
+		\~English Values which are profiled in a frame
+		\~Japanese 1フレームで計測された値
+	*/
+	struct ProfiledValues
+	{
+		/**
+			@brief
+			\~English A time to update instances (microseconds)
+			\~Japanese インスタンスの更新時間(マイクロ秒)
+		*/
+		float UpdateTime = 0.0f;
+
+		//! \~English The number of instances at the end of an update \~Japanese 更新終了時のインスタンス数
+		int32_t InstanceCount = 0;
+
+		//! \~English The number of spawned instances \~Japanese 生成されたインスタンス数
+		int32_t SpawnedCount = 0;
+
+		//! \~English The number of removed instances \~Japanese 削除されたインスタンス数
+		int32_t KilledCount = 0;
+
+		/**
+			@brief
+			\~English The number of vertices which renderers emit
+			\~Japanese レンダラーが出力する頂点数
+			@note
+			\~English It is estimated from types of nodes.
+			\~Japanese ノードの種類から推定される。
+		*/
+		int32_t VertexCount = 0;
+
+		//! \~English The number of times which instances are passed to renderers \~Japanese インスタンスがレンダラーに渡された回数
+		int32_t DrawCallCount = 0;
+	};
+
+	/**
+		@brief
+		\~English Values of a node of a playing effect which are profiled in a frame
+		\~Japanese 1フレームで計測された再生中のエフェクトのノードの値
+	*/
+	struct ProfiledNode : public ProfiledValues
+	{
+		Handle EffectHandle = -1;
+
+		EffectNode* Node = nullptr;
+	};
+
+	/**
+		@brief
+		\~English Values of a playing effect which are profiled in a frame
+		\~Japanese 1フレームで計測された再生中のエフェクトの値
+	*/
+	struct ProfiledHandle : public ProfiledValues
+	{
+		Handle EffectHandle = -1;
+
+		EffectRef Effect;
+	};
+
+	/**
+		@brief
+		\~English Values which are profiled from an update to the next update
+		\~Japanese 更新から次の更新までに計測された値
+	*/
+	struct ProfiledFrame
+	{
+		//! \~English A time of Update (microseconds) \~Japanese Updateの時間(マイクロ秒)
+		int32_t UpdateTime = 0;
+
+		//! \~English A time of the last Draw (microseconds) \~Japanese 最後のDrawの時間(マイクロ秒)
+		int32_t DrawTime = 0;
+
+		CustomVector<ProfiledHandle> Handles;
+
+		CustomVector<ProfiledNode> Nodes;
+	};
+
 	/**
 	@brief
 		@brief
@@ -95,6 +299,58 @@ public:
 		*/
 		bool IsSortingEffectsEnabled = false;
 
+		/**
+			@brief
+			\~English A matrix which is multiplied a camera matrix and a projection matrix
+			\~Japanese カメラ行列とプロジェクション行列を掛け合わせた行列
+			@note
+			\~English It is used only if IsInstanceCullingEnabled is true.
+			\~Japanese IsInstanceCullingEnabledがtrueの場合のみ使用される。
+		*/
+		Matrix44 ViewProjectionMatrix;
+
+		/**
+			@brief
+			\~English Whether nodes whose instances are outside of ViewProjectionMatrix are not drawn
+			\~Japanese ViewProjectionMatrixの外側にインスタンスがあるノードを描画しないかどうか
+			@note
+			\~English Bounding boxes of nodes are calculated in an update. Sprites and models from files are culled unless they have depth parameters, a view offset or a material file.
+			\~Japanese ノードのバウンディングボックスは更新時に計算される。スプライトとファイルのモデルは深度パラメーター、ビューオフセット、マテリアルファイルがない場合にカリングされる。
+		*/
+		bool IsInstanceCullingEnabled = false;
+
+		/**
+			@brief
+			\~English The size of a viewport in pixels
+			\~Japanese ビューポートのピクセル単位の大きさ
+		*/
+		int32_t ViewportWidth = 0;
+		int32_t ViewportHeight = 0;
+
+		/**
+			@brief
+			\~English Effects whose area on a screen is smaller than this value in pixels are not drawn
+			\~Japanese 画面上の面積がこのピクセル数より小さいエフェクトは描画されない。
+			@note
+			\~English It is disabled if it is 0. The area is estimated from bounding boxes with ViewProjectionMatrix and a viewport size.
+			\~Japanese 0の場合は無効である。面積はバウンディングボックスからViewProjectionMatrixとビューポートの大きさで推定される。
+		*/
+		float MinimumScreenCoverage = 0.0f;
+
+		/**
+			@brief
+			\~English A low resolution depth buffer to skip drawing effects behind it
+			\~Japanese 後ろにあるエフェクトの描画を省略するための低解像度の深度バッファ
+			@note
+			\~English Depths are z / w with ViewProjectionMatrix from the top left texel. A larger value must be farther. It is disabled if it is nullptr.
+			It is used only while drawing.
+			\~Japanese 深度はViewProjectionMatrixによるz / wで左上のテクセルから並ぶ。大きい値ほど遠くなければならない。nullptrの場合は無効である。
+			描画中のみ使用される。
+		*/
+		const float* OcclusionDepth = nullptr;
+		int32_t OcclusionDepthWidth = 0;
+		int32_t OcclusionDepthHeight = 0;
+
 		DrawParameter();
 	};
 
@@ -115,6 +371,25 @@ public:
 	*/
 	static ManagerRef Create(int instance_max, bool autoFlip = true);
 
+	/**
+		@brief
+		\~English	Create a manager whose memory for instances is grown on demand
+		\~Japanese	インスタンス用のメモリが必要に応じて増えるマネージャーを生成する。
+		@param	parameter
+		\~English	parameters of memory for instances
+		\~Japanese	インスタンス用のメモリのパラメーター
+		@param	autoFlip
+		\~English	whether data between threads is flipped automatically in Update
+		\~Japanese	自動でスレッド間のデータを入れ替えるかどうか。trueの場合、Update時に入れ替わる。
+		@return
+		\~English	a manager
+		\~Japanese	マネージャー
+		@note
+		\~English	Addresses of instances are not changed even if memory is added.
+		\~Japanese	メモリが追加されてもインスタンスのアドレスは変わらない。
+	*/
+	static ManagerRef Create(const MemoryParameter& parameter, bool autoFlip = true);
+
 	/**
 		@brief
 		\~English Starts a specified number of worker threads
@@ -281,6 +556,13 @@ public:
 	*/
 	virtual void SetSoundPlayer(SoundPlayerRef soundPlayer) = 0;
 
+	/**
+		@brief
+		\~English	Get a class which limits voices played by the sound player
+		\~Japanese	サウンド再生機能で再生されるボイスを制限するクラスを取得する。
+	*/
+	virtual SoundVoiceManagerRef GetSoundVoiceManager() = 0;
+
 	/**
 		@brief	サウンド読込クラスを取得する
 	*/
@@ -594,6 +876,33 @@ public:
 	*/
 	virtual void SetGroupMask(Handle handle, int64_t groupmask) = 0;
 
+	/**
+		@brief
+		\~English	Get a priority to spawn instances with a budget
+		\~Japanese	予算の下でインスタンスを生成する優先度を取得する。
+	*/
+	virtual float GetSpawnPriority(Handle handle) const = 0;
+
+	/**
+		@brief
+		\~English	Set a priority to spawn instances with a budget
+		\~Japanese	予算の下でインスタンスを生成する優先度を設定する。
+		@param	priority
+		\~English	A value from 0 (lowest) to 1 (highest). The default is 0.5.
+		\~Japanese	0(最低)から1(最高)までの値。既定値は0.5。
+		@note
+		\~English	Spawning of an effect whose priority is 1 is stopped only when the number of instances reaches the budget.
+		\~Japanese	優先度が1のエフェクトの生成はインスタンス数が予算に達したときのみ停止される。
+	*/
+	virtual void SetSpawnPriority(Handle handle, float priority) = 0;
+
+	/**
+		@brief
+		\~English	Get the number of instances of an effect which were not spawned because of a budget or a lack of memory
+		\~Japanese	予算またはメモリ不足のために生成されなかったエフェクトのインスタンス数を取得する。
+	*/
+	virtual int32_t GetDroppedSpawnCount(Handle handle) const = 0;
+
 	/**
 	@brief
 	\~English	Get a playing speed of particle of effect.
@@ -727,6 +1036,93 @@ public:
 	*/
 	virtual void UpdateHandleToMoveToFrame(Handle handle, float frame) = 0;
 
+	/**
+		@brief
+		\~English	Fast-forward an effect to the specified frame to start it in progress
+		\~Japanese	途中から開始するために、指定した時間までエフェクトを早送りする
+		@param	handle
+		\~English	a handle.
+		\~Japanese	ハンドル
+		@param	frame
+		\~English	frame time (1 is 1/60 seconds)
+		\~Japanese	フレーム時間(60fps基準)
+		@param	parameter
+		\~English	parameters to fast-forward
+		\~Japanese	早送りのパラメーター
+		@note
+		\~English	Unlike UpdateHandleToMoveToFrame, UVs, alpha cutoffs and sounds are skipped except the last frame. Colors and matrices are still calculated because spawned children depend on them.
+		\~Japanese	UpdateHandleToMoveToFrameと異なり、最後のフレーム以外はUV、アルファクリップ、音の処理を省略する。生成される子が依存するため、色と行列は計算される。
+	*/
+	virtual void PrewarmHandle(Handle handle, float frame, const PrewarmParameter& parameter = PrewarmParameter()) = 0;
+
+	/**
+		@brief
+		\~English	Save a state of a playing effect
+		\~Japanese	再生中のエフェクトの状態を保存する
+		@param	handle
+		\~English	a handle.
+		\~Japanese	ハンドル
+		@param	snapshot
+		\~English	a destination
+		\~Japanese	保存先
+		@return
+		\~English	Whether it is succeeded
+		\~Japanese	成功したか?
+	*/
+	virtual bool SaveSnapshot(Handle handle, Snapshot& snapshot) = 0;
+
+	/**
+		@brief
+		\~English	Save states of all playing effects
+		\~Japanese	全ての再生中のエフェクトの状態を保存する
+		@param	snapshot
+		\~English	a destination
+		\~Japanese	保存先
+		@return
+		\~English	Whether it is succeeded
+		\~Japanese	成功したか?
+	*/
+	virtual bool SaveSnapshot(Snapshot& snapshot) = 0;
+
+	/**
+		@brief
+		\~English	Restore a state saved with SaveSnapshot(Handle, Snapshot&) into the handle
+		\~Japanese	SaveSnapshot(Handle, Snapshot&)で保存した状態をハンドルに復元する
+		@param	handle
+		\~English	a handle. It may be other than the saved handle.
+		\~Japanese	ハンドル。保存したハンドル以外でもよい。
+		@param	snapshot
+		\~English	a saved state
+		\~Japanese	保存された状態
+		@return
+		\~English	Whether it is succeeded. It fails also if some instances are not restored because of a lack of instances.
+		\~Japanese	成功したか? インスタンスの不足により一部のインスタンスが復元されなかった場合も失敗する。
+		@note
+		\~English	An effect can be cloned cheaply by restoring a state of a prewarmed effect into handles which are returned by Play.
+		A removing callback and user data of the handle are kept.
+		\~Japanese	早送りしたエフェクトの状態をPlayで返されたハンドルに復元することで、エフェクトを低コストで複製できる。
+		ハンドルの削除時のコールバックとユーザーデータは維持される。
+	*/
+	virtual bool LoadSnapshot(Handle handle, const Snapshot& snapshot) = 0;
+
+	/**
+		@brief
+		\~English	Restore states saved with SaveSnapshot(Snapshot&)
+		\~Japanese	SaveSnapshot(Snapshot&)で保存した状態を復元する
+		@param	snapshot
+		\~English	saved states
+		\~Japanese	保存された状態
+		@return
+		\~English	Whether it is succeeded. It fails also if some instances are not restored because of a lack of instances.
+		\~Japanese	成功したか? インスタンスの不足により一部のインスタンスが復元されなかった場合も失敗する。
+		@note
+		\~English	Handles which have been removed after saving are played again with the same handle.
+		Handles which have been played after saving are stopped. It is useful to rewind effects for a rollback.
+		\~Japanese	保存後に削除されたハンドルは同じハンドルで再度再生される。
+		保存後に再生されたハンドルは停止される。ロールバックのためにエフェクトを巻き戻すときに有用である。
+	*/
+	virtual bool LoadSnapshot(const Snapshot& snapshot) = 0;
+
 	/**
 	@brief
 	\~English	Draw particles.
@@ -816,9 +1212,72 @@ public:
 		@brief
 		\~English	Gets the number of remaining allocated instances.
 		\~Japanese	残りの確保したインスタンス数を取得する。
+		@note
+		\~English	Instances which can be added on demand are included.
+		\~Japanese	必要に応じて追加できるインスタンスを含む。
 	*/
 	virtual int32_t GetRestInstancesCount() const = 0;
 
+	/**
+		@brief
+		\~English	Set a budget to throttle spawning instances of effects with low priorities gradually
+		\~Japanese	優先度の低いエフェクトのインスタンスの生成を段階的に抑制するための予算を設定する。
+	*/
+	virtual void SetSpawnBudget(const SpawnBudgetParameter& parameter) = 0;
+
+	/**
+		@brief
+		\~English	Get the number of instances of all effects which were not spawned because of a budget or a lack of memory
+		\~Japanese	予算またはメモリ不足のために生成されなかった全てのエフェクトのインスタンス数を取得する。
+		@note
+		\~English	Instances of stopped effects are included.
+		\~Japanese	停止したエフェクトのインスタンスを含む。
+	*/
+	virtual int32_t GetTotalDroppedSpawnCount() const = 0;
+
+	/**
+		@brief
+		\~English	Start or stop to profile effects and nodes
+		\~Japanese	エフェクトとノードの計測を開始または停止する。
+		@param	frameCount
+		\~English	The number of frames which are kept in a ring buffer
+		\~Japanese	リングバッファに保持されるフレーム数
+		@note
+		\~English	A frame is recorded when Update is called. It contains values from the previous Update.
+		\~Japanese	フレームはUpdateが呼ばれたときに記録される。前回のUpdateからの値を含む。
+	*/
+	virtual void SetProfilingEnabled(bool enabled, int32_t frameCount) = 0;
+
+	/**
+		@brief
+		\~English	Get whether effects and nodes are profiled
+		\~Japanese	エフェクトとノードが計測されているかを取得する。
+	*/
+	virtual bool GetProfilingEnabled() const = 0;
+
+	/**
+		@brief
+		\~English	Get the number of recorded frames
+		\~Japanese	記録されたフレーム数を取得する。
+	*/
+	virtual int32_t GetProfiledFrameCount() const = 0;
+
+	/**
+		@brief
+		\~English	Get a recorded frame
+		\~Japanese	記録されたフレームを取得する。
+		@param	index
+		\~English	0 is the latest frame
+		\~Japanese	0が最新のフレーム
+		@return
+		\~English	Whether the frame exists
+		\~Japanese	フレームが存在するか
+		@note
+		\~English	It can be called while effects are updated on a worker thread.
+		\~Japanese	ワーカースレッドでエフェクトが更新されている間に呼び出すことができる。
+	*/
+	virtual bool GetProfiledFrame(int32_t index, ProfiledFrame& frame) const = 0;
+
 	/**
 		@brief	エフェクトをカリングし描画負荷を減らすための空間を生成する。
 		@param	xsize	X方向幅
@@ -828,6 +1287,19 @@ public:
 	*/
 	virtual void CreateCullingWorld(float xsize, float ysize, float zsize, int32_t layerCount) = 0;
 
+	/**
+		@brief
+		\~English	Create a space to cull effects with a dynamic bounding volume tree instead of grids.
+		\~Japanese	グリッドの代わりに動的なバウンディングボリュームツリーでエフェクトをカリングするための空間を生成する。
+		@param	margin
+		\~English	A margin to extend bounds of effects. The tree is updated only when an effect moves out of the extended bounds.
+		\~Japanese	エフェクトの範囲を拡張する幅。拡張された範囲の外にエフェクトが移動した時のみツリーが更新される。
+		@note
+		\~English	The size of a space is not needed and RessignCulling is not needed even if effects move far away.
+		\~Japanese	空間の大きさは不要で、エフェクトが遠くに移動してもRessignCullingは不要である。
+	*/
+	virtual void CreateCullingWorldWithTree(float margin) = 0;
+
 	/**
 		@brief	カリングを行い、カリングされたオブジェクトのみを描画するようにする。
 		@param	cameraProjMat	カメラプロジェクション行列
@@ -4,13 +4,16 @@
 
 #include "Culling/Culling3D.h"
 #include "Effekseer.Base.h"
+#include "Effekseer.DepthPyramid.h"
 #include "Effekseer.InstanceChunk.h"
 #include "Effekseer.IntrusiveList.h"
 #include "Effekseer.Manager.h"
 #include "Effekseer.Matrix43.h"
 #include "Effekseer.Matrix44.h"
 #include "Effekseer.WorkerThread.h"
+#include "SIMD/Kernels.h"
 #include "Utils/Effekseer.CustomAllocator.h"
+#include "Utils/Effekseer.FreeList.h"
 
 namespace Effekseer
 {
@@ -69,6 +72,14 @@ private:
 		//! a bit mask for group
 		int64_t GroupMask = 0;
 
+		//! a frame to fast-forward in next update (negative if not requested)
+		float PrewarmFrame = -1.0f;
+
+		float PrewarmStepFrame = 1.0f;
+
+		//! a priority to spawn instances with a budget
+		float SpawnPriority = 0.5f;
+
 		DrawSet(const EffectRef& effect, InstanceContainer* pContainer, InstanceGlobal* pGlobal)
 			: ParameterPointer(effect)
 			, InstanceContainerPointer(pContainer)
@@ -117,6 +128,8 @@ private:
 		float SizeY;
 		float SizeZ;
 		int32_t LayerCount;
+		bool IsTree;
+		float Margin;
 
 		CullingParameter()
 		{
@@ -124,6 +137,8 @@ private:
 			SizeY = 0.0f;
 			SizeZ = 0.0f;
 			LayerCount = 0;
+			IsTree = false;
+			Margin = 0.0f;
 		}
 
 	} cullingCurrent, cullingNext;
@@ -140,17 +155,19 @@ private:
 	// 確保済みインスタンス数
 	int m_instance_max;
 
-	// buffers which is allocated while initializing
-	// 初期化中に確保されたバッファ
-	CustomAlignedVector<InstanceChunk> reservedChunksBuffer_;
-	CustomAlignedVector<uint8_t> reservedGroupBuffer_;
-	CustomAlignedVector<uint8_t> reservedContainerBuffer_;
+	// pooled instances. Thease are not used and waiting to be used. They can be accessed from worker threads.
+	// Memory is allocated in segments while initializing and added on demand.
+	// プールされたインスタンス。使用されておらず、使用されてるのを待っている。ワーカースレッドからアクセスできる。
+	// メモリは初期化中にセグメント単位で確保され、必要に応じて追加される。
+	FreeList<InstanceChunk> pooledChunks_;
+	FreeList<InstanceGroup> pooledGroups_;
+	FreeList<InstanceContainer> pooledContainers_;
+
+	//! the number of updates after which added memory is released if it is not used
+	int32_t shrinkFrameCount_ = 0;
 
-	// pooled instances. Thease are not used and waiting to be used.
-	// プールされたインスタンス。使用されておらず、使用されてるのを待っている。
-	std::queue<InstanceChunk*> pooledChunks_;
-	std::queue<InstanceGroup*> pooledGroups_;
-	std::queue<InstanceContainer*> pooledContainers_;
+	//! the number of updates while the last segment of each pool can be released
+	std::array<int32_t, 3> idleFrameCounts_;
 
 	// instance chunks by generations
 	// 世代ごとのインスタンスチャンク
@@ -173,8 +190,47 @@ private:
 	//! objects on rendering
 	CustomAlignedMap<Handle, DrawSet> m_renderingDrawSetMaps;
 
+	//! active instances of a container which are passed to a node at once (temporaly)
+	CustomVector<Instance*> renderingInstances_;
+
+	//! end indexes of groups in renderingInstances_ (temporaly)
+	CustomVector<int32_t> renderingGroupEnds_;
+
+	//! planes (a, b, c, d) of a camera frustum while rendering. a point is inside if ax + by + cz + d >= 0 with all planes
+	std::array<std::array<float, 4>, 6> renderingFrustumPlanes_;
+
+	//! whether containers are culled with renderingFrustumPlanes_ while rendering
+	bool isRenderingFrustumEnabled_ = false;
+
+	//! a depth buffer from a host to skip drawing occluded effects while rendering
+	DepthPyramid occlusionDepthPyramid_;
+
+	SpawnBudgetParameter spawnBudget_;
+
+	//! the number of instances to compare with the budget. it is recalculated in BeginUpdate and an update, increased when an instance is created
+	//! and followed with a difference of instances of an effect in UpdateHandle
+	int32_t budgetedInstanceCount_ = 0;
+
+	int32_t droppedSpawnCount_ = 0;
+
+	bool isProfilingEnabled_ = false;
+
+	//! a ring buffer of profiled frames
+	CustomVector<ProfiledFrame> profiledFrames_;
+
+	//! an index of profiledFrames_ where a next frame is recorded
+	int32_t nextProfiledFrameIndex_ = 0;
+
+	int32_t profiledFrameCount_ = 0;
+
+	//! record values accumulated in containers into the ring buffer and reset them. the ring buffer is guarded with m_renderingMutex
+	void RecordProfiledFrame();
+
+	//! collect and reset values of a container and its children
+	void CollectProfiledNodes(InstanceContainer* container, Handle handle, ProfiledFrame& frame, ProfiledHandle& handleValues);
+
 	// mutex for rendering
-	std::recursive_mutex m_renderingMutex;
+	mutable std::recursive_mutex m_renderingMutex;
 	bool m_isLockedWithRenderingMutex = false;
 
 	SettingRef m_setting;
@@ -202,6 +258,8 @@ private:
 
 	SoundPlayerRef m_soundPlayer;
 
+	SoundVoiceManagerRef soundVoiceManager_;
+
 	MallocFunc m_MallocFunc;
 
 	FreeFunc m_FreeFunc;
@@ -210,6 +268,9 @@ private:
 
 	int m_randMax;
 
+	//! kernels with the best instruction set on this CPU
+	const SIMD::Kernels* kernels_ = nullptr;
+
 	std::queue<std::pair<SoundTag, SoundPlayer::InstanceParameter>> m_requestedSounds;
 	std::mutex m_soundMutex;
 
@@ -228,13 +289,18 @@ private:
 
 	void ExecuteEvents();
 
-	void ExecuteSounds();
+	void ExecuteSounds(float deltaFrame);
+
+	//! release added memory which has not been used for a while
+	void ShrinkPools();
 
 	void StoreSortingDrawSets(const Manager::DrawParameter& drawParameter);
 
 public:
 	ManagerImplemented(int instance_max, bool autoFlip);
 
+	ManagerImplemented(const MemoryParameter& parameter, bool autoFlip);
+
 	virtual ~ManagerImplemented();
 
 	Instance* CreateInstance(EffectNodeImplemented* pEffectNode, InstanceContainer* pContainer, InstanceGroup* pGroup);
@@ -252,6 +318,12 @@ public:
 
 	uint32_t GetSequenceNumber() const;
 
+	//! get kernels with the best instruction set on this CPU
+	const SIMD::Kernels& GetKernels() const
+	{
+		return *kernels_;
+	}
+
 	MallocFunc GetMallocFunc() const override;
 
 	void SetMallocFunc(MallocFunc func) override;
@@ -308,6 +380,8 @@ public:
 
 	void SetSoundPlayer(SoundPlayerRef soundPlayer) override;
 
+	SoundVoiceManagerRef GetSoundVoiceManager() override;
+
 	SoundLoaderRef GetSoundLoader() override;
 
 	void SetSoundLoader(SoundLoaderRef soundLoader) override;
@@ -386,6 +460,12 @@ public:
 
 	void SetGroupMask(Handle handle, int64_t groupmask) override;
 
+	float GetSpawnPriority(Handle handle) const override;
+
+	void SetSpawnPriority(Handle handle, float priority) override;
+
+	int32_t GetDroppedSpawnCount(Handle handle) const override;
+
 	float GetSpeed(Handle handle) const override;
 
 	void SetSpeed(Handle handle, float speed) override;
@@ -414,9 +494,22 @@ public:
 
 	void UpdateHandleToMoveToFrame(Handle handle, float frame) override;
 
+	void PrewarmHandle(Handle handle, float frame, const PrewarmParameter& parameter) override;
+
+	bool SaveSnapshot(Handle handle, Snapshot& snapshot) override;
+
+	bool SaveSnapshot(Snapshot& snapshot) override;
+
+	bool LoadSnapshot(Handle handle, const Snapshot& snapshot) override;
+
+	bool LoadSnapshot(const Snapshot& snapshot) override;
+
 	void SetRandomSeed(Handle handle, int32_t seed) override;
 
 private:
+	//! get a chunk which has a space for an instance of the generation
+	InstanceChunk* GetCreatableChunk(int32_t generationNumber);
+
 	void UpdateInstancesByInstanceGlobal(const DrawSet& drawSet);
 
 	//! update draw sets
@@ -427,10 +520,37 @@ private:
 	//! whether container is disabled while rendering because of a distance between the effect and a camera
 	bool IsClippedWithDepth(DrawSet& drawSet, InstanceContainer* container, const Manager::DrawParameter& drawParameter);
 
+	//! set a camera frustum to cull containers while rendering
+	void SetRenderingFrustum(const Manager::DrawParameter& drawParameter);
+
+	//! whether a bounding box is outside of the camera frustum while rendering
+	bool IsCulledWithRenderingFrustum(const SIMD::Vec3f& min, const SIMD::Vec3f& max) const;
+
+	//! calculate a bounding box which contains rendered instances of a draw set. returns false if it is unknown
+	bool CalculateDrawSetBounds(DrawSet& drawSet, SIMD::Vec3f& min, SIMD::Vec3f& max);
+
+	//! whether a draw set is too small on a screen or occluded by a depth buffer from a host
+	bool IsSkippedWithScreenCoverage(DrawSet& drawSet, const Manager::DrawParameter& drawParameter);
+
 	void StopWithoutRemoveDrawSet(DrawSet& drawSet);
 
+	//! reset a draw set to play from the beginning
+	void ResetDrawSet(DrawSet& drawSet);
+
 	void ResetAndPlayWithDataSet(DrawSet& drawSet, float frame);
 
+	//! update a draw set to the frame with coarse steps without values only for rendering
+	void FastForward(DrawSet& drawSet, float frame, float stepFrame);
+
+	//! collect containers in the same order as nodes are collected by depth first search
+	void CollectInstanceContainers(InstanceContainer* container, CustomVector<InstanceContainer*>& containers);
+
+	//! append a state of a draw set to a snapshot
+	bool WriteSnapshot(const DrawSet& drawSet, Snapshot& snapshot);
+
+	//! restore a state of a draw set from a record in a snapshot
+	bool ReadSnapshot(DrawSet& drawSet, const Snapshot& snapshot, size_t offset, bool isCreated);
+
 public:
 	void Draw(const Manager::DrawParameter& drawParameter) override;
 
@@ -456,12 +576,47 @@ public:
 
 	int32_t GetRestInstancesCount() const override;
 
+	void SetSpawnBudget(const SpawnBudgetParameter& parameter) override;
+
+	int32_t GetTotalDroppedSpawnCount() const override;
+
+	void SetProfilingEnabled(bool enabled, int32_t frameCount) override;
+
+	bool GetProfilingEnabled() const override
+	{
+		return isProfilingEnabled_;
+	}
+
+	int32_t GetProfiledFrameCount() const override;
+
+	bool GetProfiledFrame(int32_t index, ProfiledFrame& frame) const override;
+
+	//! calculate rates to spawn instances of all effects from the budget. it is called once in an update because it counts all instances
+	void UpdateSpawnRates();
+
+	//! calculate a rate to spawn instances of an effect from budgetedInstanceCount_
+	void UpdateSpawnRate(DrawSet& drawSet);
+
+	/**
+		@brief	whether an instance should not be spawned because of the budget
+		@param	spawnCredit	a credit of a group which is accumulated with a rate to spawn instances
+	*/
+	bool IsSpawnThrottled(const InstanceGlobal* global, float& spawnCredit);
+
+	//! count an instance which was not spawned
+	void AddDroppedSpawn(InstanceGlobal* global);
+
 	void BeginReloadEffect(const EffectRef& effect, bool doLockThread);
 
 	void EndReloadEffect(const EffectRef& effect, bool doLockThread);
 
+	//! replace nodes which playing instances of the effect refer to without restarting them
+	void ReplaceEffectNodes(const EffectRef& effect, const CustomMap<EffectNodeImplemented*, EffectNodeImplemented*>& effectNodes);
+
 	void CreateCullingWorld(float xsize, float ysize, float zsize, int32_t layerCount) override;
 
+	void CreateCullingWorldWithTree(float margin) override;
+
 	void CalcCulling(const Matrix44& cameraProjMat, bool isOpenGL) override;
 
 	void RessignCulling() override;
@@ -28,6 +28,14 @@ void RandObject::SetSeed(int32_t seed)
 	m_seed = seed;
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+int32_t RandObject::GetSeed() const
+{
+	return m_seed;
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -26,6 +26,8 @@ class RandObject : public IRandObject
 public:
 	void SetSeed(int32_t seed);
 
+	int32_t GetSeed() const;
+
 	int32_t GetRandInt();
 
 	float GetRand();
@@ -10,6 +10,7 @@
 #include "Effekseer.TextureLoader.h"
 #include "Model/ModelLoader.h"
 #include "Model/ProceduralModelGenerator.h"
+#include "Utils/Profiler.h"
 
 //----------------------------------------------------------------------------------
 //
@@ -22,9 +23,103 @@ namespace Effekseer
 //----------------------------------------------------------------------------------
 TextureRef ResourceManager::LoadTexture(const char16_t* path, TextureType textureType)
 {
+	PROFILER_BLOCK("ResourceManager::LoadTexture", profiler::colors::Green);
+
 	return cachedTextures_.Load(path, textureType);
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ResourceManager::LoadTextures(const char16_t* const* paths, const TextureType* textureTypes, int32_t count, TextureRef* textures)
+{
+	PROFILER_BLOCK("ResourceManager::LoadTextures", profiler::colors::Green);
+
+	auto& loader = cachedTextures_.loader;
+
+	if (loader == nullptr)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			textures[i] = nullptr;
+		}
+		return;
+	}
+
+	if (!cachedTextures_.isCacheEnabled)
+	{
+		loader->Load(paths, textureTypes, count, textures);
+		return;
+	}
+
+	// textures which are not cached are loaded at once and a path is loaded only once
+	CustomVector<const char16_t*> loadingPaths;
+	CustomVector<TextureType> loadingTypes;
+	CustomVector<int32_t> loadingIndexes(count, -1);
+	CustomUnorderedMap<StringView<char16_t>, int32_t, StringView<char16_t>::Hash> loadingMap;
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		textures[i] = nullptr;
+
+		auto it = cachedTextures_.cached.find(paths[i]);
+		if (it != cachedTextures_.cached.end())
+		{
+			it->second.loadCount++;
+			textures[i] = it->second.resource;
+			continue;
+		}
+
+		auto loadingIt = loadingMap.find(paths[i]);
+		if (loadingIt != loadingMap.end())
+		{
+			loadingIndexes[i] = loadingIt->second;
+			continue;
+		}
+
+		loadingIndexes[i] = static_cast<int32_t>(loadingPaths.size());
+		loadingMap.emplace(paths[i], loadingIndexes[i]);
+		loadingPaths.emplace_back(paths[i]);
+		loadingTypes.emplace_back(textureTypes[i]);
+	}
+
+	if (loadingPaths.size() == 0)
+	{
+		return;
+	}
+
+	CustomVector<TextureRef> loaded(loadingPaths.size());
+	loader->Load(loadingPaths.data(), loadingTypes.data(), static_cast<int32_t>(loadingPaths.size()), loaded.data());
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		if (loadingIndexes[i] < 0)
+		{
+			continue;
+		}
+
+		auto resource = loaded[loadingIndexes[i]];
+		if (resource == nullptr)
+		{
+			continue;
+		}
+
+		auto it = cachedTextures_.cached.find(paths[i]);
+		if (it != cachedTextures_.cached.end())
+		{
+			it->second.loadCount++;
+		}
+		else
+		{
+			resource->SetPath(paths[i]);
+			const StringView<char16_t> view = resource->GetPath();
+			cachedTextures_.cached.emplace(view, LoadCounted<TextureRef>{resource, 1});
+		}
+
+		textures[i] = resource;
+	}
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -38,6 +133,8 @@ void ResourceManager::UnloadTexture(TextureRef resource)
 //----------------------------------------------------------------------------------
 ModelRef ResourceManager::LoadModel(const char16_t* path)
 {
+	PROFILER_BLOCK("ResourceManager::LoadModel", profiler::colors::Green);
+
 	return cachedModels_.Load(path);
 }
 
@@ -54,6 +151,8 @@ void ResourceManager::UnloadModel(ModelRef resource)
 //----------------------------------------------------------------------------------
 SoundDataRef ResourceManager::LoadSoundData(const char16_t* path)
 {
+	PROFILER_BLOCK("ResourceManager::LoadSoundData", profiler::colors::Green);
+
 	return cachedSounds_.Load(path);
 }
 
@@ -70,6 +169,8 @@ void ResourceManager::UnloadSoundData(SoundDataRef resource)
 //----------------------------------------------------------------------------------
 MaterialRef ResourceManager::LoadMaterial(const char16_t* path)
 {
+	PROFILER_BLOCK("ResourceManager::LoadMaterial", profiler::colors::Green);
+
 	return cachedMaterials_.Load(path);
 }
 
@@ -86,6 +187,8 @@ void ResourceManager::UnloadMaterial(MaterialRef resource)
 //----------------------------------------------------------------------------------
 CurveRef ResourceManager::LoadCurve(const char16_t* path)
 {
+	PROFILER_BLOCK("ResourceManager::LoadCurve", profiler::colors::Green);
+
 	return cachedCurves_.Load(path);
 }
 
@@ -99,6 +202,8 @@ void ResourceManager::UnloadCurve(CurveRef resource)
 
 ModelRef ResourceManager::GenerateProceduralModel(const ProceduralModelParameter& param)
 {
+	PROFILER_BLOCK("ResourceManager::GenerateProceduralModel", profiler::colors::Green);
+
 	return proceduralMeshGenerator_.Load(param);
 }
 
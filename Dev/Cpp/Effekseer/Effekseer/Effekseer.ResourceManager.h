@@ -89,6 +89,11 @@ public:
 
 	TextureRef LoadTexture(const char16_t* path, TextureType textureType);
 
+	/**
+		@brief	Load textures at once so that a loader can decode them in parallel
+	*/
+	void LoadTextures(const char16_t* const* paths, const TextureType* textureTypes, int32_t count, TextureRef* textures);
+
 	void UnloadTexture(TextureRef resource);
 
 	ModelRef LoadModel(const char16_t* path);
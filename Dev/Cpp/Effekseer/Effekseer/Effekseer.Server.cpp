@@ -4,6 +4,7 @@
 
 #include "Effekseer.Server.h"
 #include "Effekseer.Effect.h"
+#include "Effekseer.EffectDataDelta.h"
 #include "Effekseer.ServerImplemented.h"
 #include <thread>
 
@@ -110,6 +111,44 @@ void ServerImplemented::InternalClient::ShutDown()
 	}
 }
 
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+void ServerImplemented::InternalClient::RequestWholeData(const std::u16string& key)
+{
+	if (m_socket == InvalidSocket)
+	{
+		return;
+	}
+
+	// size, key length, key
+	const int32_t keylen = static_cast<int32_t>(key.size());
+	const int32_t datasize = static_cast<int32_t>(sizeof(int32_t) + sizeof(char16_t) * keylen);
+
+	std::vector<uint8_t> buf(sizeof(int32_t) + datasize);
+	memcpy(buf.data(), &datasize, sizeof(int32_t));
+	memcpy(buf.data() + sizeof(int32_t), &keylen, sizeof(int32_t));
+	memcpy(buf.data() + sizeof(int32_t) * 2, key.data(), sizeof(char16_t) * keylen);
+
+	// a disconnection is handled in RecvAsync, so a signal must not be raised
+#if defined(__linux__)
+	const int flags = MSG_NOSIGNAL;
+#else
+	const int flags = 0;
+#endif
+
+	int32_t size = static_cast<int32_t>(buf.size());
+	while (size > 0)
+	{
+		auto ret = ::send(m_socket, (const char*)(&(buf[buf.size() - size])), size, flags);
+		if (ret == 0 || ret < 0)
+		{
+			return;
+		}
+		size -= ret;
+	}
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -390,20 +429,43 @@ void ServerImplemented::Update(ManagerRef* managers, int32_t managerCount, Reloa
 			uint8_t* recv_data = p;
 			auto datasize = (int32_t)buf.size() - (p - &(buf[0]));
 
-			if (m_data.count(key) > 0)
+			const bool isDelta = EffectDataDelta::IsDelta(recv_data, datasize);
+
+			if (isDelta)
 			{
-				m_data[key].clear();
-			}
+				std::vector<uint8_t> patched;
+				if (m_data.count(key) == 0 || !EffectDataDelta::Decode(m_data[key], recv_data, datasize, patched))
+				{
+					Log(LogType::Warning, "Server : A delta is ignored because data to apply it is not found. Whole data is requested.");
+					(*it)->RequestWholeData(key);
+					continue;
+				}
 
-			for (int32_t d = 0; d < datasize; d++)
+				m_data[key] = std::move(patched);
+			}
+			else
 			{
-				m_data[key].push_back(recv_data[d]);
+				if (m_data.count(key) > 0)
+				{
+					m_data[key].clear();
+				}
+
+				for (int32_t d = 0; d < datasize; d++)
+				{
+					m_data[key].push_back(recv_data[d]);
+				}
 			}
 
 			if (m_effects.count(key) > 0)
 			{
 				const auto& data_ = m_data[key];
 
+				// keep playing instances if only parameters are changed
+				if (isDelta && m_effects[key].EffectPtr->ReloadParameters(managers, managerCount, data_.data(), (int32_t)data_.size()))
+				{
+					continue;
+				}
+
 				if (m_materialPath.size() > 1)
 				{
 					m_effects[key].EffectPtr->Reload(
@@ -49,6 +49,9 @@ private:
 		InternalClient(EfkSocket socket_, ServerImplemented* server);
 		~InternalClient();
 		void ShutDown();
+
+		//! request a client to send whole data of a key because a delta cannot be applied
+		void RequestWholeData(const std::u16string& key);
 	};
 
 private:
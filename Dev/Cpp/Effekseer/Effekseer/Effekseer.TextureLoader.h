@@ -75,6 +75,34 @@ public:
 		return nullptr;
 	}
 
+	/**
+		@brief
+		\~English	a function called when textures which are used in an effect are loaded
+		\~Japanese	エフェクトで使用されるテクスチャが読み込まれるときに呼ばれる関数
+		@param	paths
+		\~English	paths of textures
+		\~Japanese	テクスチャのパス
+		@param	textureTypes
+		\~English	kinds of textures
+		\~Japanese	テクスチャの種類
+		@param	count
+		\~English	the number of textures
+		\~Japanese	テクスチャの数
+		@param	textures
+		\~English	loaded textures are written into it
+		\~Japanese	読み込まれたテクスチャが書き込まれる
+		@note
+		\~English	Textures are loaded one by one by default. Override it to decode textures in parallel.
+		\~Japanese	デフォルトでは1つずつ読み込まれる。並列に展開する場合はオーバーライドする。
+	*/
+	virtual void Load(const char16_t* const* paths, const TextureType* textureTypes, int32_t count, TextureRef* textures)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			textures[i] = Load(paths[i], textureTypes[i]);
+		}
+	}
+
 	/**
 		@brief	テクスチャを破棄する。
 		@param	data	[in]	テクスチャ
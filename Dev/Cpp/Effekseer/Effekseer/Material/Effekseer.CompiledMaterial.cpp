@@ -328,4 +328,9 @@ void CompiledMaterial::UpdateData(const std::vector<uint8_t>& standardVS,
 	platforms[type] = CreateUniqueReference(static_cast<CompiledMaterialBinary*>(binary));
 }
 
+void CompiledMaterial::UpdateData(CompiledMaterialBinary* binary, CompiledMaterialPlatformType type)
+{
+	platforms[type] = CreateUniqueReference(binary, true);
+}
+
 } // namespace Effekseer
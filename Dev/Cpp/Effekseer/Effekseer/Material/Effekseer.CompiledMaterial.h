@@ -61,6 +61,8 @@ public:
 					const std::vector<uint8_t>& modelRefractionVS,
 					const std::vector<uint8_t>& modelRefractionPS,
 					CompiledMaterialPlatformType type);
+
+	void UpdateData(CompiledMaterialBinary* binary, CompiledMaterialPlatformType type);
 };
 
 } // namespace Effekseer
@@ -0,0 +1,201 @@
+#include "Effekseer.CompiledMaterialCache.h"
+
+namespace Effekseer
+{
+
+CompiledMaterialCache::CompiledMaterialCache(const char16_t* directory, FileInterface* fileInterface, int32_t maxCount)
+	: maxCount_(maxCount)
+	, fileInterface_(fileInterface)
+{
+	if (fileInterface_ == nullptr)
+	{
+		fileInterface_ = &defaultFileInterface_;
+	}
+
+	if (directory != nullptr)
+	{
+		directory_ = directory;
+	}
+
+	if (!directory_.empty() && directory_.back() != u'/' && directory_.back() != u'\\')
+	{
+		directory_ += u'/';
+	}
+}
+
+std::u16string CompiledMaterialCache::GetPath(uint64_t key) const
+{
+	const char16_t* digits = u"0123456789abcdef";
+
+	auto path = directory_;
+	for (int32_t i = 15; i >= 0; i--)
+	{
+		path += digits[(key >> (i * 4)) & 0xF];
+	}
+	path += u".efkmatd";
+	return path;
+}
+
+uint64_t CompiledMaterialCache::CalculateKey(const void* data, int32_t size, CompiledMaterialPlatformType platformType)
+{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+
+	auto add = [&hash](const void* p, size_t s) {
+		auto bytes = static_cast<const uint8_t*>(p);
+		for (size_t i = 0; i < s; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+	};
+
+	// generated codes are changed when the format or generators are changed
+	const int32_t version = CompiledMaterialVersion16;
+	const int32_t generatorVersion = CompiledMaterialGeneratorVersion;
+	const auto platform = static_cast<int32_t>(platformType);
+
+	add(&version, sizeof(int32_t));
+	add(&generatorVersion, sizeof(int32_t));
+	add(&platform, sizeof(int32_t));
+	add(data, static_cast<size_t>(size));
+
+	return hash;
+}
+
+CompiledMaterialBinary* CompiledMaterialCache::LoadFromFile(uint64_t key, CompiledMaterialPlatformType platformType)
+{
+	if (directory_.empty())
+	{
+		return nullptr;
+	}
+
+	auto path = GetPath(key);
+	std::unique_ptr<FileReader> reader(fileInterface_->TryOpenRead(path.c_str()));
+	if (reader == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::vector<uint8_t> data;
+	data.resize(reader->GetLength());
+	if (data.empty() || reader->Read(data.data(), data.size()) != data.size())
+	{
+		return nullptr;
+	}
+
+	CompiledMaterial compiled;
+	if (!compiled.Load(data.data(), static_cast<int32_t>(data.size())) || !compiled.GetHasValue(platformType))
+	{
+		return nullptr;
+	}
+
+	auto binary = compiled.GetBinary(platformType);
+	binary->AddRef();
+	return binary;
+}
+
+void CompiledMaterialCache::SaveToFile(uint64_t key, CompiledMaterialPlatformType platformType, CompiledMaterialBinary* binary)
+{
+	if (directory_.empty())
+	{
+		return;
+	}
+
+	CompiledMaterial compiled;
+	compiled.UpdateData(binary, platformType);
+
+	// an original data is not required because the key is generated from it
+	std::vector<uint8_t> dst;
+	std::vector<uint8_t> originalData;
+	compiled.Save(dst, 0, originalData);
+
+	auto path = GetPath(key);
+	std::unique_ptr<FileWriter> writer(fileInterface_->OpenWrite(path.c_str()));
+	if (writer == nullptr)
+	{
+		return;
+	}
+
+	writer->Write(dst.data(), dst.size());
+	writer->Flush();
+}
+
+void CompiledMaterialCache::Store(uint64_t key, CompiledMaterialBinary* binary)
+{
+	auto& entry = binaries_[key];
+	entry.Binary = CreateUniqueReference(binary, true);
+	entry.LastUsedTime = ++time_;
+
+	if (maxCount_ > 0 && static_cast<int32_t>(binaries_.size()) > maxCount_)
+	{
+		auto oldest = binaries_.begin();
+		for (auto it = binaries_.begin(); it != binaries_.end(); it++)
+		{
+			if (it->second.LastUsedTime < oldest->second.LastUsedTime)
+			{
+				oldest = it;
+			}
+		}
+		binaries_.erase(oldest);
+	}
+}
+
+CompiledMaterialBinary* CompiledMaterialCache::Load(uint64_t key, CompiledMaterialPlatformType platformType)
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+
+	auto it = binaries_.find(key);
+	if (it != binaries_.end())
+	{
+		it->second.LastUsedTime = ++time_;
+		it->second.Binary->AddRef();
+		return it->second.Binary.get();
+	}
+
+	auto binary = LoadFromFile(key, platformType);
+	if (binary == nullptr)
+	{
+		return nullptr;
+	}
+
+	Store(key, binary);
+	return binary;
+}
+
+void CompiledMaterialCache::Save(uint64_t key, CompiledMaterialPlatformType platformType, CompiledMaterialBinary* binary)
+{
+	if (binary == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mtx_);
+
+	Store(key, binary);
+
+	SaveToFile(key, platformType, binary);
+}
+
+CompiledMaterialBinary* CompiledMaterialCache::Compile(MaterialCompiler* compiler, MaterialFile* materialFile, const void* data, int32_t size, CompiledMaterialPlatformType platformType)
+{
+	const auto key = CalculateKey(data, size, platformType);
+
+	if (auto binary = Load(key, platformType))
+	{
+		return binary;
+	}
+
+	// compile without a lock because it takes a long time
+	auto binary = compiler->Compile(materialFile);
+	Save(key, platformType, binary);
+	return binary;
+}
+
+int32_t CompiledMaterialCache::GetCount()
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+	return static_cast<int32_t>(binaries_.size());
+}
+
+} // namespace Effekseer
@@ -0,0 +1,89 @@
+#ifndef __EFFEKSEER_COMPILED_MATERIAL_CACHE_H__
+#define __EFFEKSEER_COMPILED_MATERIAL_CACHE_H__
+
+#include "../Effekseer.DefaultFile.h"
+#include "Effekseer.CompiledMaterial.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace Effekseer
+{
+
+/**
+	@brief	A cache of compiled materials which is keyed by a hash of a material file
+	@note
+	Binaries are kept on memory and are saved into a directory if it is specified, so that they are shared among effects and processes.
+	It can be used from multiple threads.
+*/
+class CompiledMaterialCache : public ReferenceObject
+{
+private:
+	struct Entry
+	{
+		std::unique_ptr<CompiledMaterialBinary, ReferenceDeleter<CompiledMaterialBinary>> Binary;
+		uint64_t LastUsedTime = 0;
+	};
+
+	std::mutex mtx_;
+	std::map<uint64_t, Entry> binaries_;
+	int32_t maxCount_ = 0;
+	uint64_t time_ = 0;
+
+	std::u16string directory_;
+	FileInterface* fileInterface_ = nullptr;
+	DefaultFileInterface defaultFileInterface_;
+
+	std::u16string GetPath(uint64_t key) const;
+
+	CompiledMaterialBinary* LoadFromFile(uint64_t key, CompiledMaterialPlatformType platformType);
+
+	void SaveToFile(uint64_t key, CompiledMaterialPlatformType platformType, CompiledMaterialBinary* binary);
+
+	//! store a binary on memory and release the least recently used binary if the number of binaries exceeds the limit
+	void Store(uint64_t key, CompiledMaterialBinary* binary);
+
+public:
+	/**
+		@param	directory	a directory where binaries are saved. Binaries are only kept on memory if it is nullptr.
+		@param	maxCount	the maximum number of binaries on memory. The least recently used binary is released when it is exceeded. It is not limited if it is 0.
+	*/
+	CompiledMaterialCache(const char16_t* directory = nullptr, FileInterface* fileInterface = nullptr, int32_t maxCount = 64);
+
+	~CompiledMaterialCache() override = default;
+
+	/**
+		@brief	Calculate a key from a content of a material file (.efkmat), a platform and versions of generated codes
+	*/
+	static uint64_t CalculateKey(const void* data, int32_t size, CompiledMaterialPlatformType platformType);
+
+	/**
+		@brief	Get a binary. Return nullptr if it is not found.
+		@note
+		A reference counter of the binary is incremented.
+	*/
+	CompiledMaterialBinary* Load(uint64_t key, CompiledMaterialPlatformType platformType);
+
+	/**
+		@brief	Store a binary
+	*/
+	void Save(uint64_t key, CompiledMaterialPlatformType platformType, CompiledMaterialBinary* binary);
+
+	/**
+		@brief	Get a binary from the cache or compile a material and store the result
+		@note
+		A reference counter of the binary is incremented.
+	*/
+	CompiledMaterialBinary* Compile(MaterialCompiler* compiler, MaterialFile* materialFile, const void* data, int32_t size, CompiledMaterialPlatformType platformType);
+
+	/**
+		@brief	Get the number of binaries on memory
+	*/
+	int32_t GetCount();
+};
+
+using CompiledMaterialCacheRef = RefPtr<CompiledMaterialCache>;
+
+} // namespace Effekseer
+
+#endif
@@ -1,5 +1,7 @@
 ﻿#include "Model.h"
 #include "../Backend/GraphicsDevice.h"
+#include <algorithm>
+#include <cmath>
 
 namespace Effekseer
 {
@@ -9,6 +11,8 @@ Model::Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& fa
 	models_.resize(1);
 	models_[0].vertexes = vertecies;
 	models_[0].faces = faces;
+
+	CalculateBoundingRadius();
 }
 
 Model::Model(const void* data, int32_t size)
@@ -83,12 +87,30 @@ Model::Model(const void* data, int32_t size)
 		memcpy(models_[f].faces.data(), p, sizeof(Face) * faceCount);
 		p += sizeof(Face) * faceCount;
 	}
+
+	CalculateBoundingRadius();
 }
 
 Model ::~Model()
 {
 }
 
+void Model::CalculateBoundingRadius()
+{
+	float squaredRadius = 0.0f;
+
+	for (const auto& model : models_)
+	{
+		for (const auto& vertex : model.vertexes)
+		{
+			const auto& position = vertex.Position;
+			squaredRadius = std::max(squaredRadius, position.X * position.X + position.Y * position.Y + position.Z * position.Z);
+		}
+	}
+
+	boundingRadius_ = std::sqrt(squaredRadius);
+}
+
 const RefPtr<Backend::VertexBuffer>& Model::GetVertexBuffer(int32_t index) const
 {
 	return models_[index].vertexBuffer;
@@ -129,6 +151,11 @@ int32_t Model::GetFrameCount() const
 	return static_cast<int32_t>(models_.size());
 }
 
+float Model::GetBoundingRadius() const
+{
+	return boundingRadius_;
+}
+
 Model::Emitter Model::GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification)
 {
 	time = time % GetFrameCount();
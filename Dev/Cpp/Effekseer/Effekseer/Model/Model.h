@@ -69,6 +69,11 @@ protected:
 	bool isBufferStoredOnGPU_ = false;
 	bool isWireIndexBufferGenerated_ = false;
 
+	//! the maximum distance from the origin to vertexes in all frames
+	float boundingRadius_ = 0.0f;
+
+	void CalculateBoundingRadius();
+
 public:
 	Model(const CustomVector<Vertex>& vertecies, const CustomVector<Face>& faces);
 
@@ -92,6 +97,13 @@ public:
 
 	int32_t GetFrameCount() const;
 
+	/**
+		@brief
+		\~English	Get the maximum distance from the origin to vertexes in all frames
+		\~Japanese	全てのフレームの頂点の原点からの最大距離を取得する。
+	*/
+	float GetBoundingRadius() const;
+
 	Emitter GetEmitter(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
 
 	Emitter GetEmitterFromVertex(IRandObject* g, int32_t time, CoordinateSystem coordinate, float magnification);
@@ -75,4 +75,73 @@ SIMD::Vec3f SplineGenerator::GetValue(float t) const
 	return a[j] + (b[j] + (c[j] + d[j] * dt) * dt) * dt;
 }
 
-} // namespace Effekseer
\ No newline at end of file
+void SplineGenerator::GetValues(int32_t index, int32_t division, SIMD::Vec3f* dst) const
+{
+	if (index < 0)
+	{
+		index = 0;
+	}
+
+	if (index >= (int32_t)a.size())
+	{
+		index = (int32_t)a.size() - 1;
+	}
+
+	if (index < (int32_t)isSame.size() && isSame[index])
+	{
+		for (int32_t i = 0; i < division; i++)
+		{
+			dst[i] = a[index];
+		}
+		return;
+	}
+
+	auto a_ = a[index].s;
+	auto b_ = b[index].s;
+	auto c_ = c[index].s;
+	auto d_ = d[index].s;
+
+	const float step = 1.0f / static_cast<float>(division);
+
+	int32_t i = 0;
+
+	// 4 values are calculated at once with a structure of arrays
+	{
+		const auto ax = a_.Dup<0>();
+		const auto ay = a_.Dup<1>();
+		const auto az = a_.Dup<2>();
+		const auto bx = b_.Dup<0>();
+		const auto by = b_.Dup<1>();
+		const auto bz = b_.Dup<2>();
+		const auto cx = c_.Dup<0>();
+		const auto cy = c_.Dup<1>();
+		const auto cz = c_.Dup<2>();
+		const auto dx = d_.Dup<0>();
+		const auto dy = d_.Dup<1>();
+		const auto dz = d_.Dup<2>();
+
+		for (; i + 4 <= division; i += 4)
+		{
+			const SIMD::Float4 dt(i * step, (i + 1) * step, (i + 2) * step, (i + 3) * step);
+
+			auto x = SIMD::Float4::MulAdd(ax, SIMD::Float4::MulAdd(bx, SIMD::Float4::MulAdd(cx, dx, dt), dt), dt);
+			auto y = SIMD::Float4::MulAdd(ay, SIMD::Float4::MulAdd(by, SIMD::Float4::MulAdd(cy, dy, dt), dt), dt);
+			auto z = SIMD::Float4::MulAdd(az, SIMD::Float4::MulAdd(bz, SIMD::Float4::MulAdd(cz, dz, dt), dt), dt);
+			SIMD::Float4 w_;
+			SIMD::Float4::Transpose(x, y, z, w_);
+
+			dst[i + 0] = x;
+			dst[i + 1] = y;
+			dst[i + 2] = z;
+			dst[i + 3] = w_;
+		}
+	}
+
+	for (; i < division; i++)
+	{
+		const auto dt = i * step;
+		dst[i] = a[index] + (b[index] + (c[index] + d[index] * dt) * dt) * dt;
+	}
+}
+
+} // namespace Effekseer
@@ -28,6 +28,11 @@ class SplineGenerator
 public:
 	void AddVertex(const SIMD::Vec3f& v);
 
+	/**
+		@brief	Calculate coefficients
+		@note
+		All coefficients are recalculated. A natural cubic spline is a global system, so adding or removing a vertex changes every segment.
+	*/
 	void Calculate();
 
 	void CalculateDistances();
@@ -35,6 +40,13 @@ public:
 	void Reset();
 
 	SIMD::Vec3f GetValue(float t) const;
+
+	/**
+		@brief	Get values at index + i / division (0 <= i < division)
+		@note
+		It is faster than GetValue because values are calculated in batches.
+	*/
+	void GetValues(int32_t index, int32_t division, SIMD::Vec3f* dst) const;
 };
 
 } // namespace Effekseer
@@ -1,4 +1,5 @@
 #include "CurlNoise.h"
+#include "../SIMD/Kernels.h"
 
 namespace Effekseer
 {
@@ -13,19 +14,28 @@ SIMD::Vec3f CurlNoise::Get(SIMD::Vec3f pos) const
 	const SIMD::Vec3f dy = SIMD::Vec3f(0.0, e, 0.0);
 	const SIMD::Vec3f dz = SIMD::Vec3f(0.0, 0.0, e);
 
-	auto noise_x = [this](SIMD::Vec3f v) -> SIMD::Vec3f { return SIMD::Vec3f(0.0f, ynoise_.OctaveNoise(Octave, v), znoise_.OctaveNoise(Octave, v)); };
+	const auto& kernels = SIMD::GetKernels();
 
-	auto noise_y = [this](SIMD::Vec3f v) -> SIMD::Vec3f { return SIMD::Vec3f(xnoise_.OctaveNoise(Octave, v), 0.0f, znoise_.OctaveNoise(Octave, v)); };
+	// evaluate 4 points with a noise at once
+	auto noise = [&](const PerlinNoise& perlin, const SIMD::Vec3f& d1, const SIMD::Vec3f& d2) -> std::array<float, 4> {
+		std::array<float, 16> positions;
+		SIMD::Float4::Store4(&positions[0], (pos + d1).s);
+		SIMD::Float4::Store4(&positions[4], (pos - d1).s);
+		SIMD::Float4::Store4(&positions[8], (pos + d2).s);
+		SIMD::Float4::Store4(&positions[12], (pos - d2).s);
 
-	auto noise_z = [this](SIMD::Vec3f v) -> SIMD::Vec3f { return SIMD::Vec3f(xnoise_.OctaveNoise(Octave, v), ynoise_.OctaveNoise(Octave, v), 0.0f); };
+		std::array<float, 4> values;
+		kernels.OctaveNoise(values.data(), positions.data(), 4, Octave, perlin.GetPermutation());
+		return values;
+	};
 
-	SIMD::Vec3f p_x = noise_x(pos + dx) - noise_x(pos - dx);
-	SIMD::Vec3f p_y = noise_y(pos + dy) - noise_y(pos - dy);
-	SIMD::Vec3f p_z = noise_z(pos + dz) - noise_z(pos - dz);
+	const auto xn = noise(xnoise_, dy, dz);
+	const auto yn = noise(ynoise_, dx, dz);
+	const auto zn = noise(znoise_, dx, dy);
 
-	float x = p_y.GetZ() - p_z.GetY();
-	float y = p_z.GetX() - p_x.GetZ();
-	float z = p_x.GetY() - p_y.GetX();
+	float x = (zn[2] - zn[3]) - (yn[2] - yn[3]);
+	float y = (xn[2] - xn[3]) - (zn[0] - zn[1]);
+	float z = (yn[0] - yn[1]) - (xn[0] - xn[1]);
 
 	return SIMD::Vec3f(x, y, z) * (1.0f / (e * 2.0f));
 }
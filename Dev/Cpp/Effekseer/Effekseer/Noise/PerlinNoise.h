@@ -19,7 +19,9 @@ namespace Effekseer
 class PerlinNoise
 {
 	using Pint = std::uint_fast8_t;
-	std::array<Pint, 512> p{{}};
+
+	//! stored as int32_t to be looked up with SIMD::Kernels
+	std::array<int32_t, 512> p{{}};
 
 	uint32_t seed_ = 0;
 
@@ -52,7 +54,7 @@ public:
 		seed_ = seed;
 
 		for (std::size_t i{}; i < 256; ++i)
-			this->p[i] = static_cast<Pint>(i);
+			this->p[i] = static_cast<int32_t>(i);
 
 		for (std::size_t i{}; i < 256; ++i)
 		{
@@ -219,6 +221,12 @@ public:
 		}
 		return noise_value * 0.5f + 0.5f;
 	}
+
+	//! get the permutation table which has 512 elements for SIMD::Kernels::OctaveNoise
+	const int32_t* GetPermutation() const
+	{
+		return p.data();
+	}
 };
 
 } // namespace Effekseer
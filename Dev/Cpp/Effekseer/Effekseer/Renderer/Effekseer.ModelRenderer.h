@@ -98,6 +98,19 @@ public:
 	{
 	}
 
+	/**
+		@brief
+		\~English	Render instances in a node at once. Rendering is called for each instance by default.
+		\~Japanese	ノードのインスタンスをまとめて描画する。デフォルトでは各インスタンスに対してRenderingが呼ばれる。
+	*/
+	virtual void Rendering(const NodeParameter& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+	{
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering(parameter, instanceParameters[i], userData);
+		}
+	}
+
 	virtual void EndRendering(const NodeParameter& parameter, void* userData)
 	{
 	}
@@ -0,0 +1,43 @@
+
+#ifndef __EFFEKSEER_SIMD_BRIDGE8_H__
+#define __EFFEKSEER_SIMD_BRIDGE8_H__
+
+#include <cstdint>
+#include "Base.h"
+#include "Bridge.h"
+#include "Float8.h"
+#include "Int8.h"
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+#if defined(EFK_SIMD_AVX2)
+
+inline Int8 Float8::Convert8i() const { return _mm256_cvtps_epi32(s); }
+
+inline Int8 Float8::Cast8i() const { return _mm256_castps_si256(s); }
+
+inline Float8 Int8::Convert8f() const { return _mm256_cvtepi32_ps(s); }
+
+inline Float8 Int8::Cast8f() const { return _mm256_castsi256_ps(s); }
+
+#else
+
+inline Int8 Float8::Convert8i() const { return Int8{s[0].Convert4i(), s[1].Convert4i()}; }
+
+inline Int8 Float8::Cast8i() const { return Int8{s[0].Cast4i(), s[1].Cast4i()}; }
+
+inline Float8 Int8::Convert8f() const { return Float8{s[0].Convert4f(), s[1].Convert4f()}; }
+
+inline Float8 Int8::Cast8f() const { return Float8{s[0].Cast4f(), s[1].Cast4f()}; }
+
+#endif
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_SIMD_BRIDGE8_H__
@@ -0,0 +1,253 @@
+
+#ifndef __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+#define __EFFEKSEER_SIMD_FLOAT8_GEN_H__
+
+#include "Base.h"
+#include "Float4.h"
+
+#if !defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Int8;
+
+/**
+	@brief	simd class for 8 lanes which consists of two Float4
+*/
+struct alignas(16) Float8
+{
+	Float4 s[2];
+
+	Float8() = default;
+	Float8(const Float8& rhs) = default;
+	Float8(const Float4& low, const Float4& high) { s[0] = low; s[1] = high; }
+	Float8(float x0, float x1, float x2, float x3, float x4, float x5, float x6, float x7)
+	{
+		s[0] = Float4(x0, x1, x2, x3);
+		s[1] = Float4(x4, x5, x6, x7);
+	}
+	Float8(float i) { s[0] = Float4(i); s[1] = Float4(i); }
+
+	Float4 GetLow() const { return s[0]; }
+	Float4 GetHigh() const { return s[1]; }
+
+	Int8 Convert8i() const;
+	Int8 Cast8i() const;
+
+	Float8& operator+=(const Float8& rhs);
+	Float8& operator-=(const Float8& rhs);
+	Float8& operator*=(const Float8& rhs);
+	Float8& operator*=(float rhs);
+	Float8& operator/=(const Float8& rhs);
+	Float8& operator/=(float rhs);
+
+	static Float8 Load8(const void* mem);
+	static void Store8(void* mem, const Float8& i);
+
+	static Float8 SetZero();
+	static Float8 Sqrt(const Float8& in);
+	static Float8 Rsqrt(const Float8& in);
+	static Float8 Abs(const Float8& in);
+	static Float8 Min(const Float8& lhs, const Float8& rhs);
+	static Float8 Max(const Float8& lhs, const Float8& rhs);
+	static Float8 Floor(const Float8& in);
+	static Float8 Ceil(const Float8& in);
+	static Float8 MulAdd(const Float8& a, const Float8& b, const Float8& c);
+	static Float8 MulSub(const Float8& a, const Float8& b, const Float8& c);
+
+	static uint32_t MoveMask(const Float8& in);
+	static Float8 Select(const Float8& mask, const Float8& sel1, const Float8& sel2);
+	static Float8 Equal(const Float8& lhs, const Float8& rhs);
+	static Float8 NotEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 LessThan(const Float8& lhs, const Float8& rhs);
+	static Float8 LessEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterThan(const Float8& lhs, const Float8& rhs);
+	static Float8 GreaterEqual(const Float8& lhs, const Float8& rhs);
+	static Float8 NearEqual(const Float8& lhs, const Float8& rhs, float epsilon = DefaultEpsilon);
+	static Float8 IsZero(const Float8& in, float epsilon = DefaultEpsilon);
+};
+
+inline Float8 operator+(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] + rhs.s[0], lhs.s[1] + rhs.s[1]};
+}
+
+inline Float8 operator-(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] - rhs.s[0], lhs.s[1] - rhs.s[1]};
+}
+
+inline Float8 operator*(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] * rhs.s[0], lhs.s[1] * rhs.s[1]};
+}
+
+inline Float8 operator*(const Float8& lhs, float rhs)
+{
+	return Float8{lhs.s[0] * rhs, lhs.s[1] * rhs};
+}
+
+inline Float8 operator/(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] / rhs.s[0], lhs.s[1] / rhs.s[1]};
+}
+
+inline Float8 operator/(const Float8& lhs, float rhs)
+{
+	return Float8{lhs.s[0] / rhs, lhs.s[1] / rhs};
+}
+
+inline Float8 operator&(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] & rhs.s[0], lhs.s[1] & rhs.s[1]};
+}
+
+inline Float8 operator|(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] | rhs.s[0], lhs.s[1] | rhs.s[1]};
+}
+
+inline Float8 operator^(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{lhs.s[0] ^ rhs.s[0], lhs.s[1] ^ rhs.s[1]};
+}
+
+inline bool operator==(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Float8& lhs, const Float8& rhs)
+{
+	return Float8::MoveMask(Float8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Float8& Float8::operator+=(const Float8& rhs) { return *this = *this + rhs; }
+inline Float8& Float8::operator-=(const Float8& rhs) { return *this = *this - rhs; }
+inline Float8& Float8::operator*=(const Float8& rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator*=(float rhs) { return *this = *this * rhs; }
+inline Float8& Float8::operator/=(const Float8& rhs) { return *this = *this / rhs; }
+inline Float8& Float8::operator/=(float rhs) { return *this = *this / rhs; }
+
+inline Float8 Float8::Load8(const void* mem)
+{
+	return Float8{Float4::Load4(mem), Float4::Load4((const float*)mem + 4)};
+}
+
+inline void Float8::Store8(void* mem, const Float8& i)
+{
+	Float4::Store4(mem, i.s[0]);
+	Float4::Store4((float*)mem + 4, i.s[1]);
+}
+
+inline Float8 Float8::SetZero()
+{
+	return Float8{Float4::SetZero(), Float4::SetZero()};
+}
+
+inline Float8 Float8::Sqrt(const Float8& in)
+{
+	return Float8{Float4::Sqrt(in.s[0]), Float4::Sqrt(in.s[1])};
+}
+
+inline Float8 Float8::Rsqrt(const Float8& in)
+{
+	return Float8{Float4::Rsqrt(in.s[0]), Float4::Rsqrt(in.s[1])};
+}
+
+inline Float8 Float8::Abs(const Float8& in)
+{
+	return Float8{Float4::Abs(in.s[0]), Float4::Abs(in.s[1])};
+}
+
+inline Float8 Float8::Min(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::Min(lhs.s[0], rhs.s[0]), Float4::Min(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::Max(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::Max(lhs.s[0], rhs.s[0]), Float4::Max(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::Floor(const Float8& in)
+{
+	return Float8{Float4::Floor(in.s[0]), Float4::Floor(in.s[1])};
+}
+
+inline Float8 Float8::Ceil(const Float8& in)
+{
+	return Float8{Float4::Ceil(in.s[0]), Float4::Ceil(in.s[1])};
+}
+
+inline Float8 Float8::MulAdd(const Float8& a, const Float8& b, const Float8& c)
+{
+	return Float8{Float4::MulAdd(a.s[0], b.s[0], c.s[0]), Float4::MulAdd(a.s[1], b.s[1], c.s[1])};
+}
+
+inline Float8 Float8::MulSub(const Float8& a, const Float8& b, const Float8& c)
+{
+	return Float8{Float4::MulSub(a.s[0], b.s[0], c.s[0]), Float4::MulSub(a.s[1], b.s[1], c.s[1])};
+}
+
+inline uint32_t Float8::MoveMask(const Float8& in)
+{
+	return Float4::MoveMask(in.s[0]) | (Float4::MoveMask(in.s[1]) << 4);
+}
+
+inline Float8 Float8::Select(const Float8& mask, const Float8& sel1, const Float8& sel2)
+{
+	return Float8{Float4::Select(mask.s[0], sel1.s[0], sel2.s[0]), Float4::Select(mask.s[1], sel1.s[1], sel2.s[1])};
+}
+
+inline Float8 Float8::Equal(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::Equal(lhs.s[0], rhs.s[0]), Float4::Equal(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::NotEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::NotEqual(lhs.s[0], rhs.s[0]), Float4::NotEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::LessThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::LessThan(lhs.s[0], rhs.s[0]), Float4::LessThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::LessEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::LessEqual(lhs.s[0], rhs.s[0]), Float4::LessEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::GreaterThan(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::GreaterThan(lhs.s[0], rhs.s[0]), Float4::GreaterThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::GreaterEqual(const Float8& lhs, const Float8& rhs)
+{
+	return Float8{Float4::GreaterEqual(lhs.s[0], rhs.s[0]), Float4::GreaterEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Float8 Float8::NearEqual(const Float8& lhs, const Float8& rhs, float epsilon)
+{
+	return LessEqual(Abs(lhs - rhs), Float8(epsilon));
+}
+
+inline Float8 Float8::IsZero(const Float8& in, float epsilon)
+{
+	return LessEqual(Abs(in), Float8(epsilon));
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_FLOAT8_GEN_H__
@@ -0,0 +1,14 @@
+
+#ifndef __EFFEKSEER_SIMD_INT8_H__
+#define __EFFEKSEER_SIMD_INT8_H__
+
+#include <cstdint>
+#include "Base.h"
+
+#if defined(EFK_SIMD_AVX2)
+#include "Int8_AVX2.h"
+#else
+#include "Int8_Gen.h"
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_H__
@@ -0,0 +1,209 @@
+
+#ifndef __EFFEKSEER_SIMD_INT8_AVX2_H__
+#define __EFFEKSEER_SIMD_INT8_AVX2_H__
+
+#include "Base.h"
+#include "Int4.h"
+
+#if defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Float8;
+
+/**
+	@brief	simd class for avx2
+*/
+struct alignas(32) Int8
+{
+	__m256i s;
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(__m256i rhs) { s = rhs; }
+	Int8(__m256 rhs) { s = _mm256_castps_si256(rhs); }
+	Int8(const Int4& low, const Int4& high) { s = _mm256_inserti128_si256(_mm256_castsi128_si256(low.s), high.s, 1); }
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7) { s = _mm256_setr_epi32(x0, x1, x2, x3, x4, x5, x6, x7); }
+	Int8(int32_t i) { s = _mm256_set1_epi32(i); }
+
+	Int4 GetLow() const { return _mm256_castsi256_si128(s); }
+	Int4 GetHigh() const { return _mm256_extracti128_si256(s, 1); }
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_add_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_sub_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_mullo_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_and_si256(lhs.s, rhs.s)};
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_or_si256(lhs.s, rhs.s)};
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * Int8(rhs); }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	return _mm256_loadu_si256((const __m256i*)mem);
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	_mm256_storeu_si256((__m256i*)mem, i.s);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return _mm256_setzero_si256();
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	return _mm256_abs_epi32(in.s);
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	return _mm256_min_epi32(lhs.s, rhs.s);
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	return _mm256_max_epi32(lhs.s, rhs.s);
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	return _mm256_slli_epi32(lhs.s, COUNT);
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	return _mm256_srli_epi32(lhs.s, COUNT);
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	return _mm256_srai_epi32(lhs.s, COUNT);
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	return (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(in.s));
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpeq_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpeq_epi32(lhs.s, rhs.s), _mm256_set1_epi32(-1))};
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpgt_epi32(rhs.s, lhs.s)};
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpgt_epi32(lhs.s, rhs.s), _mm256_set1_epi32(-1))};
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_cmpgt_epi32(lhs.s, rhs.s)};
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{_mm256_andnot_si256(_mm256_cmpgt_epi32(rhs.s, lhs.s), _mm256_set1_epi32(-1))};
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_AVX2_H__
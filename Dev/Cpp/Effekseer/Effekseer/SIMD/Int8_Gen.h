@@ -0,0 +1,212 @@
+
+#ifndef __EFFEKSEER_SIMD_INT8_GEN_H__
+#define __EFFEKSEER_SIMD_INT8_GEN_H__
+
+#include "Base.h"
+#include "Int4.h"
+
+#if !defined(EFK_SIMD_AVX2)
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+struct Float8;
+
+/**
+	@brief	simd class for 8 lanes which consists of two Int4
+*/
+struct alignas(16) Int8
+{
+	Int4 s[2];
+
+	Int8() = default;
+	Int8(const Int8& rhs) = default;
+	Int8(const Int4& low, const Int4& high) { s[0] = low; s[1] = high; }
+	Int8(int32_t x0, int32_t x1, int32_t x2, int32_t x3, int32_t x4, int32_t x5, int32_t x6, int32_t x7)
+	{
+		s[0] = Int4(x0, x1, x2, x3);
+		s[1] = Int4(x4, x5, x6, x7);
+	}
+	Int8(int32_t i) { s[0] = Int4(i); s[1] = Int4(i); }
+
+	Int4 GetLow() const { return s[0]; }
+	Int4 GetHigh() const { return s[1]; }
+
+	Float8 Convert8f() const;
+	Float8 Cast8f() const;
+
+	Int8& operator+=(const Int8& rhs);
+	Int8& operator-=(const Int8& rhs);
+	Int8& operator*=(const Int8& rhs);
+	Int8& operator*=(int32_t rhs);
+
+	static Int8 Load8(const void* mem);
+	static void Store8(void* mem, const Int8& i);
+
+	static Int8 SetZero();
+	static Int8 Abs(const Int8& in);
+	static Int8 Min(const Int8& lhs, const Int8& rhs);
+	static Int8 Max(const Int8& lhs, const Int8& rhs);
+	static Int8 MulAdd(const Int8& a, const Int8& b, const Int8& c);
+	static Int8 MulSub(const Int8& a, const Int8& b, const Int8& c);
+
+	template <int COUNT>
+	static Int8 ShiftL(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftR(const Int8& in);
+	template <int COUNT>
+	static Int8 ShiftRA(const Int8& in);
+
+	static uint32_t MoveMask(const Int8& in);
+	static Int8 Equal(const Int8& lhs, const Int8& rhs);
+	static Int8 NotEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 LessThan(const Int8& lhs, const Int8& rhs);
+	static Int8 LessEqual(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterThan(const Int8& lhs, const Int8& rhs);
+	static Int8 GreaterEqual(const Int8& lhs, const Int8& rhs);
+};
+
+inline Int8 operator+(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] + rhs.s[0], lhs.s[1] + rhs.s[1]};
+}
+
+inline Int8 operator-(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] - rhs.s[0], lhs.s[1] - rhs.s[1]};
+}
+
+inline Int8 operator*(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] * rhs.s[0], lhs.s[1] * rhs.s[1]};
+}
+
+inline Int8 operator&(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] & rhs.s[0], lhs.s[1] & rhs.s[1]};
+}
+
+inline Int8 operator|(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{lhs.s[0] | rhs.s[0], lhs.s[1] | rhs.s[1]};
+}
+
+inline bool operator==(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) == 0xff;
+}
+
+inline bool operator!=(const Int8& lhs, const Int8& rhs)
+{
+	return Int8::MoveMask(Int8::Equal(lhs, rhs)) != 0xff;
+}
+
+inline Int8& Int8::operator+=(const Int8& rhs) { return *this = *this + rhs; }
+inline Int8& Int8::operator-=(const Int8& rhs) { return *this = *this - rhs; }
+inline Int8& Int8::operator*=(const Int8& rhs) { return *this = *this * rhs; }
+inline Int8& Int8::operator*=(int32_t rhs) { return *this = *this * Int8(rhs); }
+
+inline Int8 Int8::Load8(const void* mem)
+{
+	return Int8{Int4::Load4(mem), Int4::Load4((const int32_t*)mem + 4)};
+}
+
+inline void Int8::Store8(void* mem, const Int8& i)
+{
+	Int4::Store4(mem, i.s[0]);
+	Int4::Store4((int32_t*)mem + 4, i.s[1]);
+}
+
+inline Int8 Int8::SetZero()
+{
+	return Int8{Int4::SetZero(), Int4::SetZero()};
+}
+
+inline Int8 Int8::Abs(const Int8& in)
+{
+	return Int8{Int4::Abs(in.s[0]), Int4::Abs(in.s[1])};
+}
+
+inline Int8 Int8::Min(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::Min(lhs.s[0], rhs.s[0]), Int4::Min(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::Max(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::Max(lhs.s[0], rhs.s[0]), Int4::Max(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::MulAdd(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a + b * c;
+}
+
+inline Int8 Int8::MulSub(const Int8& a, const Int8& b, const Int8& c)
+{
+	return a - b * c;
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftL(const Int8& lhs)
+{
+	return Int8{Int4::ShiftL<COUNT>(lhs.s[0]), Int4::ShiftL<COUNT>(lhs.s[1])};
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftR(const Int8& lhs)
+{
+	return Int8{Int4::ShiftR<COUNT>(lhs.s[0]), Int4::ShiftR<COUNT>(lhs.s[1])};
+}
+
+template <int COUNT>
+inline Int8 Int8::ShiftRA(const Int8& lhs)
+{
+	return Int8{Int4::ShiftRA<COUNT>(lhs.s[0]), Int4::ShiftRA<COUNT>(lhs.s[1])};
+}
+
+inline uint32_t Int8::MoveMask(const Int8& in)
+{
+	return Int4::MoveMask(in.s[0]) | (Int4::MoveMask(in.s[1]) << 4);
+}
+
+inline Int8 Int8::Equal(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::Equal(lhs.s[0], rhs.s[0]), Int4::Equal(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::NotEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::NotEqual(lhs.s[0], rhs.s[0]), Int4::NotEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::LessThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::LessThan(lhs.s[0], rhs.s[0]), Int4::LessThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::LessEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::LessEqual(lhs.s[0], rhs.s[0]), Int4::LessEqual(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::GreaterThan(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::GreaterThan(lhs.s[0], rhs.s[0]), Int4::GreaterThan(lhs.s[1], rhs.s[1])};
+}
+
+inline Int8 Int8::GreaterEqual(const Int8& lhs, const Int8& rhs)
+{
+	return Int8{Int4::GreaterEqual(lhs.s[0], rhs.s[0]), Int4::GreaterEqual(lhs.s[1], rhs.s[1])};
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif
+
+#endif // __EFFEKSEER_SIMD_INT8_GEN_H__
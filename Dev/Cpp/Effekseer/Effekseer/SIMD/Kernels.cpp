@@ -0,0 +1,303 @@
+#include "Kernels.h"
+#include "Bridge.h"
+#include "Bridge8.h"
+#include "Float4.h"
+#include "Float8.h"
+#include "Int4.h"
+#include "Int8.h"
+#include <array>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define EFK_SIMD_KERNELS_X64
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+//! defined in Kernels_AVX2.cpp. nullptr is returned if it is not compiled with AVX2
+const Kernels* GetKernelsAVX2();
+
+namespace
+{
+
+#if defined(EFK_SIMD_KERNELS_X64)
+
+void GetCpuid(uint32_t* regs, uint32_t leaf, uint32_t subleaf)
+{
+#if defined(_MSC_VER)
+	int32_t values[4];
+	__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+	for (int32_t i = 0; i < 4; i++)
+	{
+		regs[i] = static_cast<uint32_t>(values[i]);
+	}
+#else
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+uint64_t GetXCR0()
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ volatile("xgetbv"
+					 : "=a"(eax), "=d"(edx)
+					 : "c"(0));
+	return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+bool DetectAVX2()
+{
+	uint32_t regs[4];
+	GetCpuid(regs, 0, 0);
+	if (regs[0] < 7)
+	{
+		return false;
+	}
+
+	// OSXSAVE and AVX
+	GetCpuid(regs, 1, 0);
+	const uint32_t osxsaveAndAVX = (1u << 27) | (1u << 28);
+	if ((regs[2] & osxsaveAndAVX) != osxsaveAndAVX)
+	{
+		return false;
+	}
+
+	// OS saves xmm and ymm registers
+	if ((GetXCR0() & 6) != 6)
+	{
+		return false;
+	}
+
+	GetCpuid(regs, 7, 0);
+	return (regs[1] & (1u << 5)) != 0;
+}
+
+#endif
+
+void MultiplyMat43Generic(float* dst, const float* lhs, const float* rhs, int32_t count)
+{
+	const Float4 mask = Float4::SetUInt(0, 0, 0, 0xffffffff);
+
+	for (int32_t i = 0; i < count; i++)
+	{
+		const Float4 lx = Float4::Load4(lhs + i * 12 + 0);
+		const Float4 ly = Float4::Load4(lhs + i * 12 + 4);
+		const Float4 lz = Float4::Load4(lhs + i * 12 + 8);
+
+		std::array<Float4, 3> rows;
+		for (size_t r = 0; r < rows.size(); r++)
+		{
+			Float4 row = Float4::Load4(rhs + i * 12 + r * 4);
+			rows[r] = (((mask & row) + lx * row.Dup<0>()) + ly * row.Dup<1>()) + lz * row.Dup<2>();
+		}
+
+		for (size_t r = 0; r < rows.size(); r++)
+		{
+			Float4::Store4(dst + i * 12 + r * 4, rows[r]);
+		}
+	}
+}
+
+void IntegratePVAGeneric(float* dst, const float* location, const float* velocity, const float* acceleration, const float* time, int32_t count)
+{
+	int32_t i = 0;
+
+	for (; i + 2 <= count; i += 2)
+	{
+		const Float8 t{Float4(time[i]), Float4(time[i + 1])};
+		const Float8 tt{Float4(time[i] * time[i] * 0.5f), Float4(time[i + 1] * time[i + 1] * 0.5f)};
+
+		const auto loc = Float8::Load8(location + i * 4);
+		const auto vel = Float8::Load8(velocity + i * 4);
+		const auto acc = Float8::Load8(acceleration + i * 4);
+		Float8::Store8(dst + i * 4, (loc + vel * t) + acc * tt);
+	}
+
+	for (; i < count; i++)
+	{
+		const auto loc = Float4::Load4(location + i * 4);
+		const auto vel = Float4::Load4(velocity + i * 4);
+		const auto acc = Float4::Load4(acceleration + i * 4);
+		Float4::Store4(dst + i * 4, (loc + vel * time[i]) + acc * (time[i] * time[i] * 0.5f));
+	}
+}
+
+Int8 Lookup(const int32_t* table, const Int8& index)
+{
+	std::array<int32_t, 8> indexes;
+	std::array<int32_t, 8> values;
+	Int8::Store8(indexes.data(), index);
+
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		values[i] = table[indexes[i]];
+	}
+
+	return Int8::Load8(values.data());
+}
+
+Float8 Fade(const Float8& t)
+{
+	return (t * t * t) * ((t * ((t * Float8(6.0f)) - Float8(15.0f))) + Float8(10.0f));
+}
+
+Float8 Lerp(const Float8& t, const Float8& a, const Float8& b)
+{
+	return a + t * (b - a);
+}
+
+Float8 Grad(const Int8& hash, const Float8& x, const Float8& y, const Float8& z)
+{
+	const Int8 h = hash & Int8(15);
+	const Float8 u = Float8::Select(Int8::LessThan(h, Int8(8)).Cast8f(), x, y);
+	const Float8 v = Float8::Select(Int8::LessThan(h, Int8(4)).Cast8f(),
+									y,
+									Float8::Select((Int8::Equal(h, Int8(12)) | Int8::Equal(h, Int8(14))).Cast8f(), x, z));
+
+	return (u ^ Int8::ShiftL<31>(h & Int8(1)).Cast8f()) + (v ^ Int8::ShiftL<30>(h & Int8(2)).Cast8f());
+}
+
+Float8 Noise(const Float8& inX, const Float8& inY, const Float8& inZ, const int32_t* p)
+{
+	const Float8 flX = Float8::Floor(inX);
+	const Float8 flY = Float8::Floor(inY);
+	const Float8 flZ = Float8::Floor(inZ);
+
+	const Int8 ix = flX.Convert8i() & Int8(0xff);
+	const Int8 iy = flY.Convert8i() & Int8(0xff);
+	const Int8 iz = flZ.Convert8i() & Int8(0xff);
+
+	const Float8 x0 = inX - flX;
+	const Float8 y0 = inY - flY;
+	const Float8 z0 = inZ - flZ;
+	const Float8 x1 = x0 - Float8(1.0f);
+	const Float8 y1 = y0 - Float8(1.0f);
+	const Float8 z1 = z0 - Float8(1.0f);
+
+	const Float8 u = Fade(x0);
+	const Float8 v = Fade(y0);
+	const Float8 w = Fade(z0);
+
+	const Int8 one(1);
+	const Int8 a0 = Lookup(p, ix) + iy;
+	const Int8 a1 = Lookup(p, a0) + iz;
+	const Int8 a2 = Lookup(p, a0 + one) + iz;
+	const Int8 b0 = Lookup(p, ix + one) + iy;
+	const Int8 b1 = Lookup(p, b0) + iz;
+	const Int8 b2 = Lookup(p, b0 + one) + iz;
+
+	const Float8 v00 = Lerp(u, Grad(Lookup(p, a1), x0, y0, z0), Grad(Lookup(p, b1), x1, y0, z0));
+	const Float8 v10 = Lerp(u, Grad(Lookup(p, a2), x0, y1, z0), Grad(Lookup(p, b2), x1, y1, z0));
+	const Float8 v01 = Lerp(u, Grad(Lookup(p, a1 + one), x0, y0, z1), Grad(Lookup(p, b1 + one), x1, y0, z1));
+	const Float8 v11 = Lerp(u, Grad(Lookup(p, a2 + one), x0, y1, z1), Grad(Lookup(p, b2 + one), x1, y1, z1));
+
+	return Lerp(w, Lerp(v, v00, v10), Lerp(v, v01, v11));
+}
+
+void OctaveNoiseGeneric(float* dst, const float* positions, int32_t count, int32_t octaves, const int32_t* permutation)
+{
+	for (int32_t offset = 0; offset < count; offset += 8)
+	{
+		const int32_t blockCount = count - offset < 8 ? count - offset : 8;
+
+		std::array<float, 8> xs{};
+		std::array<float, 8> ys{};
+		std::array<float, 8> zs{};
+
+		for (int32_t i = 0; i < blockCount; i++)
+		{
+			xs[i] = positions[(offset + i) * 4 + 0];
+			ys[i] = positions[(offset + i) * 4 + 1];
+			zs[i] = positions[(offset + i) * 4 + 2];
+		}
+
+		Float8 x = Float8::Load8(xs.data());
+		Float8 y = Float8::Load8(ys.data());
+		Float8 z = Float8::Load8(zs.data());
+
+		Float8 value = Float8::SetZero();
+		float amp = 1.0f;
+		for (int32_t o = 0; o < octaves; o++)
+		{
+			value += Noise(x, y, z, permutation) * amp;
+			x *= 2.0f;
+			y *= 2.0f;
+			z *= 2.0f;
+			amp *= 0.5f;
+		}
+
+		std::array<float, 8> values;
+		Float8::Store8(values.data(), value * 0.5f + Float8(0.5f));
+
+		for (int32_t i = 0; i < blockCount; i++)
+		{
+			dst[offset + i] = values[i];
+		}
+	}
+}
+
+const Kernels GenericKernels = {
+	InstructionSet::Generic,
+	MultiplyMat43Generic,
+	IntegratePVAGeneric,
+	OctaveNoiseGeneric,
+};
+
+} // namespace
+
+bool IsSupported(InstructionSet set)
+{
+	return GetKernels(set) != nullptr;
+}
+
+const Kernels* GetKernels(InstructionSet set)
+{
+	switch (set)
+	{
+	case InstructionSet::Generic:
+		return &GenericKernels;
+	case InstructionSet::AVX2:
+	{
+#if defined(EFK_SIMD_KERNELS_X64)
+		static const bool isAVX2Supported = DetectAVX2();
+		if (isAVX2Supported)
+		{
+			return GetKernelsAVX2();
+		}
+#endif
+		return nullptr;
+	}
+	}
+
+	return nullptr;
+}
+
+const Kernels& GetKernels()
+{
+	static const Kernels* kernels = []() {
+		if (auto avx2 = GetKernels(InstructionSet::AVX2))
+		{
+			return avx2;
+		}
+		return &GenericKernels;
+	}();
+
+	return *kernels;
+}
+
+} // namespace SIMD
+
+} // namespace Effekseer
@@ -0,0 +1,67 @@
+
+#ifndef __EFFEKSEER_SIMD_KERNELS_H__
+#define __EFFEKSEER_SIMD_KERNELS_H__
+
+#include <cstdint>
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+/**
+	@brief	instruction sets which kernels are implemented with
+*/
+enum class InstructionSet : int32_t
+{
+	//! the instruction set which is selected at compile time
+	Generic,
+
+	//! x86-64 AVX2 which is selected at runtime
+	AVX2,
+};
+
+/**
+	@brief	hot loops which process many elements at once
+	@note
+	Vectors are stored as 4 floats (x, y, z, unused) like Vec3f.
+	Matrices are stored as 12 floats like Mat43f (rows X, Y and Z).
+	Kernels don't use FMA, so results are same as Float4 and Mat43f built without AVX2.
+*/
+struct Kernels
+{
+	InstructionSet Set;
+
+	//! dst[i] = lhs[i] * rhs[i]. dst may be same as lhs or rhs
+	void (*MultiplyMat43)(float* dst, const float* lhs, const float* rhs, int32_t count);
+
+	//! dst[i] = location[i] + velocity[i] * time[i] + acceleration[i] * time[i] * time[i] * 0.5
+	void (*IntegratePVA)(float* dst, const float* location, const float* velocity, const float* acceleration, const float* time, int32_t count);
+
+	//! dst[i] = PerlinNoise::OctaveNoise(octaves, positions[i]) with a permutation table which has 512 elements
+	void (*OctaveNoise)(float* dst, const float* positions, int32_t count, int32_t octaves, const int32_t* permutation);
+};
+
+/**
+	@brief	whether kernels with the instruction set can be run on this CPU
+*/
+bool IsSupported(InstructionSet set);
+
+/**
+	@brief	get kernels with the instruction set. nullptr is returned if they can't be run on this CPU
+*/
+const Kernels* GetKernels(InstructionSet set);
+
+/**
+	@brief	get kernels with the best instruction set on this CPU
+	@note
+	The instruction set is detected with CPUID at the first call.
+*/
+const Kernels& GetKernels();
+
+} // namespace SIMD
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_SIMD_KERNELS_H__
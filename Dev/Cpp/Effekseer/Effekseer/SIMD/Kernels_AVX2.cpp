@@ -0,0 +1,266 @@
+// This file is compiled with AVX2 and only the kernels are called after AVX2 is detected at runtime.
+// Don't include other headers of Effekseer. Their inline functions compiled with AVX2 may be shared with other files.
+#include "Kernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Effekseer
+{
+
+namespace SIMD
+{
+
+#if defined(__AVX2__)
+
+namespace
+{
+
+void MultiplyMat43AVX2(float* dst, const float* lhs, const float* rhs, int32_t count)
+{
+	const __m256 mask = _mm256_castsi256_ps(_mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1));
+
+	int32_t i = 0;
+
+	// two matrices in a register
+	for (; i + 2 <= count; i += 2)
+	{
+		const float* l = lhs + i * 12;
+		const float* r = rhs + i * 12;
+
+		const __m256 lx = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(l + 0)), _mm_loadu_ps(l + 12), 1);
+		const __m256 ly = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(l + 4)), _mm_loadu_ps(l + 16), 1);
+		const __m256 lz = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(l + 8)), _mm_loadu_ps(l + 20), 1);
+
+		__m256 rows[3];
+		for (int32_t j = 0; j < 3; j++)
+		{
+			const __m256 row = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(r + j * 4)), _mm_loadu_ps(r + j * 4 + 12), 1);
+
+			__m256 res = _mm256_and_ps(mask, row);
+			res = _mm256_add_ps(res, _mm256_mul_ps(lx, _mm256_permute_ps(row, _MM_SHUFFLE(0, 0, 0, 0))));
+			res = _mm256_add_ps(res, _mm256_mul_ps(ly, _mm256_permute_ps(row, _MM_SHUFFLE(1, 1, 1, 1))));
+			res = _mm256_add_ps(res, _mm256_mul_ps(lz, _mm256_permute_ps(row, _MM_SHUFFLE(2, 2, 2, 2))));
+			rows[j] = res;
+		}
+
+		for (int32_t j = 0; j < 3; j++)
+		{
+			_mm_storeu_ps(dst + i * 12 + j * 4, _mm256_castps256_ps128(rows[j]));
+			_mm_storeu_ps(dst + i * 12 + j * 4 + 12, _mm256_extractf128_ps(rows[j], 1));
+		}
+	}
+
+	for (; i < count; i++)
+	{
+		const float* l = lhs + i * 12;
+		const float* r = rhs + i * 12;
+
+		const __m128 lx = _mm_loadu_ps(l + 0);
+		const __m128 ly = _mm_loadu_ps(l + 4);
+		const __m128 lz = _mm_loadu_ps(l + 8);
+
+		__m128 rows[3];
+		for (int32_t j = 0; j < 3; j++)
+		{
+			const __m128 row = _mm_loadu_ps(r + j * 4);
+
+			__m128 res = _mm_and_ps(_mm256_castps256_ps128(mask), row);
+			res = _mm_add_ps(res, _mm_mul_ps(lx, _mm_permute_ps(row, _MM_SHUFFLE(0, 0, 0, 0))));
+			res = _mm_add_ps(res, _mm_mul_ps(ly, _mm_permute_ps(row, _MM_SHUFFLE(1, 1, 1, 1))));
+			res = _mm_add_ps(res, _mm_mul_ps(lz, _mm_permute_ps(row, _MM_SHUFFLE(2, 2, 2, 2))));
+			rows[j] = res;
+		}
+
+		for (int32_t j = 0; j < 3; j++)
+		{
+			_mm_storeu_ps(dst + i * 12 + j * 4, rows[j]);
+		}
+	}
+}
+
+void IntegratePVAAVX2(float* dst, const float* location, const float* velocity, const float* acceleration, const float* time, int32_t count)
+{
+	int32_t i = 0;
+
+	for (; i + 2 <= count; i += 2)
+	{
+		const float t0 = time[i];
+		const float t1 = time[i + 1];
+		const __m256 t = _mm256_setr_ps(t0, t0, t0, t0, t1, t1, t1, t1);
+		const float tt0 = t0 * t0 * 0.5f;
+		const float tt1 = t1 * t1 * 0.5f;
+		const __m256 tt = _mm256_setr_ps(tt0, tt0, tt0, tt0, tt1, tt1, tt1, tt1);
+
+		const __m256 loc = _mm256_loadu_ps(location + i * 4);
+		const __m256 vel = _mm256_loadu_ps(velocity + i * 4);
+		const __m256 acc = _mm256_loadu_ps(acceleration + i * 4);
+		_mm256_storeu_ps(dst + i * 4, _mm256_add_ps(_mm256_add_ps(loc, _mm256_mul_ps(vel, t)), _mm256_mul_ps(acc, tt)));
+	}
+
+	for (; i < count; i++)
+	{
+		const __m128 t = _mm_set1_ps(time[i]);
+		const __m128 tt = _mm_set1_ps(time[i] * time[i] * 0.5f);
+
+		const __m128 loc = _mm_loadu_ps(location + i * 4);
+		const __m128 vel = _mm_loadu_ps(velocity + i * 4);
+		const __m128 acc = _mm_loadu_ps(acceleration + i * 4);
+		_mm_storeu_ps(dst + i * 4, _mm_add_ps(_mm_add_ps(loc, _mm_mul_ps(vel, t)), _mm_mul_ps(acc, tt)));
+	}
+}
+
+__m256 Fade(__m256 t)
+{
+	const __m256 t3 = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+	const __m256 t6_15_10 = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f));
+	return _mm256_mul_ps(t3, t6_15_10);
+}
+
+__m256 Lerp(__m256 t, __m256 a, __m256 b)
+{
+	return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+}
+
+__m256i Lookup(const int32_t* table, __m256i index)
+{
+	return _mm256_i32gather_epi32(reinterpret_cast<const int*>(table), index, 4);
+}
+
+__m256 Grad(__m256i hash, __m256 x, __m256 y, __m256 z)
+{
+	const __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+
+	const __m256 lessThan8 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), h));
+	const __m256 lessThan4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+	const __m256 is12or14 = _mm256_castsi256_ps(_mm256_or_si256(_mm256_cmpeq_epi32(h, _mm256_set1_epi32(12)), _mm256_cmpeq_epi32(h, _mm256_set1_epi32(14))));
+
+	const __m256 u = _mm256_blendv_ps(y, x, lessThan8);
+	const __m256 v = _mm256_blendv_ps(_mm256_blendv_ps(z, x, is12or14), y, lessThan4);
+
+	const __m256 signU = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31));
+	const __m256 signV = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30));
+
+	return _mm256_add_ps(_mm256_xor_ps(u, signU), _mm256_xor_ps(v, signV));
+}
+
+__m256 Noise(__m256 inX, __m256 inY, __m256 inZ, const int32_t* p)
+{
+	const __m256 flX = _mm256_floor_ps(inX);
+	const __m256 flY = _mm256_floor_ps(inY);
+	const __m256 flZ = _mm256_floor_ps(inZ);
+
+	const __m256i byteMask = _mm256_set1_epi32(0xff);
+	const __m256i ix = _mm256_and_si256(_mm256_cvtps_epi32(flX), byteMask);
+	const __m256i iy = _mm256_and_si256(_mm256_cvtps_epi32(flY), byteMask);
+	const __m256i iz = _mm256_and_si256(_mm256_cvtps_epi32(flZ), byteMask);
+
+	const __m256 one = _mm256_set1_ps(1.0f);
+	const __m256 x0 = _mm256_sub_ps(inX, flX);
+	const __m256 y0 = _mm256_sub_ps(inY, flY);
+	const __m256 z0 = _mm256_sub_ps(inZ, flZ);
+	const __m256 x1 = _mm256_sub_ps(x0, one);
+	const __m256 y1 = _mm256_sub_ps(y0, one);
+	const __m256 z1 = _mm256_sub_ps(z0, one);
+
+	const __m256 u = Fade(x0);
+	const __m256 v = Fade(y0);
+	const __m256 w = Fade(z0);
+
+	const __m256i onei = _mm256_set1_epi32(1);
+	const __m256i a0 = _mm256_add_epi32(Lookup(p, ix), iy);
+	const __m256i a1 = _mm256_add_epi32(Lookup(p, a0), iz);
+	const __m256i a2 = _mm256_add_epi32(Lookup(p, _mm256_add_epi32(a0, onei)), iz);
+	const __m256i b0 = _mm256_add_epi32(Lookup(p, _mm256_add_epi32(ix, onei)), iy);
+	const __m256i b1 = _mm256_add_epi32(Lookup(p, b0), iz);
+	const __m256i b2 = _mm256_add_epi32(Lookup(p, _mm256_add_epi32(b0, onei)), iz);
+
+	const __m256 v00 = Lerp(u, Grad(Lookup(p, a1), x0, y0, z0), Grad(Lookup(p, b1), x1, y0, z0));
+	const __m256 v10 = Lerp(u, Grad(Lookup(p, a2), x0, y1, z0), Grad(Lookup(p, b2), x1, y1, z0));
+	const __m256 v01 = Lerp(u, Grad(Lookup(p, _mm256_add_epi32(a1, onei)), x0, y0, z1), Grad(Lookup(p, _mm256_add_epi32(b1, onei)), x1, y0, z1));
+	const __m256 v11 = Lerp(u, Grad(Lookup(p, _mm256_add_epi32(a2, onei)), x0, y1, z1), Grad(Lookup(p, _mm256_add_epi32(b2, onei)), x1, y1, z1));
+
+	return Lerp(w, Lerp(v, v00, v10), Lerp(v, v01, v11));
+}
+
+void OctaveNoiseAVX2(float* dst, const float* positions, int32_t count, int32_t octaves, const int32_t* permutation)
+{
+	const __m256i stride = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+
+	for (int32_t offset = 0; offset < count; offset += 8)
+	{
+		const int32_t blockCount = count - offset < 8 ? count - offset : 8;
+
+		const float* src = positions + offset * 4;
+		float padded[32];
+		if (blockCount < 8)
+		{
+			for (int32_t i = 0; i < 32; i++)
+			{
+				padded[i] = i < blockCount * 4 ? src[i] : 0.0f;
+			}
+			src = padded;
+		}
+
+		__m256 x = _mm256_i32gather_ps(src + 0, stride, 4);
+		__m256 y = _mm256_i32gather_ps(src + 1, stride, 4);
+		__m256 z = _mm256_i32gather_ps(src + 2, stride, 4);
+
+		const __m256 two = _mm256_set1_ps(2.0f);
+		__m256 value = _mm256_setzero_ps();
+		float amp = 1.0f;
+		for (int32_t o = 0; o < octaves; o++)
+		{
+			value = _mm256_add_ps(value, _mm256_mul_ps(Noise(x, y, z, permutation), _mm256_set1_ps(amp)));
+			x = _mm256_mul_ps(x, two);
+			y = _mm256_mul_ps(y, two);
+			z = _mm256_mul_ps(z, two);
+			amp *= 0.5f;
+		}
+
+		const __m256 half = _mm256_set1_ps(0.5f);
+		value = _mm256_add_ps(_mm256_mul_ps(value, half), half);
+
+		if (blockCount == 8)
+		{
+			_mm256_storeu_ps(dst + offset, value);
+		}
+		else
+		{
+			float values[8];
+			_mm256_storeu_ps(values, value);
+			for (int32_t i = 0; i < blockCount; i++)
+			{
+				dst[offset + i] = values[i];
+			}
+		}
+	}
+}
+
+const Kernels AVX2Kernels = {
+	InstructionSet::AVX2,
+	MultiplyMat43AVX2,
+	IntegratePVAAVX2,
+	OctaveNoiseAVX2,
+};
+
+} // namespace
+
+const Kernels* GetKernelsAVX2()
+{
+	return &AVX2Kernels;
+}
+
+#else
+
+const Kernels* GetKernelsAVX2()
+{
+	return nullptr;
+}
+
+#endif
+
+} // namespace SIMD
+
+} // namespace Effekseer
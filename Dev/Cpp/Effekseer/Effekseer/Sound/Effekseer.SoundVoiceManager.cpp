@@ -0,0 +1,298 @@
+﻿//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "Effekseer.SoundVoiceManager.h"
+#include <algorithm>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+
+bool SoundVoiceManager::IsLimited() const
+{
+	return maxVoiceCount_ > 0 || audibleVolume_ > 0.0f || defaultDataParameter_.MaxVoiceCount > 0 || dataParameters_.size() > 0;
+}
+
+const SoundVoiceManager::DataParameter& SoundVoiceManager::GetDataParameter(const SoundData* data) const
+{
+	auto it = dataParameters_.find(data);
+	if (it != dataParameters_.end())
+	{
+		return it->second.Parameter;
+	}
+	return defaultDataParameter_;
+}
+
+float SoundVoiceManager::CalculateAudibility(const SoundPlayer::InstanceParameter& parameter) const
+{
+	if (!parameter.Mode3D)
+	{
+		return parameter.Volume;
+	}
+
+	// a volume decreases linearly and becomes zero at twice the distance
+	const float distance = Vector3D::Length(parameter.Position - listenerPosition_);
+	if (distance <= parameter.Distance)
+	{
+		return parameter.Volume;
+	}
+
+	if (parameter.Distance <= 0.0f || distance >= parameter.Distance * 2.0f)
+	{
+		return 0.0f;
+	}
+
+	return parameter.Volume * (1.0f - (distance - parameter.Distance) / parameter.Distance);
+}
+
+void SoundVoiceManager::SetSoundPlayer(SoundPlayerRef player)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	voices_.clear();
+	player_ = player;
+}
+
+void SoundVoiceManager::SetMaxVoiceCount(int32_t count)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	maxVoiceCount_ = count;
+}
+
+void SoundVoiceManager::SetDataParameter(const SoundDataRef& data, const DataParameter& parameter)
+{
+	if (data == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	dataParameters_[data.Get()] = DataEntry{data, parameter};
+}
+
+void SoundVoiceManager::SetDefaultDataParameter(const DataParameter& parameter)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	defaultDataParameter_ = parameter;
+}
+
+void SoundVoiceManager::SetListener(const Vector3D& position)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	listenerPosition_ = position;
+}
+
+void SoundVoiceManager::SetAudibleVolume(float volume)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	audibleVolume_ = volume;
+}
+
+void SoundVoiceManager::SetVirtualVoiceLifetime(float frames)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	virtualVoiceLifetime_ = frames;
+}
+
+int32_t SoundVoiceManager::GetVoiceCount()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return static_cast<int32_t>(voices_.size());
+}
+
+int32_t SoundVoiceManager::GetVirtualVoiceCount()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+	return static_cast<int32_t>(std::count_if(voices_.begin(), voices_.end(), [](const Voice& v) { return v.IsVirtual; }));
+}
+
+void SoundVoiceManager::Play(SoundTag tag, const SoundPlayer::InstanceParameter& parameter)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (player_ == nullptr)
+	{
+		return;
+	}
+
+	// voices are not tracked if nothing is limited
+	if (!IsLimited())
+	{
+		player_->Play(tag, parameter);
+		return;
+	}
+
+	// a voice starts as a virtual voice and is played in Update if it can be played
+	Voice voice;
+	voice.Tag = tag;
+	voice.Parameter = parameter;
+	voice.Handle = nullptr;
+	voice.Priority = GetDataParameter(parameter.Data.Get()).Priority;
+	voice.Audibility = 0.0f;
+	voice.VirtualFrame = 0.0f;
+	voice.Sequence = sequence_++;
+	voice.IsStarted = false;
+	voice.IsVirtual = true;
+	voices_.emplace_back(voice);
+}
+
+void SoundVoiceManager::Update(float deltaFrame)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (voices_.size() == 0 || player_ == nullptr)
+	{
+		return;
+	}
+
+	// remove finished voices and expired virtual voices
+	size_t alive = 0;
+	for (size_t i = 0; i < voices_.size(); i++)
+	{
+		auto& voice = voices_[i];
+
+		// virtual voices are aged after they are evaluated, so new voices are always evaluated once
+		if (voice.IsVirtual)
+		{
+			if (voice.VirtualFrame > virtualVoiceLifetime_)
+			{
+				if (voice.IsStarted)
+				{
+					player_->Stop(voice.Handle, voice.Tag);
+				}
+				continue;
+			}
+		}
+		else if (!player_->CheckPlaying(voice.Handle, voice.Tag))
+		{
+			continue;
+		}
+
+		voice.Audibility = CalculateAudibility(voice.Parameter);
+
+		if (alive != i)
+		{
+			voices_[alive] = voice;
+		}
+		alive++;
+	}
+	voices_.resize(alive);
+
+	// voices which have a higher priority take slots and lower voices are stolen
+	sortedVoices_.resize(voices_.size());
+	for (size_t i = 0; i < voices_.size(); i++)
+	{
+		sortedVoices_[i] = static_cast<int32_t>(i);
+	}
+
+	std::sort(sortedVoices_.begin(), sortedVoices_.end(), [this](int32_t lhs, int32_t rhs) {
+		const auto& l = voices_[lhs];
+		const auto& r = voices_[rhs];
+		if (l.Priority != r.Priority)
+		{
+			return l.Priority > r.Priority;
+		}
+		if (l.Audibility != r.Audibility)
+		{
+			return l.Audibility > r.Audibility;
+		}
+		return l.Sequence < r.Sequence;
+	});
+
+	dataVoiceCounts_.clear();
+	int32_t voiceCount = 0;
+
+	for (auto index : sortedVoices_)
+	{
+		auto& voice = voices_[index];
+		auto& dataVoiceCount = dataVoiceCounts_[voice.Parameter.Data.Get()];
+		const auto& dataParameter = GetDataParameter(voice.Parameter.Data.Get());
+
+		const bool canPlay = voice.Audibility >= audibleVolume_ && (maxVoiceCount_ <= 0 || voiceCount < maxVoiceCount_) &&
+							 (dataParameter.MaxVoiceCount <= 0 || dataVoiceCount < dataParameter.MaxVoiceCount);
+
+		if (canPlay)
+		{
+			voiceCount++;
+			dataVoiceCount++;
+
+			if (voice.IsVirtual)
+			{
+				if (voice.IsStarted)
+				{
+					player_->Pause(voice.Handle, voice.Tag, false);
+				}
+				else
+				{
+					voice.Handle = player_->Play(voice.Tag, voice.Parameter);
+					voice.IsStarted = true;
+				}
+				voice.IsVirtual = false;
+			}
+		}
+		else if (!voice.IsVirtual)
+		{
+			player_->Pause(voice.Handle, voice.Tag, true);
+			voice.IsVirtual = true;
+			voice.VirtualFrame = 0.0f;
+		}
+		else
+		{
+			voice.VirtualFrame += deltaFrame;
+		}
+	}
+}
+
+void SoundVoiceManager::StopTag(SoundTag tag)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (player_ != nullptr)
+	{
+		player_->StopTag(tag);
+	}
+
+	voices_.erase(std::remove_if(voices_.begin(), voices_.end(), [tag](const Voice& v) { return v.Tag == tag; }), voices_.end());
+}
+
+bool SoundVoiceManager::CheckPlayingTag(SoundTag tag)
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (player_ == nullptr)
+	{
+		return false;
+	}
+
+	// virtual voices are treated as playing until they expire
+	for (const auto& voice : voices_)
+	{
+		if (voice.Tag == tag && voice.IsVirtual)
+		{
+			return true;
+		}
+	}
+
+	return player_->CheckPlayingTag(tag);
+}
+
+void SoundVoiceManager::StopAll()
+{
+	std::lock_guard<std::mutex> lock(mutex_);
+
+	if (player_ != nullptr)
+	{
+		player_->StopAll();
+	}
+
+	voices_.clear();
+}
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
@@ -0,0 +1,188 @@
+﻿
+#ifndef __EFFEKSEER_SOUND_VOICE_MANAGER_H__
+#define __EFFEKSEER_SOUND_VOICE_MANAGER_H__
+
+//----------------------------------------------------------------------------------
+// Include
+//----------------------------------------------------------------------------------
+#include "../Effekseer.Base.h"
+#include "../Effekseer.Vector3D.h"
+#include "Effekseer.SoundPlayer.h"
+#include <mutex>
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+namespace Effekseer
+{
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+
+/**
+	@brief
+	\~English	A class which limits voices played by a sound player
+	\~Japanese	サウンド再生機能で再生されるボイスを制限するクラス
+	@note
+	\~English	Voices which exceed limits or are too quiet become virtual. Virtual voices are not mixed and resume when they can be played again.
+	Nothing is limited by default. Limits are applied to sounds which are played after they are specified.
+	\~Japanese	制限を超えるか音量が小さすぎるボイスは仮想ボイスになる。仮想ボイスはミックスされず、再び再生できるようになると再開される。
+	デフォルトでは何も制限されない。制限は指定された後に再生されるサウンドに適用される。
+*/
+class SoundVoiceManager : public ReferenceObject
+{
+public:
+	/**
+		@brief
+		\~English	A parameter which is specified for each sound data
+		\~Japanese	サウンドデータごとに指定されるパラメーター
+	*/
+	struct DataParameter
+	{
+		//! the maximum number of voices which play the data at the same time. 0 means unlimited.
+		int32_t MaxVoiceCount = 0;
+
+		//! voices which have a higher priority are played first
+		int32_t Priority = 0;
+	};
+
+private:
+	struct Voice
+	{
+		SoundTag Tag;
+		SoundPlayer::InstanceParameter Parameter;
+		SoundHandle Handle;
+		int32_t Priority;
+		float Audibility;
+		float VirtualFrame;
+		uint64_t Sequence;
+		bool IsStarted;
+		bool IsVirtual;
+	};
+
+	struct DataEntry
+	{
+		SoundDataRef Data;
+		DataParameter Parameter;
+	};
+
+	SoundPlayerRef player_;
+	CustomVector<Voice> voices_;
+	CustomVector<int32_t> sortedVoices_;
+	CustomUnorderedMap<const SoundData*, DataEntry> dataParameters_;
+	CustomUnorderedMap<const SoundData*, int32_t> dataVoiceCounts_;
+	DataParameter defaultDataParameter_;
+	Vector3D listenerPosition_;
+	int32_t maxVoiceCount_ = 0;
+	float audibleVolume_ = 0.0f;
+	float virtualVoiceLifetime_ = 60.0f;
+	uint64_t sequence_ = 0;
+	std::mutex mutex_;
+
+	bool IsLimited() const;
+
+	const DataParameter& GetDataParameter(const SoundData* data) const;
+
+	float CalculateAudibility(const SoundPlayer::InstanceParameter& parameter) const;
+
+public:
+	SoundVoiceManager() = default;
+	virtual ~SoundVoiceManager() = default;
+
+	/**
+		@brief
+		\~English	Specify a sound player which plays voices actually
+		\~Japanese	実際にボイスを再生するサウンド再生機能を指定する。
+	*/
+	void SetSoundPlayer(SoundPlayerRef player);
+
+	/**
+		@brief
+		\~English	Specify the maximum number of voices which are played at the same time. 0 means unlimited.
+		\~Japanese	同時に再生されるボイスの最大数を指定する。0は無制限を意味する。
+	*/
+	void SetMaxVoiceCount(int32_t count);
+
+	int32_t GetMaxVoiceCount() const
+	{
+		return maxVoiceCount_;
+	}
+
+	/**
+		@brief
+		\~English	Specify a parameter for a sound data
+		\~Japanese	サウンドデータのパラメーターを指定する。
+	*/
+	void SetDataParameter(const SoundDataRef& data, const DataParameter& parameter);
+
+	/**
+		@brief
+		\~English	Specify a parameter for sound data whose parameter is not specified
+		\~Japanese	パラメーターが指定されていないサウンドデータのパラメーターを指定する。
+	*/
+	void SetDefaultDataParameter(const DataParameter& parameter);
+
+	/**
+		@brief
+		\~English	Specify the position of a listener to calculate volumes of 3D sounds. It should be same as a position which is specified to a sound player.
+		\~Japanese	3Dサウンドの音量を計算するためのリスナーの位置を指定する。サウンド再生機能に指定された位置と同じであるべきである。
+	*/
+	void SetListener(const Vector3D& position);
+
+	/**
+		@brief
+		\~English	Specify the minimum volume which is audible. Quieter voices including distant 3D sounds become virtual.
+		\~Japanese	聞こえる最小の音量を指定する。離れた3Dサウンドを含む、より小さいボイスは仮想ボイスになる。
+	*/
+	void SetAudibleVolume(float volume);
+
+	/**
+		@brief
+		\~English	Specify frames while virtual voices are kept. Virtual voices are stopped after it.
+		\~Japanese	仮想ボイスが保持されるフレーム数を指定する。その後、仮想ボイスは停止される。
+	*/
+	void SetVirtualVoiceLifetime(float frames);
+
+	/**
+		@brief
+		\~English	Get the number of voices which are tracked. It includes virtual voices.
+		\~Japanese	追跡されているボイスの数を取得する。仮想ボイスを含む。
+	*/
+	int32_t GetVoiceCount();
+
+	/**
+		@brief
+		\~English	Get the number of virtual voices
+		\~Japanese	仮想ボイスの数を取得する。
+	*/
+	int32_t GetVirtualVoiceCount();
+
+	/**
+		@brief
+		\~English	Request to play a sound. It is called by a manager.
+		\~Japanese	サウンドの再生を要求する。マネージャーから呼ばれる。
+	*/
+	void Play(SoundTag tag, const SoundPlayer::InstanceParameter& parameter);
+
+	/**
+		@brief
+		\~English	Update voices. It is called by a manager.
+		\~Japanese	ボイスを更新する。マネージャーから呼ばれる。
+	*/
+	void Update(float deltaFrame);
+
+	void StopTag(SoundTag tag);
+
+	bool CheckPlayingTag(SoundTag tag);
+
+	void StopAll();
+};
+
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+} // namespace Effekseer
+//----------------------------------------------------------------------------------
+//
+//----------------------------------------------------------------------------------
+#endif // __EFFEKSEER_SOUND_VOICE_MANAGER_H__
@@ -22,6 +22,11 @@ const int32_t Version16 = 1610;
 const int32_t CompiledMaterialVersion15 = 1;
 const int32_t CompiledMaterialVersion16 = 1610;
 
+//! a version of codes generated from materials. it must be incremented when TextExporter or material compilers change generated codes
+//! 2 : material nodes are optimized before exporting codes
+//! 3 : nodes whose values differ in less significant digits are not merged
+const int32_t CompiledMaterialGeneratorVersion = 3;
+
 const int32_t MaterialVersion15 = 3;
 const int32_t MaterialVersion16 = 1610;
 
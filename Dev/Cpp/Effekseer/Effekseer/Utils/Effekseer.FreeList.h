@@ -0,0 +1,331 @@
+#ifndef __EFFEKSEER_FREE_LIST_H__
+#define __EFFEKSEER_FREE_LIST_H__
+
+#include "../Effekseer.Base.Pre.h"
+#include "Effekseer.CustomAllocator.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace Effekseer
+{
+
+/**
+	@brief	a lock-free list of unused elements in segments of memory
+	@note
+	Elements can be popped and pushed from multiple threads.
+	The head has a tag which is increased with each change to avoid the ABA problem.
+	When all elements are used, a segment is added on demand up to the limit. Addresses of elements are not changed.
+	Elements are not constructed. initializer and finalizer are called for each segment when it is added and removed.
+*/
+template <typename T>
+class FreeList
+{
+public:
+	static const int32_t SegmentsMax = 64;
+
+	using SegmentFunc = void (*)(T* elements, int32_t count);
+
+private:
+	static const uint32_t InvalidIndex = 0xffffffff;
+
+	struct Segment
+	{
+		T* Elements = nullptr;
+		std::atomic<uint32_t>* Nexts = nullptr;
+	};
+
+	std::array<Segment, SegmentsMax> segments_;
+	std::atomic<int32_t> segmentCount_;
+	int32_t segmentSize_ = 0;
+	int32_t segmentCountMax_ = 0;
+	SegmentFunc initializer_ = nullptr;
+	SegmentFunc finalizer_ = nullptr;
+	std::mutex growingMutex_;
+
+	//! a tag in upper bits and an index of the first unused element in lower bits
+	std::atomic<uint64_t> head_;
+
+	std::atomic<int32_t> count_;
+
+	static uint64_t MakeHead(uint64_t previousHead, uint32_t index)
+	{
+		return (((previousHead >> 32) + 1) << 32) | index;
+	}
+
+	std::atomic<uint32_t>& GetNext(uint32_t index)
+	{
+		return segments_[index / segmentSize_].Nexts[index % segmentSize_];
+	}
+
+	T* GetElement(uint32_t index)
+	{
+		return segments_[index / segmentSize_].Elements + index % segmentSize_;
+	}
+
+	//! push elements linked from first to last with one change of the head
+	void PushRange(uint32_t first, uint32_t last, int32_t count)
+	{
+		uint64_t head = head_.load(std::memory_order_relaxed);
+
+		do
+		{
+			GetNext(last).store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+		} while (!head_.compare_exchange_weak(head, MakeHead(head, first), std::memory_order_release, std::memory_order_relaxed));
+
+		count_.fetch_add(count, std::memory_order_relaxed);
+	}
+
+	bool Grow()
+	{
+		std::lock_guard<std::mutex> lock(growingMutex_);
+
+		// other thread may have already grown it
+		if (count_.load(std::memory_order_acquire) > 0)
+		{
+			return true;
+		}
+
+		const auto segmentIndex = segmentCount_.load(std::memory_order_relaxed);
+		if (segmentIndex >= segmentCountMax_)
+		{
+			return false;
+		}
+
+		auto& segment = segments_[segmentIndex];
+		segment.Elements = reinterpret_cast<T*>(GetAlignedMallocFunc()(static_cast<uint32_t>(sizeof(T) * segmentSize_), std::max(static_cast<uint32_t>(alignof(T)), 16u)));
+		segment.Nexts = reinterpret_cast<std::atomic<uint32_t>*>(GetMallocFunc()(static_cast<uint32_t>(sizeof(std::atomic<uint32_t>) * segmentSize_)));
+
+		if (segment.Elements == nullptr || segment.Nexts == nullptr)
+		{
+			FreeSegment(segment);
+			return false;
+		}
+
+		if (initializer_ != nullptr)
+		{
+			initializer_(segment.Elements, segmentSize_);
+		}
+
+		const auto offset = static_cast<uint32_t>(segmentIndex * segmentSize_);
+		for (int32_t i = 0; i < segmentSize_; i++)
+		{
+			new (&segment.Nexts[i]) std::atomic<uint32_t>(offset + i + 1);
+		}
+
+		segmentCount_.store(segmentIndex + 1, std::memory_order_release);
+
+		PushRange(offset, offset + segmentSize_ - 1, segmentSize_);
+		return true;
+	}
+
+	void FreeSegment(Segment& segment)
+	{
+		if (segment.Elements != nullptr)
+		{
+			GetAlignedFreeFunc()(segment.Elements, static_cast<uint32_t>(sizeof(T) * segmentSize_));
+		}
+
+		if (segment.Nexts != nullptr)
+		{
+			GetFreeFunc()(segment.Nexts, static_cast<uint32_t>(sizeof(std::atomic<uint32_t>) * segmentSize_));
+		}
+
+		segment = Segment();
+	}
+
+public:
+	FreeList()
+		: segmentCount_(0)
+		, head_(InvalidIndex)
+		, count_(0)
+	{
+	}
+
+	FreeList(const FreeList&) = delete;
+
+	FreeList& operator=(const FreeList&) = delete;
+
+	~FreeList()
+	{
+		Reset(0, 0, 0, initializer_, finalizer_);
+	}
+
+	/**
+		@brief	release all segments and allocate initial segments
+		@param	segmentSize	the number of elements in a segment
+		@param	initialSegmentCount	the number of segments which are allocated now
+		@param	segmentCountMax	the maximum number of segments. it is clamped with SegmentsMax
+		@note
+		It must not be called while other threads access the list.
+	*/
+	void Reset(int32_t segmentSize, int32_t initialSegmentCount, int32_t segmentCountMax, SegmentFunc initializer = nullptr, SegmentFunc finalizer = nullptr)
+	{
+		for (int32_t i = 0; i < segmentCount_.load(std::memory_order_relaxed); i++)
+		{
+			if (finalizer_ != nullptr)
+			{
+				finalizer_(segments_[i].Elements, segmentSize_);
+			}
+			FreeSegment(segments_[i]);
+		}
+
+		segmentCount_.store(0, std::memory_order_relaxed);
+		head_.store(InvalidIndex, std::memory_order_relaxed);
+		count_.store(0, std::memory_order_relaxed);
+
+		segmentSize_ = segmentSize;
+		segmentCountMax_ = std::min(segmentCountMax, static_cast<int32_t>(SegmentsMax));
+		initializer_ = initializer;
+		finalizer_ = finalizer;
+
+		for (int32_t i = 0; i < std::min(initialSegmentCount, segmentCountMax_); i++)
+		{
+			Grow();
+		}
+	}
+
+	//! get an unused element. a segment is added if required. nullptr is returned if elements reach the limit
+	T* Pop()
+	{
+		uint64_t head = head_.load(std::memory_order_acquire);
+
+		while (true)
+		{
+			const auto index = static_cast<uint32_t>(head);
+			if (index == InvalidIndex)
+			{
+				if (!Grow())
+				{
+					return nullptr;
+				}
+
+				head = head_.load(std::memory_order_acquire);
+				continue;
+			}
+
+			const auto next = GetNext(index).load(std::memory_order_relaxed);
+			if (head_.compare_exchange_weak(head, MakeHead(head, next), std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				count_.fetch_sub(1, std::memory_order_relaxed);
+				return GetElement(index);
+			}
+		}
+	}
+
+	//! return an element which is got with Pop
+	void Push(T* element)
+	{
+		const auto segmentCount = segmentCount_.load(std::memory_order_acquire);
+
+		for (int32_t i = 0; i < segmentCount; i++)
+		{
+			const auto& segment = segments_[i];
+			if (segment.Elements <= element && element < segment.Elements + segmentSize_)
+			{
+				const auto index = static_cast<uint32_t>(i * segmentSize_ + (element - segment.Elements));
+				PushRange(index, index, 1);
+				return;
+			}
+		}
+
+		assert(false);
+	}
+
+	/**
+		@brief	remove the last segment if all elements in it are unused
+		@note
+		It must not be called while other threads access the list.
+	*/
+	bool ShrinkLastSegment()
+	{
+		const auto segmentCount = segmentCount_.load(std::memory_order_relaxed);
+		if (segmentCount <= 1)
+		{
+			return false;
+		}
+
+		const auto first = static_cast<uint32_t>((segmentCount - 1) * segmentSize_);
+		auto isRemoved = [first](uint32_t index) { return index >= first; };
+
+		int32_t unusedCount = 0;
+		for (auto index = static_cast<uint32_t>(head_.load(std::memory_order_relaxed)); index != InvalidIndex; index = GetNext(index).load(std::memory_order_relaxed))
+		{
+			if (isRemoved(index))
+			{
+				unusedCount++;
+			}
+		}
+
+		if (unusedCount < segmentSize_)
+		{
+			return false;
+		}
+
+		// relink elements in other segments
+		auto newHead = InvalidIndex;
+		auto last = InvalidIndex;
+		for (auto index = static_cast<uint32_t>(head_.load(std::memory_order_relaxed)); index != InvalidIndex; index = GetNext(index).load(std::memory_order_relaxed))
+		{
+			if (isRemoved(index))
+			{
+				continue;
+			}
+
+			if (last == InvalidIndex)
+			{
+				newHead = index;
+			}
+			else
+			{
+				GetNext(last).store(index, std::memory_order_relaxed);
+			}
+			last = index;
+		}
+
+		if (last != InvalidIndex)
+		{
+			GetNext(last).store(InvalidIndex, std::memory_order_relaxed);
+		}
+
+		head_.store(MakeHead(head_.load(std::memory_order_relaxed), newHead), std::memory_order_relaxed);
+		count_.fetch_sub(segmentSize_, std::memory_order_relaxed);
+
+		auto& segment = segments_[segmentCount - 1];
+		if (finalizer_ != nullptr)
+		{
+			finalizer_(segment.Elements, segmentSize_);
+		}
+		FreeSegment(segment);
+		segmentCount_.store(segmentCount - 1, std::memory_order_release);
+		return true;
+	}
+
+	//! get the number of unused elements in allocated segments. it may be changed by other threads soon
+	int32_t GetCount() const
+	{
+		return count_.load(std::memory_order_relaxed);
+	}
+
+	//! get the number of elements which can be allocated in addition to unused elements
+	int32_t GetGrowableCount() const
+	{
+		return (segmentCountMax_ - segmentCount_.load(std::memory_order_relaxed)) * segmentSize_;
+	}
+
+	//! get the number of elements in allocated segments
+	int32_t GetCapacity() const
+	{
+		return segmentCount_.load(std::memory_order_relaxed) * segmentSize_;
+	}
+
+	int32_t GetSegmentSize() const
+	{
+		return segmentSize_;
+	}
+};
+
+} // namespace Effekseer
+
+#endif // __EFFEKSEER_FREE_LIST_H__
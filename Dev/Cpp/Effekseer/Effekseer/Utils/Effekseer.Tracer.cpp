@@ -0,0 +1,241 @@
+#include "Effekseer.Tracer.h"
+#include "../Effekseer.Base.Pre.h"
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+namespace Effekseer
+{
+
+namespace
+{
+
+struct TraceEvent
+{
+	const char* Name;
+	int64_t BeginTime;
+	int64_t EndTime;
+};
+
+//! events of a thread. only the owner thread writes events
+struct TraceThreadBuffer
+{
+	int32_t ThreadID = 0;
+	std::atomic<const char*> ThreadName{nullptr};
+	std::atomic<int32_t> Generation{0};
+	std::atomic<int32_t> EventCount{0};
+	std::atomic<int32_t> DroppedCount{0};
+	std::vector<TraceEvent> Events;
+};
+
+//! the tracer is shared by all managers in a process and outlives them, so it does not use custom allocators
+struct TracerState
+{
+	std::mutex Mtx;
+	std::vector<std::unique_ptr<TraceThreadBuffer>> Buffers;
+	std::atomic<int32_t> Generation{0};
+	std::atomic<int32_t> MaxEventCount{0};
+	std::atomic<int64_t> StartTime{0};
+};
+
+TracerState& GetTracerState()
+{
+	static TracerState state;
+	return state;
+}
+
+thread_local TraceThreadBuffer* t_buffer = nullptr;
+
+TraceThreadBuffer* GetThreadBuffer()
+{
+	if (t_buffer == nullptr)
+	{
+		auto& state = GetTracerState();
+		std::lock_guard<std::mutex> lock(state.Mtx);
+		auto buffer = std::unique_ptr<TraceThreadBuffer>(new TraceThreadBuffer());
+		buffer->ThreadID = static_cast<int32_t>(state.Buffers.size()) + 1;
+		t_buffer = buffer.get();
+		state.Buffers.emplace_back(std::move(buffer));
+	}
+
+	return t_buffer;
+}
+
+void AppendEscaped(std::string& dst, const char* str)
+{
+	for (; *str != 0; str++)
+	{
+		if (*str == '"' || *str == '\\')
+		{
+			dst += '\\';
+			dst += *str;
+		}
+		else if (static_cast<unsigned char>(*str) < 0x20)
+		{
+			dst += ' ';
+		}
+		else
+		{
+			dst += *str;
+		}
+	}
+}
+
+void AppendMicroseconds(std::string& dst, int64_t time)
+{
+	char text[32];
+	snprintf(text, sizeof(text), "%lld.%03d", static_cast<long long>(time / 1000), static_cast<int>(time % 1000));
+	dst += text;
+}
+
+} // namespace
+
+std::atomic<bool> Tracer::isEnabled_{false};
+
+int64_t Tracer::GetTime()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracer::Record(const char* name, int64_t beginTime, int64_t endTime)
+{
+	auto& state = GetTracerState();
+	auto buffer = GetThreadBuffer();
+
+	// events recorded before tracing is restarted are discarded
+	const auto generation = state.Generation.load(std::memory_order_acquire);
+	if (buffer->Generation.load(std::memory_order_relaxed) != generation)
+	{
+		buffer->EventCount.store(0, std::memory_order_relaxed);
+		buffer->DroppedCount.store(0, std::memory_order_relaxed);
+		buffer->Events.resize(state.MaxEventCount.load(std::memory_order_relaxed));
+		buffer->Generation.store(generation, std::memory_order_release);
+	}
+
+	const auto count = buffer->EventCount.load(std::memory_order_relaxed);
+	if (count >= static_cast<int32_t>(buffer->Events.size()))
+	{
+		buffer->DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	buffer->Events[count] = TraceEvent{name, beginTime, endTime};
+	buffer->EventCount.store(count + 1, std::memory_order_release);
+}
+
+void Tracer::SetThreadName(const char* name)
+{
+	GetThreadBuffer()->ThreadName.store(name, std::memory_order_release);
+}
+
+void SetTracingEnabled(bool enabled, int32_t maxEventCountPerThread)
+{
+	auto& state = GetTracerState();
+
+	if (enabled)
+	{
+		if (Tracer::isEnabled_.load())
+		{
+			return;
+		}
+
+		state.MaxEventCount.store(std::max(maxEventCountPerThread, 0), std::memory_order_relaxed);
+		state.StartTime.store(Tracer::GetTime(), std::memory_order_relaxed);
+		state.Generation.fetch_add(1, std::memory_order_release);
+	}
+
+	Tracer::isEnabled_.store(enabled);
+}
+
+bool GetTracingEnabled()
+{
+	return Tracer::IsEnabled();
+}
+
+std::string ExportChromeTrace()
+{
+	auto& state = GetTracerState();
+	std::lock_guard<std::mutex> lock(state.Mtx);
+
+	const auto generation = state.Generation.load(std::memory_order_acquire);
+	const auto startTime = state.StartTime.load(std::memory_order_relaxed);
+	int32_t droppedCount = 0;
+	bool isFirst = true;
+
+	std::string json = "{\"traceEvents\":[";
+
+	auto beginEvent = [&]() {
+		json += isFirst ? "\n" : ",\n";
+		isFirst = false;
+	};
+
+	for (const auto& buffer : state.Buffers)
+	{
+		const auto tid = std::to_string(buffer->ThreadID);
+
+		beginEvent();
+		json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + tid + ",\"args\":{\"name\":\"";
+		if (auto name = buffer->ThreadName.load(std::memory_order_acquire))
+		{
+			AppendEscaped(json, name);
+		}
+		else
+		{
+			json += "Thread " + tid;
+		}
+		json += "\"}}";
+
+		if (buffer->Generation.load(std::memory_order_acquire) != generation)
+		{
+			continue;
+		}
+
+		const auto count = buffer->EventCount.load(std::memory_order_acquire);
+		droppedCount += buffer->DroppedCount.load(std::memory_order_relaxed);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			const auto& e = buffer->Events[i];
+
+			// a block which began before tracing is started
+			if (e.BeginTime < startTime)
+			{
+				continue;
+			}
+
+			beginEvent();
+			json += "{\"name\":\"";
+			AppendEscaped(json, e.Name);
+			json += "\",\"ph\":\"X\",\"pid\":0,\"tid\":" + tid + ",\"ts\":";
+			AppendMicroseconds(json, e.BeginTime - startTime);
+			json += ",\"dur\":";
+			AppendMicroseconds(json, e.EndTime - e.BeginTime);
+			json += "}";
+		}
+	}
+
+	json += "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEventCount\":" + std::to_string(droppedCount) + "}}\n";
+
+	return json;
+}
+
+void ReleaseTracingBuffers()
+{
+	if (Tracer::IsEnabled())
+	{
+		return;
+	}
+
+	auto& state = GetTracerState();
+	std::lock_guard<std::mutex> lock(state.Mtx);
+
+	// buffers themselves are kept because threads refer them. events are allocated again when tracing is enabled
+	for (auto& buffer : state.Buffers)
+	{
+		std::vector<TraceEvent>().swap(buffer->Events);
+		buffer->EventCount.store(0, std::memory_order_relaxed);
+		buffer->DroppedCount.store(0, std::memory_order_relaxed);
+	}
+}
+
+} // namespace Effekseer
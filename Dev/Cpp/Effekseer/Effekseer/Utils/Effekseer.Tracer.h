@@ -0,0 +1,72 @@
+#ifndef __EFFEKSEER_TRACER_H__
+#define __EFFEKSEER_TRACER_H__
+
+#include <atomic>
+#include <stdint.h>
+
+namespace Effekseer
+{
+
+/**
+	@brief	a built-in tracer which records blocks into buffers per thread
+	@note
+	each thread writes only into its own buffer, so recording does not take locks.
+	a lock is taken only when a thread records first.
+*/
+class Tracer
+{
+public:
+	static bool IsEnabled()
+	{
+		return isEnabled_.load(std::memory_order_relaxed);
+	}
+
+	//! get a time in nanoseconds
+	static int64_t GetTime();
+
+	//! record a block which is finished on the current thread
+	static void Record(const char* name, int64_t beginTime, int64_t endTime);
+
+	//! set a name of the current thread which is shown in traces
+	static void SetThreadName(const char* name);
+
+private:
+	friend void SetTracingEnabled(bool enabled, int32_t maxEventCountPerThread);
+
+	static std::atomic<bool> isEnabled_;
+};
+
+/**
+	@brief	a block which is recorded when it is destroyed
+*/
+class TraceBlock
+{
+	const char* name_ = nullptr;
+	int64_t beginTime_ = 0;
+
+public:
+	TraceBlock(const char* name)
+	{
+		if (Tracer::IsEnabled())
+		{
+			name_ = name;
+			beginTime_ = Tracer::GetTime();
+		}
+	}
+
+	~TraceBlock()
+	{
+		if (name_ != nullptr)
+		{
+			Tracer::Record(name_, beginTime_, Tracer::GetTime());
+		}
+	}
+
+	TraceBlock(const TraceBlock&) = delete;
+
+	TraceBlock& operator=(const TraceBlock&) = delete;
+};
+
+} // namespace Effekseer
+
+#endif
@@ -9,6 +9,17 @@
 #define PROFILER_BLOCK(name, ...) EASY_BLOCK(name, __VA_ARGS__)
 #define PROFILER_THREAD(name) EASY_THREAD(name)
 
+#elif !defined(__EFFEKSEER_TRACER_DISABLED__)
+
+#include "Effekseer.Tracer.h"
+
+#define EFK_PROFILER_CONCAT_INTERNAL(a, b) a##b
+#define EFK_PROFILER_CONCAT(a, b) EFK_PROFILER_CONCAT_INTERNAL(a, b)
+
+// colors are ignored by the built-in tracer
+#define PROFILER_BLOCK(name, ...) ::Effekseer::TraceBlock EFK_PROFILER_CONCAT(profilerBlock, __LINE__)(name)
+#define PROFILER_THREAD(name) ::Effekseer::Tracer::SetThreadName(name)
+
 #else
 
 #define PROFILER_BLOCK(name, ...)
@@ -16,4 +27,4 @@
 
 #endif
 
-#endif
\ No newline at end of file
+#endif
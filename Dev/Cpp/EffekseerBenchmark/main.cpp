@@ -0,0 +1,531 @@
+#include <Effekseer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+struct Option
+{
+	std::vector<fs::path> Inputs;
+	fs::path Output;
+	int32_t Frames = 300;
+	int32_t WarmupFrames = 60;
+	int32_t LoadCount = 5;
+	int32_t MaxWorkerThreads = 4;
+	int32_t Emitters = 9;
+	int32_t MaxInstances = 20000;
+};
+
+struct RunResult
+{
+	int32_t WorkerThreads = 0;
+	double MeanInstanceCount = 0.0;
+	double UpdateTime = 0.0;
+	double DrawTime = 0.0;
+	double InstancesPerSecond = 0.0;
+	int64_t PeakAllocatedBytes = 0;
+};
+
+struct EffectResult
+{
+	std::string Path;
+	bool IsLoaded = false;
+	double MinLoadTime = 0.0;
+	double MeanLoadTime = 0.0;
+	int64_t LoadPeakAllocatedBytes = 0;
+	std::vector<RunResult> Runs;
+};
+
+void PrintUsage()
+{
+	std::cerr << "Usage : EffekseerBenchmark <effect file|directory>... [--output file] [--frames n] [--warmup n] [--loads n] [--threads n] [--emitters n] [--max-instances n]" << std::endl;
+	std::cerr << "Measure loading, updating with 0 to n worker threads and drawing with null renderers without a window or GPU." << std::endl;
+	std::cerr << "Directories are searched for .efkefc and .efk recursively (e.g. TestData/Effects). Results are written as JSON." << std::endl;
+}
+
+bool ParseOption(int argc, char* argv[], Option& option)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (arg == "--output" && hasValue)
+		{
+			option.Output = argv[++i];
+		}
+		else if (arg == "--frames" && hasValue)
+		{
+			option.Frames = std::max(std::stoi(argv[++i]), 1);
+		}
+		else if (arg == "--warmup" && hasValue)
+		{
+			option.WarmupFrames = std::max(std::stoi(argv[++i]), 0);
+		}
+		else if (arg == "--loads" && hasValue)
+		{
+			option.LoadCount = std::max(std::stoi(argv[++i]), 1);
+		}
+		else if (arg == "--threads" && hasValue)
+		{
+			option.MaxWorkerThreads = std::max(std::stoi(argv[++i]), 0);
+		}
+		else if (arg == "--emitters" && hasValue)
+		{
+			option.Emitters = std::max(std::stoi(argv[++i]), 1);
+		}
+		else if (arg == "--max-instances" && hasValue)
+		{
+			option.MaxInstances = std::max(std::stoi(argv[++i]), 1);
+		}
+		else if (arg.size() > 0 && arg[0] == '-')
+		{
+			return false;
+		}
+		else
+		{
+			option.Inputs.emplace_back(arg);
+		}
+	}
+
+	return option.Inputs.size() > 0;
+}
+
+std::vector<fs::path> CollectEffects(const std::vector<fs::path>& inputs)
+{
+	std::vector<fs::path> paths;
+
+	auto isEffect = [](const fs::path& path) {
+		const auto ext = path.extension();
+		return ext == ".efkefc" || ext == ".efk";
+	};
+
+	for (const auto& input : inputs)
+	{
+		if (fs::is_directory(input))
+		{
+			for (const auto& entry : fs::recursive_directory_iterator(input))
+			{
+				if (entry.is_regular_file() && isEffect(entry.path()))
+				{
+					paths.emplace_back(entry.path());
+				}
+			}
+		}
+		else if (fs::is_regular_file(input))
+		{
+			paths.emplace_back(input);
+		}
+		else
+		{
+			std::cerr << "Not found : " << input.generic_string() << std::endl;
+		}
+	}
+
+	std::sort(paths.begin(), paths.end());
+	paths.erase(std::unique(paths.begin(), paths.end()), paths.end());
+	return paths;
+}
+
+// memory allocated by the runtime is tracked through custom allocators
+
+std::atomic<int64_t> g_allocatedBytes{0};
+std::atomic<int64_t> g_peakAllocatedBytes{0};
+Effekseer::MallocFunc g_mallocFunc = nullptr;
+Effekseer::FreeFunc g_freeFunc = nullptr;
+Effekseer::AlignedMallocFunc g_alignedMallocFunc = nullptr;
+Effekseer::AlignedFreeFunc g_alignedFreeFunc = nullptr;
+
+void AddAllocatedBytes(int64_t size)
+{
+	const auto current = g_allocatedBytes.fetch_add(size) + size;
+	auto peak = g_peakAllocatedBytes.load();
+	while (current > peak && !g_peakAllocatedBytes.compare_exchange_weak(peak, current))
+	{
+	}
+}
+
+void* EFK_STDCALL TrackedMalloc(unsigned int size)
+{
+	AddAllocatedBytes(size);
+	return g_mallocFunc(size);
+}
+
+void EFK_STDCALL TrackedFree(void* p, unsigned int size)
+{
+	if (p != nullptr)
+	{
+		g_allocatedBytes.fetch_sub(size);
+	}
+	g_freeFunc(p, size);
+}
+
+void* EFK_STDCALL TrackedAlignedMalloc(unsigned int size, unsigned int alignment)
+{
+	AddAllocatedBytes(size);
+	return g_alignedMallocFunc(size, alignment);
+}
+
+void EFK_STDCALL TrackedAlignedFree(void* p, unsigned int size)
+{
+	if (p != nullptr)
+	{
+		g_allocatedBytes.fetch_sub(size);
+	}
+	g_alignedFreeFunc(p, size);
+}
+
+void EnableAllocationTracking()
+{
+	g_mallocFunc = Effekseer::GetMallocFunc();
+	g_freeFunc = Effekseer::GetFreeFunc();
+	g_alignedMallocFunc = Effekseer::GetAlignedMallocFunc();
+	g_alignedFreeFunc = Effekseer::GetAlignedFreeFunc();
+	Effekseer::SetMallocFunc(TrackedMalloc);
+	Effekseer::SetFreeFunc(TrackedFree);
+	Effekseer::SetAlignedMallocFunc(TrackedAlignedMalloc);
+	Effekseer::SetAlignedFreeFunc(TrackedAlignedFree);
+}
+
+void ResetPeakAllocatedBytes()
+{
+	g_peakAllocatedBytes.store(g_allocatedBytes.load());
+}
+
+// renderers which receive parameters and do nothing to measure drawing without a GPU
+
+class NullSpriteRenderer : public Effekseer::SpriteRenderer
+{
+public:
+	void Rendering(const NodeParameter& parameter, const InstanceParameter& instanceParameter, void* userData) override
+	{
+	}
+};
+
+class NullRibbonRenderer : public Effekseer::RibbonRenderer
+{
+public:
+	void Rendering(const NodeParameter& parameter, const InstanceParameter& instanceParameter, void* userData) override
+	{
+	}
+};
+
+class NullRingRenderer : public Effekseer::RingRenderer
+{
+public:
+	void Rendering(const NodeParameter& parameter, const InstanceParameter& instanceParameter, void* userData) override
+	{
+	}
+};
+
+class NullModelRenderer : public Effekseer::ModelRenderer
+{
+public:
+	void Rendering(const NodeParameter& parameter, const InstanceParameter& instanceParameter, void* userData) override
+	{
+	}
+};
+
+class NullTrackRenderer : public Effekseer::TrackRenderer
+{
+public:
+	void Rendering(const NodeParameter& parameter, const InstanceParameter& instanceParameter, void* userData) override
+	{
+	}
+};
+
+// a model loader which reads files without a GPU. meshes are kept only in memory
+
+class FileModelLoader : public Effekseer::ModelLoader
+{
+	Effekseer::DefaultFileInterface fileInterface_;
+
+public:
+	Effekseer::ModelRef Load(const char16_t* path) override
+	{
+		std::unique_ptr<Effekseer::FileReader> reader(fileInterface_.OpenRead(path));
+		if (reader == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::vector<uint8_t> data(reader->GetLength());
+		reader->Read(data.data(), data.size());
+		return Load(data.data(), static_cast<int32_t>(data.size()));
+	}
+
+	Effekseer::ModelRef Load(const void* data, int32_t size) override
+	{
+		return Effekseer::MakeRefPtr<Effekseer::Model>(static_cast<const uint8_t*>(data), size);
+	}
+};
+
+Effekseer::ManagerRef CreateManager(const Option& option, int32_t workerThreads)
+{
+	auto manager = Effekseer::Manager::Create(option.MaxInstances);
+
+	// models and curves are loaded because they are used while updating
+	manager->SetModelLoader(Effekseer::MakeRefPtr<FileModelLoader>());
+	manager->SetCurveLoader(Effekseer::MakeRefPtr<Effekseer::CurveLoader>());
+
+	manager->SetSpriteRenderer(Effekseer::MakeRefPtr<NullSpriteRenderer>());
+	manager->SetRibbonRenderer(Effekseer::MakeRefPtr<NullRibbonRenderer>());
+	manager->SetRingRenderer(Effekseer::MakeRefPtr<NullRingRenderer>());
+	manager->SetModelRenderer(Effekseer::MakeRefPtr<NullModelRenderer>());
+	manager->SetTrackRenderer(Effekseer::MakeRefPtr<NullTrackRenderer>());
+
+	if (workerThreads > 0)
+	{
+		manager->LaunchWorkerThreads(workerThreads);
+	}
+
+	return manager;
+}
+
+double GetSeconds(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+{
+	return std::chrono::duration<double>(end - begin).count();
+}
+
+RunResult Run(const Option& option, const fs::path& path, int32_t workerThreads)
+{
+	RunResult result;
+	result.WorkerThreads = workerThreads;
+
+	ResetPeakAllocatedBytes();
+
+	auto manager = CreateManager(option, workerThreads);
+	auto effect = Effekseer::Effect::Create(manager, path.u16string().c_str());
+	if (effect == nullptr)
+	{
+		return result;
+	}
+
+	// emitters are placed on a grid like Test/Runtime/Performance.cpp
+	const auto side = static_cast<int32_t>(std::ceil(std::sqrt(static_cast<float>(option.Emitters))));
+	std::vector<Effekseer::Handle> handles(option.Emitters, -1);
+
+	auto playStoppedEmitters = [&]() {
+		for (int32_t i = 0; i < option.Emitters; i++)
+		{
+			if (handles[i] >= 0 && manager->Exists(handles[i]))
+			{
+				continue;
+			}
+
+			const float x = (i % side - (side - 1) * 0.5f) * 2.0f;
+			const float y = (i / side - (side - 1) * 0.5f) * 2.0f;
+			handles[i] = manager->Play(effect, x, y, 0.0f);
+			manager->SetRandomSeed(handles[i], i + 1);
+		}
+	};
+
+	for (int32_t i = 0; i < option.WarmupFrames; i++)
+	{
+		playStoppedEmitters();
+		manager->Update();
+		manager->Draw();
+	}
+
+	int64_t instanceCount = 0;
+	double updateTime = 0.0;
+	double drawTime = 0.0;
+
+	for (int32_t i = 0; i < option.Frames; i++)
+	{
+		playStoppedEmitters();
+
+		const auto beginTime = std::chrono::steady_clock::now();
+		manager->Update();
+		const auto updatedTime = std::chrono::steady_clock::now();
+		manager->Draw();
+		const auto drawnTime = std::chrono::steady_clock::now();
+
+		instanceCount += manager->GetTotalInstanceCount();
+		updateTime += GetSeconds(beginTime, updatedTime);
+		drawTime += GetSeconds(updatedTime, drawnTime);
+	}
+
+	result.MeanInstanceCount = static_cast<double>(instanceCount) / option.Frames;
+	result.UpdateTime = updateTime / option.Frames * 1000000.0;
+	result.DrawTime = drawTime / option.Frames * 1000000.0;
+	result.InstancesPerSecond = updateTime > 0.0 ? instanceCount / updateTime : 0.0;
+	result.PeakAllocatedBytes = g_peakAllocatedBytes.load();
+	return result;
+}
+
+EffectResult Benchmark(const Option& option, const fs::path& path)
+{
+	EffectResult result;
+	result.Path = path.generic_string();
+
+	ResetPeakAllocatedBytes();
+
+	// an effect is released before it is loaded again, so resources are loaded every time
+	{
+		auto manager = CreateManager(option, 0);
+		double totalLoadTime = 0.0;
+
+		for (int32_t i = 0; i < option.LoadCount; i++)
+		{
+			const auto beginTime = std::chrono::steady_clock::now();
+			auto effect = Effekseer::Effect::Create(manager, path.u16string().c_str());
+			const auto time = GetSeconds(beginTime, std::chrono::steady_clock::now()) * 1000.0;
+
+			if (effect == nullptr)
+			{
+				return result;
+			}
+
+			result.MinLoadTime = i == 0 ? time : std::min(result.MinLoadTime, time);
+			totalLoadTime += time;
+		}
+
+		result.IsLoaded = true;
+		result.MeanLoadTime = totalLoadTime / option.LoadCount;
+		result.LoadPeakAllocatedBytes = g_peakAllocatedBytes.load();
+	}
+
+	for (int32_t t = 0; t <= option.MaxWorkerThreads; t++)
+	{
+		result.Runs.emplace_back(Run(option, path, t));
+	}
+
+	return result;
+}
+
+std::string EscapeJSON(const std::string& str)
+{
+	std::string ret;
+	for (auto c : str)
+	{
+		if (c == '"' || c == '\\')
+		{
+			ret += '\\';
+		}
+		ret += c;
+	}
+	return ret;
+}
+
+std::string ToJSON(const Option& option, const std::vector<EffectResult>& results)
+{
+	std::ostringstream ss;
+	ss << std::fixed << std::setprecision(3);
+	ss << "{\n";
+	ss << "  \"frames\": " << option.Frames << ",\n";
+	ss << "  \"warmupFrames\": " << option.WarmupFrames << ",\n";
+	ss << "  \"loads\": " << option.LoadCount << ",\n";
+	ss << "  \"emitters\": " << option.Emitters << ",\n";
+	ss << "  \"effects\": [";
+
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const auto& r = results[i];
+		ss << (i == 0 ? "\n" : ",\n");
+		ss << "    {\n";
+		ss << "      \"path\": \"" << EscapeJSON(r.Path) << "\",\n";
+		ss << "      \"loaded\": " << (r.IsLoaded ? "true" : "false") << ",\n";
+		ss << "      \"minLoadTimeMs\": " << r.MinLoadTime << ",\n";
+		ss << "      \"meanLoadTimeMs\": " << r.MeanLoadTime << ",\n";
+		ss << "      \"loadPeakAllocatedBytes\": " << r.LoadPeakAllocatedBytes << ",\n";
+		ss << "      \"runs\": [";
+
+		for (size_t j = 0; j < r.Runs.size(); j++)
+		{
+			const auto& run = r.Runs[j];
+			ss << (j == 0 ? "\n" : ",\n");
+			ss << "        {\"workerThreads\": " << run.WorkerThreads << ", \"meanInstanceCount\": " << run.MeanInstanceCount
+			   << ", \"updateTimeUs\": " << run.UpdateTime << ", \"drawTimeUs\": " << run.DrawTime
+			   << ", \"instancesPerSecond\": " << run.InstancesPerSecond << ", \"peakAllocatedBytes\": " << run.PeakAllocatedBytes << "}";
+		}
+
+		ss << "\n      ]\n";
+		ss << "    }";
+	}
+
+	ss << "\n  ]\n";
+	ss << "}\n";
+	return ss.str();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	Option option;
+	if (!ParseOption(argc, argv, option))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// it must be replaced before any object of the runtime is created
+	EnableAllocationTracking();
+
+	const auto paths = CollectEffects(option.Inputs);
+	if (paths.size() == 0)
+	{
+		std::cerr << "No effect is found." << std::endl;
+		return 1;
+	}
+
+	std::vector<EffectResult> results;
+	bool hasFailed = false;
+
+	for (const auto& path : paths)
+	{
+		auto result = Benchmark(option, path);
+		hasFailed |= !result.IsLoaded;
+
+		std::cerr << result.Path;
+		if (!result.IsLoaded)
+		{
+			std::cerr << " : failed to load" << std::endl;
+		}
+		else
+		{
+			std::cerr << " : load " << result.MinLoadTime << "ms, peak " << result.LoadPeakAllocatedBytes / 1024 << "KB" << std::endl;
+			for (const auto& run : result.Runs)
+			{
+				std::cerr << "  threads " << run.WorkerThreads << " : update " << run.UpdateTime << "us, draw " << run.DrawTime << "us, "
+						  << static_cast<int64_t>(run.InstancesPerSecond) << " instances/s, peak " << run.PeakAllocatedBytes / 1024 << "KB" << std::endl;
+			}
+		}
+
+		results.emplace_back(std::move(result));
+	}
+
+	const auto json = ToJSON(option, results);
+
+	if (option.Output.empty())
+	{
+		std::cout << json;
+	}
+	else
+	{
+		std::ofstream ofs(option.Output);
+		if (!ofs)
+		{
+			std::cerr << "Failed to write : " << option.Output.generic_string() << std::endl;
+			return 1;
+		}
+		ofs << json;
+	}
+
+	return hasFailed ? 1 : 0;
+}
@@ -3,9 +3,14 @@
 #include "efkMat.Parameters.h"
 #include "efkMat.Utils.h"
 
+#include <cmath>
+#include <iomanip>
+
 namespace EffekseerMaterial
 {
 
+// CompiledMaterialGeneratorVersion in Effekseer/Utils/BinaryVersion.h must be incremented when exported codes are changed
+
 /**
 	@brief	Refactor with it
 */
@@ -407,35 +412,6 @@ TextExporterResult TextExporter::Export(std::shared_ptr<Material> material, std:
 	// Generate wrapper with variables
 	std::reverse(nodes.begin(), nodes.end());
 
-	// Check custom data
-	int32_t customData1Count = 0;
-	int32_t customData2Count = 0;
-
-	for (auto& node : nodes)
-	{
-		if (node->Parameter->Type == NodeType::CustomData1)
-		{
-			for (int32_t i = 0; i < 4; i++)
-			{
-				if (node->Properties[i]->Floats[0] > 0)
-				{
-					customData1Count = std::max(customData1Count, i + 1);
-				}
-			}
-		}
-
-		if (node->Parameter->Type == NodeType::CustomData2)
-		{
-			for (int32_t i = 0; i < 4; i++)
-			{
-				if (node->Properties[i]->Floats[0] > 0)
-				{
-					customData2Count = std::max(customData2Count, i + 1);
-				}
-			}
-		}
-	}
-
 	// Generate exporter node
 	std::vector<std::shared_ptr<TextExporterNode>> exportedNodes;
 	std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<TextExporterNode>> node2exportedNode;
@@ -735,6 +711,39 @@ TextExporterResult TextExporter::Export(std::shared_ptr<Material> material, std:
 		option.ShadingModel = 1;
 	}
 
+	Optimize(exportedNodes, outputExportedNode, option);
+
+	// Check custom data
+	int32_t customData1Count = 0;
+	int32_t customData2Count = 0;
+
+	for (auto& enode : exportedNodes)
+	{
+		auto node = enode->Target;
+
+		if (node->Parameter->Type == NodeType::CustomData1)
+		{
+			for (int32_t i = 0; i < 4; i++)
+			{
+				if (node->Properties[i]->Floats[0] > 0)
+				{
+					customData1Count = std::max(customData1Count, i + 1);
+				}
+			}
+		}
+
+		if (node->Parameter->Type == NodeType::CustomData2)
+		{
+			for (int32_t i = 0; i < 4; i++)
+			{
+				if (node->Properties[i]->Floats[0] > 0)
+				{
+					customData2Count = std::max(customData2Count, i + 1);
+				}
+			}
+		}
+	}
+
 	// Generate outputs
 	std::ostringstream ret;
 
@@ -745,10 +754,9 @@ TextExporterResult TextExporter::Export(std::shared_ptr<Material> material, std:
 		auto normalIndex = outputExportedNode->Target->GetInputPinIndex("Normal");
 		if (outputExportedNode->Inputs[normalIndex].IsConnected)
 		{
-			std::vector<std::shared_ptr<Node>> pnNodes;
-			std::unordered_set<std::shared_ptr<Node>> pnFoundNodes;
+			std::unordered_set<std::shared_ptr<TextExporterNode>> pnFoundNodes;
 
-			GatherNodes(material, outputExportedNode->Target->InputPins[normalIndex], pnNodes, pnFoundNodes);
+			GatherNodes(exportedNodes, {outputExportedNode->Inputs[normalIndex]}, pnFoundNodes);
 
 			// nodes to calculate pixelNormalDir
 			std::vector<std::shared_ptr<TextExporterNode>> pnExportedNodes;
@@ -756,7 +764,7 @@ TextExporterResult TextExporter::Export(std::shared_ptr<Material> material, std:
 
 			for (auto wn : exportedNodes)
 			{
-				if (pnFoundNodes.find(wn->Target) != pnFoundNodes.end())
+				if (pnFoundNodes.find(wn) != pnFoundNodes.end())
 				{
 					pnExportedNodes.push_back(wn);
 				}
@@ -877,6 +885,453 @@ void TextExporter::GatherNodes(std::shared_ptr<Material> material,
 	}
 }
 
+void TextExporter::GatherNodes(const std::vector<std::shared_ptr<TextExporterNode>>& nodes,
+							   const std::vector<TextExporterPin>& pins,
+							   std::unordered_set<std::shared_ptr<TextExporterNode>>& foundNodes)
+{
+	std::unordered_map<std::string, std::shared_ptr<TextExporterNode>> name2node;
+
+	for (auto node : nodes)
+	{
+		for (auto& output : node->Outputs)
+		{
+			name2node[output.Name] = node;
+		}
+	}
+
+	std::vector<TextExporterPin> stack = pins;
+
+	while (stack.size() > 0)
+	{
+		auto pin = stack.back();
+		stack.pop_back();
+
+		if (!pin.IsConnected || pin.IsConstant)
+			continue;
+
+		auto it = name2node.find(pin.Name);
+		if (it == name2node.end() || foundNodes.count(it->second) > 0)
+			continue;
+
+		foundNodes.insert(it->second);
+		stack.insert(stack.end(), it->second->Inputs.begin(), it->second->Inputs.end());
+	}
+}
+
+void TextExporter::Optimize(std::vector<std::shared_ptr<TextExporterNode>>& nodes,
+							std::shared_ptr<TextExporterNode> outputNode,
+							const TextExporterOutputOption& option)
+{
+	// inputs for lighting are not used in unlit
+	if (outputNode->Target->Parameter->Type == NodeType::Output && option.ShadingModel == static_cast<int>(ShadingModelType::Unlit))
+	{
+		for (auto name : {"BaseColor", "Metallic", "Roughness", "AmbientOcclusion"})
+		{
+			auto ind = outputNode->Target->GetInputPinIndex(name);
+			auto& pin = outputNode->Inputs[ind];
+
+			TextExporterPin unused;
+			unused.Type = pin.Type;
+			unused.IsConnected = false;
+			unused.Default = outputNode->Target->Parameter->InputPins[ind]->Default;
+			unused.NumberValue = outputNode->Target->Parameter->InputPins[ind]->DefaultValues;
+			pin = unused;
+		}
+	}
+
+	// nodes are sorted by dependencies, so replaced pins are always found before they are referred
+	std::unordered_map<std::string, TextExporterPin> replacedPins;
+	std::unordered_map<std::string, std::shared_ptr<TextExporterNode>> commonNodes;
+	std::vector<std::shared_ptr<TextExporterNode>> remainedNodes;
+
+	for (auto node : nodes)
+	{
+		for (auto& input : node->Inputs)
+		{
+			if (!input.IsConnected)
+				continue;
+
+			auto it = replacedPins.find(input.Name);
+			if (it != replacedPins.end())
+			{
+				input = it->second;
+			}
+		}
+
+		if (node == outputNode)
+		{
+			remainedNodes.push_back(node);
+			continue;
+		}
+
+		std::array<float, 4> values;
+		if (FoldConstant(node, values))
+		{
+			auto pin = node->Outputs[0];
+			pin.IsConstant = true;
+			pin.NumberValue = values;
+			pin.Name = GetConstantName(pin.Type, values);
+			replacedPins[node->Outputs[0].Name] = pin;
+			continue;
+		}
+
+		auto key = GetCommonKey(node);
+		if (key != "")
+		{
+			auto it = commonNodes.find(key);
+			if (it != commonNodes.end())
+			{
+				for (size_t i = 0; i < node->Outputs.size(); i++)
+				{
+					// some nodes export only connected outputs
+					it->second->Outputs[i].IsConnected |= node->Outputs[i].IsConnected;
+					replacedPins[node->Outputs[i].Name] = it->second->Outputs[i];
+				}
+				continue;
+			}
+
+			commonNodes[key] = node;
+		}
+
+		remainedNodes.push_back(node);
+	}
+
+	// remove nodes which don't reach outputs
+	std::unordered_set<std::shared_ptr<TextExporterNode>> foundNodes;
+	foundNodes.insert(outputNode);
+	GatherNodes(remainedNodes, outputNode->Inputs, foundNodes);
+
+	nodes.clear();
+
+	for (auto node : remainedNodes)
+	{
+		if (foundNodes.count(node) > 0)
+		{
+			nodes.push_back(node);
+		}
+	}
+}
+
+static std::array<float, 4> ConvertConstant(ValueType dst, ValueType src, const std::array<float, 4>& values)
+{
+	// same as ConvertType
+	std::array<float, 4> ret;
+	ret.fill(0.0f);
+
+	auto srcCount = GetElementCount(src);
+	auto dstCount = GetElementCount(dst);
+
+	for (int i = 0; i < dstCount; i++)
+	{
+		if (src == ValueType::Float1)
+		{
+			ret[i] = values[0];
+		}
+		else if (i < srcCount)
+		{
+			ret[i] = values[i];
+		}
+		else if (i == 3)
+		{
+			ret[i] = 1.0f;
+		}
+	}
+
+	return ret;
+}
+
+static bool IsNumberType(ValueType type)
+{
+	return type == ValueType::Float1 || type == ValueType::Float2 || type == ValueType::Float3 || type == ValueType::Float4;
+}
+
+bool TextExporter::GetConstantInput(const TextExporterPin& pin, ValueType type, std::array<float, 4>& values) const
+{
+	if (!IsNumberType(pin.Type) || !IsNumberType(type))
+		return false;
+
+	if (pin.IsConnected && !pin.IsConstant)
+		return false;
+
+	if (!pin.IsConnected && pin.Default != DefaultType::Value)
+		return false;
+
+	values = ConvertConstant(type, pin.Type, pin.NumberValue);
+	return true;
+}
+
+bool TextExporter::GetConstantInputOrProp(const TextExporterPin& pin,
+										  const std::shared_ptr<NodeProperty>& prop,
+										  ValueType type,
+										  std::array<float, 4>& values) const
+{
+	if (pin.IsConnected)
+	{
+		return GetConstantInput(pin, type, values);
+	}
+
+	values.fill(prop->Floats[0]);
+	return true;
+}
+
+bool TextExporter::FoldConstant(std::shared_ptr<TextExporterNode> node, std::array<float, 4>& values) const
+{
+	if (node->Outputs.size() != 1 || !IsNumberType(node->Outputs[0].Type))
+		return false;
+
+	auto type = node->Target->Parameter->Type;
+	auto outputType = node->Outputs[0].Type;
+	auto& props = node->Target->Properties;
+	auto& inputs = node->Inputs;
+	auto count = GetElementCount(outputType);
+
+	std::array<float, 4> v1;
+	std::array<float, 4> v2;
+	std::array<float, 4> v3;
+
+	auto calc2 = [&](const std::function<float(float, float)>& func) -> bool {
+		if (!GetConstantInputOrProp(inputs[0], props[0], outputType, v1) || !GetConstantInputOrProp(inputs[1], props[1], outputType, v2))
+			return false;
+
+		for (int i = 0; i < count; i++)
+		{
+			values[i] = func(v1[i], v2[i]);
+		}
+		return true;
+	};
+
+	auto calc1 = [&](const std::function<float(float)>& func) -> bool {
+		if (!GetConstantInput(inputs[0], outputType, v1))
+			return false;
+
+		for (int i = 0; i < count; i++)
+		{
+			values[i] = func(v1[i]);
+		}
+		return true;
+	};
+
+	bool folded = false;
+	values.fill(0.0f);
+
+	if (type == NodeType::Constant1 || type == NodeType::Constant2 || type == NodeType::Constant3 || type == NodeType::Constant4)
+	{
+		values = ConvertConstant(outputType, outputType, props[0]->Floats);
+		folded = true;
+	}
+	else if (type == NodeType::Add)
+	{
+		folded = calc2([](float a, float b) { return a + b; });
+	}
+	else if (type == NodeType::Subtract)
+	{
+		folded = calc2([](float a, float b) { return a - b; });
+	}
+	else if (type == NodeType::Multiply)
+	{
+		folded = calc2([](float a, float b) { return a * b; });
+	}
+	else if (type == NodeType::Divide)
+	{
+		folded = calc2([](float a, float b) { return a / b; });
+	}
+	else if (type == NodeType::Min)
+	{
+		folded = calc2([](float a, float b) { return std::min(a, b); });
+	}
+	else if (type == NodeType::Max)
+	{
+		folded = calc2([](float a, float b) { return std::max(a, b); });
+	}
+	else if (type == NodeType::Abs)
+	{
+		folded = calc1([](float a) { return std::abs(a); });
+	}
+	else if (type == NodeType::Sine)
+	{
+		folded = calc1([](float a) { return std::sin(a); });
+	}
+	else if (type == NodeType::Ceil)
+	{
+		folded = calc1([](float a) { return std::ceil(a); });
+	}
+	else if (type == NodeType::Floor)
+	{
+		folded = calc1([](float a) { return std::floor(a); });
+	}
+	else if (type == NodeType::Frac)
+	{
+		folded = calc1([](float a) { return a - std::floor(a); });
+	}
+	else if (type == NodeType::SquareRoot)
+	{
+		folded = calc1([](float a) { return std::sqrt(a); });
+	}
+	else if (type == NodeType::OneMinus)
+	{
+		folded = calc1([](float a) { return 1.0f - a; });
+	}
+	else if (type == NodeType::Clamp)
+	{
+		if (GetConstantInput(inputs[0], outputType, v1) && GetConstantInputOrProp(inputs[1], props[0], outputType, v2) &&
+			GetConstantInputOrProp(inputs[2], props[1], outputType, v3))
+		{
+			for (int i = 0; i < count; i++)
+			{
+				values[i] = std::min(std::max(v1[i], v2[i]), v3[i]);
+			}
+			folded = true;
+		}
+	}
+	else if (type == NodeType::ComponentMask)
+	{
+		if (GetConstantInput(inputs[0], ValueType::Float4, v1))
+		{
+			int32_t ind = 0;
+			for (int i = 0; i < 4; i++)
+			{
+				if (props[i]->Floats[0] > 0)
+				{
+					values[ind] = v1[i];
+					ind++;
+				}
+			}
+			folded = ind == count;
+		}
+	}
+	else if (type == NodeType::AppendVector)
+	{
+		if (GetConstantInput(inputs[0], inputs[0].Type, v1) && GetConstantInput(inputs[1], inputs[1].Type, v2))
+		{
+			auto v1Count = GetElementCount(inputs[0].Type);
+
+			for (int i = 0; i < count; i++)
+			{
+				if (i < v1Count)
+				{
+					values[i] = v1[i];
+				}
+				else
+				{
+					values[i] = inputs[1].Type == ValueType::Float1 ? v2[0] : v2[i - v1Count];
+				}
+			}
+			folded = true;
+		}
+	}
+
+	if (!folded)
+		return false;
+
+	// keep the behavior of GPU with invalid values
+	for (int i = 0; i < count; i++)
+	{
+		if (!std::isfinite(values[i]))
+			return false;
+	}
+
+	return true;
+}
+
+std::string TextExporter::GetCommonKey(std::shared_ptr<TextExporterNode> node) const
+{
+	auto type = node->Target->Parameter->Type;
+
+	// pixelNormalDir is changed while exporting
+	if (type == NodeType::Output || type == NodeType::PixelNormalWS || type == NodeType::Fresnel || type == NodeType::TextureObject ||
+		type == NodeType::TextureObjectParameter)
+	{
+		return "";
+	}
+
+	// values must be distinguished with all significant digits of float
+	std::ostringstream key;
+	key << std::setprecision(9);
+	key << static_cast<int>(type) << "|";
+
+	for (auto& prop : node->Target->Properties)
+	{
+		for (auto f : prop->Floats)
+		{
+			key << f << ",";
+		}
+		key << prop->Str << "|";
+	}
+
+	for (auto& input : node->Inputs)
+	{
+		key << static_cast<int>(input.Type) << ":";
+
+		if (input.IsConnected)
+		{
+			key << input.Name;
+		}
+		else
+		{
+			key << "#" << static_cast<int>(input.Default);
+			for (auto f : input.NumberValue)
+			{
+				key << "," << f;
+			}
+		}
+
+		if (input.TextureValue != nullptr)
+		{
+			key << "@" << input.TextureValue->GUID;
+		}
+		key << "|";
+	}
+
+	for (auto& output : node->Outputs)
+	{
+		key << static_cast<int>(output.Type) << ":";
+
+		if (output.UniformValue != nullptr)
+		{
+			key << "@" << output.UniformValue->GUID;
+		}
+
+		if (output.TextureValue != nullptr)
+		{
+			key << "@" << output.TextureValue->GUID;
+		}
+		key << "|";
+	}
+
+	return key.str();
+}
+
+std::string TextExporter::GetConstantName(ValueType type, const std::array<float, 4>& values) const
+{
+	// for opengl es
+	auto getNum = [](float f) -> std::string {
+		std::ostringstream ret;
+		if (f == std::floor(f) && std::abs(f) < 1.0e7f)
+		{
+			ret << static_cast<int64_t>(f) << ".0";
+		}
+		else
+		{
+			ret << std::setprecision(9) << f;
+		}
+
+		return ret.str();
+	};
+
+	std::ostringstream ret;
+	ret << GetTypeName(type) << "(";
+
+	for (int i = 0; i < GetElementCount(type); i++)
+	{
+		if (i > 0)
+			ret << ",";
+		ret << getNum(values[i]);
+	}
+
+	ret << ")";
+	return ret.str();
+}
+
 std::string TextExporter::MergeTemplate(std::string code, std::string uniform_texture)
 {
 	const char template_[] = R"(
@@ -1001,6 +1456,57 @@ std::string TextExporter::ExportNode(std::shared_ptr<TextExporterNode> node)
 			<< exportInputOrProp(node->Outputs[0].Type, node->Inputs[1], node->Target->Properties[1]) << ");" << std::endl;
 	};
 
+	// a scalar is broadcasted by arithmetic operators without constructing a vector
+	auto getScalarArg = [this](TextExporterPin& pin_, std::shared_ptr<NodeProperty>& prop_, std::string& arg) -> bool {
+		if (!pin_.IsConnected)
+		{
+			arg = GetInputArg(ValueType::Float1, prop_->Floats[0]);
+			return true;
+		}
+
+		if (pin_.Type == ValueType::Float1)
+		{
+			arg = GetInputArg(ValueType::Float1, pin_);
+			return true;
+		}
+
+		if (pin_.IsConstant)
+		{
+			for (int i = 1; i < GetElementCount(pin_.Type); i++)
+			{
+				if (pin_.NumberValue[i] != pin_.NumberValue[0])
+					return false;
+			}
+
+			arg = GetInputArg(ValueType::Float1, pin_.NumberValue[0]);
+			return true;
+		}
+
+		return false;
+	};
+
+	auto exportArithmetic = [&, this](const char* op) -> void {
+		auto type = node->Outputs[0].Type;
+		std::string arg1;
+		std::string arg2;
+
+		// one of arguments must have the type of the output
+		auto isScalar1 = type != ValueType::Float1 && getScalarArg(node->Inputs[0], node->Target->Properties[0], arg1);
+		auto isScalar2 = type != ValueType::Float1 && !isScalar1 && getScalarArg(node->Inputs[1], node->Target->Properties[1], arg2);
+
+		if (!isScalar1)
+		{
+			arg1 = exportInputOrProp(type, node->Inputs[0], node->Target->Properties[0]);
+		}
+
+		if (!isScalar2)
+		{
+			arg2 = exportInputOrProp(type, node->Inputs[1], node->Target->Properties[1]);
+		}
+
+		ret << GetTypeName(type) << " " << node->Outputs[0].Name << "=(" << arg1 << op << arg2 << ");" << std::endl;
+	};
+
 	auto exportIn1Out1 = [&, this](const char* func) -> void {
 		assert(node->Inputs.size() == 1);
 		assert(node->Outputs.size() == 1);
@@ -1091,22 +1597,22 @@ std::string TextExporter::ExportNode(std::shared_ptr<TextExporterNode> node)
 
 	if (node->Target->Parameter->Type == NodeType::Add)
 	{
-		exportIn2Out2Param2("", "+");
+		exportArithmetic("+");
 	}
 
 	if (node->Target->Parameter->Type == NodeType::Subtract)
 	{
-		exportIn2Out2Param2("", "-");
+		exportArithmetic("-");
 	}
 
 	if (node->Target->Parameter->Type == NodeType::Multiply)
 	{
-		exportIn2Out2Param2("", "*");
+		exportArithmetic("*");
 	}
 
 	if (node->Target->Parameter->Type == NodeType::Divide)
 	{
-		exportIn2Out2Param2("", "/");
+		exportArithmetic("/");
 	}
 
 	if (node->Target->Parameter->Type == NodeType::FMod)
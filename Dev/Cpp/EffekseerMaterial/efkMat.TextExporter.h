@@ -47,6 +47,9 @@ struct TextExporterPin
 
 	//! if pin is output, always true (should be improved)
 	bool IsConnected = false;
+
+	//! if pin is folded into a constant, Name is a literal and NumberValue is its value
+	bool IsConstant = false;
 	DefaultType Default;
 
 	std::array<float, 4> NumberValue;
@@ -113,6 +116,30 @@ protected:
 					 std::vector<std::shared_ptr<Node>>& nodes,
 					 std::unordered_set<std::shared_ptr<Node>>& foundNodes);
 
+	void GatherNodes(const std::vector<std::shared_ptr<TextExporterNode>>& nodes,
+					 const std::vector<TextExporterPin>& pins,
+					 std::unordered_set<std::shared_ptr<TextExporterNode>>& foundNodes);
+
+	/**
+		@brief	fold constants, merge common nodes and remove nodes which don't reach outputs
+	*/
+	virtual void Optimize(std::vector<std::shared_ptr<TextExporterNode>>& nodes,
+						  std::shared_ptr<TextExporterNode> outputNode,
+						  const TextExporterOutputOption& option);
+
+	bool FoldConstant(std::shared_ptr<TextExporterNode> node, std::array<float, 4>& values) const;
+
+	bool GetConstantInput(const TextExporterPin& pin, ValueType type, std::array<float, 4>& values) const;
+
+	bool GetConstantInputOrProp(const TextExporterPin& pin,
+								const std::shared_ptr<NodeProperty>& prop,
+								ValueType type,
+								std::array<float, 4>& values) const;
+
+	std::string GetCommonKey(std::shared_ptr<TextExporterNode> node) const;
+
+	virtual std::string GetConstantName(ValueType type, const std::array<float, 4>& values) const;
+
 	virtual std::string MergeTemplate(std::string code, std::string uniform_texture);
 
 	virtual std::string ExportOutputNode(std::shared_ptr<Material> material,
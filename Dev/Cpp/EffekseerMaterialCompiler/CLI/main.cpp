@@ -0,0 +1,197 @@
+#include "../../Effekseer/Effekseer/Material/Effekseer.CompiledMaterialCache.h"
+#include "../OpenGL/EffekseerMaterialCompilerGL.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+struct Option
+{
+	fs::path InputDirectory;
+	fs::path OutputDirectory;
+	fs::path CacheDirectory;
+	int32_t JobCount = 0;
+};
+
+void PrintUsage()
+{
+	std::cout << "Usage : EffekseerMaterialCompilerCLI <input directory> <output directory> [--cache <directory>] [--jobs <count>]" << std::endl;
+	std::cout << "Compile all .efkmat in the input directory into .efkmatd in the output directory." << std::endl;
+}
+
+bool ParseOption(int argc, char* argv[], Option& option)
+{
+	std::vector<std::string> positionals;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+
+		if (arg == "--cache" && i + 1 < argc)
+		{
+			option.CacheDirectory = argv[++i];
+		}
+		else if (arg == "--jobs" && i + 1 < argc)
+		{
+			option.JobCount = std::stoi(argv[++i]);
+		}
+		else
+		{
+			positionals.emplace_back(arg);
+		}
+	}
+
+	if (positionals.size() != 2)
+	{
+		return false;
+	}
+
+	option.InputDirectory = positionals[0];
+	option.OutputDirectory = positionals[1];
+
+	if (option.JobCount <= 0)
+	{
+		option.JobCount = std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+	}
+
+	return true;
+}
+
+bool ReadFile(const fs::path& path, std::vector<uint8_t>& data)
+{
+	std::ifstream ifs(path, std::ios::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+
+	data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	return true;
+}
+
+bool WriteFile(const fs::path& path, const std::vector<uint8_t>& data)
+{
+	std::error_code ec;
+	fs::create_directories(path.parent_path(), ec);
+
+	std::ofstream ofs(path, std::ios::binary);
+	if (!ofs)
+	{
+		return false;
+	}
+
+	ofs.write(reinterpret_cast<const char*>(data.data()), data.size());
+	return static_cast<bool>(ofs);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	Option option;
+	if (!ParseOption(argc, argv, option))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	std::vector<fs::path> inputs;
+	std::error_code ec;
+	for (const auto& entry : fs::recursive_directory_iterator(option.InputDirectory, ec))
+	{
+		if (entry.is_regular_file() && entry.path().extension() == ".efkmat")
+		{
+			inputs.emplace_back(entry.path());
+		}
+	}
+
+	if (ec)
+	{
+		std::cout << "Error : Failed to open " << option.InputDirectory.string() << std::endl;
+		return 1;
+	}
+
+	// materials which have same contents are compiled only once
+	const auto cacheDirectory = option.CacheDirectory.u16string();
+	// binaries are not released to count unique materials
+	auto cache = Effekseer::MakeRefPtr<Effekseer::CompiledMaterialCache>(cacheDirectory.empty() ? nullptr : cacheDirectory.c_str(), nullptr, 0);
+
+	if (!cacheDirectory.empty())
+	{
+		fs::create_directories(option.CacheDirectory, ec);
+	}
+
+	std::atomic<size_t> next(0);
+	std::atomic<int32_t> failedCount(0);
+	std::mutex logMutex;
+
+	auto compile = [&]() {
+		auto compiler = Effekseer::CreateUniqueReference(new Effekseer::MaterialCompilerGL());
+
+		for (size_t i = next++; i < inputs.size(); i = next++)
+		{
+			const auto& input = inputs[i];
+			auto output = option.OutputDirectory / fs::relative(input, option.InputDirectory);
+			output.replace_extension(".efkmatd");
+
+			std::vector<uint8_t> data;
+			Effekseer::MaterialFile materialFile;
+			if (!ReadFile(input, data) || !materialFile.Load(data.data(), static_cast<int32_t>(data.size())))
+			{
+				std::lock_guard<std::mutex> lock(logMutex);
+				std::cout << "Error : Failed to load " << input.string() << std::endl;
+				failedCount++;
+				continue;
+			}
+
+			auto binary = Effekseer::CreateUniqueReference(
+				cache->Compile(compiler.get(), &materialFile, data.data(), static_cast<int32_t>(data.size()), Effekseer::CompiledMaterialPlatformType::OpenGL));
+
+			if (binary == nullptr)
+			{
+				std::lock_guard<std::mutex> lock(logMutex);
+				std::cout << "Error : Failed to compile " << input.string() << std::endl;
+				failedCount++;
+				continue;
+			}
+
+			Effekseer::CompiledMaterial compiled;
+			compiled.UpdateData(binary.get(), Effekseer::CompiledMaterialPlatformType::OpenGL);
+
+			std::vector<uint8_t> dst;
+			compiled.Save(dst, materialFile.GetGUID(), data);
+
+			if (!WriteFile(output, dst))
+			{
+				std::lock_guard<std::mutex> lock(logMutex);
+				std::cout << "Error : Failed to save " << output.string() << std::endl;
+				failedCount++;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int32_t i = 0; i < option.JobCount; i++)
+	{
+		threads.emplace_back(compile);
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	std::cout << "Compiled : " << inputs.size() - failedCount << " / " << inputs.size() << " (unique : " << cache->GetCount() << ")" << std::endl;
+
+	return failedCount == 0 ? 0 : 1;
+}
@@ -467,6 +467,15 @@ void CalculateAlignedTextureInformation(Effekseer::Backend::TextureFormatType fo
 		sizePerWidth = 16 * aligned(size[0], blockSize) / blockSize;
 		height = aligned(size[1], blockSize) / blockSize;
 	}
+	else if (Effekseer::Backend::IsCompressedTextureFormat(format))
+	{
+		int32_t blockWidth = 0;
+		int32_t blockHeight = 0;
+		int32_t blockBytes = 0;
+		Effekseer::Backend::GetTextureFormatBlockSize(format, blockWidth, blockHeight, blockBytes);
+		sizePerWidth = blockBytes * aligned(size[0], blockWidth) / blockWidth;
+		height = aligned(size[1], blockHeight) / blockHeight;
+	}
 }
 
 Effekseer::Backend::VertexLayoutRef GetVertexLayout(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, RendererShaderType type)
@@ -533,4 +542,65 @@ Effekseer::Backend::VertexLayoutRef GetVertexLayout(Effekseer::Backend::Graphics
 	return {};
 }
 
+static RendererShaderType GetRequiredShaderType(const Effekseer::EffectRef& effect, Effekseer::EffectNode* node)
+{
+	const auto& param = node->GetNodeRendererBasicParameter();
+
+	if (param.MaterialType == ::Effekseer::RendererMaterialType::File)
+	{
+		auto material = effect->GetMaterial(param.MaterialRenderDataPtr != nullptr ? param.MaterialRenderDataPtr->MaterialIndex : -1);
+		if (material != nullptr && !material->IsSimpleVertex)
+		{
+			return RendererShaderType::Material;
+		}
+
+		return RendererShaderType::Unlit;
+	}
+
+	const auto edgeFalloff = node->GetNodeType() == Effekseer::EffectNodeType::Model && node->GetBasicRenderParameter().EnableFalloff;
+	const auto isAdvanced = param.GetIsRenderedWithAdvancedRenderer() || edgeFalloff;
+
+	if (param.MaterialType == ::Effekseer::RendererMaterialType::Lighting)
+	{
+		return isAdvanced ? RendererShaderType::AdvancedLit : RendererShaderType::Lit;
+	}
+	else if (param.MaterialType == ::Effekseer::RendererMaterialType::BackDistortion)
+	{
+		return isAdvanced ? RendererShaderType::AdvancedBackDistortion : RendererShaderType::BackDistortion;
+	}
+	else if (param.MaterialType == ::Effekseer::RendererMaterialType::Default)
+	{
+		return isAdvanced ? RendererShaderType::AdvancedUnlit : RendererShaderType::Unlit;
+	}
+
+	return RendererShaderType::Unlit;
+}
+
+static void EnumerateRequiredShaderTypes(const Effekseer::EffectRef& effect,
+										 Effekseer::EffectNode* node,
+										 const std::function<void(Effekseer::EffectNodeType, RendererShaderType)>& visitor)
+{
+	const auto nodeType = node->GetNodeType();
+
+	if (nodeType != Effekseer::EffectNodeType::Root && nodeType != Effekseer::EffectNodeType::NoneType)
+	{
+		visitor(nodeType, GetRequiredShaderType(effect, node));
+	}
+
+	for (int i = 0; i < node->GetChildrenCount(); i++)
+	{
+		EnumerateRequiredShaderTypes(effect, node->GetChild(i), visitor);
+	}
+}
+
+void EnumerateRequiredShaderTypes(const Effekseer::EffectRef& effect, const std::function<void(Effekseer::EffectNodeType, RendererShaderType)>& visitor)
+{
+	if (effect == nullptr || effect->GetRoot() == nullptr)
+	{
+		return;
+	}
+
+	EnumerateRequiredShaderTypes(effect, effect->GetRoot(), visitor);
+}
+
 } // namespace EffekseerRenderer
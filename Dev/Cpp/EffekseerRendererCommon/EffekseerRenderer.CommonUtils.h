@@ -7,6 +7,7 @@
 #include <Effekseer.h>
 #include <Effekseer/Material/Effekseer.CompiledMaterial.h>
 #include <Effekseer/Model/SplineGenerator.h>
+#include <Effekseer/Utils/Profiler.h>
 #include <algorithm>
 #include <array>
 #include <assert.h>
@@ -1535,5 +1536,12 @@ void CalculateAlignedTextureInformation(Effekseer::Backend::TextureFormatType fo
 //! only support OpenGL
 Effekseer::Backend::VertexLayoutRef GetVertexLayout(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, RendererShaderType type);
 
+/**
+	@brief	Enumerate shader types which nodes in an effect require to be rendered
+	@note
+	Shaders for a wireframe mode and external shader settings are not included.
+*/
+void EnumerateRequiredShaderTypes(const Effekseer::EffectRef& effect, const std::function<void(Effekseer::EffectNodeType, RendererShaderType)>& visitor);
+
 } // namespace EffekseerRenderer
 #endif // __EFFEKSEERRENDERER_COMMON_UTILS_H__
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "EffekseerRenderer.DDSTextureLoader.h"
+#include <algorithm>
 #include <stdint.h>
 
 namespace EffekseerRenderer
@@ -18,6 +19,8 @@ enum class DdsDx10Format : uint32_t
 	BC4_SNORM = 81,
 	BC5_UNORM = 83,
 	BC5_SNORM = 84,
+	BC7_UNORM = 98,
+	BC7_UNORM_SRGB = 99,
 };
 
 constexpr uint32_t MakeFourCC(const char v1, const char v2, const char v3, const char v4)
@@ -26,6 +29,16 @@ constexpr uint32_t MakeFourCC(const char v1, const char v2, const char v3, const
 }
 
 bool DDSTextureLoader::Load(const void* data, int32_t size)
+{
+	return LoadInternal(data, size, nullptr);
+}
+
+bool DDSTextureLoader::Load(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	return LoadInternal(data, size, &dst);
+}
+
+bool DDSTextureLoader::LoadInternal(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>* dst)
 {
 	textures_.clear();
 
@@ -100,6 +113,10 @@ bool DDSTextureLoader::Load(const void* data, int32_t size)
 	if (dds.ddspf.dwFourCC == MakeFourCC('D', 'X', '1', '0'))
 	{
 		hasDX10Flag = true;
+
+		if (static_cast<size_t>(size) < 4 + sizeof(DDS_HEADER) + sizeof(DDS_HEADER_DXT10))
+			return false;
+
 		memcpy(&dds_dxt10, p, sizeof(DDS_HEADER_DXT10));
 		p += sizeof(DDS_HEADER_DXT10);
 	}
@@ -139,6 +156,22 @@ bool DDSTextureLoader::Load(const void* data, int32_t size)
 			{
 				return Effekseer::Backend::TextureFormatType::BC3_SRGB;
 			}
+			else if (dds_dxt10.dxgiFormat == DdsDx10Format::BC4_UNORM)
+			{
+				return Effekseer::Backend::TextureFormatType::BC4;
+			}
+			else if (dds_dxt10.dxgiFormat == DdsDx10Format::BC5_UNORM)
+			{
+				return Effekseer::Backend::TextureFormatType::BC5;
+			}
+			else if (dds_dxt10.dxgiFormat == DdsDx10Format::BC7_UNORM)
+			{
+				return Effekseer::Backend::TextureFormatType::BC7;
+			}
+			else if (dds_dxt10.dxgiFormat == DdsDx10Format::BC7_UNORM_SRGB)
+			{
+				return Effekseer::Backend::TextureFormatType::BC7_SRGB;
+			}
 			else
 			{
 				return Effekseer::Backend::TextureFormatType::Unknown;
@@ -163,6 +196,14 @@ bool DDSTextureLoader::Load(const void* data, int32_t size)
 			{
 				return Effekseer::Backend::TextureFormatType::BC3;
 			}
+			else if (dds.ddspf.dwFourCC == MakeFourCC('A', 'T', 'I', '1') || dds.ddspf.dwFourCC == MakeFourCC('B', 'C', '4', 'U'))
+			{
+				return Effekseer::Backend::TextureFormatType::BC4;
+			}
+			else if (dds.ddspf.dwFourCC == MakeFourCC('A', 'T', 'I', '2') || dds.ddspf.dwFourCC == MakeFourCC('B', 'C', '5', 'U'))
+			{
+				return Effekseer::Backend::TextureFormatType::BC5;
+			}
 			else
 			{
 				return Effekseer::Backend::TextureFormatType::Unknown;
@@ -171,36 +212,33 @@ bool DDSTextureLoader::Load(const void* data, int32_t size)
 	};
 
 	auto format = detectFormat();
-	int32_t blockSize = 0;
-	bool isCompressed = false;
 
 	if (format == Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM ||
 		format == Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB)
 	{
 		textureFormatType = Effekseer::TextureFormatType::ABGR8;
-		blockSize = 4;
-		isCompressed = false;
 	}
 	else if (format == Effekseer::Backend::TextureFormatType::BC1 ||
 			 format == Effekseer::Backend::TextureFormatType::BC1_SRGB)
 	{
 		textureFormatType = Effekseer::TextureFormatType::BC1;
-		blockSize = 8;
-		isCompressed = true;
 	}
 	else if (format == Effekseer::Backend::TextureFormatType::BC2 ||
 			 format == Effekseer::Backend::TextureFormatType::BC2_SRGB)
 	{
 		textureFormatType = Effekseer::TextureFormatType::BC2;
-		blockSize = 16;
-		isCompressed = true;
 	}
 	else if (format == Effekseer::Backend::TextureFormatType::BC3 ||
 			 format == Effekseer::Backend::TextureFormatType::BC3_SRGB)
 	{
 		textureFormatType = Effekseer::TextureFormatType::BC3;
-		blockSize = 16;
-		isCompressed = true;
+	}
+	else if (format == Effekseer::Backend::TextureFormatType::BC4 ||
+			 format == Effekseer::Backend::TextureFormatType::BC5 ||
+			 format == Effekseer::Backend::TextureFormatType::BC7 ||
+			 format == Effekseer::Backend::TextureFormatType::BC7_SRGB)
+	{
+		// they are only supported by the backend
 	}
 	else
 	{
@@ -208,22 +246,63 @@ bool DDSTextureLoader::Load(const void* data, int32_t size)
 	}
 
 	backendTextureFormatType = format;
-	textures_.reserve(dds.dwMipMapCount);
+
+	// dwMipMapCount may be 0 if a texture doesn't have mipmaps
+	const uint32_t mipMapCount = std::max(dds.dwMipMapCount, 1u);
 
 	int32_t width = static_cast<int32_t>(dds.dwWidth);
 	int32_t height = static_cast<int32_t>(dds.dwHeight);
 
-	for (size_t i = 0; i < dds.dwMipMapCount; i++)
+	if (width <= 0 || height <= 0)
+	{
+		return false;
+	}
+
+	// floor(log2(max(width, height))) + 1
+	uint32_t maxMipMapCount = 1;
+	for (int32_t levelSize = std::max(width, height); levelSize > 1; levelSize /= 2)
+	{
+		maxMipMapCount++;
+	}
+
+	if (mipMapCount > maxMipMapCount)
+	{
+		Effekseer::Log(Effekseer::LogType::Error, "The mipmap count of DDS is invalid.(" + std::to_string(dds.dwMipMapCount) + ")");
+		return false;
+	}
+
+	const auto end = reinterpret_cast<const uint8_t*>(data) + size;
+
+	// levels are arranged from the first level in the file, so they are copied at once
+	if (dst != nullptr)
 	{
-		int32_t textureSize{};
+		size_t levelsSize = 0;
+		for (uint32_t i = 0; i < mipMapCount; i++)
+		{
+			levelsSize += Effekseer::Backend::GetTextureMipLevelSize(format, width, height, i);
+		}
 
-		if (isCompressed)
+		if (static_cast<size_t>(end - p) < levelsSize)
 		{
-			textureSize = ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
+			return false;
 		}
-		else
+
+		dst->assign(p, p + levelsSize);
+		mipLevelCount_ = static_cast<int32_t>(mipMapCount);
+		textureWidth = width;
+		textureHeight = height;
+		return true;
+	}
+
+	textures_.reserve(mipMapCount);
+
+	for (size_t i = 0; i < mipMapCount; i++)
+	{
+		const int32_t textureSize = Effekseer::Backend::GetTextureMipLevelSize(format, width, height, 0);
+
+		if (end - p < textureSize)
 		{
-			textureSize = width * height * blockSize;
+			return false;
 		}
 
 		::Effekseer::CustomVector<uint8_t> textureData;
@@ -247,6 +326,7 @@ bool DDSTextureLoader::Load(const void* data, int32_t size)
 
 	textureWidth = static_cast<int32_t>(dds.dwWidth);
 	textureHeight = static_cast<int32_t>(dds.dwHeight);
+	mipLevelCount_ = static_cast<int32_t>(mipMapCount);
 
 	return true;
 }
@@ -31,11 +31,22 @@ private:
 
 	int32_t textureWidth = 0;
 	int32_t textureHeight = 0;
+	int32_t mipLevelCount_ = 0;
 	Effekseer::TextureFormatType textureFormatType = Effekseer::TextureFormatType::ABGR8;
 	Effekseer::Backend::TextureFormatType backendTextureFormatType = Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
 
+	bool LoadInternal(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>* dst);
+
 public:
 	bool Load(const void* data, int32_t size);
+
+	/**
+		@brief	Load all levels into dst without copying them into textures
+		@note
+		Levels are arranged from the first level.
+	*/
+	bool Load(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>& dst);
+
 	void Unload();
 
 	const ::Effekseer::CustomVector<Texture>& GetTextures() const
@@ -43,6 +54,21 @@ public:
 		return textures_;
 	}
 
+	int32_t GetWidth() const
+	{
+		return textureWidth;
+	}
+
+	int32_t GetHeight() const
+	{
+		return textureHeight;
+	}
+
+	int32_t GetMipLevelCount() const
+	{
+		return mipLevelCount_;
+	}
+
 	Effekseer::TextureFormatType GetTextureFormat()
 	{
 		return textureFormatType;
@@ -0,0 +1,213 @@
+#include "EffekseerRenderer.KTX2TextureLoader.h"
+#include <string.h>
+
+namespace EffekseerRenderer
+{
+
+namespace
+{
+
+const uint8_t KTX2Identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+
+struct KTX2Header
+{
+	uint8_t identifier[12];
+	uint32_t vkFormat;
+	uint32_t typeSize;
+	uint32_t pixelWidth;
+	uint32_t pixelHeight;
+	uint32_t pixelDepth;
+	uint32_t layerCount;
+	uint32_t faceCount;
+	uint32_t levelCount;
+	uint32_t supercompressionScheme;
+	uint32_t dfdByteOffset;
+	uint32_t dfdByteLength;
+	uint32_t kvdByteOffset;
+	uint32_t kvdByteLength;
+	uint64_t sgdByteOffset;
+	uint64_t sgdByteLength;
+};
+
+struct KTX2LevelIndex
+{
+	uint64_t byteOffset;
+	uint64_t byteLength;
+	uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(KTX2Header) == 80, "Invalid header size");
+static_assert(sizeof(KTX2LevelIndex) == 24, "Invalid level index size");
+
+bool ConvertVkFormat(uint32_t vkFormat, Effekseer::Backend::TextureFormatType& format)
+{
+	using Format = Effekseer::Backend::TextureFormatType;
+
+	switch (vkFormat)
+	{
+	case 37: // VK_FORMAT_R8G8B8A8_UNORM
+		format = Format::R8G8B8A8_UNORM;
+		return true;
+	case 43: // VK_FORMAT_R8G8B8A8_SRGB
+		format = Format::R8G8B8A8_UNORM_SRGB;
+		return true;
+	case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+	case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+		format = Format::BC1;
+		return true;
+	case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+	case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+		format = Format::BC1_SRGB;
+		return true;
+	case 135: // VK_FORMAT_BC2_UNORM_BLOCK
+		format = Format::BC2;
+		return true;
+	case 136: // VK_FORMAT_BC2_SRGB_BLOCK
+		format = Format::BC2_SRGB;
+		return true;
+	case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+		format = Format::BC3;
+		return true;
+	case 138: // VK_FORMAT_BC3_SRGB_BLOCK
+		format = Format::BC3_SRGB;
+		return true;
+	case 139: // VK_FORMAT_BC4_UNORM_BLOCK
+		format = Format::BC4;
+		return true;
+	case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+		format = Format::BC5;
+		return true;
+	case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+		format = Format::BC7;
+		return true;
+	case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+		format = Format::BC7_SRGB;
+		return true;
+	case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+		format = Format::ETC2_RGB8;
+		return true;
+	case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+		format = Format::ETC2_RGB8_SRGB;
+		return true;
+	case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+		format = Format::ETC2_RGBA8;
+		return true;
+	case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+		format = Format::ETC2_RGBA8_SRGB;
+		return true;
+	case 157: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+		format = Format::ASTC_4x4;
+		return true;
+	case 158: // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+		format = Format::ASTC_4x4_SRGB;
+		return true;
+	case 165: // VK_FORMAT_ASTC_6x6_UNORM_BLOCK
+		format = Format::ASTC_6x6;
+		return true;
+	case 166: // VK_FORMAT_ASTC_6x6_SRGB_BLOCK
+		format = Format::ASTC_6x6_SRGB;
+		return true;
+	case 171: // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+		format = Format::ASTC_8x8;
+		return true;
+	case 172: // VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+		format = Format::ASTC_8x8_SRGB;
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace
+
+bool KTX2TextureLoader::IsKTX2(const void* data, int32_t size)
+{
+	return size >= static_cast<int32_t>(sizeof(KTX2Identifier)) && memcmp(data, KTX2Identifier, sizeof(KTX2Identifier)) == 0;
+}
+
+bool KTX2TextureLoader::Load(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	if (!IsKTX2(data, size) || size < static_cast<int32_t>(sizeof(KTX2Header)))
+	{
+		return false;
+	}
+
+	auto p = static_cast<const uint8_t*>(data);
+
+	KTX2Header header;
+	memcpy(&header, p, sizeof(KTX2Header));
+
+	if (header.supercompressionScheme != 0)
+	{
+		Effekseer::Log(Effekseer::LogType::Error, "Supercompressed KTX2 files are not supported.");
+		return false;
+	}
+
+	if (header.pixelWidth == 0 || header.pixelHeight == 0 || header.pixelDepth != 0 || header.layerCount > 1 || header.faceCount != 1)
+	{
+		Effekseer::Log(Effekseer::LogType::Error, "Only 2D KTX2 textures are supported.");
+		return false;
+	}
+
+	Effekseer::Backend::TextureFormatType format;
+	if (!ConvertVkFormat(header.vkFormat, format))
+	{
+		Effekseer::Log(Effekseer::LogType::Error, "The format of KTX2 is not supported.(" + std::to_string(header.vkFormat) + ")");
+		return false;
+	}
+
+	const int32_t width = static_cast<int32_t>(header.pixelWidth);
+	const int32_t height = static_cast<int32_t>(header.pixelHeight);
+	const int32_t levelCount = Effekseer::Max(static_cast<int32_t>(header.levelCount), 1);
+
+	// floor(log2(max(width, height))) + 1
+	int32_t maxLevelCount = 1;
+	for (int32_t levelSize = Effekseer::Max(width, height); levelSize > 1; levelSize /= 2)
+	{
+		maxLevelCount++;
+	}
+
+	if (header.levelCount > static_cast<uint32_t>(maxLevelCount))
+	{
+		Effekseer::Log(Effekseer::LogType::Error, "The level count of KTX2 is invalid.(" + std::to_string(header.levelCount) + ")");
+		return false;
+	}
+
+	const size_t levelIndexOffset = sizeof(KTX2Header);
+	if (levelIndexOffset + sizeof(KTX2LevelIndex) * levelCount > static_cast<size_t>(size))
+	{
+		return false;
+	}
+
+	size_t totalSize = 0;
+	for (int32_t level = 0; level < levelCount; level++)
+	{
+		totalSize += Effekseer::Backend::GetTextureMipLevelSize(format, width, height, level);
+	}
+
+	dst.resize(totalSize);
+
+	size_t offset = 0;
+	for (int32_t level = 0; level < levelCount; level++)
+	{
+		KTX2LevelIndex index;
+		memcpy(&index, p + levelIndexOffset + sizeof(KTX2LevelIndex) * level, sizeof(KTX2LevelIndex));
+
+		const auto levelSize = static_cast<uint64_t>(Effekseer::Backend::GetTextureMipLevelSize(format, width, height, level));
+		if (index.byteLength != levelSize || index.byteOffset > static_cast<uint64_t>(size) || index.byteLength > static_cast<uint64_t>(size) - index.byteOffset)
+		{
+			return false;
+		}
+
+		memcpy(dst.data() + offset, p + index.byteOffset, static_cast<size_t>(levelSize));
+		offset += static_cast<size_t>(levelSize);
+	}
+
+	textureWidth_ = width;
+	textureHeight_ = height;
+	mipLevelCount_ = header.levelCount == 0 ? 0 : levelCount;
+	backendTextureFormatType_ = format;
+	return true;
+}
+
+} // namespace EffekseerRenderer
@@ -0,0 +1,57 @@
+#ifndef __EFFEKSEERRENDERER_KTX2_TEXTURE_LOADER_H__
+#define __EFFEKSEERRENDERER_KTX2_TEXTURE_LOADER_H__
+
+#include <Effekseer.h>
+#include <stdint.h>
+
+namespace EffekseerRenderer
+{
+
+/**
+	@brief	A loader of KTX2 files
+	@note
+	Supercompressed files, cube maps, arrays and 3D textures are not supported.
+*/
+class KTX2TextureLoader
+{
+private:
+	int32_t textureWidth_ = 0;
+	int32_t textureHeight_ = 0;
+	int32_t mipLevelCount_ = 0;
+	Effekseer::Backend::TextureFormatType backendTextureFormatType_ = Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
+
+public:
+	static bool IsKTX2(const void* data, int32_t size);
+
+	/**
+		@brief	Load all levels into dst
+		@note
+		Levels are arranged from the first level.
+	*/
+	bool Load(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>& dst);
+
+	int32_t GetWidth() const
+	{
+		return textureWidth_;
+	}
+
+	int32_t GetHeight() const
+	{
+		return textureHeight_;
+	}
+
+	//! 0 means that mipmaps should be generated
+	int32_t GetMipLevelCount() const
+	{
+		return mipLevelCount_;
+	}
+
+	Effekseer::Backend::TextureFormatType GetBackendTextureFormat() const
+	{
+		return backendTextureFormatType_;
+	}
+};
+
+} // namespace EffekseerRenderer
+
+#endif // __EFFEKSEERRENDERER_KTX2_TEXTURE_LOADER_H__
@@ -223,6 +223,20 @@ enum class ModelRendererVertexType
 	Single,
 };
 
+/**
+	@brief	per-instance data which is stored into an instance buffer
+	@note
+	ModelMatrix contains the first three columns of a model matrix because the last column is always (0, 0, 0, 1)
+*/
+struct ModelRendererInstanceData
+{
+	float ModelMatrix[3][4];
+	float ModelUV[4];
+	::Effekseer::Color ModelColor;
+};
+
+static_assert(sizeof(ModelRendererInstanceData) == 68, "ModelRendererInstanceData must be packed");
+
 class ModelRendererBase : public ::Effekseer::ModelRenderer, public ::Effekseer::SIMD::AlignedAllocationPolicy<16>
 {
 protected:
@@ -270,8 +284,38 @@ protected:
 	int32_t customData1Count_ = 0;
 	int32_t customData2Count_ = 0;
 
+	//! if it is true, built-in shaders read per-instance data from an instance buffer and all instances are drawn at once
+	bool isInstanceBufferEnabled_ = false;
+	std::vector<ModelRendererInstanceData> instanceData_;
+
 	ShaderParameterCollector collector_;
 
+	//! whether all instances refer the same frame of a model
+	bool IsModelFrameSame(int32_t frameCount) const
+	{
+		if (m_times.size() == 0)
+			return true;
+
+		auto stTime0 = m_times[0] % frameCount;
+
+		for (auto t : m_times)
+		{
+			if (t % frameCount != stTime0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+		@brief	upload per-instance data and draw all instances. it is called only if isInstanceBufferEnabled_ is true
+	*/
+	virtual void DrawWithInstanceBuffer(const ModelRendererInstanceData* data, int32_t instanceCount, int32_t vertexCount, int32_t indexCount)
+	{
+	}
+
 	void ColorToFloat4(::Effekseer::Color color, float fc[4])
 	{
 		fc[0] = color.R / 255.0f;
@@ -838,13 +882,19 @@ public:
 		if (param.ModelIndex < 0)
 			return;
 
-		if (renderer->GetExternalShaderSettings() == nullptr)
-		{
-			shader_unlit->OverrideShader(nullptr);
-		}
-		else
+		PROFILER_BLOCK("ModelRenderer::EndRendering", profiler::colors::Blue300);
+
+		// shaders which are not used may be nullptr
+		if (shader_unlit != nullptr)
 		{
-			shader_unlit->OverrideShader(renderer->GetExternalShaderSettings()->ModelShader);
+			if (renderer->GetExternalShaderSettings() == nullptr)
+			{
+				shader_unlit->OverrideShader(nullptr);
+			}
+			else
+			{
+				shader_unlit->OverrideShader(renderer->GetExternalShaderSettings()->ModelShader);
+			}
 		}
 
 		int32_t renderPassCount = 1;
@@ -1091,17 +1141,7 @@ public:
 
 		// Check time
 		auto stTime0 = m_times[0] % model->GetFrameCount();
-		auto isTimeSame = true;
-
-		for (auto t : m_times)
-		{
-			t = t % model->GetFrameCount();
-			if (t != stTime0)
-			{
-				isTimeSame = false;
-				break;
-			}
-		}
+		auto isTimeSame = IsModelFrameSame(model->GetFrameCount());
 
 		if (Instancing && isTimeSame)
 		{
@@ -1123,20 +1163,17 @@ public:
 
 			renderer->SetLayout(shader_);
 
-			for (size_t loop = 0; loop < m_matrixes.size();)
+			if (isInstanceBufferEnabled_ && !REQUIRE_ADVANCED_DATA && material == nullptr)
 			{
-				int32_t modelCount = Effekseer::Min(static_cast<int32_t>(m_matrixes.size()) - (int32_t)loop, InstanceCount);
+				instanceData_.resize(m_matrixes.size());
 
-				for (int32_t num = 0; num < modelCount; num++)
+				for (size_t i = 0; i < m_matrixes.size(); i++)
 				{
-					vcb->ModelMatrix[num] = m_matrixes[loop + num];
-
-					// DepthParameter
-					::Effekseer::SIMD::Mat44f modelMatrix = vcb->ModelMatrix[num];
+					::Effekseer::SIMD::Mat44f modelMatrix = m_matrixes[i];
 
 					if (param.EnableViewOffset)
 					{
-						ApplyViewOffset(modelMatrix, renderer->GetCameraMatrix(), m_viewOffsetDistance[loop + num]);
+						ApplyViewOffset(modelMatrix, renderer->GetCameraMatrix(), m_viewOffsetDistance[i]);
 					}
 
 					ApplyDepthParameters(modelMatrix,
@@ -1144,66 +1181,116 @@ public:
 										 renderer->GetCameraPosition(),
 										 param.DepthParameterPtr,
 										 param.IsRightHand);
-					vcb->ModelMatrix[num] = ToStruct(modelMatrix);
-
-					vcb->ModelUV[num][0] = m_uv[loop + num].X;
-					vcb->ModelUV[num][1] = m_uv[loop + num].Y;
-					vcb->ModelUV[num][2] = m_uv[loop + num].Width;
-					vcb->ModelUV[num][3] = m_uv[loop + num].Height;
-
-					vcb->SetModelAlphaUV(
-						num, m_alphaUV[loop + num].X, m_alphaUV[loop + num].Y, m_alphaUV[loop + num].Width, m_alphaUV[loop + num].Height);
-					vcb->SetModelUVDistortionUV(num,
-												m_uvDistortionUV[loop + num].X,
-												m_uvDistortionUV[loop + num].Y,
-												m_uvDistortionUV[loop + num].Width,
-												m_uvDistortionUV[loop + num].Height);
-					vcb->SetModelBlendUV(
-						num, m_blendUV[loop + num].X, m_blendUV[loop + num].Y, m_blendUV[loop + num].Width, m_blendUV[loop + num].Height);
-					vcb->SetModelBlendAlphaUV(num,
-											  m_blendAlphaUV[loop + num].X,
-											  m_blendAlphaUV[loop + num].Y,
-											  m_blendAlphaUV[loop + num].Width,
-											  m_blendAlphaUV[loop + num].Height);
-					vcb->SetModelBlendUVDistortionUV(num,
-													 m_blendUVDistortionUV[loop + num].X,
-													 m_blendUVDistortionUV[loop + num].Y,
-													 m_blendUVDistortionUV[loop + num].Width,
-													 m_blendUVDistortionUV[loop + num].Height);
-					vcb->SetModelFlipbookIndexAndNextRate(num, m_flipbookIndexAndNextRate[loop + num]);
-					vcb->SetModelAlphaThreshold(num, m_alphaThreshold[loop + num]);
-
-					ColorToFloat4(m_colors[loop + num], vcb->ModelColor[num]);
-
-					if (cutomData1Ptr != nullptr)
-					{
-						cutomData1Ptr[num * 4 + 0] = customData1_[loop + num][0];
-						cutomData1Ptr[num * 4 + 1] = customData1_[loop + num][1];
-						cutomData1Ptr[num * 4 + 2] = customData1_[loop + num][2];
-						cutomData1Ptr[num * 4 + 3] = customData1_[loop + num][3];
-					}
 
-					if (cutomData2Ptr != nullptr)
+					const auto mat = ToStruct(modelMatrix);
+					auto& data = instanceData_[i];
+
+					for (int32_t c = 0; c < 3; c++)
 					{
-						cutomData2Ptr[num * 4 + 0] = customData2_[loop + num][0];
-						cutomData2Ptr[num * 4 + 1] = customData2_[loop + num][1];
-						cutomData2Ptr[num * 4 + 2] = customData2_[loop + num][2];
-						cutomData2Ptr[num * 4 + 3] = customData2_[loop + num][3];
+						for (int32_t r = 0; r < 4; r++)
+						{
+							data.ModelMatrix[c][r] = mat.Values[r][c];
+						}
 					}
+
+					data.ModelUV[0] = m_uv[i].X;
+					data.ModelUV[1] = m_uv[i].Y;
+					data.ModelUV[2] = m_uv[i].Width;
+					data.ModelUV[3] = m_uv[i].Height;
+					data.ModelColor = m_colors[i];
 				}
 
 				shader_->SetConstantBuffer();
 
-				if (VertexType == ModelRendererVertexType::Instancing)
-				{
-					renderer->DrawPolygonInstanced(model->GetVertexCount(stTime0), model->GetFaceCount(stTime0) * indexPerFace, modelCount);
-				}
-				else
+				DrawWithInstanceBuffer(instanceData_.data(),
+									   static_cast<int32_t>(instanceData_.size()),
+									   model->GetVertexCount(stTime0),
+									   model->GetFaceCount(stTime0) * indexPerFace);
+			}
+			else
+			{
+				for (size_t loop = 0; loop < m_matrixes.size();)
 				{
-					assert(0);
-				}
+					int32_t modelCount = Effekseer::Min(static_cast<int32_t>(m_matrixes.size()) - (int32_t)loop, InstanceCount);
+
+					for (int32_t num = 0; num < modelCount; num++)
+					{
+						vcb->ModelMatrix[num] = m_matrixes[loop + num];
+
+						// DepthParameter
+						::Effekseer::SIMD::Mat44f modelMatrix = vcb->ModelMatrix[num];
+
+						if (param.EnableViewOffset)
+						{
+							ApplyViewOffset(modelMatrix, renderer->GetCameraMatrix(), m_viewOffsetDistance[loop + num]);
+						}
+
+						ApplyDepthParameters(modelMatrix,
+											 renderer->GetCameraFrontDirection(),
+											 renderer->GetCameraPosition(),
+											 param.DepthParameterPtr,
+											 param.IsRightHand);
+						vcb->ModelMatrix[num] = ToStruct(modelMatrix);
+
+						vcb->ModelUV[num][0] = m_uv[loop + num].X;
+						vcb->ModelUV[num][1] = m_uv[loop + num].Y;
+						vcb->ModelUV[num][2] = m_uv[loop + num].Width;
+						vcb->ModelUV[num][3] = m_uv[loop + num].Height;
+
+						vcb->SetModelAlphaUV(
+							num, m_alphaUV[loop + num].X, m_alphaUV[loop + num].Y, m_alphaUV[loop + num].Width, m_alphaUV[loop + num].Height);
+						vcb->SetModelUVDistortionUV(num,
+													m_uvDistortionUV[loop + num].X,
+													m_uvDistortionUV[loop + num].Y,
+													m_uvDistortionUV[loop + num].Width,
+													m_uvDistortionUV[loop + num].Height);
+						vcb->SetModelBlendUV(
+							num, m_blendUV[loop + num].X, m_blendUV[loop + num].Y, m_blendUV[loop + num].Width, m_blendUV[loop + num].Height);
+						vcb->SetModelBlendAlphaUV(num,
+												  m_blendAlphaUV[loop + num].X,
+												  m_blendAlphaUV[loop + num].Y,
+												  m_blendAlphaUV[loop + num].Width,
+												  m_blendAlphaUV[loop + num].Height);
+						vcb->SetModelBlendUVDistortionUV(num,
+														 m_blendUVDistortionUV[loop + num].X,
+														 m_blendUVDistortionUV[loop + num].Y,
+														 m_blendUVDistortionUV[loop + num].Width,
+														 m_blendUVDistortionUV[loop + num].Height);
+						vcb->SetModelFlipbookIndexAndNextRate(num, m_flipbookIndexAndNextRate[loop + num]);
+						vcb->SetModelAlphaThreshold(num, m_alphaThreshold[loop + num]);
+
+						ColorToFloat4(m_colors[loop + num], vcb->ModelColor[num]);
+
+						if (cutomData1Ptr != nullptr)
+						{
+							cutomData1Ptr[num * 4 + 0] = customData1_[loop + num][0];
+							cutomData1Ptr[num * 4 + 1] = customData1_[loop + num][1];
+							cutomData1Ptr[num * 4 + 2] = customData1_[loop + num][2];
+							cutomData1Ptr[num * 4 + 3] = customData1_[loop + num][3];
+						}
+
+						if (cutomData2Ptr != nullptr)
+						{
+							cutomData2Ptr[num * 4 + 0] = customData2_[loop + num][0];
+							cutomData2Ptr[num * 4 + 1] = customData2_[loop + num][1];
+							cutomData2Ptr[num * 4 + 2] = customData2_[loop + num][2];
+							cutomData2Ptr[num * 4 + 3] = customData2_[loop + num][3];
+						}
+					}
 
-				loop += modelCount;
+					shader_->SetConstantBuffer();
+
+					if (VertexType == ModelRendererVertexType::Instancing)
+					{
+						renderer->DrawPolygonInstanced(model->GetVertexCount(stTime0), model->GetFaceCount(stTime0) * indexPerFace, modelCount);
+					}
+					else
+					{
+						assert(0);
+					}
+
+					loop += modelCount;
+				}
 			}
 		}
 		else
@@ -21,7 +21,8 @@ static void PngReadData(png_structp png_ptr, png_bytep data, png_size_t length)
 }
 #endif
 
-bool PngTextureLoader::Load(const void* data, int32_t size, bool rev)
+template <typename BUFFER>
+static bool LoadPng(const void* data, int32_t size, bool rev, BUFFER& textureData, int32_t& textureWidth, int32_t& textureHeight)
 {
 #ifdef __EFFEKSEER_USE_LIBPNG__
 	textureWidth = 0;
@@ -100,7 +101,10 @@ bool PngTextureLoader::Load(const void* data, int32_t size, bool rev)
 	textureWidth = png_get_image_width(png, png_info);
 	textureHeight = png_get_image_height(png, png_info);
 
-	uint8_t* image = new uint8_t[textureWidth * textureHeight * pixelBytes];
+	textureData.resize(textureWidth * textureHeight * 4);
+
+	// rows are read into the destination directly if conversion is not needed
+	uint8_t* image = pixelBytes == 4 ? textureData.data() : new uint8_t[textureWidth * textureHeight * pixelBytes];
 	uint32_t pitch = textureWidth * pixelBytes;
 
 	for (int pass = 0; pass < passes; pass++)
@@ -121,12 +125,10 @@ bool PngTextureLoader::Load(const void* data, int32_t size, bool rev)
 		}
 	}
 
-	textureData.resize(textureWidth * textureHeight * 4);
 	auto imagedst_ = textureData.data();
 
 	if (pixelBytes == 4)
 	{
-		memcpy(imagedst_, image, textureWidth * textureHeight * 4);
 	}
 	else if (pixelBytes == 1)
 	{
@@ -159,7 +161,10 @@ bool PngTextureLoader::Load(const void* data, int32_t size, bool rev)
 		}
 	}
 
-	delete[] image;
+	if (image != imagedst_)
+	{
+		delete[] image;
+	}
 	png_destroy_read_struct(&png, &png_info, nullptr);
 
 	return true;
@@ -237,6 +242,16 @@ bool PngTextureLoader::Load(const void* data, int32_t size, bool rev)
 #endif
 }
 
+bool PngTextureLoader::Load(const void* data, int32_t size, bool rev)
+{
+	return LoadPng(data, size, rev, textureData, textureWidth, textureHeight);
+}
+
+bool PngTextureLoader::Load(const void* data, int32_t size, bool rev, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	return LoadPng(data, size, rev, dst, textureWidth, textureHeight);
+}
+
 void PngTextureLoader::Unload()
 {
 	textureData.clear();
@@ -19,6 +19,12 @@ private:
 
 public:
 	bool Load(const void* data, int32_t size, bool rev);
+
+	/**
+		@brief	Load an image into dst instead of an internal buffer
+	*/
+	bool Load(const void* data, int32_t size, bool rev, ::Effekseer::CustomVector<uint8_t>& dst);
+
 	void Unload();
 
 	std::vector<uint8_t>& GetData()
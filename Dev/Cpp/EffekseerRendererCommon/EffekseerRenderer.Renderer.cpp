@@ -20,6 +20,23 @@ namespace EffekseerRenderer
 #endif
 }
 
+::Effekseer::TextureLoaderRef CreateTextureLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice,
+												  ::Effekseer::FileInterface* fileInterface,
+												  ::Effekseer::ColorSpaceType colorSpaceType,
+												  const ::Effekseer::CustomVector<TextureDecoderRef>& decoders)
+{
+#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
+	auto loader = ::Effekseer::MakeRefPtr<TextureLoader>(gprahicsDevice.Get(), fileInterface, colorSpaceType);
+	for (auto& decoder : decoders)
+	{
+		loader->AddDecoder(decoder);
+	}
+	return loader;
+#else
+	return nullptr;
+#endif
+}
+
 ::Effekseer::ModelLoaderRef CreateModelLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice, ::Effekseer::FileInterface* fileInterface)
 {
 	return ::Effekseer::MakeRefPtr<ModelLoader>(gprahicsDevice, fileInterface);
@@ -42,6 +42,8 @@ protected:
 	Effekseer::CustomAlignedVector<efkRibbonInstanceParam> instances;
 	Effekseer::SplineGenerator spline_left;
 	Effekseer::SplineGenerator spline_right;
+	Effekseer::CustomAlignedVector<efkVector3D> splineLeftValues_;
+	Effekseer::CustomAlignedVector<efkVector3D> splineRightValues_;
 
 	int32_t vertexCount_ = 0;
 	int32_t stride_ = 0;
@@ -466,6 +468,15 @@ protected:
 		{
 			auto& param = instances[loop];
 
+			if (parameter.SplineDivision > 1)
+			{
+				// values in a segment are calculated at once
+				splineLeftValues_.resize(parameter.SplineDivision);
+				splineRightValues_.resize(parameter.SplineDivision);
+				spline_left.GetValues(param.InstanceIndex, parameter.SplineDivision, splineLeftValues_.data());
+				spline_right.GetValues(param.InstanceIndex, parameter.SplineDivision, splineRightValues_.data());
+			}
+
 			for (auto sploop = 0; sploop < parameter.SplineDivision; sploop++)
 			{
 				bool isFirst = param.InstanceIndex == 0 && sploop == 0;
@@ -475,8 +486,9 @@ protected:
 
 				if (parameter.SplineDivision > 1)
 				{
-					verteies[0].Pos = ToStruct(spline_left.GetValue(param.InstanceIndex + sploop / (float)parameter.SplineDivision));
-					verteies[1].Pos = ToStruct(spline_right.GetValue(param.InstanceIndex + sploop / (float)parameter.SplineDivision));
+					// positions on a spline are already transformed
+					verteies[0].Pos = ToStruct(splineLeftValues_[sploop]);
+					verteies[1].Pos = ToStruct(splineRightValues_[sploop]);
 
 					verteies[0].SetColor(Effekseer::Color::Lerp(param.Colors[0], param.Colors[2], percent_instance), FLIP_RGB);
 					verteies[1].SetColor(Effekseer::Color::Lerp(param.Colors[1], param.Colors[3], percent_instance), FLIP_RGB);
@@ -492,35 +504,29 @@ protected:
 						verteies[i].SetFlipbookIndexAndNextRate(param.FlipbookIndexAndNextRate);
 						verteies[i].SetAlphaThreshold(param.AlphaThreshold);
 					}
-				}
-
-				if (parameter.ViewpointDependent)
-				{
-					::Effekseer::SIMD::Mat43f mat = param.SRTMatrix43;
 
-					if (parameter.EnableViewOffset == true)
+					if (parameter.ViewpointDependent)
 					{
-						ApplyViewOffset(mat, camera, param.ViewOffsetDistance);
-					}
+						::Effekseer::SIMD::Mat43f mat = param.SRTMatrix43;
 
-					::Effekseer::SIMD::Vec3f s;
-					::Effekseer::SIMD::Mat43f r;
-					::Effekseer::SIMD::Vec3f t;
-					mat.GetSRT(s, r, t);
+						if (parameter.EnableViewOffset == true)
+						{
+							ApplyViewOffset(mat, camera, param.ViewOffsetDistance);
+						}
 
-					ApplyDepthParameters(r,
-										 t,
-										 s,
-										 m_renderer->GetCameraFrontDirection(),
-										 m_renderer->GetCameraPosition(),
-										 parameter.DepthParameterPtr,
-										 parameter.IsRightHand);
+						::Effekseer::SIMD::Vec3f s;
+						::Effekseer::SIMD::Mat43f r;
+						::Effekseer::SIMD::Vec3f t;
+						mat.GetSRT(s, r, t);
+
+						ApplyDepthParameters(r,
+											 t,
+											 s,
+											 m_renderer->GetCameraFrontDirection(),
+											 m_renderer->GetCameraPosition(),
+											 parameter.DepthParameterPtr,
+											 parameter.IsRightHand);
 
-					if (parameter.SplineDivision > 1)
-					{
-					}
-					else
-					{
 						for (int i = 0; i < 2; i++)
 						{
 							verteies[i].Pos.X = verteies[i].Pos.X * s.GetX();
@@ -554,12 +560,6 @@ protected:
 							verteies[i].Pos = ToStruct(::Effekseer::SIMD::Vec3f::Transform(verteies[i].Pos, mat_rot));
 						}
 					}
-				}
-				else
-				{
-					if (parameter.SplineDivision > 1)
-					{
-					}
 					else
 					{
 						::Effekseer::SIMD::Mat43f mat = param.SRTMatrix43;
@@ -904,6 +904,17 @@ public:
 	{
 		Rendering_(parameter, instanceParameter, m_renderer->GetCameraMatrix());
 	}
+
+	void Rendering(const efkRibbonNodeParam& parameter, const efkRibbonInstanceParam* instanceParameters, int32_t count, void* userData) override
+	{
+		PROFILER_BLOCK("RibbonRenderer::Rendering", profiler::colors::Blue300);
+
+		const auto cameraMat = m_renderer->GetCameraMatrix();
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering_(parameter, instanceParameters[i], cameraMat);
+		}
+	}
 };
 //----------------------------------------------------------------------------------
 //
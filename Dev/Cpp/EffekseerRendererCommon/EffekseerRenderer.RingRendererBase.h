@@ -723,6 +723,22 @@ public:
 		Rendering_(parameter, instanceParameter, m_renderer->GetCameraMatrix());
 	}
 
+	void Rendering(const efkRingNodeParam& parameter, const efkRingInstanceParam* instanceParameters, int32_t count, void* userData) override
+	{
+		if (m_ringBufferData == nullptr)
+			return;
+
+		PROFILER_BLOCK("RingRenderer::Rendering", profiler::colors::Blue300);
+
+		const auto cameraMat = m_renderer->GetCameraMatrix();
+		for (int32_t i = 0; i < count; i++)
+		{
+			if (m_spriteCount + 2 * parameter.VertexCount > m_renderer->GetSquareMaxCount())
+				return;
+			Rendering_(parameter, instanceParameters[i], cameraMat);
+		}
+	}
+
 	void EndRendering(const efkRingNodeParam& parameter, void* userData)
 	{
 		if (m_ringBufferData == nullptr)
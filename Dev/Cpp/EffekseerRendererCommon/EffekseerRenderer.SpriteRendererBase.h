@@ -455,6 +455,22 @@ public:
 		Rendering_(parameter, instanceParameter, m_renderer->GetCameraMatrix());
 	}
 
+	void Rendering(const efkSpriteNodeParam& parameter, const efkSpriteInstanceParam* instanceParameters, int32_t count, void* userData) override
+	{
+		if (m_ringBufferData == nullptr)
+			return;
+
+		PROFILER_BLOCK("SpriteRenderer::Rendering", profiler::colors::Blue300);
+
+		const auto cameraMat = m_renderer->GetCameraMatrix();
+		for (int32_t i = 0; i < count; i++)
+		{
+			if (m_spriteCount == m_renderer->GetSquareMaxCount())
+				return;
+			Rendering_(parameter, instanceParameters[i], cameraMat);
+		}
+	}
+
 	void EndRendering(const efkSpriteNodeParam& parameter, void* userData) override
 	{
 		if (m_ringBufferData == nullptr)
@@ -438,6 +438,8 @@ public:
 		if (vertexCacheOffset_ == 0)
 			return;
 
+		PROFILER_BLOCK("StandardRenderer::Rendering", profiler::colors::Blue500);
+
 		int cpuBufStart = INT_MAX;
 		int cpuBufEnd = 0;
 
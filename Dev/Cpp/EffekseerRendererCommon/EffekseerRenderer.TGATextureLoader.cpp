@@ -4,13 +4,19 @@
 namespace EffekseerRenderer
 {
 
-bool TGATextureLoader::Load(const void* data, int32_t size)
+template <typename BUFFER>
+static bool LoadTGA(const void* data, int32_t size, BUFFER& textureData, int32_t& textureWidth, int32_t& textureHeight)
 {
 	uint8_t* data_texture = (uint8_t*)data;
 
 	const int TGA_HEADER_SIZE = 18;
 	uint8_t TgaHeader[TGA_HEADER_SIZE];
 
+	if (size < TGA_HEADER_SIZE)
+	{
+		return false;
+	}
+
 	// tga ヘッダー読み込み
 	for (int i = 0; i < TGA_HEADER_SIZE; i++)
 	{
@@ -39,6 +45,11 @@ bool TGATextureLoader::Load(const void* data, int32_t size)
 		return false;
 	}
 
+	if (size - TGA_HEADER_SIZE < textureWidth * textureHeight * ColorStep)
+	{
+		return false;
+	}
+
 	// カラーマップ取得
 	int MapSize = textureWidth * textureHeight * 4;
 	textureData.resize(MapSize);
@@ -90,6 +101,16 @@ bool TGATextureLoader::Load(const void* data, int32_t size)
 	return true;
 }
 
+bool TGATextureLoader::Load(const void* data, int32_t size)
+{
+	return LoadTGA(data, size, textureData, textureWidth, textureHeight);
+}
+
+bool TGATextureLoader::Load(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	return LoadTGA(data, size, dst, textureWidth, textureHeight);
+}
+
 void TGATextureLoader::Unload()
 {
 	textureData.clear();
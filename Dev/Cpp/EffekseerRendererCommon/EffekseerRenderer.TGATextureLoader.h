@@ -19,6 +19,12 @@ private:
 
 public:
 	bool Load(const void* data, int32_t size);
+
+	/**
+		@brief	Load an image into dst instead of an internal buffer
+	*/
+	bool Load(const void* data, int32_t size, ::Effekseer::CustomVector<uint8_t>& dst);
+
 	void Unload();
 
 	void Initialize();
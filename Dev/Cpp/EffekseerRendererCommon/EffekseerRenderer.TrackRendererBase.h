@@ -40,6 +40,7 @@ protected:
 	efkTrackNodeParam innstancesNodeParam;
 	Effekseer::CustomAlignedVector<efkTrackInstanceParam> instances;
 	Effekseer::SplineGenerator spline;
+	Effekseer::CustomAlignedVector<efkVector3D> splineValues_;
 
 	int32_t vertexCount_ = 0;
 	int32_t stride_ = 0;
@@ -487,28 +488,35 @@ protected:
 		{
 			auto& param = instances[loop];
 
-			for (int32_t sploop = 0; sploop < parameter.SplineDivision; sploop++)
+			auto mat = param.SRTMatrix43;
+
+			if (parameter.EnableViewOffset == true)
 			{
-				auto mat = param.SRTMatrix43;
+				ApplyViewOffset(mat, camera, param.ViewOffsetDistance);
+			}
 
-				if (parameter.EnableViewOffset == true)
-				{
-					ApplyViewOffset(mat, camera, param.ViewOffsetDistance);
-				}
+			::Effekseer::SIMD::Vec3f s;
+			::Effekseer::SIMD::Mat43f r;
+			::Effekseer::SIMD::Vec3f t;
+			mat.GetSRT(s, r, t);
 
-				::Effekseer::SIMD::Vec3f s;
-				::Effekseer::SIMD::Mat43f r;
-				::Effekseer::SIMD::Vec3f t;
-				mat.GetSRT(s, r, t);
+			ApplyDepthParameters(r,
+								 t,
+								 s,
+								 m_renderer->GetCameraFrontDirection(),
+								 m_renderer->GetCameraPosition(),
+								 parameter.DepthParameterPtr,
+								 parameter.IsRightHand);
 
-				ApplyDepthParameters(r,
-									 t,
-									 s,
-									 m_renderer->GetCameraFrontDirection(),
-									 m_renderer->GetCameraPosition(),
-									 parameter.DepthParameterPtr,
-									 parameter.IsRightHand);
+			if (parameter.SplineDivision > 1)
+			{
+				// values in a segment are calculated at once
+				splineValues_.resize(parameter.SplineDivision);
+				spline.GetValues(param.InstanceIndex, parameter.SplineDivision, splineValues_.data());
+			}
 
+			for (int32_t sploop = 0; sploop < parameter.SplineDivision; sploop++)
+			{
 				bool isFirst = param.InstanceIndex == 0 && sploop == 0;
 				bool isLast = param.InstanceIndex == (param.InstanceCount - 1);
 
@@ -606,7 +614,7 @@ protected:
 
 				if (parameter.SplineDivision > 1)
 				{
-					v[1].Pos = ToStruct(spline.GetValue(param.InstanceIndex + sploop / (float)parameter.SplineDivision));
+					v[1].Pos = ToStruct(splineValues_[sploop]);
 				}
 				else
 				{
@@ -935,6 +943,17 @@ public:
 		Rendering_(parameter, instanceParameter, m_renderer->GetCameraMatrix());
 	}
 
+	void Rendering(const efkTrackNodeParam& parameter, const efkTrackInstanceParam* instanceParameters, int32_t count, void* userData) override
+	{
+		PROFILER_BLOCK("TrackRenderer::Rendering", profiler::colors::Blue300);
+
+		const auto cameraMat = m_renderer->GetCameraMatrix();
+		for (int32_t i = 0; i < count; i++)
+		{
+			Rendering_(parameter, instanceParameters[i], cameraMat);
+		}
+	}
+
 	void BeginRenderingGroup(const efkTrackNodeParam& param, int32_t count, void* userData) override
 	{
 		m_ribbonCount = 0;
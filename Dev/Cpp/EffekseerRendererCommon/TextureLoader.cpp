@@ -1,10 +1,99 @@
 ﻿#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
 
 #include "TextureLoader.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace EffekseerRenderer
 {
 
+//! the maximum number of threads which decode textures including the calling thread
+static const int32_t MaxDecodingThreadCount = 8;
+
+bool PngTextureDecoder::Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	auto data_texture = static_cast<const uint8_t*>(data);
+
+	if (size < 4 || data_texture[1] != 'P' || data_texture[2] != 'N' || data_texture[3] != 'G')
+	{
+		return false;
+	}
+
+	::EffekseerRenderer::PngTextureLoader loader;
+	if (!loader.Load(data, size, false, dst))
+	{
+		return false;
+	}
+
+	param.Size[0] = loader.GetWidth();
+	param.Size[1] = loader.GetHeight();
+	param.Format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
+	param.MipLevelCount = 0;
+	param.Dimension = 2;
+	return true;
+}
+
+bool DDSTextureDecoder::Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	auto data_texture = static_cast<const uint8_t*>(data);
+
+	if (size < 4 || data_texture[0] != 'D' || data_texture[1] != 'D' || data_texture[2] != 'S' || data_texture[3] != ' ')
+	{
+		return false;
+	}
+
+	::EffekseerRenderer::DDSTextureLoader loader;
+	if (!loader.Load(data, size, dst))
+	{
+		return false;
+	}
+
+	param.Size[0] = loader.GetWidth();
+	param.Size[1] = loader.GetHeight();
+	param.Format = loader.GetBackendTextureFormat();
+	param.MipLevelCount = loader.GetMipLevelCount();
+	param.Dimension = 2;
+	return true;
+}
+
+bool KTX2TextureDecoder::Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	if (!::EffekseerRenderer::KTX2TextureLoader::IsKTX2(data, size))
+	{
+		return false;
+	}
+
+	::EffekseerRenderer::KTX2TextureLoader loader;
+	if (!loader.Load(data, size, dst))
+	{
+		return false;
+	}
+
+	param.Size[0] = loader.GetWidth();
+	param.Size[1] = loader.GetHeight();
+	param.Format = loader.GetBackendTextureFormat();
+	param.MipLevelCount = loader.GetMipLevelCount();
+	param.Dimension = 2;
+	return true;
+}
+
+bool TGATextureDecoder::Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst)
+{
+	::EffekseerRenderer::TGATextureLoader loader;
+	if (!loader.Load(data, size, dst))
+	{
+		return false;
+	}
+
+	param.Size[0] = loader.GetWidth();
+	param.Size[1] = loader.GetHeight();
+	param.Format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
+	param.MipLevelCount = 0;
+	param.Dimension = 2;
+	return true;
+}
+
 TextureLoader::TextureLoader(::Effekseer::Backend::GraphicsDevice* graphicsDevice,
 							 ::Effekseer::FileInterface* fileInterface,
 							 ::Effekseer::ColorSpaceType colorSpaceType)
@@ -17,6 +106,12 @@ TextureLoader::TextureLoader(::Effekseer::Backend::GraphicsDevice* graphicsDevic
 	{
 		m_fileInterface = &m_defaultFileInterface;
 	}
+
+	// TGA doesn't have a signature, so it must be last
+	decoders_.emplace_back(::Effekseer::MakeRefPtr<PngTextureDecoder>());
+	decoders_.emplace_back(::Effekseer::MakeRefPtr<DDSTextureDecoder>());
+	decoders_.emplace_back(::Effekseer::MakeRefPtr<KTX2TextureDecoder>());
+	decoders_.emplace_back(::Effekseer::MakeRefPtr<TGATextureDecoder>());
 }
 
 TextureLoader::~TextureLoader()
@@ -24,6 +119,17 @@ TextureLoader::~TextureLoader()
 	ES_SAFE_RELEASE(graphicsDevice_);
 }
 
+void TextureLoader::AddDecoder(TextureDecoderRef decoder)
+{
+	if (decoder == nullptr)
+	{
+		return;
+	}
+
+	decoders_.insert(decoders_.begin() + builtinDecoderOffset_, decoder);
+	builtinDecoderOffset_++;
+}
+
 Effekseer::TextureRef TextureLoader::Load(const char16_t* path, ::Effekseer::TextureType textureType)
 {
 	std::unique_ptr<::Effekseer::FileReader> reader(m_fileInterface->OpenRead(path));
@@ -34,10 +140,10 @@ Effekseer::TextureRef TextureLoader::Load(const char16_t* path, ::Effekseer::Tex
 		auto isMipEnabled = path16.find(u"_NoMip") == std::u16string::npos;
 
 		size_t fileSize = reader->GetLength();
-		std::vector<uint8_t> fileData(fileSize);
-		reader->Read(fileData.data(), fileSize);
+		fileBuffer_.resize(fileSize);
+		reader->Read(fileBuffer_.data(), fileSize);
 
-		auto texture = Load(fileData.data(), static_cast<int32_t>(fileSize), textureType, isMipEnabled);
+		auto texture = Load(fileBuffer_.data(), static_cast<int32_t>(fileSize), textureType, isMipEnabled);
 		return texture;
 	}
 
@@ -46,107 +152,146 @@ Effekseer::TextureRef TextureLoader::Load(const char16_t* path, ::Effekseer::Tex
 
 Effekseer::TextureRef TextureLoader::Load(const void* data, int32_t size, Effekseer::TextureType textureType, bool isMipMapEnabled)
 {
-	auto size_texture = size;
-	auto data_texture = (uint8_t*)data;
+	::Effekseer::Backend::TextureParameter param;
+	if (!Decode(data, size, textureType, isMipMapEnabled, param, decodedBuffer_))
+	{
+		return nullptr;
+	}
+
+	return CreateTexture(param, decodedBuffer_);
+}
 
-	if (size_texture < 4)
+void TextureLoader::Load(const char16_t* const* paths, const ::Effekseer::TextureType* textureTypes, int32_t count, Effekseer::TextureRef* textures)
+{
+	// threads are reused among batches. the calling thread also decodes
+	if (!isWorkerThreadsLaunched_ && count > 1)
 	{
+		const auto hardwareThreadCount = static_cast<int32_t>(std::thread::hardware_concurrency());
+		workerThreads_.resize(std::max(std::min(hardwareThreadCount, MaxDecodingThreadCount) - 1, 0));
+		for (auto& worker : workerThreads_)
+		{
+			worker.Launch();
+		}
+		isWorkerThreadsLaunched_ = true;
 	}
-	else if (data_texture[1] == 'P' && data_texture[2] == 'N' && data_texture[3] == 'G')
+
+	const int32_t threadCount = std::min(count, static_cast<int32_t>(workerThreads_.size()) + 1);
+
+	// buffers are reused when textures are not decoded in parallel
+	if (threadCount <= 1)
 	{
-		if (pngTextureLoader_.Load(data_texture, size_texture, false))
+		for (int32_t i = 0; i < count; i++)
 		{
-			// Newbackend
-			{
-				::Effekseer::Backend::TextureFormatType format;
-				if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
-				}
-				else
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
-				}
-
-				::Effekseer::Backend::TextureParameter param;
-				param.Size[0] = pngTextureLoader_.GetWidth();
-				param.Size[1] = pngTextureLoader_.GetHeight();
-				param.Format = format;
-				param.MipLevelCount = isMipMapEnabled ? 0 : 1;
-				param.Dimension = 2;
-
-				Effekseer::CustomVector<uint8_t> initialData;
-				initialData.assign(pngTextureLoader_.GetData().begin(), pngTextureLoader_.GetData().end());
-
-				auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
-				texture->SetBackend(graphicsDevice_->CreateTexture(param, initialData));
-				return texture;
-			}
+			textures[i] = Load(paths[i], textureTypes[i]);
 		}
+		return;
 	}
-	else if (data_texture[0] == 'D' && data_texture[1] == 'D' && data_texture[2] == 'S' && data_texture[3] == ' ')
+
+	struct Job
+	{
+		::Effekseer::CustomVector<uint8_t> file;
+		::Effekseer::CustomVector<uint8_t> decoded;
+		::Effekseer::Backend::TextureParameter param;
+		bool isMipMapEnabled = true;
+		bool isRead = false;
+		bool isDecoded = false;
+	};
+
+	// files are read on this thread because a file interface may not be thread safe
+	::Effekseer::CustomVector<Job> jobs(count);
+	for (int32_t i = 0; i < count; i++)
 	{
-		// Newbackend
-		if (ddsTextureLoader_.Load(data_texture, size_texture))
+		std::unique_ptr<::Effekseer::FileReader> reader(m_fileInterface->OpenRead(paths[i]));
+		if (reader.get() == nullptr)
 		{
-			::Effekseer::Backend::TextureFormatType format;
-			if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
-			{
-				format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
-			}
-			else
+			continue;
+		}
+
+		auto path16 = std::u16string(paths[i]);
+		jobs[i].isMipMapEnabled = path16.find(u"_NoMip") == std::u16string::npos;
+
+		size_t fileSize = reader->GetLength();
+		jobs[i].file.resize(fileSize);
+		reader->Read(jobs[i].file.data(), fileSize);
+		jobs[i].isRead = true;
+	}
+
+	// images are decoded in parallel
+	std::atomic<int32_t> next(0);
+	auto decode = [&]() {
+		for (int32_t i = next++; i < count; i = next++)
+		{
+			auto& job = jobs[i];
+			if (job.isRead)
 			{
-				format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
+				job.isDecoded = Decode(job.file.data(), static_cast<int32_t>(job.file.size()), textureTypes[i], job.isMipMapEnabled, job.param, job.decoded);
 			}
+		}
+	};
 
-			::Effekseer::Backend::TextureParameter param;
-			param.Size[0] = ddsTextureLoader_.GetTextures().at(0).Width;
-			param.Size[1] = ddsTextureLoader_.GetTextures().at(0).Height;
-			param.Dimension = 2;
-			param.Format = ddsTextureLoader_.GetBackendTextureFormat();
+	for (int32_t i = 1; i < threadCount; i++)
+	{
+		workerThreads_[i - 1].RunAsync(decode);
+	}
 
-			Effekseer::CustomVector<uint8_t> initialData;
-			initialData.assign(ddsTextureLoader_.GetTextures().at(0).Data.begin(), ddsTextureLoader_.GetTextures().at(0).Data.end());
-			param.MipLevelCount = 1; // TODO : Support nomipmap
+	decode();
 
-			auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
-			texture->SetBackend(graphicsDevice_->CreateTexture(param, initialData));
-			return texture;
-		}
+	for (int32_t i = 1; i < threadCount; i++)
+	{
+		workerThreads_[i - 1].WaitForComplete();
+	}
+
+	// textures are created on this thread because a graphics device may not be thread safe
+	for (int32_t i = 0; i < count; i++)
+	{
+		textures[i] = jobs[i].isDecoded ? CreateTexture(jobs[i].param, jobs[i].decoded) : nullptr;
 	}
-	else
+}
+
+bool TextureLoader::Decode(const void* data,
+						   int32_t size,
+						   ::Effekseer::TextureType textureType,
+						   bool isMipMapEnabled,
+						   ::Effekseer::Backend::TextureParameter& param,
+						   ::Effekseer::CustomVector<uint8_t>& dst) const
+{
+	for (auto& decoder : decoders_)
 	{
-		if (tgaTextureLoader_.Load(data_texture, size_texture) == true)
+		param = ::Effekseer::Backend::TextureParameter();
+		if (!decoder->Decode(data, size, param, dst))
 		{
-			// Newbackend
-			{
-				::Effekseer::Backend::TextureFormatType format;
-				if (colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear && textureType == Effekseer::TextureType::Color)
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
-				}
-				else
-				{
-					format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM;
-				}
-
-				::Effekseer::Backend::TextureParameter param;
-				param.Size[0] = tgaTextureLoader_.GetWidth();
-				param.Size[1] = tgaTextureLoader_.GetHeight();
-				param.Format = format;
-				param.MipLevelCount = isMipMapEnabled ? 0 : 1;
-				param.Dimension = 2;
-				Effekseer::CustomVector<uint8_t> initialData;
-				initialData.assign(tgaTextureLoader_.GetData().begin(), tgaTextureLoader_.GetData().end());
-
-				auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
-				texture->SetBackend(graphicsDevice_->CreateTexture(param, initialData));
-				return texture;
-			}
+			continue;
+		}
+
+		if (decoder->IsColorSpaceConverted() && colorSpaceType_ == ::Effekseer::ColorSpaceType::Linear &&
+			textureType == Effekseer::TextureType::Color && param.Format == ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM)
+		{
+			param.Format = ::Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM_SRGB;
 		}
+
+		// the first level is arranged at first
+		if (!isMipMapEnabled)
+		{
+			param.MipLevelCount = 1;
+		}
+
+		return true;
 	}
 
-	return nullptr;
+	return false;
+}
+
+Effekseer::TextureRef TextureLoader::CreateTexture(const ::Effekseer::Backend::TextureParameter& param, const ::Effekseer::CustomVector<uint8_t>& data)
+{
+	auto backend = graphicsDevice_->CreateTexture(param, data);
+	if (backend == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto texture = ::Effekseer::MakeRefPtr<::Effekseer::Texture>();
+	texture->SetBackend(backend);
+	return texture;
 }
 
 void TextureLoader::Unload(Effekseer::TextureRef data)
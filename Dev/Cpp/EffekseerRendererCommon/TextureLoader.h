@@ -4,14 +4,51 @@
 #define __EFFEKSEERRENDERER_TEXTURELOADER_H__
 
 #include <Effekseer.h>
+#include <Effekseer/Effekseer.WorkerThread.h>
 
 #include "../EffekseerRendererCommon/EffekseerRenderer.DDSTextureLoader.h"
+#include "../EffekseerRendererCommon/EffekseerRenderer.KTX2TextureLoader.h"
 #include "../EffekseerRendererCommon/EffekseerRenderer.PngTextureLoader.h"
+#include "../EffekseerRendererCommon/EffekseerRenderer.Renderer.h"
 #include "../EffekseerRendererCommon/EffekseerRenderer.TGATextureLoader.h"
 
 namespace EffekseerRenderer
 {
 
+class PngTextureDecoder : public TextureDecoder
+{
+public:
+	bool Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst) override;
+};
+
+class DDSTextureDecoder : public TextureDecoder
+{
+public:
+	bool Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst) override;
+
+	bool IsColorSpaceConverted() const override
+	{
+		return false;
+	}
+};
+
+class KTX2TextureDecoder : public TextureDecoder
+{
+public:
+	bool Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst) override;
+
+	bool IsColorSpaceConverted() const override
+	{
+		return false;
+	}
+};
+
+class TGATextureDecoder : public TextureDecoder
+{
+public:
+	bool Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst) override;
+};
+
 class TextureLoader : public ::Effekseer::TextureLoader
 {
 private:
@@ -19,11 +56,27 @@ private:
 	::Effekseer::DefaultFileInterface m_defaultFileInterface;
 	::Effekseer::ColorSpaceType colorSpaceType_;
 	::Effekseer::Backend::GraphicsDevice* graphicsDevice_ = nullptr;
-#ifdef __EFFEKSEER_RENDERER_INTERNAL_LOADER__
-	::EffekseerRenderer::PngTextureLoader pngTextureLoader_;
-	::EffekseerRenderer::DDSTextureLoader ddsTextureLoader_;
-	::EffekseerRenderer::TGATextureLoader tgaTextureLoader_;
-#endif
+
+	//! decoders added by users are tried before built-in decoders
+	::Effekseer::CustomVector<TextureDecoderRef> decoders_;
+	int32_t builtinDecoderOffset_ = 0;
+
+	//! buffers which are reused among loads
+	::Effekseer::CustomVector<uint8_t> fileBuffer_;
+	::Effekseer::CustomVector<uint8_t> decodedBuffer_;
+
+	//! threads which decode textures in batches. they are launched when they are required at first
+	::Effekseer::CustomVector<::Effekseer::WorkerThread> workerThreads_;
+	bool isWorkerThreadsLaunched_ = false;
+
+	bool Decode(const void* data,
+				int32_t size,
+				::Effekseer::TextureType textureType,
+				bool isMipMapEnabled,
+				::Effekseer::Backend::TextureParameter& param,
+				::Effekseer::CustomVector<uint8_t>& dst) const;
+
+	Effekseer::TextureRef CreateTexture(const ::Effekseer::Backend::TextureParameter& param, const ::Effekseer::CustomVector<uint8_t>& data);
 
 public:
 	TextureLoader(::Effekseer::Backend::GraphicsDevice* graphicsDevice,
@@ -31,11 +84,15 @@ public:
 				  ::Effekseer::ColorSpaceType colorSpaceType = ::Effekseer::ColorSpaceType::Gamma);
 	virtual ~TextureLoader();
 
+	void AddDecoder(TextureDecoderRef decoder);
+
 public:
 	Effekseer::TextureRef Load(const char16_t* path, ::Effekseer::TextureType textureType) override;
 
 	Effekseer::TextureRef Load(const void* data, int32_t size, Effekseer::TextureType textureType, bool isMipMapEnabled) override;
 
+	void Load(const char16_t* const* paths, const ::Effekseer::TextureType* textureTypes, int32_t count, Effekseer::TextureRef* textures) override;
+
 	void Unload(Effekseer::TextureRef data) override;
 };
 
@@ -53,6 +53,8 @@ public:
 
 	virtual void Rendering(const efkModelNodeParam& parameter, const InstanceParameter& instanceParameter, void* userData) override;
 
+	void Rendering(const efkModelNodeParam& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData) override;
+
 	void EndRendering(const efkModelNodeParam& parameter, void* userData);
 };
 //----------------------------------------------------------------------------------
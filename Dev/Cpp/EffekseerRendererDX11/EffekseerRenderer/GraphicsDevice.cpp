@@ -218,6 +218,22 @@ DXGI_FORMAT GetTextureFormatType(Effekseer::Backend::TextureFormatType format)
 	{
 		return DXGI_FORMAT_BC3_UNORM_SRGB;
 	}
+	else if (format == Effekseer::Backend::TextureFormatType::BC4)
+	{
+		return DXGI_FORMAT_BC4_UNORM;
+	}
+	else if (format == Effekseer::Backend::TextureFormatType::BC5)
+	{
+		return DXGI_FORMAT_BC5_UNORM;
+	}
+	else if (format == Effekseer::Backend::TextureFormatType::BC7)
+	{
+		return DXGI_FORMAT_BC7_UNORM;
+	}
+	else if (format == Effekseer::Backend::TextureFormatType::BC7_SRGB)
+	{
+		return DXGI_FORMAT_BC7_UNORM_SRGB;
+	}
 
 	return DXGI_FORMAT_UNKNOWN;
 }
@@ -509,12 +525,7 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 	auto context = graphicsDevice_->GetContext();
 	assert(context != nullptr);
 
-	auto isCompressed = param.Format == Effekseer::Backend::TextureFormatType::BC1 ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC2 ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC3 ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC1_SRGB ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC2_SRGB ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC3_SRGB;
+	auto isCompressed = Effekseer::Backend::IsCompressedTextureFormat(param.Format);
 
 	int32_t sizePerWidth = 0;
 	int32_t height = 0;
@@ -559,7 +570,19 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 		texDesc.BindFlags = bindFlag;
 		texDesc.CPUAccessFlags = 0;
 
-		if (param.MipLevelCount != 1)
+		// initial data may contain all mip levels
+		bool hasAllLevels = false;
+		if (param.MipLevelCount > 1 && texDesc.ArraySize == 1)
+		{
+			size_t levelsSize = 0;
+			for (int32_t level = 0; level < param.MipLevelCount; level++)
+			{
+				levelsSize += Effekseer::Backend::GetTextureMipLevelSize(param.Format, param.Size[0], param.Size[1], level);
+			}
+			hasAllLevels = levelsSize == initialData.size();
+		}
+
+		if (param.MipLevelCount != 1 && !hasAllLevels)
 		{
 			texDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
 		}
@@ -573,7 +596,24 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 
 		bool hasInitData = initialData.size() > 0;
 
-		if (hasInitData)
+		if (hasInitData && hasAllLevels)
+		{
+			data.resize(param.MipLevelCount);
+			size_t offset = 0;
+			for (int32_t level = 0; level < param.MipLevelCount; level++)
+			{
+				int32_t levelSizePerWidth = 0;
+				int32_t levelHeight = 0;
+				EffekseerRenderer::CalculateAlignedTextureInformation(
+					param.Format, {Effekseer::Max(param.Size[0] >> level, 1), Effekseer::Max(param.Size[1] >> level, 1)}, levelSizePerWidth, levelHeight);
+
+				data[level].pSysMem = initialData.data() + offset;
+				data[level].SysMemPitch = levelSizePerWidth;
+				data[level].SysMemSlicePitch = levelSizePerWidth * levelHeight;
+				offset += levelSizePerWidth * levelHeight;
+			}
+		}
+		else if (hasInitData)
 		{
 			data.resize(texDesc.ArraySize);
 			for (int i = 0; i < texDesc.ArraySize; i++)
@@ -584,7 +624,7 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 			}
 		}
 
-		HRESULT hr = device->CreateTexture2D(&texDesc, hasInitData && param.MipLevelCount == 1 ? data.data() : nullptr, &texture);
+		HRESULT hr = device->CreateTexture2D(&texDesc, hasInitData && (param.MipLevelCount == 1 || hasAllLevels) ? data.data() : nullptr, &texture);
 
 		if (FAILED(hr))
 		{
@@ -618,7 +658,7 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 		}
 
 		// Generate mipmap
-		if (param.MipLevelCount != 1)
+		if (param.MipLevelCount != 1 && !hasAllLevels)
 		{
 			if (hasInitData)
 			{
@@ -137,10 +137,63 @@ struct DepthReconstructionParameter
 	float ProjectionMatrix44 = 0.0f;
 };
 
+/**
+	@brief
+	\~English	A decoder of image files which is used by a texture loader created with CreateTextureLoader
+	\~Japanese	CreateTextureLoaderで生成されたテクスチャローダーで使用される画像ファイルのデコーダー
+*/
+class TextureDecoder : public ::Effekseer::ReferenceObject
+{
+public:
+	TextureDecoder() = default;
+	virtual ~TextureDecoder() = default;
+
+	/**
+		@brief
+		\~English	Decode an image into dst. Return false if the image is not supported.
+		\~Japanese	画像をdstにデコードする。対応していない画像の場合、falseを返す。
+		@note
+		\~English	It is called from multiple threads at the same time when textures of an effect are loaded.
+		\~Japanese	エフェクトのテクスチャが読み込まれるとき、複数のスレッドから同時に呼ばれる。
+		@param	data
+		\~English	An image file. It may be a memory mapped file. It is valid only while this function is called.
+		\~Japanese	画像ファイル。メモリマップされたファイルの場合がある。この関数の呼び出し中のみ有効である。
+		@param	param
+		\~English	A parameter to create a texture. MipLevelCount is 0 if mipmaps should be generated.
+		\~Japanese	テクスチャを生成するためのパラメーター。ミップマップを生成する場合、MipLevelCountは0である。
+		@param	dst
+		\~English	A buffer which is reused among images. Resize it and write pixels into it.
+		\~Japanese	画像の間で再利用されるバッファ。リサイズし、ピクセルを書き込む。
+	*/
+	virtual bool Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst) = 0;
+
+	/**
+		@brief
+		\~English	Whether R8G8B8A8_UNORM is converted into R8G8B8A8_UNORM_SRGB for color textures in a linear color space. Return false if images specify a color space.
+		\~Japanese	リニア色空間のカラーテクスチャの場合、R8G8B8A8_UNORMをR8G8B8A8_UNORM_SRGBに変換するか。画像が色空間を指定する場合、falseを返す。
+	*/
+	virtual bool IsColorSpaceConverted() const
+	{
+		return true;
+	}
+};
+
+using TextureDecoderRef = ::Effekseer::RefPtr<TextureDecoder>;
+
 ::Effekseer::TextureLoaderRef CreateTextureLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice,
 												  ::Effekseer::FileInterface* fileInterface = nullptr,
 												  ::Effekseer::ColorSpaceType colorSpaceType = ::Effekseer::ColorSpaceType::Gamma);
 
+/**
+	@brief
+	\~English	Create a texture loader with additional decoders. They are tried before built-in decoders.
+	\~Japanese	追加のデコーダーを持つテクスチャローダーを生成する。それらは組み込みのデコーダーより先に試される。
+*/
+::Effekseer::TextureLoaderRef CreateTextureLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice,
+												  ::Effekseer::FileInterface* fileInterface,
+												  ::Effekseer::ColorSpaceType colorSpaceType,
+												  const ::Effekseer::CustomVector<TextureDecoderRef>& decoders);
+
 ::Effekseer::ModelLoaderRef CreateModelLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice, ::Effekseer::FileInterface* fileInterface = nullptr);
 
 class Renderer : public ::Effekseer::IReference
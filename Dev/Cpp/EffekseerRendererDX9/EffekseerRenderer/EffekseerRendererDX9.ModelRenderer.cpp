@@ -255,6 +255,14 @@ void ModelRenderer::Rendering(const efkModelNodeParam& parameter, const Instance
 	Rendering_<RendererImplemented>(m_renderer.Get(), parameter, instanceParameter, userData);
 }
 
+void ModelRenderer::Rendering(const efkModelNodeParam& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
+{
+	for (int32_t i = 0; i < count; i++)
+	{
+		Rendering_<RendererImplemented>(m_renderer.Get(), parameter, instanceParameters[i], userData);
+	}
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
@@ -71,6 +71,37 @@ enum class OpenGLDeviceType
 	OpenGLES3,
 };
 
+/**
+	@brief
+	\~English	A storage of linked program binaries to skip compiling and linking shaders
+	\~Japanese	シェーダーのコンパイルとリンクを省略するためのプログラムバイナリの保存先
+	@note
+	\~English	Keys are generated from shader codes and a driver. A cache may be shared among graphics devices on other threads.
+	\~Japanese	キーはシェーダーのコードとドライバから生成される。キャッシュは他のスレッドのグラフィックスデバイスと共有してもよい。
+*/
+class ProgramBinaryCache : public ::Effekseer::ReferenceObject
+{
+public:
+	ProgramBinaryCache() = default;
+	virtual ~ProgramBinaryCache() = default;
+
+	/**
+		@brief
+		\~English	Load a binary. Return false if it is not found.
+		\~Japanese	バイナリを読み込む。見つからない場合はfalseを返す。
+	*/
+	virtual bool Load(uint64_t key, ::Effekseer::CustomVector<uint8_t>& data) = 0;
+
+	/**
+		@brief
+		\~English	Save a binary.
+		\~Japanese	バイナリを保存する。
+	*/
+	virtual void Save(uint64_t key, const void* data, int32_t size) = 0;
+};
+
+using ProgramBinaryCacheRef = ::Effekseer::RefPtr<ProgramBinaryCache>;
+
 } // namespace EffekseerRendererGL
 
 #endif // __EFFEKSEERRENDERER_GL_BASE_PRE_H__
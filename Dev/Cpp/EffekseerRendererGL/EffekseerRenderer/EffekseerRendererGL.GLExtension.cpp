@@ -135,6 +135,14 @@ typedef void(EFK_STDCALL* FP_glCopyTexSubImage3D)(GLenum target,
 												  GLsizei width,
 												  GLsizei height);
 
+typedef void(EFK_STDCALL* FP_glGetProgramBinary)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
+
+typedef void(EFK_STDCALL* FP_glProgramBinary)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+
+typedef void(EFK_STDCALL* FP_glProgramParameteri)(GLuint program, GLenum pname, GLint value);
+
+typedef void(EFK_STDCALL* FP_glVertexAttribDivisor)(GLuint index, GLuint divisor);
+
 static FP_glDeleteBuffers g_glDeleteBuffers = nullptr;
 static FP_glCreateShader g_glCreateShader = nullptr;
 static FP_glBindBuffer g_glBindBuffer = nullptr;
@@ -204,6 +212,14 @@ static FP_glTexImage3D g_glTexImage3D = nullptr;
 
 static FP_glCopyTexSubImage3D g_glCopyTexSubImage3D = nullptr;
 
+static FP_glGetProgramBinary g_glGetProgramBinary = nullptr;
+
+static FP_glProgramBinary g_glProgramBinary = nullptr;
+
+static FP_glProgramParameteri g_glProgramParameteri = nullptr;
+
+static FP_glVertexAttribDivisor g_glVertexAttribDivisor = nullptr;
+
 #elif defined(__EFFEKSEER_RENDERER_GLES2__)
 
 typedef void (*FP_glGenVertexArraysOES)(GLsizei n, GLuint* arrays);
@@ -241,6 +257,8 @@ static bool g_isInitialized = false;
 static bool g_isSupportedVertexArray = false;
 static bool g_isSurrpotedBufferRange = false;
 static bool g_isSurrpotedMapBuffer = false;
+static bool g_isSupportedProgramBinary = false;
+static bool g_isSupportedVertexAttribDivisor = false;
 static OpenGLDeviceType g_deviceType = OpenGLDeviceType::OpenGL2;
 
 #if _WIN32
@@ -366,9 +384,19 @@ bool Initialize(OpenGLDeviceType deviceType, bool isExtensionsEnabled)
 
 	GET_PROC_REQ(glCopyTexSubImage3D);
 
+	GET_PROC(glGetProgramBinary);
+
+	GET_PROC(glProgramBinary);
+
+	GET_PROC(glProgramParameteri);
+
+	GET_PROC(glVertexAttribDivisor);
+
 	g_isSupportedVertexArray = (g_glGenVertexArrays && g_glDeleteVertexArrays && g_glBindVertexArray);
 	g_isSurrpotedBufferRange = (g_glMapBufferRange && g_glUnmapBuffer);
 	g_isSurrpotedMapBuffer = (g_glMapBuffer && g_glUnmapBuffer);
+	g_isSupportedProgramBinary = (g_glGetProgramBinary && g_glProgramBinary && g_glProgramParameteri);
+	g_isSupportedVertexAttribDivisor = g_glVertexAttribDivisor != nullptr;
 
 #endif
 
@@ -438,8 +466,29 @@ bool Initialize(OpenGLDeviceType deviceType, bool isExtensionsEnabled)
 		g_isSurrpotedMapBuffer = true;
 	}
 
+#if _WIN32
+	g_isSupportedProgramBinary = g_isSupportedProgramBinary && (deviceType == OpenGLDeviceType::OpenGL3 || deviceType == OpenGLDeviceType::OpenGLES3);
+#elif !defined(__EFFEKSEER_RENDERER_GL2__) && !defined(EMSCRIPTEN)
+	g_isSupportedProgramBinary = (deviceType == OpenGLDeviceType::OpenGL3 || deviceType == OpenGLDeviceType::OpenGLES3);
+#endif
+
+#if _WIN32
+	g_isSupportedVertexAttribDivisor =
+		g_isSupportedVertexAttribDivisor && (deviceType == OpenGLDeviceType::OpenGL3 || deviceType == OpenGLDeviceType::OpenGLES3);
+#elif !defined(__EFFEKSEER_RENDERER_GL2__)
+	g_isSupportedVertexAttribDivisor = (deviceType == OpenGLDeviceType::OpenGL3 || deviceType == OpenGLDeviceType::OpenGLES3);
 #endif
 
+#endif
+
+	// a driver may support the functions without any binary format
+	if (g_isSupportedProgramBinary)
+	{
+		GLint formatCount = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+		g_isSupportedProgramBinary = formatCount > 0;
+	}
+
 	g_isInitialized = true;
 	return true;
 }
@@ -459,6 +508,16 @@ bool IsSupportedMapBuffer()
 	return g_isSurrpotedMapBuffer;
 }
 
+bool IsSupportedProgramBinary()
+{
+	return g_isSupportedProgramBinary;
+}
+
+bool IsSupportedVertexAttribDivisor()
+{
+	return g_isSupportedVertexAttribDivisor;
+}
+
 void MakeMapBufferInvalid()
 {
 	g_isSurrpotedMapBuffer = false;
@@ -1028,6 +1087,46 @@ void glCopyTexSubImage3D(GLenum target,
 #endif
 }
 
+void glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary)
+{
+#if _WIN32
+	g_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+#elif defined(__EFFEKSEER_RENDERER_GLES2__) || defined(__EFFEKSEER_RENDERER_GL2__) || defined(EMSCRIPTEN)
+#else
+	::glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+#endif
+}
+
+void glProgramBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length)
+{
+#if _WIN32
+	g_glProgramBinary(program, binaryFormat, binary, length);
+#elif defined(__EFFEKSEER_RENDERER_GLES2__) || defined(__EFFEKSEER_RENDERER_GL2__) || defined(EMSCRIPTEN)
+#else
+	::glProgramBinary(program, binaryFormat, binary, length);
+#endif
+}
+
+void glProgramParameteri(GLuint program, GLenum pname, GLint value)
+{
+#if _WIN32
+	g_glProgramParameteri(program, pname, value);
+#elif defined(__EFFEKSEER_RENDERER_GLES2__) || defined(__EFFEKSEER_RENDERER_GL2__) || defined(EMSCRIPTEN)
+#else
+	::glProgramParameteri(program, pname, value);
+#endif
+}
+
+void glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+#if _WIN32
+	g_glVertexAttribDivisor(index, divisor);
+#elif defined(__EFFEKSEER_RENDERER_GLES2__) || defined(__EFFEKSEER_RENDERER_GL2__)
+#else
+	::glVertexAttribDivisor(index, divisor);
+#endif
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
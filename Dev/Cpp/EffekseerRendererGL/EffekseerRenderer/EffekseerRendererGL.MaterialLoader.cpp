@@ -465,7 +465,23 @@ MaterialLoader ::~MaterialLoader()
 		}
 
 		auto compiler = ::Effekseer::CreateUniqueReference(new Effekseer::MaterialCompilerGL());
-		auto binary = ::Effekseer::CreateUniqueReference(compiler->Compile(&materialFile));
+		std::unique_ptr<Effekseer::CompiledMaterialBinary, Effekseer::ReferenceDeleter<Effekseer::CompiledMaterialBinary>> binary;
+
+		// codes are not generated again if the same material has been compiled
+		const auto& cache = graphicsDevice_->GetCompiledMaterialCache();
+		if (cache != nullptr)
+		{
+			binary = ::Effekseer::CreateUniqueReference(cache->Compile(compiler.get(), &materialFile, data, size, ::Effekseer::CompiledMaterialPlatformType::OpenGL));
+		}
+		else
+		{
+			binary = ::Effekseer::CreateUniqueReference(compiler->Compile(&materialFile));
+		}
+
+		if (binary == nullptr)
+		{
+			return nullptr;
+		}
 
 		return LoadAcutually(materialFile, binary.get());
 	}
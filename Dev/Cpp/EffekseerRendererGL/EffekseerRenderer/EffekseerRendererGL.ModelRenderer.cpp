@@ -11,6 +11,7 @@
 #include "EffekseerRendererGL.Shader.h"
 #include "EffekseerRendererGL.VertexArray.h"
 #include "EffekseerRendererGL.VertexBuffer.h"
+#include <sstream>
 #include <string>
 
 #include "ShaderHeader/ad_model_distortion_ps.h"
@@ -32,6 +33,52 @@ namespace EffekseerRendererGL
 
 static const int InstanceCount = OpenGLInstancingCount;
 
+//! the first location of attributes for per-instance data
+static const int32_t InstanceAttribLocation = 6;
+
+/**
+	@brief	convert a transpiled vertex shader which reads per-instance data from uniforms into a shader which reads it from attributes
+	@return	an empty string if the shader is not supported
+*/
+static std::string ConvertToInstanceBufferShader(const char* code)
+{
+	std::string ret = code;
+
+	auto replace = [&ret](const std::string& from, const std::string& to) -> bool {
+		auto pos = ret.find(from);
+		if (pos == std::string::npos)
+		{
+			return false;
+		}
+		ret.replace(pos, from.size(), to);
+		return true;
+	};
+
+	std::ostringstream attribs;
+	attribs << "uniform VS_ConstantBuffer CBVS0;\n\n";
+	attribs << "layout(location = " << InstanceAttribLocation + 0 << ") in vec4 Input_ModelMatrix0;\n";
+	attribs << "layout(location = " << InstanceAttribLocation + 1 << ") in vec4 Input_ModelMatrix1;\n";
+	attribs << "layout(location = " << InstanceAttribLocation + 2 << ") in vec4 Input_ModelMatrix2;\n";
+	attribs << "layout(location = " << InstanceAttribLocation + 3 << ") in vec4 Input_ModelUV;\n";
+	attribs << "layout(location = " << InstanceAttribLocation + 4 << ") in vec4 Input_ModelColor;\n";
+
+	if (!replace("uniform VS_ConstantBuffer CBVS0;\n", attribs.str()) ||
+		!replace("CBVS0.mModel_Inst[index]", "mat4(Input_ModelMatrix0, Input_ModelMatrix1, Input_ModelMatrix2, vec4(0.0, 0.0, 0.0, 1.0))") ||
+		!replace("CBVS0.fUV[index]", "Input_ModelUV") ||
+		!replace("CBVS0.fModelColor[index]", "Input_ModelColor"))
+	{
+		return std::string();
+	}
+
+	// other per-instance data is not supported
+	if (ret.find("[index]") != std::string::npos)
+	{
+		return std::string();
+	}
+
+	return ret;
+}
+
 void AddModelVertexUniformLayout(Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement>& uniformLayout, bool isAd, bool isInstancing, int N)
 {
 	using namespace Effekseer::Backend;
@@ -81,78 +128,39 @@ void AddModelVertexUniformLayout(Effekseer::CustomVector<Effekseer::Backend::Uni
 }
 
 template <int N>
-void ModelRenderer::InitRenderer()
+void ModelRenderer::InitShader(Shader* shader, EffekseerRenderer::RendererShaderType type)
 {
-	for (size_t i = 0; i < 6; i++)
-	{
-		m_va[i] = nullptr;
-	}
-
-	const Effekseer::Backend::VertexLayoutElement vlElem[6] = {
-		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Pos", "POSITION", 0},
-		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Normal", "NORMAL", 1},
-		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Binormal", "NORMAL", 1},
-		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Tangent", "NORMAL", 2},
-		{Effekseer::Backend::VertexLayoutFormat::R32G32_FLOAT, "Input_UV", "TEXCOORD", 0},
-		{Effekseer::Backend::VertexLayoutFormat::R8G8B8A8_UNORM, "Input_Color", "NORMAL", 3},
-	};
-
-	auto vl = graphicsDevice_->CreateVertexLayout(vlElem, 6).DownCast<Backend::VertexLayout>();
+	using RendererShaderType = EffekseerRenderer::RendererShaderType;
 
-	shader_ad_lit_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
-	shader_ad_unlit_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
-	shader_ad_distortion_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
-	shader_ad_lit_->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBuffer));
-	shader_ad_unlit_->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBuffer));
-	shader_ad_distortion_->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBufferDistortion));
+	const auto isAd = type == RendererShaderType::AdvancedUnlit || type == RendererShaderType::AdvancedLit || type == RendererShaderType::AdvancedBackDistortion;
+	const auto isDistortion = type == RendererShaderType::BackDistortion || type == RendererShaderType::AdvancedBackDistortion;
 
-	shader_lit_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererVertexConstantBuffer<N>));
-	shader_unlit_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererVertexConstantBuffer<N>));
-	shader_distortion_->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererVertexConstantBuffer<N>));
-	shader_lit_->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBuffer));
-	shader_unlit_->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBuffer));
-	shader_distortion_->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBufferDistortion));
-
-	for (auto& shader : {shader_ad_lit_, shader_lit_})
+	if (isAd)
 	{
-		shader->SetVertexLayout(vl);
+		shader->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererAdvancedVertexConstantBuffer<N>));
 	}
-
-	for (auto& shader : {shader_ad_unlit_, shader_unlit_})
+	else
 	{
-		shader->SetVertexLayout(vl);
+		shader->SetVertexConstantBufferSize(sizeof(::EffekseerRenderer::ModelRendererVertexConstantBuffer<N>));
 	}
 
-	for (auto& shader : {shader_ad_distortion_, shader_distortion_})
+	if (isDistortion)
 	{
-		shader->SetVertexLayout(vl);
+		shader->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBufferDistortion));
+	}
+	else
+	{
+		shader->SetPixelConstantBufferSize(sizeof(::EffekseerRenderer::PixelConstantBuffer));
 	}
 }
 
-ModelRenderer::ModelRenderer(RendererImplemented* renderer,
-							 Shader* shader_ad_lit,
-							 Shader* shader_ad_unlit,
-							 Shader* shader_ad_distortion,
-							 Shader* shader_lit,
-							 Shader* shader_unlit,
-							 Shader* shader_distortion)
+ModelRenderer::ModelRenderer(RendererImplemented* renderer)
 	: m_renderer(renderer)
-	, shader_ad_lit_(shader_ad_lit)
-	, shader_ad_unlit_(shader_ad_unlit)
-	, shader_ad_distortion_(shader_ad_distortion)
-	, shader_lit_(shader_lit)
-	, shader_unlit_(shader_unlit)
-	, shader_distortion_(shader_distortion)
 {
 	graphicsDevice_ = renderer->GetGraphicsDevice().DownCast<Backend::GraphicsDevice>();
 	if (renderer->GetDeviceType() == OpenGLDeviceType::OpenGL3 || renderer->GetDeviceType() == OpenGLDeviceType::OpenGLES3)
 	{
 		VertexType = EffekseerRenderer::ModelRendererVertexType::Instancing;
-		InitRenderer<InstanceCount>();
-	}
-	else
-	{
-		InitRenderer<1>();
 	}
 
 	GLint currentVAO = 0;
@@ -162,12 +170,7 @@ ModelRenderer::ModelRenderer(RendererImplemented* renderer,
 		glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &currentVAO);
 	}
 
-	m_va[0] = VertexArray::Create(graphicsDevice_, shader_ad_lit_, nullptr, nullptr);
-	m_va[1] = VertexArray::Create(graphicsDevice_, shader_ad_unlit_, nullptr, nullptr);
-	m_va[2] = VertexArray::Create(graphicsDevice_, shader_ad_distortion_, nullptr, nullptr);
-	m_va[3] = VertexArray::Create(graphicsDevice_, shader_lit_, nullptr, nullptr);
-	m_va[4] = VertexArray::Create(graphicsDevice_, shader_unlit_, nullptr, nullptr);
-	m_va[5] = VertexArray::Create(graphicsDevice_, shader_distortion_, nullptr, nullptr);
+	vertexArray_ = VertexArray::Create(graphicsDevice_, nullptr, nullptr, nullptr);
 
 	if (GLExt::IsSupportedVertexArray())
 	{
@@ -180,18 +183,7 @@ ModelRenderer::ModelRenderer(RendererImplemented* renderer,
 //----------------------------------------------------------------------------------
 ModelRenderer::~ModelRenderer()
 {
-	for (size_t i = 0; i < 6; i++)
-	{
-		ES_SAFE_DELETE(m_va[i]);
-	}
-
-	ES_SAFE_DELETE(shader_unlit_);
-	ES_SAFE_DELETE(shader_lit_);
-	ES_SAFE_DELETE(shader_distortion_);
-
-	ES_SAFE_DELETE(shader_ad_unlit_);
-	ES_SAFE_DELETE(shader_ad_lit_);
-	ES_SAFE_DELETE(shader_ad_distortion_);
+	ES_SAFE_DELETE(vertexArray_);
 }
 
 //----------------------------------------------------------------------------------
@@ -201,6 +193,27 @@ ModelRendererRef ModelRenderer::Create(RendererImplemented* renderer)
 {
 	assert(renderer != nullptr);
 
+	// shaders are created by the renderer when they are used first
+	return ModelRendererRef(new ModelRenderer(renderer));
+}
+
+Shader* ModelRenderer::CreateShader(RendererImplemented* renderer, EffekseerRenderer::RendererShaderType type, bool isInstanceBufferUsed)
+{
+	using RendererShaderType = EffekseerRenderer::RendererShaderType;
+
+	if (isInstanceBufferUsed)
+	{
+		if (!GLExt::IsSupportedVertexAttribDivisor())
+		{
+			return nullptr;
+		}
+
+		if (type != RendererShaderType::Unlit && type != RendererShaderType::Lit && type != RendererShaderType::BackDistortion)
+		{
+			return nullptr;
+		}
+	}
+
 	auto graphicsDevice = renderer->GetGraphicsDevice();
 
 	int instanceCount = 1;
@@ -215,112 +228,110 @@ ModelRendererRef ModelRenderer::Create(RendererImplemented* renderer)
 		instaincing = false;
 	}
 
-	Shader* shader_ad_lit = nullptr;
-	Shader* shader_ad_unlit = nullptr;
-	Shader* shader_ad_distortion = nullptr;
-	Shader* shader_lit = nullptr;
-	Shader* shader_unlit = nullptr;
-	Shader* shader_distortion = nullptr;
-
-	ShaderCodeView ad_lit_vs(get_ad_model_lit_vs(renderer->GetDeviceType()));
-	ShaderCodeView ad_lit_ps(get_ad_model_lit_ps(renderer->GetDeviceType()));
-	ShaderCodeView ad_unlit_vs(get_ad_model_unlit_vs(renderer->GetDeviceType()));
-	ShaderCodeView ad_unlit_ps(get_ad_model_unlit_ps(renderer->GetDeviceType()));
-	ShaderCodeView ad_dist_vs(get_ad_model_distortion_vs(renderer->GetDeviceType()));
-	ShaderCodeView ad_dist_ps(get_ad_model_distortion_ps(renderer->GetDeviceType()));
-	ShaderCodeView lit_vs(get_model_lit_vs(renderer->GetDeviceType()));
-	ShaderCodeView lit_ps(get_model_lit_ps(renderer->GetDeviceType()));
-	ShaderCodeView unlit_vs(get_model_unlit_vs(renderer->GetDeviceType()));
-	ShaderCodeView unlit_ps(get_model_unlit_ps(renderer->GetDeviceType()));
-	ShaderCodeView dist_vs(get_model_distortion_vs(renderer->GetDeviceType()));
-	ShaderCodeView dist_ps(get_model_distortion_ps(renderer->GetDeviceType()));
+	const char* vs = nullptr;
+	const char* ps = nullptr;
+	const char* name = nullptr;
 
-	const auto texLocUnlit = GetTextureLocations(EffekseerRenderer::RendererShaderType::Unlit);
-	const auto texLocLit = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedLit);
-	const auto texLocDist = GetTextureLocations(EffekseerRenderer::RendererShaderType::BackDistortion);
-	const auto texLocAdUnlit = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedUnlit);
-	const auto texLocAdLit = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedLit);
-	const auto texLocAdDist = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedBackDistortion);
-
-	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElementsLitUnlit;
-	AddModelVertexUniformLayout(uniformLayoutElementsLitUnlit, false, instaincing, instanceCount);
-	AddPixelUniformLayout(uniformLayoutElementsLitUnlit);
-
-	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElementsDist;
-	AddModelVertexUniformLayout(uniformLayoutElementsDist, false, instaincing, instanceCount);
-	AddDistortionPixelUniformLayout(uniformLayoutElementsDist);
-
-	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElementsLitUnlitAd;
-	AddModelVertexUniformLayout(uniformLayoutElementsLitUnlitAd, true, instaincing, instanceCount);
-	AddPixelUniformLayout(uniformLayoutElementsLitUnlitAd);
-
-	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElementsDistAd;
-	AddModelVertexUniformLayout(uniformLayoutElementsDistAd, true, instaincing, instanceCount);
-	AddDistortionPixelUniformLayout(uniformLayoutElementsDistAd);
-
-	auto uniformLayoutLitAd = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocAdLit, uniformLayoutElementsLitUnlitAd);
-	auto shader_lit_ad_in = graphicsDevice->CreateShaderFromCodes({ad_lit_vs}, {ad_lit_ps}, uniformLayoutLitAd).DownCast<Backend::Shader>();
-
-	auto uniformLayoutUnlitAd = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocAdUnlit, uniformLayoutElementsLitUnlitAd);
-	auto shader_unlit_ad_in = graphicsDevice->CreateShaderFromCodes({ad_unlit_vs}, {ad_unlit_ps}, uniformLayoutUnlitAd).DownCast<Backend::Shader>();
+	switch (type)
+	{
+	case RendererShaderType::Unlit:
+		vs = get_model_unlit_vs(renderer->GetDeviceType());
+		ps = get_model_unlit_ps(renderer->GetDeviceType());
+		name = "ModelRendererUnlit";
+		break;
+	case RendererShaderType::Lit:
+		vs = get_model_lit_vs(renderer->GetDeviceType());
+		ps = get_model_lit_ps(renderer->GetDeviceType());
+		name = "ModelRendererLit";
+		break;
+	case RendererShaderType::BackDistortion:
+		vs = get_model_distortion_vs(renderer->GetDeviceType());
+		ps = get_model_distortion_ps(renderer->GetDeviceType());
+		name = "ModelRendererDist";
+		break;
+	case RendererShaderType::AdvancedUnlit:
+		vs = get_ad_model_unlit_vs(renderer->GetDeviceType());
+		ps = get_ad_model_unlit_ps(renderer->GetDeviceType());
+		name = "ModelRendererUnlitAd";
+		break;
+	case RendererShaderType::AdvancedLit:
+		vs = get_ad_model_lit_vs(renderer->GetDeviceType());
+		ps = get_ad_model_lit_ps(renderer->GetDeviceType());
+		name = "ModelRendererLitAd";
+		break;
+	case RendererShaderType::AdvancedBackDistortion:
+		vs = get_ad_model_distortion_vs(renderer->GetDeviceType());
+		ps = get_ad_model_distortion_ps(renderer->GetDeviceType());
+		name = "ModelRendererDistAd";
+		break;
+	default:
+		return nullptr;
+	}
 
-	auto uniformLayoutDistAd = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocAdDist, uniformLayoutElementsDistAd);
-	auto shader_dist_ad_in = graphicsDevice->CreateShaderFromCodes({ad_dist_vs}, {ad_dist_ps}, uniformLayoutDistAd).DownCast<Backend::Shader>();
+	std::string instanceBufferVS;
+	if (isInstanceBufferUsed)
+	{
+		instanceBufferVS = ConvertToInstanceBufferShader(vs);
+		if (instanceBufferVS.empty())
+		{
+			return nullptr;
+		}
 
-	auto uniformLayoutLit = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocLit, uniformLayoutElementsLitUnlit);
-	auto shader_lit_in = graphicsDevice->CreateShaderFromCodes({lit_vs}, {lit_ps}, uniformLayoutLit).DownCast<Backend::Shader>();
+		vs = instanceBufferVS.c_str();
+	}
 
-	auto uniformLayoutUnlit = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocUnlit, uniformLayoutElementsLitUnlit);
-	auto shader_unlit_in = graphicsDevice->CreateShaderFromCodes({unlit_vs}, {unlit_ps}, uniformLayoutUnlit).DownCast<Backend::Shader>();
+	const auto isAd = type == RendererShaderType::AdvancedUnlit || type == RendererShaderType::AdvancedLit || type == RendererShaderType::AdvancedBackDistortion;
+	const auto isDistortion = type == RendererShaderType::BackDistortion || type == RendererShaderType::AdvancedBackDistortion;
 
-	auto uniformLayoutDist = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocDist, uniformLayoutElementsDist);
-	auto shader_dist_in = graphicsDevice->CreateShaderFromCodes({dist_vs}, {dist_ps}, uniformLayoutDist).DownCast<Backend::Shader>();
+	// Lit uses texture locations of AdvancedLit
+	const auto texLoc = GetTextureLocations(type == RendererShaderType::Lit ? RendererShaderType::AdvancedLit : type);
 
-	shader_ad_lit = Shader::Create(renderer->GetInternalGraphicsDevice(), shader_lit_ad_in, "ModelRendererLitAd");
-	if (shader_ad_lit == nullptr)
-		goto End;
+	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElements;
+	AddModelVertexUniformLayout(uniformLayoutElements, isAd, instaincing, instanceCount);
 
-	shader_ad_unlit = Shader::Create(renderer->GetInternalGraphicsDevice(), shader_unlit_ad_in, "ModelRendererUnlitAd");
-	if (shader_ad_unlit == nullptr)
-		goto End;
+	if (isDistortion)
+	{
+		AddDistortionPixelUniformLayout(uniformLayoutElements);
+	}
+	else
+	{
+		AddPixelUniformLayout(uniformLayoutElements);
+	}
 
-	shader_ad_distortion = Shader::Create(renderer->GetInternalGraphicsDevice(), shader_dist_ad_in, "ModelRendererDistAd");
-	if (shader_ad_distortion == nullptr)
-		goto End;
+	auto uniformLayout = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLoc, uniformLayoutElements);
+	auto shaderIn = graphicsDevice->CreateShaderFromCodes({ShaderCodeView(vs)}, {ShaderCodeView(ps)}, uniformLayout).DownCast<Backend::Shader>();
 
-	shader_lit = Shader::Create(renderer->GetInternalGraphicsDevice(), shader_lit_in, "ModelRendererLit");
-	if (shader_lit == nullptr)
-		goto End;
+	auto shader = Shader::Create(renderer->GetInternalGraphicsDevice(), shaderIn, name);
+	if (shader == nullptr)
+	{
+		Effekseer::Log(Effekseer::LogType::Error, std::string("Failed to compile ") + name + (isInstanceBufferUsed ? "(Instanced)" : ""));
+		return nullptr;
+	}
 
-	shader_unlit = Shader::Create(renderer->GetInternalGraphicsDevice(), shader_unlit_in, "ModelRendererUnlit");
-	if (shader_unlit == nullptr)
-		goto End;
+	const Effekseer::Backend::VertexLayoutElement vlElem[6] = {
+		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Pos", "POSITION", 0},
+		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Normal", "NORMAL", 1},
+		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Binormal", "NORMAL", 1},
+		{Effekseer::Backend::VertexLayoutFormat::R32G32B32_FLOAT, "Input_Tangent", "NORMAL", 2},
+		{Effekseer::Backend::VertexLayoutFormat::R32G32_FLOAT, "Input_UV", "TEXCOORD", 0},
+		{Effekseer::Backend::VertexLayoutFormat::R8G8B8A8_UNORM, "Input_Color", "NORMAL", 3},
+	};
 
-	shader_distortion = Shader::Create(renderer->GetInternalGraphicsDevice(), shader_dist_in, "ModelRendererDit");
-	if (shader_distortion == nullptr)
-		goto End;
+	auto vl = graphicsDevice->CreateVertexLayout(vlElem, 6).DownCast<Backend::VertexLayout>();
+	shader->SetVertexLayout(vl);
 
 	// Transpiled shader is transposed
-	if (renderer->GetDeviceType() == OpenGLDeviceType::OpenGL3 || renderer->GetDeviceType() == OpenGLDeviceType::OpenGLES3)
+	if (instaincing)
 	{
-		shader_ad_lit->SetIsTransposeEnabled(true);
-		shader_ad_unlit->SetIsTransposeEnabled(true);
-		shader_ad_distortion->SetIsTransposeEnabled(true);
-		shader_lit->SetIsTransposeEnabled(true);
-		shader_unlit->SetIsTransposeEnabled(true);
-		shader_distortion->SetIsTransposeEnabled(true);
+		InitShader<InstanceCount>(shader, type);
+		shader->SetIsTransposeEnabled(true);
+	}
+	else
+	{
+		InitShader<1>(shader, type);
 	}
 
-	return ModelRendererRef(new ModelRenderer(renderer, shader_ad_lit, shader_ad_unlit, shader_ad_distortion, shader_lit, shader_unlit, shader_distortion));
-End:;
-
-	ES_SAFE_DELETE(shader_ad_lit);
-	ES_SAFE_DELETE(shader_ad_unlit);
-	ES_SAFE_DELETE(shader_ad_distortion);
-	ES_SAFE_DELETE(shader_lit);
-	ES_SAFE_DELETE(shader_unlit);
-	ES_SAFE_DELETE(shader_distortion);
-	return nullptr;
+	return shader;
 }
 
 void ModelRenderer::BeginRendering(const efkModelNodeParam& parameter, int32_t count, void* userData)
@@ -333,38 +344,17 @@ void ModelRenderer::Rendering(const efkModelNodeParam& parameter, const Instance
 	Rendering_<RendererImplemented>(m_renderer, parameter, instanceParameter, userData);
 }
 
-void ModelRenderer::EndRendering(const efkModelNodeParam& parameter, void* userData)
+void ModelRenderer::Rendering(const efkModelNodeParam& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData)
 {
-	if (collector_.DoRequireAdvancedRenderer())
-	{
-		if (parameter.BasicParameterPtr->MaterialType == Effekseer::RendererMaterialType::BackDistortion)
-		{
-			m_renderer->SetVertexArray(m_va[2]);
-		}
-		else if (parameter.BasicParameterPtr->MaterialType == Effekseer::RendererMaterialType::Lighting)
-		{
-			m_renderer->SetVertexArray(m_va[0]);
-		}
-		else
-		{
-			m_renderer->SetVertexArray(m_va[1]);
-		}
-	}
-	else
+	for (int32_t i = 0; i < count; i++)
 	{
-		if (parameter.BasicParameterPtr->MaterialType == Effekseer::RendererMaterialType::BackDistortion)
-		{
-			m_renderer->SetVertexArray(m_va[5]);
-		}
-		else if (parameter.BasicParameterPtr->MaterialType == Effekseer::RendererMaterialType::Lighting)
-		{
-			m_renderer->SetVertexArray(m_va[3]);
-		}
-		else
-		{
-			m_renderer->SetVertexArray(m_va[4]);
-		}
+		Rendering_<RendererImplemented>(m_renderer, parameter, instanceParameters[i], userData);
 	}
+}
+
+void ModelRenderer::EndRendering(const efkModelNodeParam& parameter, void* userData)
+{
+	m_renderer->SetVertexArray(vertexArray_);
 
 	if (parameter.ModelIndex < 0)
 	{
@@ -402,18 +392,107 @@ void ModelRenderer::EndRendering(const efkModelNodeParam& parameter, void* userD
 		}
 	}
 
+	// only a shader which is required is created
+	std::array<Shader*, BuiltinShaderCount> shaders;
+	shaders.fill(nullptr);
+
+	// all instances are drawn at once if they can be drawn with an instance buffer
+	isInstanceBufferEnabled_ = false;
+
+	if (VertexType == EffekseerRenderer::ModelRendererVertexType::Instancing && m_renderer->GetExternalShaderSettings() == nullptr &&
+		IsModelFrameSame(model->GetFrameCount()))
+	{
+		auto shader = m_renderer->GetModelShader(collector_.ShaderType, true);
+		if (shader != nullptr)
+		{
+			shaders[static_cast<int32_t>(collector_.ShaderType)] = shader;
+			isInstanceBufferEnabled_ = true;
+		}
+	}
+
+	if (!isInstanceBufferEnabled_ && collector_.ShaderType != EffekseerRenderer::RendererShaderType::Material)
+	{
+		shaders[static_cast<int32_t>(collector_.ShaderType)] = m_renderer->GetModelShader(collector_.ShaderType);
+	}
+
+	using RendererShaderType = EffekseerRenderer::RendererShaderType;
+	auto shader_ad_lit = shaders[static_cast<int32_t>(RendererShaderType::AdvancedLit)];
+	auto shader_ad_unlit = shaders[static_cast<int32_t>(RendererShaderType::AdvancedUnlit)];
+	auto shader_ad_distortion = shaders[static_cast<int32_t>(RendererShaderType::AdvancedBackDistortion)];
+	auto shader_lit = shaders[static_cast<int32_t>(RendererShaderType::Lit)];
+	auto shader_unlit = shaders[static_cast<int32_t>(RendererShaderType::Unlit)];
+	auto shader_distortion = shaders[static_cast<int32_t>(RendererShaderType::BackDistortion)];
+
 	if (VertexType == EffekseerRenderer::ModelRendererVertexType::Instancing)
 	{
 		EndRendering_<RendererImplemented, Shader, Effekseer::Model, true, InstanceCount>(
-			m_renderer, shader_ad_lit_, shader_ad_unlit_, shader_ad_distortion_, shader_lit_, shader_unlit_, shader_distortion_, parameter, userData);
+			m_renderer, shader_ad_lit, shader_ad_unlit, shader_ad_distortion, shader_lit, shader_unlit, shader_distortion, parameter, userData);
 	}
 	else
 	{
 		EndRendering_<RendererImplemented, Shader, Effekseer::Model, false, 1>(
-			m_renderer, shader_ad_lit_, shader_ad_unlit_, shader_ad_distortion_, shader_lit_, shader_unlit_, shader_distortion_, parameter, userData);
+			m_renderer, shader_ad_lit, shader_ad_unlit, shader_ad_distortion, shader_lit, shader_unlit, shader_distortion, parameter, userData);
 	}
 }
 
+void ModelRenderer::DrawWithInstanceBuffer(const EffekseerRenderer::ModelRendererInstanceData* data, int32_t instanceCount, int32_t vertexCount, int32_t indexCount)
+{
+	using InstanceData = EffekseerRenderer::ModelRendererInstanceData;
+
+	const auto size = static_cast<int32_t>(sizeof(InstanceData)) * instanceCount;
+
+	if (instanceBuffer_ == nullptr || instanceBufferSize_ < size)
+	{
+		instanceBufferSize_ = std::max(size, instanceBufferSize_ * 2);
+		instanceBuffer_ = graphicsDevice_->CreateVertexBuffer(instanceBufferSize_, nullptr, true).DownCast<Backend::VertexBuffer>();
+
+		if (instanceBuffer_ == nullptr)
+		{
+			instanceBufferSize_ = 0;
+			return;
+		}
+	}
+
+	GLCheckError();
+
+	GLint arrayBufferBinding = 0;
+	glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &arrayBufferBinding);
+
+	// orphan a previous storage not to wait for previous draw calls
+	GLExt::glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer_->GetBuffer());
+	GLExt::glBufferData(GL_ARRAY_BUFFER, instanceBufferSize_, nullptr, GL_STREAM_DRAW);
+	GLExt::glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+
+	const auto stride = static_cast<GLsizei>(sizeof(InstanceData));
+
+	for (int32_t i = 0; i < 3; i++)
+	{
+		GLExt::glEnableVertexAttribArray(InstanceAttribLocation + i);
+		GLExt::glVertexAttribPointer(InstanceAttribLocation + i, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<GLvoid*>(offsetof(InstanceData, ModelMatrix) + sizeof(float) * 4 * i));
+		GLExt::glVertexAttribDivisor(InstanceAttribLocation + i, 1);
+	}
+
+	GLExt::glEnableVertexAttribArray(InstanceAttribLocation + 3);
+	GLExt::glVertexAttribPointer(InstanceAttribLocation + 3, 4, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<GLvoid*>(offsetof(InstanceData, ModelUV)));
+	GLExt::glVertexAttribDivisor(InstanceAttribLocation + 3, 1);
+
+	GLExt::glEnableVertexAttribArray(InstanceAttribLocation + 4);
+	GLExt::glVertexAttribPointer(InstanceAttribLocation + 4, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, reinterpret_cast<GLvoid*>(offsetof(InstanceData, ModelColor)));
+	GLExt::glVertexAttribDivisor(InstanceAttribLocation + 4, 1);
+
+	m_renderer->DrawPolygonInstanced(vertexCount, indexCount, instanceCount);
+
+	for (int32_t i = 0; i < 5; i++)
+	{
+		GLExt::glVertexAttribDivisor(InstanceAttribLocation + i, 0);
+		GLExt::glDisableVertexAttribArray(InstanceAttribLocation + i);
+	}
+
+	GLExt::glBindBuffer(GL_ARRAY_BUFFER, arrayBufferBinding);
+
+	GLCheckError();
+}
+
 //----------------------------------------------------------------------------------
 //
 //----------------------------------------------------------------------------------
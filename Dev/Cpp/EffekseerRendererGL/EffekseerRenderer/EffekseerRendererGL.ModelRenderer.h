@@ -38,39 +38,38 @@ public:
 private:
 	RendererImplemented* m_renderer;
 
-	VertexArray* m_va[6];
-
-	Shader* shader_ad_lit_ = nullptr;
-	Shader* shader_ad_unlit_ = nullptr;
-	Shader* shader_ad_distortion_ = nullptr;
-
-	Shader* shader_lit_ = nullptr;
-	Shader* shader_unlit_ = nullptr;
-	Shader* shader_distortion_ = nullptr;
+	//! a vertex array which is bound while rendering because models have own buffers
+	VertexArray* vertexArray_ = nullptr;
 
 	Backend::GraphicsDeviceRef graphicsDevice_ = nullptr;
 
+	//! a buffer which contains per-instance data. it grows if it is small
+	Backend::VertexBufferRef instanceBuffer_;
+	int32_t instanceBufferSize_ = 0;
+
 	template <int N>
-	void InitRenderer();
+	static void InitShader(Shader* shader, EffekseerRenderer::RendererShaderType type);
 
-	ModelRenderer(RendererImplemented* renderer,
-				  Shader* shader_ad_lit,
-				  Shader* shader_ad_unlit,
-				  Shader* shader_ad_distortion,
-				  Shader* shader_lighting_texture_normal,
-				  Shader* shader_texture,
-				  Shader* shader_distortion_texture);
+	ModelRenderer(RendererImplemented* renderer);
 
 public:
 	virtual ~ModelRenderer();
 
 	static ModelRendererRef Create(RendererImplemented* renderer);
 
+	//! create a built-in shader for models. It is called by a renderer when the shader is used first.
+	static Shader* CreateShader(RendererImplemented* renderer, EffekseerRenderer::RendererShaderType type, bool isInstanceBufferUsed = false);
+
+protected:
+	void DrawWithInstanceBuffer(const EffekseerRenderer::ModelRendererInstanceData* data, int32_t instanceCount, int32_t vertexCount, int32_t indexCount) override;
+
 public:
 	void BeginRendering(const efkModelNodeParam& parameter, int32_t count, void* userData) override;
 
 	virtual void Rendering(const efkModelNodeParam& parameter, const InstanceParameter& instanceParameter, void* userData) override;
 
+	void Rendering(const efkModelNodeParam& parameter, const InstanceParameter* instanceParameters, int32_t count, void* userData) override;
+
 	void EndRendering(const efkModelNodeParam& parameter, void* userData) override;
 };
 
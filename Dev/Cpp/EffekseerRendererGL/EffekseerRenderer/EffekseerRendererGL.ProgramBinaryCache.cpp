@@ -0,0 +1,73 @@
+#include "EffekseerRendererGL.ProgramBinaryCache.h"
+
+namespace EffekseerRendererGL
+{
+
+FileProgramBinaryCache::FileProgramBinaryCache(const char16_t* directory, ::Effekseer::FileInterface* fileInterface)
+	: fileInterface_(fileInterface)
+{
+	if (fileInterface_ == nullptr)
+	{
+		fileInterface_ = &defaultFileInterface_;
+	}
+
+	if (directory != nullptr)
+	{
+		directory_ = directory;
+	}
+
+	if (!directory_.empty() && directory_.back() != u'/' && directory_.back() != u'\\')
+	{
+		directory_ += u'/';
+	}
+}
+
+std::u16string FileProgramBinaryCache::GetPath(uint64_t key) const
+{
+	const char16_t* digits = u"0123456789abcdef";
+
+	auto path = directory_;
+	for (int32_t i = 15; i >= 0; i--)
+	{
+		path += digits[(key >> (i * 4)) & 0xF];
+	}
+	path += u".glbin";
+	return path;
+}
+
+bool FileProgramBinaryCache::Load(uint64_t key, ::Effekseer::CustomVector<uint8_t>& data)
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+
+	auto path = GetPath(key);
+	std::unique_ptr<::Effekseer::FileReader> reader(fileInterface_->TryOpenRead(path.c_str()));
+	if (reader == nullptr)
+	{
+		return false;
+	}
+
+	data.resize(reader->GetLength());
+	if (data.empty())
+	{
+		return false;
+	}
+
+	return reader->Read(data.data(), data.size()) == data.size();
+}
+
+void FileProgramBinaryCache::Save(uint64_t key, const void* data, int32_t size)
+{
+	std::lock_guard<std::mutex> lock(mtx_);
+
+	auto path = GetPath(key);
+	std::unique_ptr<::Effekseer::FileWriter> writer(fileInterface_->OpenWrite(path.c_str()));
+	if (writer == nullptr)
+	{
+		return;
+	}
+
+	writer->Write(data, size);
+	writer->Flush();
+}
+
+} // namespace EffekseerRendererGL
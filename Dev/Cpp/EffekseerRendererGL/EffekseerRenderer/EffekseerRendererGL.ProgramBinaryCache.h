@@ -0,0 +1,36 @@
+#ifndef __EFFEKSEERRENDERER_GL_PROGRAM_BINARY_CACHE_H__
+#define __EFFEKSEERRENDERER_GL_PROGRAM_BINARY_CACHE_H__
+
+#include "EffekseerRendererGL.Base.h"
+#include <mutex>
+
+namespace EffekseerRendererGL
+{
+
+/**
+	@brief	A cache which stores program binaries as files in a directory
+*/
+class FileProgramBinaryCache : public ProgramBinaryCache
+{
+private:
+	std::u16string directory_;
+	std::mutex mtx_;
+
+	::Effekseer::FileInterface* fileInterface_ = nullptr;
+	::Effekseer::DefaultFileInterface defaultFileInterface_;
+
+	std::u16string GetPath(uint64_t key) const;
+
+public:
+	FileProgramBinaryCache(const char16_t* directory, ::Effekseer::FileInterface* fileInterface);
+
+	~FileProgramBinaryCache() override = default;
+
+	bool Load(uint64_t key, ::Effekseer::CustomVector<uint8_t>& data) override;
+
+	void Save(uint64_t key, const void* data, int32_t size) override;
+};
+
+} // namespace EffekseerRendererGL
+
+#endif // __EFFEKSEERRENDERER_GL_PROGRAM_BINARY_CACHE_H__
@@ -10,6 +10,7 @@
 #include "EffekseerRendererGL.IndexBuffer.h"
 #include "EffekseerRendererGL.MaterialLoader.h"
 #include "EffekseerRendererGL.ModelRenderer.h"
+#include "EffekseerRendererGL.ProgramBinaryCache.h"
 #include "EffekseerRendererGL.Shader.h"
 #include "EffekseerRendererGL.VertexArray.h"
 #include "EffekseerRendererGL.VertexBuffer.h"
@@ -50,6 +51,9 @@
 namespace EffekseerRendererGL
 {
 
+//! names of built-in shaders in order of RendererShaderType
+static const char* BuiltinShaderNames[BuiltinShaderCount] = {"Unlit", "Lit", "Dist", "UnlitAd", "LitAd", "DistAd"};
+
 ::Effekseer::Backend::GraphicsDeviceRef CreateGraphicsDevice(OpenGLDeviceType deviceType, bool isExtensionsEnabled)
 {
 	GLCheckError();
@@ -107,6 +111,31 @@ Effekseer::Backend::TextureRef CreateTexture(Effekseer::Backend::GraphicsDeviceR
 	return gd->CreateTexture(buffer, hasMipmap, onDisposed);
 }
 
+ProgramBinaryCacheRef CreateProgramBinaryCache(const char16_t* directory, ::Effekseer::FileInterface* fileInterface)
+{
+	return Effekseer::MakeRefPtr<FileProgramBinaryCache>(directory, fileInterface);
+}
+
+void SetProgramBinaryCache(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, ProgramBinaryCacheRef programBinaryCache)
+{
+	if (graphicsDevice == nullptr)
+	{
+		return;
+	}
+
+	graphicsDevice.DownCast<Backend::GraphicsDevice>()->SetProgramBinaryCache(programBinaryCache);
+}
+
+void SetCompiledMaterialCacheDirectory(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, const char16_t* directory, ::Effekseer::FileInterface* fileInterface)
+{
+	if (graphicsDevice == nullptr)
+	{
+		return;
+	}
+
+	graphicsDevice.DownCast<Backend::GraphicsDevice>()->SetCompiledMaterialCache(Effekseer::MakeRefPtr<Effekseer::CompiledMaterialCache>(directory, fileInterface));
+}
+
 TextureProperty GetTextureProperty(::Effekseer::Backend::TextureRef texture)
 {
 	if (texture != nullptr)
@@ -161,33 +190,6 @@ int32_t RendererImplemented::GetIndexSpriteCount() const
 	return (int32_t)(vsSize / size / 4 + 1);
 }
 
-void VertexArrayGroup::Create(
-	Backend::GraphicsDeviceRef graphicsDevice,
-	VertexBuffer* vertexBuffer,
-	IndexBuffer* indexBuffer,
-	IndexBuffer* indexBufferForWireframe,
-	Shader* shader_unlit,
-	Shader* shader_distortion,
-	Shader* shader_lit,
-	Shader* shader_ad_unlit,
-	Shader* shader_ad_lit,
-	Shader* shader_ad_distortion)
-{
-	vao_ad_distortion = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_ad_distortion, vertexBuffer, indexBuffer));
-	vao_distortion = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_distortion, vertexBuffer, indexBuffer));
-	vao_ad_lit = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_ad_lit, vertexBuffer, indexBuffer));
-	vao_lit = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_lit, vertexBuffer, indexBuffer));
-	vao_unlit = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_unlit, vertexBuffer, indexBuffer));
-	vao_ad_unlit = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_ad_unlit, vertexBuffer, indexBuffer));
-
-	vao_unlit_wire = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_unlit, vertexBuffer, indexBufferForWireframe));
-	vao_lit_wire = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_lit, vertexBuffer, indexBufferForWireframe));
-	vao_distortion_wire = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_distortion, vertexBuffer, indexBufferForWireframe));
-	vao_ad_unlit_wire = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_ad_unlit, vertexBuffer, indexBufferForWireframe));
-	vao_ad_lit_wire = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_ad_lit, vertexBuffer, indexBufferForWireframe));
-	vao_ad_distortion_wire = std::unique_ptr<VertexArray>(VertexArray::Create(graphicsDevice, shader_ad_distortion, vertexBuffer, indexBufferForWireframe));
-}
-
 RendererImplemented::PlatformSetting RendererImplemented::GetPlatformSetting()
 {
 #if defined(EMSCRIPTEN) || defined(__ANDROID__) || (defined(__APPLE__) && (TARGET_OS_IPHONE || TARGET_IPHONE_SIMULATOR))
@@ -223,13 +225,22 @@ RendererImplemented::~RendererImplemented()
 	ES_SAFE_DELETE(m_distortingCallback);
 
 	ES_SAFE_DELETE(m_standardRenderer);
-	ES_SAFE_DELETE(shader_unlit_);
-	ES_SAFE_DELETE(shader_distortion_);
-	ES_SAFE_DELETE(shader_lit_);
+	ringVs_.clear();
 
-	ES_SAFE_DELETE(shader_ad_unlit_);
-	ES_SAFE_DELETE(shader_ad_lit_);
-	ES_SAFE_DELETE(shader_ad_distortion_);
+	for (auto& variant : shaders_)
+	{
+		variant.shader.reset();
+	}
+
+	for (auto& variant : modelShaders_)
+	{
+		variant.shader.reset();
+	}
+
+	for (auto& variant : instanceBufferModelShaders_)
+	{
+		variant.shader.reset();
+	}
 
 	ES_SAFE_DELETE(m_renderState);
 	ES_SAFE_DELETE(m_indexBuffer);
@@ -341,166 +352,231 @@ bool RendererImplemented::Initialize()
 
 	m_renderState = new RenderState(this);
 
-	ShaderCodeView unlit_ad_vs(get_ad_sprite_unlit_vs(GetDeviceType()));
-	ShaderCodeView unlit_ad_ps(get_ad_model_unlit_ps(GetDeviceType()));
-	ShaderCodeView distortion_ad_vs(get_ad_sprite_distortion_vs(GetDeviceType()));
-	ShaderCodeView distortion_ad_ps(get_ad_model_distortion_ps(GetDeviceType()));
-	ShaderCodeView lit_ad_vs(get_ad_sprite_lit_vs(GetDeviceType()));
-	ShaderCodeView lit_ad_ps(get_ad_model_lit_ps(GetDeviceType()));
-
-	ShaderCodeView unlit_vs(get_sprite_unlit_vs(GetDeviceType()));
-	ShaderCodeView unlit_ps(get_model_unlit_ps(GetDeviceType()));
-	ShaderCodeView distortion_vs(get_sprite_distortion_vs(GetDeviceType()));
-	ShaderCodeView distortion_ps(get_model_distortion_ps(GetDeviceType()));
-	ShaderCodeView lit_vs(get_sprite_lit_vs(GetDeviceType()));
-	ShaderCodeView lit_ps(get_model_lit_ps(GetDeviceType()));
-
-	const auto texLocUnlit = GetTextureLocations(EffekseerRenderer::RendererShaderType::Unlit);
-	const auto texLocLit = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedLit);
-	const auto texLocDist = GetTextureLocations(EffekseerRenderer::RendererShaderType::BackDistortion);
-	const auto texLocAdUnlit = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedUnlit);
-	const auto texLocAdLit = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedLit);
-	const auto texLocAdDist = GetTextureLocations(EffekseerRenderer::RendererShaderType::AdvancedBackDistortion);
-
-	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElementsLitUnlit;
-	AddVertexUniformLayout(uniformLayoutElementsLitUnlit);
-	AddPixelUniformLayout(uniformLayoutElementsLitUnlit);
-
-	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElementsDist;
-	AddVertexUniformLayout(uniformLayoutElementsDist);
-	AddDistortionPixelUniformLayout(uniformLayoutElementsDist);
-
-	auto uniformLayoutUnlitAd = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocAdUnlit, uniformLayoutElementsLitUnlit);
-	auto shader_unlit_ad = graphicsDevice_->CreateShaderFromCodes({unlit_ad_vs}, {unlit_ad_ps}, uniformLayoutUnlitAd).DownCast<Backend::Shader>();
-
-	shader_ad_unlit_ = Shader::Create(GetInternalGraphicsDevice(), shader_unlit_ad, "UnlitAd");
-	if (shader_ad_unlit_ == nullptr)
-	{
-		Effekseer::Log(Effekseer::LogType::Error, "Failed to compile UnlitAd");
+	// Other shaders are created when they are used first. Unlit is created to validate a context because it is used in all modes.
+	if (GetOrCreateShader(EffekseerRenderer::RendererShaderType::Unlit) == nullptr)
+	{
 		return false;
 	}
 
-	auto uniformLayoutDistAd = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocAdDist, uniformLayoutElementsDist);
-	auto shader_distortion_ad = graphicsDevice_->CreateShaderFromCodes({distortion_ad_vs}, {distortion_ad_ps}, uniformLayoutDistAd).DownCast<Backend::Shader>();
+	SetSquareMaxCount(m_squareMaxCount);
+
+	m_standardRenderer =
+		new EffekseerRenderer::StandardRenderer<RendererImplemented, Shader>(this);
+
+	GLExt::glBindBuffer(GL_ARRAY_BUFFER, arrayBufferBinding);
+	GLExt::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementArrayBufferBinding);
+	GetImpl()->isSoftParticleEnabled = GetDeviceType() == OpenGLDeviceType::OpenGL3 || GetDeviceType() == OpenGLDeviceType::OpenGLES3;
 
-	shader_ad_distortion_ = Shader::Create(GetInternalGraphicsDevice(), shader_distortion_ad, "DistAd");
-	if (shader_ad_distortion_ == nullptr)
+	if (GLExt::IsSupportedVertexArray())
 	{
-		Effekseer::Log(Effekseer::LogType::Error, "Failed to compile DistAd");
-		return false;
+		GLExt::glBindVertexArray(currentVAO);
 	}
 
-	auto uniformLayoutLitAd = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocAdLit, uniformLayoutElementsLitUnlit);
-	auto shader_lit_ad = graphicsDevice_->CreateShaderFromCodes({lit_ad_vs}, {lit_ad_ps}, uniformLayoutLitAd).DownCast<Backend::Shader>();
+	GetImpl()->CreateProxyTextures(this);
 
-	shader_ad_lit_ = Shader::Create(GetInternalGraphicsDevice(), shader_lit_ad, "LitAd");
-	if (shader_ad_lit_ == nullptr)
+	if (GLExt::IsSupportedVertexArray())
 	{
-		Effekseer::Log(Effekseer::LogType::Error, "Failed to compile LitAd");
-		return false;
+		GLExt::glGenVertexArrays(1, &defaultVertexArray_);
 	}
 
-	auto uniformLayoutUnlit = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocUnlit, uniformLayoutElementsLitUnlit);
-	auto shader_unlit = graphicsDevice_->CreateShaderFromCodes({unlit_vs}, {unlit_ps}, uniformLayoutUnlit).DownCast<Backend::Shader>();
+	GLCheckError();
+	return true;
+}
 
-	shader_unlit_ = Shader::Create(GetInternalGraphicsDevice(), shader_unlit, "Unlit");
-	if (shader_unlit_ == nullptr)
+Shader* RendererImplemented::GetOrCreateShader(::EffekseerRenderer::RendererShaderType type)
+{
+	if (type == ::EffekseerRenderer::RendererShaderType::Material)
 	{
-		Effekseer::Log(Effekseer::LogType::Error, "Failed to compile Unlit");
-		return false;
+		return nullptr;
 	}
 
-	auto uniformLayoutDist = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocDist, uniformLayoutElementsDist);
-	auto shader_distortion = graphicsDevice_->CreateShaderFromCodes({distortion_vs}, {distortion_ps}, uniformLayoutDist).DownCast<Backend::Shader>();
+	auto& variant = shaders_[static_cast<int32_t>(type)];
 
-	shader_distortion_ = Shader::Create(GetInternalGraphicsDevice(), shader_distortion, "Dist");
-	if (shader_distortion_ == nullptr)
+	if (variant.shader == nullptr && !variant.isFailed)
 	{
-		Effekseer::Log(Effekseer::LogType::Error, "Failed to compile Dist");
-		return false;
+		variant.shader.reset(CreateShader(type));
+		variant.isFailed = variant.shader == nullptr;
 	}
 
-	auto uniformLayoutLit = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLocLit, uniformLayoutElementsLitUnlit);
-	auto shader_lit = graphicsDevice_->CreateShaderFromCodes({lit_vs}, {lit_ps}, uniformLayoutLit).DownCast<Backend::Shader>();
+	return variant.shader.get();
+}
+
+Shader* RendererImplemented::CreateShader(::EffekseerRenderer::RendererShaderType type)
+{
+	using RendererShaderType = ::EffekseerRenderer::RendererShaderType;
+
+	const char* vs = nullptr;
+	const char* ps = nullptr;
+
+	switch (type)
+	{
+	case RendererShaderType::Unlit:
+		vs = get_sprite_unlit_vs(GetDeviceType());
+		ps = get_model_unlit_ps(GetDeviceType());
+		break;
+	case RendererShaderType::Lit:
+		vs = get_sprite_lit_vs(GetDeviceType());
+		ps = get_model_lit_ps(GetDeviceType());
+		break;
+	case RendererShaderType::BackDistortion:
+		vs = get_sprite_distortion_vs(GetDeviceType());
+		ps = get_model_distortion_ps(GetDeviceType());
+		break;
+	case RendererShaderType::AdvancedUnlit:
+		vs = get_ad_sprite_unlit_vs(GetDeviceType());
+		ps = get_ad_model_unlit_ps(GetDeviceType());
+		break;
+	case RendererShaderType::AdvancedLit:
+		vs = get_ad_sprite_lit_vs(GetDeviceType());
+		ps = get_ad_model_lit_ps(GetDeviceType());
+		break;
+	case RendererShaderType::AdvancedBackDistortion:
+		vs = get_ad_sprite_distortion_vs(GetDeviceType());
+		ps = get_ad_model_distortion_ps(GetDeviceType());
+		break;
+	default:
+		return nullptr;
+	}
 
-	shader_lit_ = Shader::Create(GetInternalGraphicsDevice(), shader_lit, "Lit");
-	if (shader_lit_ == nullptr)
+	const auto isDistortion = type == RendererShaderType::BackDistortion || type == RendererShaderType::AdvancedBackDistortion;
+
+	// Lit uses texture locations of AdvancedLit
+	const auto texLoc = GetTextureLocations(type == RendererShaderType::Lit ? RendererShaderType::AdvancedLit : type);
+
+	Effekseer::CustomVector<Effekseer::Backend::UniformLayoutElement> uniformLayoutElements;
+	AddVertexUniformLayout(uniformLayoutElements);
+
+	if (isDistortion)
 	{
-		Effekseer::Log(Effekseer::LogType::Error, "Failed to compile Lit");
-		return false;
+		AddDistortionPixelUniformLayout(uniformLayoutElements);
+	}
+	else
+	{
+		AddPixelUniformLayout(uniformLayoutElements);
 	}
 
-	// Unlit
-	auto vlUnlitAd = EffekseerRenderer::GetVertexLayout(graphicsDevice_, EffekseerRenderer::RendererShaderType::AdvancedUnlit).DownCast<Backend::VertexLayout>();
-	shader_ad_unlit_->SetVertexLayout(vlUnlitAd);
+	auto uniformLayout = Effekseer::MakeRefPtr<Effekseer::Backend::UniformLayout>(texLoc, uniformLayoutElements);
+	auto shaderIn = graphicsDevice_->CreateShaderFromCodes({ShaderCodeView(vs)}, {ShaderCodeView(ps)}, uniformLayout).DownCast<Backend::Shader>();
 
-	auto vlUnlit = EffekseerRenderer::GetVertexLayout(graphicsDevice_, EffekseerRenderer::RendererShaderType::Unlit).DownCast<Backend::VertexLayout>();
-	shader_unlit_->SetVertexLayout(vlUnlit);
+	const auto name = BuiltinShaderNames[static_cast<int32_t>(type)];
+	auto shader = Shader::Create(GetInternalGraphicsDevice(), shaderIn, name);
+	if (shader == nullptr)
+	{
+		Effekseer::Log(Effekseer::LogType::Error, std::string("Failed to compile ") + name);
+		return nullptr;
+	}
 
-	for (auto& shader : {shader_ad_unlit_, shader_unlit_})
+	// Distortion uses a vertex layout of Lit
+	auto vertexLayoutType = type;
+	if (type == RendererShaderType::BackDistortion)
 	{
-		shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
-		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBuffer));
+		vertexLayoutType = RendererShaderType::Lit;
+	}
+	else if (type == RendererShaderType::AdvancedBackDistortion)
+	{
+		vertexLayoutType = RendererShaderType::AdvancedLit;
 	}
 
-	// Distortion
-	auto vlLitDistAd = EffekseerRenderer::GetVertexLayout(graphicsDevice_, EffekseerRenderer::RendererShaderType::AdvancedLit).DownCast<Backend::VertexLayout>();
-	auto vlLitDist = EffekseerRenderer::GetVertexLayout(graphicsDevice_, EffekseerRenderer::RendererShaderType::Lit).DownCast<Backend::VertexLayout>();
+	auto vl = EffekseerRenderer::GetVertexLayout(graphicsDevice_, vertexLayoutType).DownCast<Backend::VertexLayout>();
+	shader->SetVertexLayout(vl);
 
-	shader_ad_distortion_->SetVertexLayout(vlLitDistAd);
-	shader_distortion_->SetVertexLayout(vlLitDist);
+	shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
 
-	for (auto& shader : {shader_ad_distortion_, shader_distortion_})
+	if (isDistortion)
 	{
-		shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
 		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBufferDistortion));
 	}
+	else
+	{
+		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBuffer));
+	}
+
+	// Transpiled shader for OpenGL 3.x is transposed
+	if (GetDeviceType() == OpenGLDeviceType::OpenGL3 || GetDeviceType() == OpenGLDeviceType::OpenGLES3)
+	{
+		shader->SetIsTransposeEnabled(true);
+	}
 
-	// Lit
-	shader_ad_lit_->SetVertexLayout(vlLitDistAd);
-	shader_lit_->SetVertexLayout(vlLitDist);
+	return shader;
+}
 
-	for (auto shader : {shader_ad_lit_, shader_lit_})
+Shader* RendererImplemented::GetModelShader(::EffekseerRenderer::RendererShaderType type, bool isInstanceBufferUsed)
+{
+	if (type == ::EffekseerRenderer::RendererShaderType::Material)
 	{
-		shader->SetVertexConstantBufferSize(sizeof(EffekseerRenderer::StandardRendererVertexBuffer));
-		shader->SetPixelConstantBufferSize(sizeof(EffekseerRenderer::PixelConstantBuffer));
+		return nullptr;
 	}
 
-	SetSquareMaxCount(m_squareMaxCount);
+	auto& variant = isInstanceBufferUsed ? instanceBufferModelShaders_[static_cast<int32_t>(type)] : modelShaders_[static_cast<int32_t>(type)];
 
-	m_standardRenderer =
-		new EffekseerRenderer::StandardRenderer<RendererImplemented, Shader>(this);
+	if (variant.shader == nullptr && !variant.isFailed)
+	{
+		variant.shader.reset(ModelRenderer::CreateShader(this, type, isInstanceBufferUsed));
+		variant.isFailed = variant.shader == nullptr;
+	}
 
-	GLExt::glBindBuffer(GL_ARRAY_BUFFER, arrayBufferBinding);
-	GLExt::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementArrayBufferBinding);
-	GetImpl()->isSoftParticleEnabled = GetDeviceType() == OpenGLDeviceType::OpenGL3 || GetDeviceType() == OpenGLDeviceType::OpenGLES3;
+	return variant.shader.get();
+}
 
-	if (GLExt::IsSupportedVertexArray())
+VertexArray* RendererImplemented::GetVertexArray(::EffekseerRenderer::RendererShaderType type)
+{
+	auto& ringv = ringVs_[GetImpl()->CurrentRingBufferIndex];
+	const auto isWireframe = GetRenderMode() == ::Effekseer::RenderMode::Wireframe;
+	auto& vao = isWireframe ? ringv->vao->vaosForWireframe[static_cast<int32_t>(type)] : ringv->vao->vaos[static_cast<int32_t>(type)];
+
+	if (vao == nullptr && GLExt::IsSupportedVertexArray())
 	{
-		GLExt::glBindVertexArray(currentVAO);
+		vao = std::unique_ptr<VertexArray>(VertexArray::Create(
+			graphicsDevice_, GetOrCreateShader(type), ringv->vertexBuffer.get(), isWireframe ? m_indexBufferForWireframe : m_indexBuffer));
 	}
 
-	GetImpl()->CreateProxyTextures(this);
+	return vao.get();
+}
 
-	if (GLExt::IsSupportedVertexArray())
+void RendererImplemented::PrepareShaders(const ::Effekseer::EffectRef& effect)
+{
+	EffekseerRenderer::EnumerateRequiredShaderTypes(effect, [this](Effekseer::EffectNodeType nodeType, EffekseerRenderer::RendererShaderType type) {
+		if (nodeType == Effekseer::EffectNodeType::Model)
+		{
+			GetModelShader(type);
+			GetModelShader(type, true);
+		}
+		else
+		{
+			GetOrCreateShader(type);
+		}
+	});
+}
+
+std::vector<std::string> RendererImplemented::GetResidentShaderNames() const
+{
+	std::vector<std::string> names;
+
+	for (int32_t i = 0; i < BuiltinShaderCount; i++)
 	{
-		GLExt::glGenVertexArrays(1, &defaultVertexArray_);
+		if (shaders_[i].shader != nullptr)
+		{
+			names.emplace_back(BuiltinShaderNames[i]);
+		}
 	}
 
-	// Transpiled shader for OpenGL 3.x is transposed
-	if (GetDeviceType() == OpenGLDeviceType::OpenGL3 || GetDeviceType() == OpenGLDeviceType::OpenGLES3)
+	for (int32_t i = 0; i < BuiltinShaderCount; i++)
 	{
-		shader_unlit_->SetIsTransposeEnabled(true);
-		shader_distortion_->SetIsTransposeEnabled(true);
-		shader_lit_->SetIsTransposeEnabled(true);
+		if (modelShaders_[i].shader != nullptr)
+		{
+			names.emplace_back(std::string("ModelRenderer") + BuiltinShaderNames[i]);
+		}
+	}
 
-		shader_ad_unlit_->SetIsTransposeEnabled(true);
-		shader_ad_lit_->SetIsTransposeEnabled(true);
-		shader_ad_distortion_->SetIsTransposeEnabled(true);
+	for (int32_t i = 0; i < BuiltinShaderCount; i++)
+	{
+		if (instanceBufferModelShaders_[i].shader != nullptr)
+		{
+			names.emplace_back(std::string("ModelRendererInstanced") + BuiltinShaderNames[i]);
+		}
 	}
 
-	GLCheckError();
-	return true;
+	return names;
 }
 
 void RendererImplemented::SetRestorationOfStatesFlag(bool flag)
@@ -726,18 +802,8 @@ void RendererImplemented::SetSquareMaxCount(int32_t count)
 			return;
 		}
 
+		// vertex arrays are created when shaders are used first
 		rv->vao = std::unique_ptr<VertexArrayGroup>(new VertexArrayGroup());
-		rv->vao->Create(
-			graphicsDevice_,
-			rv->vertexBuffer.get(),
-			m_indexBuffer,
-			m_indexBufferForWireframe,
-			shader_unlit_,
-			shader_distortion_,
-			shader_lit_,
-			shader_ad_unlit_,
-			shader_ad_lit_,
-			shader_ad_distortion_);
 
 		ringVs_.emplace_back(rv);
 	}
@@ -1001,43 +1067,23 @@ void RendererImplemented::DrawPolygonInstanced(int32_t vertexCount, int32_t inde
 	GLCheckError();
 }
 
-Shader* RendererImplemented::GetShader(::EffekseerRenderer::RendererShaderType type) const
+Shader* RendererImplemented::GetShader(::EffekseerRenderer::RendererShaderType type)
 {
-	if (type == ::EffekseerRenderer::RendererShaderType::AdvancedBackDistortion)
-	{
-		return shader_ad_distortion_;
-	}
-	else if (type == ::EffekseerRenderer::RendererShaderType::AdvancedLit)
-	{
-		return shader_ad_lit_;
-	}
-	else if (type == ::EffekseerRenderer::RendererShaderType::AdvancedUnlit)
-	{
-		return shader_ad_unlit_;
-	}
-	else if (type == ::EffekseerRenderer::RendererShaderType::BackDistortion)
-	{
-		return shader_distortion_;
-	}
-	else if (type == ::EffekseerRenderer::RendererShaderType::Lit)
-	{
-		return shader_lit_;
-	}
-	else if (type == ::EffekseerRenderer::RendererShaderType::Unlit)
+	auto shader = GetOrCreateShader(type);
+
+	if (type == ::EffekseerRenderer::RendererShaderType::Unlit && shader != nullptr)
 	{
 		if (GetExternalShaderSettings() == nullptr)
 		{
-			shader_unlit_->OverrideShader(nullptr);
+			shader->OverrideShader(nullptr);
 		}
 		else
 		{
-			shader_unlit_->OverrideShader(GetExternalShaderSettings()->StandardShader);
+			shader->OverrideShader(GetExternalShaderSettings()->StandardShader);
 		}
-
-		return shader_unlit_;
 	}
 
-	return shader_unlit_;
+	return shader;
 }
 
 //----------------------------------------------------------------------------------
@@ -1047,78 +1093,24 @@ void RendererImplemented::BeginShader(Shader* shader)
 {
 	GLCheckError();
 
-	auto& ringv = ringVs_[GetImpl()->CurrentRingBufferIndex];
-
 	// change VAO with shader
-	if (m_currentVertexArray != nullptr)
-	{
-		SetVertexArray(m_currentVertexArray);
-	}
-	else if (shader == shader_unlit_)
-	{
-		if (GetRenderMode() == ::Effekseer::RenderMode::Wireframe)
-		{
-			SetVertexArray(ringv->vao->vao_unlit_wire.get());
-		}
-		else
-		{
-			SetVertexArray(ringv->vao->vao_unlit.get());
-		}
-	}
-	else if (shader == shader_distortion_)
-	{
-		if (GetRenderMode() == ::Effekseer::RenderMode::Wireframe)
-		{
-			SetVertexArray(ringv->vao->vao_distortion_wire.get());
-		}
-		else
-		{
-			SetVertexArray(ringv->vao->vao_distortion.get());
-		}
-	}
-	else if (shader == shader_lit_)
-	{
-		if (GetRenderMode() == ::Effekseer::RenderMode::Wireframe)
-		{
-			SetVertexArray(ringv->vao->vao_lit_wire.get());
-		}
-		else
-		{
-			SetVertexArray(ringv->vao->vao_lit.get());
-		}
-	}
-	else if (shader == shader_ad_unlit_)
+	auto builtinIndex = BuiltinShaderCount;
+	for (int32_t i = 0; i < BuiltinShaderCount; i++)
 	{
-		if (GetRenderMode() == ::Effekseer::RenderMode::Wireframe)
+		if (shaders_[i].shader.get() == shader)
 		{
-			SetVertexArray(ringv->vao->vao_ad_unlit_wire.get());
-		}
-		else
-		{
-			SetVertexArray(ringv->vao->vao_ad_unlit.get());
+			builtinIndex = i;
+			break;
 		}
 	}
-	else if (shader == shader_ad_distortion_)
+
+	if (m_currentVertexArray != nullptr)
 	{
-		if (GetRenderMode() == ::Effekseer::RenderMode::Wireframe)
-		{
-			SetVertexArray(ringv->vao->vao_ad_distortion_wire.get());
-		}
-		else
-		{
-			SetVertexArray(ringv->vao->vao_ad_distortion.get());
-		}
+		SetVertexArray(m_currentVertexArray);
 	}
-	else if (shader == shader_ad_lit_)
+	else if (builtinIndex < BuiltinShaderCount)
 	{
-		if (GetRenderMode() == ::Effekseer::RenderMode::Wireframe)
-		{
-			SetVertexArray(ringv->vao->vao_ad_lit_wire.get());
-		}
-		else
-		{
-			SetVertexArray(ringv->vao->vao_ad_lit.get());
-		}
+		SetVertexArray(GetVertexArray(static_cast<::EffekseerRenderer::RendererShaderType>(builtinIndex)));
 	}
 	else
 	{
@@ -32,6 +32,30 @@ namespace EffekseerRendererGL
 
 Effekseer::Backend::TextureRef CreateTexture(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, GLuint buffer, bool hasMipmap, const std::function<void()>& onDisposed);
 
+/**
+	@brief
+	\~English	Create a cache which stores program binaries as files in a directory
+	\~Japanese	プログラムバイナリをディレクトリ内のファイルとして保存するキャッシュを生成する。
+*/
+ProgramBinaryCacheRef CreateProgramBinaryCache(const char16_t* directory, ::Effekseer::FileInterface* fileInterface = nullptr);
+
+/**
+	@brief
+	\~English	Specify a cache of program binaries. It must be specified before shaders and materials are created.
+	\~Japanese	プログラムバイナリのキャッシュを設定する。シェーダーとマテリアルの生成前に設定する必要がある。
+*/
+void SetProgramBinaryCache(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, ProgramBinaryCacheRef programBinaryCache);
+
+/**
+	@brief
+	\~English	Specify a directory where codes generated from material files are cached. Codes are cached only on memory without it.
+	\~Japanese	マテリアルファイルから生成されたコードをキャッシュするディレクトリを設定する。設定しない場合、コードはメモリ上にのみキャッシュされる。
+	@note
+	\~English	The cache is shared among material loaders which are created with the graphics device.
+	\~Japanese	キャッシュはグラフィックスデバイスから生成されたマテリアルローダー間で共有される。
+*/
+void SetCompiledMaterialCacheDirectory(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, const char16_t* directory, ::Effekseer::FileInterface* fileInterface = nullptr);
+
 /**
 		@brief	\~English	Properties in a texture
 				\~Japanese	テクスチャ内のプロパティ
@@ -110,6 +134,23 @@ public:
 	\~japanese VAOがサポートされているか取得する。
 	*/
 	virtual bool IsVertexArrayObjectSupported() const = 0;
+
+	/**
+	@brief
+	\~English	Create built-in shaders which an effect requires in advance. Shaders which are not prepared are created when they are used first.
+	\~Japanese	エフェクトが必要とする組み込みシェーダーを事前に生成する。事前に生成されていないシェーダーは初めて使用される時に生成される。
+	@note
+	\~English	It must be called on a thread where the context is current.
+	\~Japanese	コンテキストがカレントのスレッドで呼ぶ必要がある。
+	*/
+	virtual void PrepareShaders(const ::Effekseer::EffectRef& effect) = 0;
+
+	/**
+	@brief
+	\~English	Get names of built-in shaders which are created currently
+	\~Japanese	現在生成されている組み込みシェーダーの名前を取得する。
+	*/
+	virtual std::vector<std::string> GetResidentShaderNames() const = 0;
 };
 
 } // namespace EffekseerRendererGL
@@ -46,33 +46,13 @@ struct RenderStateSet
 class RendererImplemented;
 using RendererImplementedRef = ::Effekseer::RefPtr<RendererImplemented>;
 
+//! the number of built-in shaders except a material
+static const int32_t BuiltinShaderCount = 6;
+
 struct VertexArrayGroup
 {
-	std::unique_ptr<VertexArray> vao_unlit;
-	std::unique_ptr<VertexArray> vao_distortion;
-	std::unique_ptr<VertexArray> vao_lit;
-	std::unique_ptr<VertexArray> vao_ad_unlit;
-	std::unique_ptr<VertexArray> vao_ad_lit;
-	std::unique_ptr<VertexArray> vao_ad_distortion;
-
-	std::unique_ptr<VertexArray> vao_unlit_wire;
-	std::unique_ptr<VertexArray> vao_distortion_wire;
-	std::unique_ptr<VertexArray> vao_lit_wire;
-	std::unique_ptr<VertexArray> vao_ad_unlit_wire;
-	std::unique_ptr<VertexArray> vao_ad_distortion_wire;
-	std::unique_ptr<VertexArray> vao_ad_lit_wire;
-
-	void Create(
-		Backend::GraphicsDeviceRef graphicsDevice,
-		VertexBuffer* vertexBuffer,
-		IndexBuffer* indexBuffer,
-		IndexBuffer* indexBufferForWireframe,
-		Shader* shader_unlit,
-		Shader* shader_distortion,
-		Shader* shader_lit,
-		Shader* shader_ad_unlit,
-		Shader* shader_ad_lit,
-		Shader* shader_ad_distortion);
+	std::array<std::unique_ptr<VertexArray>, BuiltinShaderCount> vaos;
+	std::array<std::unique_ptr<VertexArray>, BuiltinShaderCount> vaosForWireframe;
 };
 
 class RendererImplemented : public Renderer, public ::Effekseer::ReferenceObject
@@ -100,12 +80,16 @@ private:
 	IndexBuffer* m_indexBufferForWireframe = nullptr;
 	int32_t m_squareMaxCount;
 
-	Shader* shader_unlit_ = nullptr;
-	Shader* shader_distortion_ = nullptr;
-	Shader* shader_lit_ = nullptr;
-	Shader* shader_ad_unlit_ = nullptr;
-	Shader* shader_ad_lit_ = nullptr;
-	Shader* shader_ad_distortion_ = nullptr;
+	struct ShaderVariant
+	{
+		std::unique_ptr<Shader> shader;
+		bool isFailed = false;
+	};
+
+	//! built-in shaders are created when they are used first
+	std::array<ShaderVariant, BuiltinShaderCount> shaders_;
+	std::array<ShaderVariant, BuiltinShaderCount> modelShaders_;
+	std::array<ShaderVariant, BuiltinShaderCount> instanceBufferModelShaders_;
 
 	Shader* currentShader = nullptr;
 
@@ -245,7 +229,8 @@ public:
 	void DrawPolygon(int32_t vertexCount, int32_t indexCount);
 	void DrawPolygonInstanced(int32_t vertexCount, int32_t indexCount, int32_t instanceCount);
 
-	Shader* GetShader(::EffekseerRenderer::RendererShaderType type) const;
+	Shader* GetShader(::EffekseerRenderer::RendererShaderType type);
+	Shader* GetModelShader(::EffekseerRenderer::RendererShaderType type, bool isInstanceBufferUsed = false);
 	void BeginShader(Shader* shader);
 	void EndShader(Shader* shader);
 
@@ -269,6 +254,10 @@ public:
 
 	bool IsVertexArrayObjectSupported() const override;
 
+	void PrepareShaders(const ::Effekseer::EffectRef& effect) override;
+
+	std::vector<std::string> GetResidentShaderNames() const override;
+
 	Backend::GraphicsDeviceRef& GetInternalGraphicsDevice()
 	{
 		return graphicsDevice_;
@@ -293,6 +282,12 @@ public:
 	}
 
 private:
+	Shader* GetOrCreateShader(::EffekseerRenderer::RendererShaderType type);
+
+	Shader* CreateShader(::EffekseerRenderer::RendererShaderType type);
+
+	VertexArray* GetVertexArray(::EffekseerRenderer::RendererShaderType type);
+
 	void GenerateIndexData();
 
 	template <typename T>
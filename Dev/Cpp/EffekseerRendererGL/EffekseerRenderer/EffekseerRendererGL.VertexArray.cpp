@@ -70,7 +70,7 @@ void VertexArray::Init()
 {
 	GLCheckError();
 
-	if (!m_shader->IsValid())
+	if (m_shader != nullptr && !m_shader->IsValid())
 	{
 		m_shader->OnResetDevice();
 	}
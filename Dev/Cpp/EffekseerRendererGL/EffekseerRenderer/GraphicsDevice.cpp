@@ -25,6 +25,17 @@ namespace EffekseerRendererGL
 namespace Backend
 {
 
+static uint64_t HashFNV1a(const void* data, size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+	auto p = static_cast<const uint8_t*>(data);
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= p[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
 Effekseer::CustomVector<GLint> GetVertexAttribLocations(const VertexLayoutRef& vertexLayout, const ShaderRef& shader)
 {
 	Effekseer::CustomVector<GLint> ret;
@@ -415,15 +426,41 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 	bool woSampling = param.SampleCount <= 1;
 
 	// Compressed texture
-	auto isCompressed = param.Format == Effekseer::Backend::TextureFormatType::BC1 ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC2 ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC3 ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC1_SRGB ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC2_SRGB ||
-						param.Format == Effekseer::Backend::TextureFormatType::BC3_SRGB;
+	auto isCompressed = Effekseer::Backend::IsCompressedTextureFormat(param.Format);
 
 	const size_t initialDataSize = initialData.size();
-	const void* initialDataPtr = initialData.size() > 0 ? initialData.data() : nullptr;
+	const uint8_t* initialDataPtr = initialData.size() > 0 ? initialData.data() : nullptr;
+
+	// initial data may contain all mip levels
+	int32_t uploadedLevelCount = 1;
+	if (param.MipLevelCount > 1 && woSampling && param.Dimension == 2 &&
+		(param.Usage & Effekseer::Backend::TextureUsageType::Array) == Effekseer::Backend::TextureUsageType::None)
+	{
+		size_t levelsSize = 0;
+		for (int32_t level = 0; level < param.MipLevelCount; level++)
+		{
+			levelsSize += Effekseer::Backend::GetTextureMipLevelSize(param.Format, param.Size[0], param.Size[1], level);
+		}
+
+		if (levelsSize == initialDataSize)
+		{
+			uploadedLevelCount = param.MipLevelCount;
+		}
+	}
+
+	const auto getLevelData = [&](int32_t level) -> const void* {
+		if (initialDataPtr == nullptr)
+		{
+			return nullptr;
+		}
+
+		size_t offset = 0;
+		for (int32_t i = 0; i < level; i++)
+		{
+			offset += Effekseer::Backend::GetTextureMipLevelSize(param.Format, param.Size[0], param.Size[1], i);
+		}
+		return initialDataPtr + offset;
+	};
 
 	GLint bound = 0;
 	int boundTarget = GL_TEXTURE_BINDING_2D;
@@ -487,15 +524,85 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 		{
 			format = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
 		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::BC4)
+		{
+			format = GL_COMPRESSED_RED_RGTC1;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::BC5)
+		{
+			format = GL_COMPRESSED_RG_RGTC2;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::BC7)
+		{
+			format = GL_COMPRESSED_RGBA_BPTC_UNORM;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::BC7_SRGB)
+		{
+			format = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ETC2_RGB8)
+		{
+			format = GL_COMPRESSED_RGB8_ETC2;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ETC2_RGB8_SRGB)
+		{
+			format = GL_COMPRESSED_SRGB8_ETC2;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ETC2_RGBA8)
+		{
+			format = GL_COMPRESSED_RGBA8_ETC2_EAC;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ETC2_RGBA8_SRGB)
+		{
+			format = GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ASTC_4x4)
+		{
+			format = GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ASTC_4x4_SRGB)
+		{
+			format = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ASTC_6x6)
+		{
+			format = GL_COMPRESSED_RGBA_ASTC_6x6_KHR;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ASTC_6x6_SRGB)
+		{
+			format = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ASTC_8x8)
+		{
+			format = GL_COMPRESSED_RGBA_ASTC_8x8_KHR;
+		}
+		else if (param.Format == Effekseer::Backend::TextureFormatType::ASTC_8x8_SRGB)
+		{
+			format = GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR;
+		}
 
-		GLExt::glCompressedTexImage2D(target,
-									  0,
-									  format,
-									  param.Size[0],
-									  param.Size[1],
-									  0,
-									  static_cast<GLsizei>(initialDataSize),
-									  initialDataPtr);
+		// clear a previous error to detect whether the format is supported
+		glGetError();
+
+		for (int32_t level = 0; level < uploadedLevelCount; level++)
+		{
+			GLExt::glCompressedTexImage2D(target,
+										  level,
+										  format,
+										  std::max(param.Size[0] >> level, 1),
+										  std::max(param.Size[1] >> level, 1),
+										  0,
+										  Effekseer::Backend::GetTextureMipLevelSize(param.Format, param.Size[0], param.Size[1], level),
+										  getLevelData(level));
+		}
+
+		// a format may not be supported by a device
+		if (glGetError() != GL_NO_ERROR)
+		{
+			Effekseer::Log(Effekseer::LogType::Error, "The compressed format is not supported by a device.(" + std::to_string(static_cast<int>(param.Format)) + ")");
+			glBindTexture(target, bound);
+			return false;
+		}
 	}
 	else
 	{
@@ -582,15 +689,18 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 			}
 			else
 			{
-				glTexImage2D(target,
-							 0,
-							 internalFormat,
-							 param.Size[0],
-							 param.Size[1],
-							 0,
-							 format,
-							 type,
-							 initialDataPtr);
+				for (int32_t level = 0; level < uploadedLevelCount; level++)
+				{
+					glTexImage2D(target,
+								 level,
+								 internalFormat,
+								 std::max(param.Size[0] >> level, 1),
+								 std::max(param.Size[1] >> level, 1),
+								 0,
+								 format,
+								 type,
+								 getLevelData(level));
+				}
 			}
 		}
 		else
@@ -599,11 +709,21 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 		}
 	}
 
-	if (param.MipLevelCount != 1)
+	// mipmaps of compressed textures cannot be generated
+	const bool hasMipmap = uploadedLevelCount > 1 || (param.MipLevelCount != 1 && !isCompressed);
+
+	if (param.MipLevelCount != 1 && uploadedLevelCount == 1 && !isCompressed)
 	{
 		GLExt::glGenerateMipmap(target);
 	}
 
+#if !defined(__EFFEKSEER_RENDERER_GLES2__)
+	if (uploadedLevelCount > 1 && graphicsDevice_->GetDeviceType() != OpenGLDeviceType::OpenGLES2)
+	{
+		glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, uploadedLevelCount - 1);
+	}
+#endif
+
 	if (woSampling)
 	{
 		glBindTexture(target, bound);
@@ -615,6 +735,12 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 
 	target_ = target;
 	param_ = param;
+
+	if (!hasMipmap)
+	{
+		param_.MipLevelCount = 1;
+	}
+
 	return true;
 }
 
@@ -742,7 +868,82 @@ Shader::~Shader()
 	ES_SAFE_RELEASE(graphicsDevice_);
 }
 
-bool Shader::Compile()
+uint64_t Shader::GetBinaryKey() const
+{
+	uint64_t key = graphicsDevice_->GetDriverHash();
+
+	for (const auto& code : vsCodes_)
+	{
+		key = HashFNV1a(code.data(), code.size(), key);
+	}
+
+	// separate stages not to collide when a code is moved into another stage
+	key = HashFNV1a("|", 1, key);
+
+	for (const auto& code : psCodes_)
+	{
+		key = HashFNV1a(code.data(), code.size(), key);
+	}
+
+	return key;
+}
+
+GLuint Shader::LoadProgramBinary(uint64_t key)
+{
+	Effekseer::CustomVector<uint8_t> data;
+	if (!graphicsDevice_->GetProgramBinaryCache()->Load(key, data))
+	{
+		return 0;
+	}
+
+	GLenum binaryFormat = 0;
+	if (data.size() <= sizeof(GLenum))
+	{
+		return 0;
+	}
+
+	memcpy(&binaryFormat, data.data(), sizeof(GLenum));
+
+	auto program = GLExt::glCreateProgram();
+	GLExt::glProgramBinary(program, binaryFormat, data.data() + sizeof(GLenum), static_cast<GLsizei>(data.size() - sizeof(GLenum)));
+
+	// a binary is rejected when a driver is changed
+	GLint res_link = GL_FALSE;
+	GLExt::glGetProgramiv(program, GL_LINK_STATUS, &res_link);
+	if (res_link == GL_FALSE)
+	{
+		GLExt::glDeleteProgram(program);
+		return 0;
+	}
+
+	return program;
+}
+
+void Shader::StoreProgramBinary(GLuint program, uint64_t key)
+{
+	GLint length = 0;
+	GLExt::glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+	{
+		return;
+	}
+
+	Effekseer::CustomVector<uint8_t> data;
+	data.resize(sizeof(GLenum) + length);
+
+	GLenum binaryFormat = 0;
+	GLsizei writtenLength = 0;
+	GLExt::glGetProgramBinary(program, length, &writtenLength, &binaryFormat, data.data() + sizeof(GLenum));
+	if (writtenLength <= 0)
+	{
+		return;
+	}
+
+	memcpy(data.data(), &binaryFormat, sizeof(GLenum));
+	graphicsDevice_->GetProgramBinaryCache()->Save(key, data.data(), static_cast<int32_t>(sizeof(GLenum) + writtenLength));
+}
+
+GLuint Shader::CompileProgram(bool isRetrievable)
 {
 	std::array<GLchar*, elementMax> vsCodePtr;
 	std::array<GLchar*, elementMax> psCodePtr;
@@ -778,6 +979,11 @@ bool Shader::Compile()
 	GLExt::glAttachShader(program, vert_shader);
 	GLExt::glAttachShader(program, frag_shader);
 
+	if (isRetrievable)
+	{
+		GLExt::glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
 	// link shaders
 	GLExt::glLinkProgram(program);
 	GLExt::glGetProgramiv(program, GL_LINK_STATUS, &res_link);
@@ -815,7 +1021,37 @@ bool Shader::Compile()
 	if (res_link == GL_FALSE)
 	{
 		GLExt::glDeleteProgram(program);
-		return false;
+		return 0;
+	}
+
+	return program;
+}
+
+bool Shader::Compile()
+{
+	const bool isBinaryCacheEnabled = graphicsDevice_->GetProgramBinaryCache() != nullptr && GLExt::IsSupportedProgramBinary();
+	const uint64_t binaryKey = isBinaryCacheEnabled ? GetBinaryKey() : 0;
+
+	GLuint program = 0;
+
+	if (isBinaryCacheEnabled)
+	{
+		program = LoadProgramBinary(binaryKey);
+	}
+
+	if (program == 0)
+	{
+		program = CompileProgram(isBinaryCacheEnabled);
+
+		if (program == 0)
+		{
+			return false;
+		}
+
+		if (isBinaryCacheEnabled)
+		{
+			StoreProgramBinary(program, binaryKey);
+		}
 	}
 
 	program_ = program;
@@ -985,6 +1221,7 @@ bool RenderPass::Init(Effekseer::FixedSizeVector<Effekseer::Backend::TextureRef,
 
 GraphicsDevice::GraphicsDevice(OpenGLDeviceType deviceType, bool isExtensionsEnabled)
 	: deviceType_(deviceType)
+	, compiledMaterialCache_(Effekseer::MakeRefPtr<Effekseer::CompiledMaterialCache>())
 {
 	if (!GLExt::Initialize(deviceType, isExtensionsEnabled))
 	{
@@ -1003,6 +1240,16 @@ GraphicsDevice::GraphicsDevice(OpenGLDeviceType deviceType, bool isExtensionsEna
 	}
 
 	GLExt::glGenFramebuffers(1, &frameBufferTemp_);
+
+	driverHash_ = HashFNV1a(&deviceType, sizeof(OpenGLDeviceType));
+	for (auto name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+	{
+		auto str = reinterpret_cast<const char*>(glGetString(name));
+		if (str != nullptr)
+		{
+			driverHash_ = HashFNV1a(str, strlen(str), driverHash_);
+		}
+	}
 }
 
 GraphicsDevice::~GraphicsDevice()
@@ -1591,5 +1838,30 @@ Effekseer::Backend::TextureRef GraphicsDevice::CreateTexture(GLuint buffer, bool
 	return ret;
 }
 
+void GraphicsDevice::SetProgramBinaryCache(const ProgramBinaryCacheRef& programBinaryCache)
+{
+	programBinaryCache_ = programBinaryCache;
+}
+
+const ProgramBinaryCacheRef& GraphicsDevice::GetProgramBinaryCache() const
+{
+	return programBinaryCache_;
+}
+
+uint64_t GraphicsDevice::GetDriverHash() const
+{
+	return driverHash_;
+}
+
+void GraphicsDevice::SetCompiledMaterialCache(const Effekseer::CompiledMaterialCacheRef& compiledMaterialCache)
+{
+	compiledMaterialCache_ = compiledMaterialCache;
+}
+
+const Effekseer::CompiledMaterialCacheRef& GraphicsDevice::GetCompiledMaterialCache() const
+{
+	return compiledMaterialCache_;
+}
+
 } // namespace Backend
 } // namespace EffekseerRendererGL
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "EffekseerRendererGL.GLExtension.h"
 #include <Effekseer.h>
+#include <Effekseer/Material/Effekseer.CompiledMaterialCache.h>
 #include <assert.h>
 #include <functional>
 #include <set>
@@ -234,6 +235,11 @@ private:
 	Effekseer::CustomVector<GLint> textureLocations_;
 	Effekseer::CustomVector<GLint> uniformLocations_;
 
+	uint64_t GetBinaryKey() const;
+	GLuint LoadProgramBinary(uint64_t key);
+	void StoreProgramBinary(GLuint program, uint64_t key);
+	GLuint CompileProgram(bool isRetrievable);
+
 	bool Compile();
 	void Reset();
 
@@ -337,6 +343,9 @@ private:
 	GLuint frameBufferTemp_ = 0;
 	std::map<DevicePropertyType, int> properties_;
 	bool isValid_ = true;
+	ProgramBinaryCacheRef programBinaryCache_;
+	uint64_t driverHash_ = 0;
+	Effekseer::CompiledMaterialCacheRef compiledMaterialCache_;
 
 public:
 	GraphicsDevice(OpenGLDeviceType deviceType, bool isExtensionsEnabled = true);
@@ -395,6 +404,18 @@ public:
 	}
 
 	Effekseer::Backend::TextureRef CreateTexture(GLuint buffer, bool hasMipmap, const std::function<void()>& onDisposed);
+
+	void SetProgramBinaryCache(const ProgramBinaryCacheRef& programBinaryCache);
+
+	const ProgramBinaryCacheRef& GetProgramBinaryCache() const;
+
+	//! a hash of a vendor, a renderer and a version of the driver to invalidate cached binaries
+	uint64_t GetDriverHash() const;
+
+	void SetCompiledMaterialCache(const Effekseer::CompiledMaterialCacheRef& compiledMaterialCache);
+
+	//! a cache of codes which are generated from material files. It is shared among material loaders.
+	const Effekseer::CompiledMaterialCacheRef& GetCompiledMaterialCache() const;
 };
 
 } // namespace Backend
@@ -71,6 +71,37 @@ enum class OpenGLDeviceType
 	OpenGLES3,
 };
 
+/**
+	@brief
+	\~English	A storage of linked program binaries to skip compiling and linking shaders
+	\~Japanese	シェーダーのコンパイルとリンクを省略するためのプログラムバイナリの保存先
+	@note
+	\~English	Keys are generated from shader codes and a driver. A cache may be shared among graphics devices on other threads.
+	\~Japanese	キーはシェーダーのコードとドライバから生成される。キャッシュは他のスレッドのグラフィックスデバイスと共有してもよい。
+*/
+class ProgramBinaryCache : public ::Effekseer::ReferenceObject
+{
+public:
+	ProgramBinaryCache() = default;
+	virtual ~ProgramBinaryCache() = default;
+
+	/**
+		@brief
+		\~English	Load a binary. Return false if it is not found.
+		\~Japanese	バイナリを読み込む。見つからない場合はfalseを返す。
+	*/
+	virtual bool Load(uint64_t key, ::Effekseer::CustomVector<uint8_t>& data) = 0;
+
+	/**
+		@brief
+		\~English	Save a binary.
+		\~Japanese	バイナリを保存する。
+	*/
+	virtual void Save(uint64_t key, const void* data, int32_t size) = 0;
+};
+
+using ProgramBinaryCacheRef = ::Effekseer::RefPtr<ProgramBinaryCache>;
+
 } // namespace EffekseerRendererGL
 
 #endif // __EFFEKSEERRENDERER_GL_BASE_PRE_H__
@@ -200,10 +231,63 @@ struct DepthReconstructionParameter
 	float ProjectionMatrix44 = 0.0f;
 };
 
+/**
+	@brief
+	\~English	A decoder of image files which is used by a texture loader created with CreateTextureLoader
+	\~Japanese	CreateTextureLoaderで生成されたテクスチャローダーで使用される画像ファイルのデコーダー
+*/
+class TextureDecoder : public ::Effekseer::ReferenceObject
+{
+public:
+	TextureDecoder() = default;
+	virtual ~TextureDecoder() = default;
+
+	/**
+		@brief
+		\~English	Decode an image into dst. Return false if the image is not supported.
+		\~Japanese	画像をdstにデコードする。対応していない画像の場合、falseを返す。
+		@note
+		\~English	It is called from multiple threads at the same time when textures of an effect are loaded.
+		\~Japanese	エフェクトのテクスチャが読み込まれるとき、複数のスレッドから同時に呼ばれる。
+		@param	data
+		\~English	An image file. It may be a memory mapped file. It is valid only while this function is called.
+		\~Japanese	画像ファイル。メモリマップされたファイルの場合がある。この関数の呼び出し中のみ有効である。
+		@param	param
+		\~English	A parameter to create a texture. MipLevelCount is 0 if mipmaps should be generated.
+		\~Japanese	テクスチャを生成するためのパラメーター。ミップマップを生成する場合、MipLevelCountは0である。
+		@param	dst
+		\~English	A buffer which is reused among images. Resize it and write pixels into it.
+		\~Japanese	画像の間で再利用されるバッファ。リサイズし、ピクセルを書き込む。
+	*/
+	virtual bool Decode(const void* data, int32_t size, ::Effekseer::Backend::TextureParameter& param, ::Effekseer::CustomVector<uint8_t>& dst) = 0;
+
+	/**
+		@brief
+		\~English	Whether R8G8B8A8_UNORM is converted into R8G8B8A8_UNORM_SRGB for color textures in a linear color space. Return false if images specify a color space.
+		\~Japanese	リニア色空間のカラーテクスチャの場合、R8G8B8A8_UNORMをR8G8B8A8_UNORM_SRGBに変換するか。画像が色空間を指定する場合、falseを返す。
+	*/
+	virtual bool IsColorSpaceConverted() const
+	{
+		return true;
+	}
+};
+
+using TextureDecoderRef = ::Effekseer::RefPtr<TextureDecoder>;
+
 ::Effekseer::TextureLoaderRef CreateTextureLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice,
 												  ::Effekseer::FileInterface* fileInterface = nullptr,
 												  ::Effekseer::ColorSpaceType colorSpaceType = ::Effekseer::ColorSpaceType::Gamma);
 
+/**
+	@brief
+	\~English	Create a texture loader with additional decoders. They are tried before built-in decoders.
+	\~Japanese	追加のデコーダーを持つテクスチャローダーを生成する。それらは組み込みのデコーダーより先に試される。
+*/
+::Effekseer::TextureLoaderRef CreateTextureLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice,
+												  ::Effekseer::FileInterface* fileInterface,
+												  ::Effekseer::ColorSpaceType colorSpaceType,
+												  const ::Effekseer::CustomVector<TextureDecoderRef>& decoders);
+
 ::Effekseer::ModelLoaderRef CreateModelLoader(::Effekseer::Backend::GraphicsDeviceRef gprahicsDevice, ::Effekseer::FileInterface* fileInterface = nullptr);
 
 class Renderer : public ::Effekseer::IReference
@@ -586,6 +670,30 @@ namespace EffekseerRendererGL
 
 Effekseer::Backend::TextureRef CreateTexture(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, GLuint buffer, bool hasMipmap, const std::function<void()>& onDisposed);
 
+/**
+	@brief
+	\~English	Create a cache which stores program binaries as files in a directory
+	\~Japanese	プログラムバイナリをディレクトリ内のファイルとして保存するキャッシュを生成する。
+*/
+ProgramBinaryCacheRef CreateProgramBinaryCache(const char16_t* directory, ::Effekseer::FileInterface* fileInterface = nullptr);
+
+/**
+	@brief
+	\~English	Specify a cache of program binaries. It must be specified before shaders and materials are created.
+	\~Japanese	プログラムバイナリのキャッシュを設定する。シェーダーとマテリアルの生成前に設定する必要がある。
+*/
+void SetProgramBinaryCache(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, ProgramBinaryCacheRef programBinaryCache);
+
+/**
+	@brief
+	\~English	Specify a directory where codes generated from material files are cached. Codes are cached only on memory without it.
+	\~Japanese	マテリアルファイルから生成されたコードをキャッシュするディレクトリを設定する。設定しない場合、コードはメモリ上にのみキャッシュされる。
+	@note
+	\~English	The cache is shared among material loaders which are created with the graphics device.
+	\~Japanese	キャッシュはグラフィックスデバイスから生成されたマテリアルローダー間で共有される。
+*/
+void SetCompiledMaterialCacheDirectory(Effekseer::Backend::GraphicsDeviceRef graphicsDevice, const char16_t* directory, ::Effekseer::FileInterface* fileInterface = nullptr);
+
 /**
 		@brief	\~English	Properties in a texture
 				\~Japanese	テクスチャ内のプロパティ
@@ -664,6 +772,23 @@ public:
 	\~japanese VAOがサポートされているか取得する。
 	*/
 	virtual bool IsVertexArrayObjectSupported() const = 0;
+
+	/**
+	@brief
+	\~English	Create built-in shaders which an effect requires in advance. Shaders which are not prepared are created when they are used first.
+	\~Japanese	エフェクトが必要とする組み込みシェーダーを事前に生成する。事前に生成されていないシェーダーは初めて使用される時に生成される。
+	@note
+	\~English	It must be called on a thread where the context is current.
+	\~Japanese	コンテキストがカレントのスレッドで呼ぶ必要がある。
+	*/
+	virtual void PrepareShaders(const ::Effekseer::EffectRef& effect) = 0;
+
+	/**
+	@brief
+	\~English	Get names of built-in shaders which are created currently
+	\~Japanese	現在生成されている組み込みシェーダーの名前を取得する。
+	*/
+	virtual std::vector<std::string> GetResidentShaderNames() const = 0;
 };
 
 } // namespace EffekseerRendererGL
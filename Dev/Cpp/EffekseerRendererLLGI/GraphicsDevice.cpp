@@ -226,7 +226,9 @@ bool Texture::Init(const Effekseer::Backend::TextureParameter& param, const Effe
 
 	if (initialData.size() > 0)
 	{
-		memcpy(buf, initialData.data(), initialData.size());
+		// initial data may contain other mip levels, but only the first level is uploaded
+		const auto levelSize = Effekseer::Backend::GetTextureMipLevelSize(param.Format, param.Size[0], param.Size[1], 0);
+		memcpy(buf, initialData.data(), std::min(initialData.size(), static_cast<size_t>(levelSize)));
 	}
 
 	texture->Unlock();
@@ -0,0 +1,245 @@
+#include "BlockCompression.h"
+#include <algorithm>
+#include <math.h>
+
+namespace EffekseerTextureConverter
+{
+
+namespace
+{
+
+uint16_t ToRGB565(const float* color)
+{
+	auto r = static_cast<uint16_t>(std::min(std::max(color[0], 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+	auto g = static_cast<uint16_t>(std::min(std::max(color[1], 0.0f), 255.0f) * 63.0f / 255.0f + 0.5f);
+	auto b = static_cast<uint16_t>(std::min(std::max(color[2], 0.0f), 255.0f) * 31.0f / 255.0f + 0.5f);
+	return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void FromRGB565(uint16_t value, float* color)
+{
+	color[0] = static_cast<float>((value >> 11) & 31) * 255.0f / 31.0f;
+	color[1] = static_cast<float>((value >> 5) & 63) * 255.0f / 63.0f;
+	color[2] = static_cast<float>(value & 31) * 255.0f / 31.0f;
+}
+
+//! find endpoints along the principal axis of colors
+void FindEndpoints(const uint8_t* rgba, const bool* enabled, float* minColor, float* maxColor)
+{
+	float mean[3] = {0.0f, 0.0f, 0.0f};
+	int32_t count = 0;
+
+	for (int32_t i = 0; i < 16; i++)
+	{
+		if (!enabled[i])
+		{
+			continue;
+		}
+
+		for (int32_t c = 0; c < 3; c++)
+		{
+			mean[c] += rgba[i * 4 + c];
+		}
+		count++;
+	}
+
+	if (count == 0)
+	{
+		std::fill(minColor, minColor + 3, 0.0f);
+		std::fill(maxColor, maxColor + 3, 0.0f);
+		return;
+	}
+
+	for (int32_t c = 0; c < 3; c++)
+	{
+		mean[c] /= count;
+	}
+
+	float cov[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+	for (int32_t i = 0; i < 16; i++)
+	{
+		if (!enabled[i])
+		{
+			continue;
+		}
+
+		const float r = rgba[i * 4 + 0] - mean[0];
+		const float g = rgba[i * 4 + 1] - mean[1];
+		const float b = rgba[i * 4 + 2] - mean[2];
+		cov[0] += r * r;
+		cov[1] += r * g;
+		cov[2] += r * b;
+		cov[3] += g * g;
+		cov[4] += g * b;
+		cov[5] += b * b;
+	}
+
+	// power iteration
+	float axis[3] = {1.0f, 1.0f, 1.0f};
+	for (int32_t iter = 0; iter < 8; iter++)
+	{
+		const float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+		const float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+		const float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+		const float length = sqrtf(x * x + y * y + z * z);
+		if (length < 1.0e-6f)
+		{
+			break;
+		}
+		axis[0] = x / length;
+		axis[1] = y / length;
+		axis[2] = z / length;
+	}
+
+	float minT = 0.0f;
+	float maxT = 0.0f;
+	for (int32_t i = 0; i < 16; i++)
+	{
+		if (!enabled[i])
+		{
+			continue;
+		}
+
+		const float t = (rgba[i * 4 + 0] - mean[0]) * axis[0] + (rgba[i * 4 + 1] - mean[1]) * axis[1] + (rgba[i * 4 + 2] - mean[2]) * axis[2];
+		minT = std::min(minT, t);
+		maxT = std::max(maxT, t);
+	}
+
+	for (int32_t c = 0; c < 3; c++)
+	{
+		minColor[c] = mean[c] + axis[c] * minT;
+		maxColor[c] = mean[c] + axis[c] * maxT;
+	}
+}
+
+void CompressColorBlock(const uint8_t* rgba, uint8_t* dst, bool isAlphaUsed)
+{
+	bool enabled[16];
+	bool hasTransparent = false;
+	for (int32_t i = 0; i < 16; i++)
+	{
+		enabled[i] = !isAlphaUsed || rgba[i * 4 + 3] >= 128;
+		hasTransparent |= !enabled[i];
+	}
+
+	float minColor[3];
+	float maxColor[3];
+	FindEndpoints(rgba, enabled, minColor, maxColor);
+
+	uint16_t color0 = ToRGB565(maxColor);
+	uint16_t color1 = ToRGB565(minColor);
+
+	// color0 > color1 means 4 colors and color0 <= color1 means 3 colors and transparent
+	if ((color0 < color1) != hasTransparent)
+	{
+		std::swap(color0, color1);
+	}
+
+	float palette[4][3];
+	FromRGB565(color0, palette[0]);
+	FromRGB565(color1, palette[1]);
+
+	int32_t paletteCount = 4;
+	if (color0 > color1)
+	{
+		for (int32_t c = 0; c < 3; c++)
+		{
+			palette[2][c] = (palette[0][c] * 2.0f + palette[1][c]) / 3.0f;
+			palette[3][c] = (palette[0][c] + palette[1][c] * 2.0f) / 3.0f;
+		}
+	}
+	else
+	{
+		for (int32_t c = 0; c < 3; c++)
+		{
+			palette[2][c] = (palette[0][c] + palette[1][c]) / 2.0f;
+		}
+		paletteCount = 3;
+	}
+
+	uint32_t indices = 0;
+	for (int32_t i = 0; i < 16; i++)
+	{
+		uint32_t best = 3;
+
+		if (enabled[i])
+		{
+			float bestDistance = 1.0e+30f;
+			for (int32_t p = 0; p < paletteCount; p++)
+			{
+				float distance = 0.0f;
+				for (int32_t c = 0; c < 3; c++)
+				{
+					const float d = palette[p][c] - rgba[i * 4 + c];
+					distance += d * d;
+				}
+
+				if (distance < bestDistance)
+				{
+					bestDistance = distance;
+					best = p;
+				}
+			}
+		}
+
+		indices |= best << (i * 2);
+	}
+
+	dst[0] = static_cast<uint8_t>(color0 & 0xFF);
+	dst[1] = static_cast<uint8_t>(color0 >> 8);
+	dst[2] = static_cast<uint8_t>(color1 & 0xFF);
+	dst[3] = static_cast<uint8_t>(color1 >> 8);
+	for (int32_t i = 0; i < 4; i++)
+	{
+		dst[4 + i] = static_cast<uint8_t>(indices >> (i * 8));
+	}
+}
+
+void CompressAlphaBlock(const uint8_t* rgba, uint8_t* dst)
+{
+	uint8_t alpha0 = 0;
+	uint8_t alpha1 = 255;
+	for (int32_t i = 0; i < 16; i++)
+	{
+		alpha0 = std::max(alpha0, rgba[i * 4 + 3]);
+		alpha1 = std::min(alpha1, rgba[i * 4 + 3]);
+	}
+
+	uint64_t indices = 0;
+
+	if (alpha0 > alpha1)
+	{
+		// 8 alphas which are interpolated from alpha0 to alpha1
+		const float range = static_cast<float>(alpha0 - alpha1);
+		const uint64_t orders[8] = {1, 7, 6, 5, 4, 3, 2, 0};
+
+		for (int32_t i = 0; i < 16; i++)
+		{
+			const float t = static_cast<float>(rgba[i * 4 + 3] - alpha1) / range * 7.0f;
+			const auto step = static_cast<int32_t>(t + 0.5f);
+			indices |= orders[step] << (i * 3);
+		}
+	}
+
+	dst[0] = alpha0;
+	dst[1] = alpha1;
+	for (int32_t i = 0; i < 6; i++)
+	{
+		dst[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+	}
+}
+
+} // namespace
+
+void CompressBC1Block(const uint8_t* rgba, uint8_t* dst)
+{
+	CompressColorBlock(rgba, dst, true);
+}
+
+void CompressBC3Block(const uint8_t* rgba, uint8_t* dst)
+{
+	CompressAlphaBlock(rgba, dst);
+	CompressColorBlock(rgba, dst + 8, false);
+}
+
+} // namespace EffekseerTextureConverter
@@ -0,0 +1,23 @@
+#ifndef __EFFEKSEERTEXTURECONVERTER_BLOCKCOMPRESSION_H__
+#define __EFFEKSEERTEXTURECONVERTER_BLOCKCOMPRESSION_H__
+
+#include <stdint.h>
+
+namespace EffekseerTextureConverter
+{
+
+/**
+	@brief	Compress a 4x4 RGBA8 block into a 8 bytes BC1 block
+	@note
+	Pixels whose alpha is less than 128 become transparent.
+*/
+void CompressBC1Block(const uint8_t* rgba, uint8_t* dst);
+
+/**
+	@brief	Compress a 4x4 RGBA8 block into a 16 bytes BC3 block
+*/
+void CompressBC3Block(const uint8_t* rgba, uint8_t* dst);
+
+} // namespace EffekseerTextureConverter
+
+#endif // __EFFEKSEERTEXTURECONVERTER_BLOCKCOMPRESSION_H__
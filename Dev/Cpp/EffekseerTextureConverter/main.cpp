@@ -0,0 +1,483 @@
+#include "../EffekseerRendererCommon/EffekseerRenderer.PngTextureLoader.h"
+#include "../EffekseerRendererCommon/EffekseerRenderer.TGATextureLoader.h"
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+enum class OutputFormat
+{
+	RGBA8,
+	BC1,
+	BC3,
+};
+
+struct Option
+{
+	fs::path Input;
+	fs::path Output;
+	OutputFormat Format = OutputFormat::RGBA8;
+	bool IsSRGB = false;
+	bool IsMipEnabled = true;
+};
+
+struct Image
+{
+	int32_t Width = 0;
+	int32_t Height = 0;
+	std::vector<uint8_t> Data;
+};
+
+void PrintUsage()
+{
+	std::cout << "Usage : EffekseerTextureConverter <input file|directory> <output file|directory> [--format rgba8|bc1|bc3] [--srgb] [--no-mip]" << std::endl;
+	std::cout << "Convert .png and .tga into KTX2 with a mipmap chain." << std::endl;
+	std::cout << "Converted files keep their names, so effects can load them without any changes." << std::endl;
+}
+
+bool ParseOption(int argc, char* argv[], Option& option)
+{
+	std::vector<std::string> positionals;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+
+		if (arg == "--format" && i + 1 < argc)
+		{
+			const std::string format = argv[++i];
+			if (format == "rgba8")
+			{
+				option.Format = OutputFormat::RGBA8;
+			}
+			else if (format == "bc1")
+			{
+				option.Format = OutputFormat::BC1;
+			}
+			else if (format == "bc3")
+			{
+				option.Format = OutputFormat::BC3;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		else if (arg == "--srgb")
+		{
+			option.IsSRGB = true;
+		}
+		else if (arg == "--no-mip")
+		{
+			option.IsMipEnabled = false;
+		}
+		else
+		{
+			positionals.emplace_back(arg);
+		}
+	}
+
+	if (positionals.size() != 2)
+	{
+		return false;
+	}
+
+	option.Input = positionals[0];
+	option.Output = positionals[1];
+	return true;
+}
+
+bool ReadFile(const fs::path& path, std::vector<uint8_t>& data)
+{
+	std::ifstream ifs(path, std::ios::binary);
+	if (!ifs)
+	{
+		return false;
+	}
+
+	data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+	return true;
+}
+
+bool WriteFile(const fs::path& path, const std::vector<uint8_t>& data)
+{
+	std::error_code ec;
+	if (path.has_parent_path())
+	{
+		fs::create_directories(path.parent_path(), ec);
+	}
+
+	std::ofstream ofs(path, std::ios::binary);
+	if (!ofs)
+	{
+		return false;
+	}
+
+	ofs.write(reinterpret_cast<const char*>(data.data()), data.size());
+	return static_cast<bool>(ofs);
+}
+
+bool LoadImage(const std::vector<uint8_t>& data, Image& image)
+{
+	const auto size = static_cast<int32_t>(data.size());
+	Effekseer::CustomVector<uint8_t> pixels;
+
+	if (size >= 4 && data[1] == 'P' && data[2] == 'N' && data[3] == 'G')
+	{
+		EffekseerRenderer::PngTextureLoader loader;
+		if (!loader.Load(data.data(), size, false, pixels))
+		{
+			return false;
+		}
+		image.Width = loader.GetWidth();
+		image.Height = loader.GetHeight();
+	}
+	else
+	{
+		EffekseerRenderer::TGATextureLoader loader;
+		if (!loader.Load(data.data(), size, pixels))
+		{
+			return false;
+		}
+		image.Width = loader.GetWidth();
+		image.Height = loader.GetHeight();
+	}
+
+	image.Data.assign(pixels.begin(), pixels.end());
+	return image.Width > 0 && image.Height > 0;
+}
+
+float ToLinear(uint8_t value)
+{
+	const float v = value / 255.0f;
+	return v <= 0.04045f ? v / 12.92f : powf((v + 0.055f) / 1.055f, 2.4f);
+}
+
+uint8_t ToGamma(float value)
+{
+	const float v = value <= 0.0031308f ? value * 12.92f : 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+	return static_cast<uint8_t>(std::min(std::max(v, 0.0f), 1.0f) * 255.0f + 0.5f);
+}
+
+//! generate a next level with a box filter
+Image GenerateNextLevel(const Image& src, bool isSRGB)
+{
+	Image dst;
+	dst.Width = std::max(src.Width / 2, 1);
+	dst.Height = std::max(src.Height / 2, 1);
+	dst.Data.resize(dst.Width * dst.Height * 4);
+
+	for (int32_t y = 0; y < dst.Height; y++)
+	{
+		for (int32_t x = 0; x < dst.Width; x++)
+		{
+			const int32_t x0 = std::min(x * 2, src.Width - 1);
+			const int32_t x1 = std::min(x * 2 + 1, src.Width - 1);
+			const int32_t y0 = std::min(y * 2, src.Height - 1);
+			const int32_t y1 = std::min(y * 2 + 1, src.Height - 1);
+			const int32_t offsets[4] = {
+				(x0 + y0 * src.Width) * 4,
+				(x1 + y0 * src.Width) * 4,
+				(x0 + y1 * src.Width) * 4,
+				(x1 + y1 * src.Width) * 4,
+			};
+
+			for (int32_t c = 0; c < 4; c++)
+			{
+				// colors are averaged in a linear space
+				if (isSRGB && c < 3)
+				{
+					float sum = 0.0f;
+					for (auto offset : offsets)
+					{
+						sum += ToLinear(src.Data[offset + c]);
+					}
+					dst.Data[(x + y * dst.Width) * 4 + c] = ToGamma(sum / 4.0f);
+				}
+				else
+				{
+					int32_t sum = 0;
+					for (auto offset : offsets)
+					{
+						sum += src.Data[offset + c];
+					}
+					dst.Data[(x + y * dst.Width) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+				}
+			}
+		}
+	}
+
+	return dst;
+}
+
+std::vector<uint8_t> EncodeLevel(const Image& image, OutputFormat format)
+{
+	if (format == OutputFormat::RGBA8)
+	{
+		return image.Data;
+	}
+
+	const int32_t blockBytes = format == OutputFormat::BC1 ? 8 : 16;
+	const int32_t blockCountX = (image.Width + 3) / 4;
+	const int32_t blockCountY = (image.Height + 3) / 4;
+	std::vector<uint8_t> dst(blockCountX * blockCountY * blockBytes);
+
+	uint8_t block[16 * 4];
+	for (int32_t by = 0; by < blockCountY; by++)
+	{
+		for (int32_t bx = 0; bx < blockCountX; bx++)
+		{
+			// edges are clamped
+			for (int32_t i = 0; i < 16; i++)
+			{
+				const int32_t x = std::min(bx * 4 + i % 4, image.Width - 1);
+				const int32_t y = std::min(by * 4 + i / 4, image.Height - 1);
+				memcpy(block + i * 4, image.Data.data() + (x + y * image.Width) * 4, 4);
+			}
+
+			auto p = dst.data() + (bx + by * blockCountX) * blockBytes;
+			if (format == OutputFormat::BC1)
+			{
+				EffekseerTextureConverter::CompressBC1Block(block, p);
+			}
+			else
+			{
+				EffekseerTextureConverter::CompressBC3Block(block, p);
+			}
+		}
+	}
+
+	return dst;
+}
+
+template <typename T>
+void Write(std::vector<uint8_t>& dst, size_t offset, T value)
+{
+	memcpy(dst.data() + offset, &value, sizeof(T));
+}
+
+//! create a basic data format descriptor
+std::vector<uint32_t> CreateDFD(OutputFormat format, bool isSRGB)
+{
+	struct Sample
+	{
+		uint32_t BitOffset;
+		uint32_t BitLength;
+		uint32_t Channel;
+		uint32_t Lower;
+		uint32_t Upper;
+	};
+
+	std::vector<Sample> samples;
+	uint32_t model = 0;
+	uint32_t blockDimension = 0;
+	uint32_t bytesPlane0 = 0;
+
+	// KHR_DF_SAMPLE_DATATYPE_LINEAR
+	const uint32_t linearFlag = 0x80;
+
+	if (format == OutputFormat::RGBA8)
+	{
+		model = 1; // KHR_DF_MODEL_RGBSDA
+		bytesPlane0 = 4;
+		samples.push_back({0, 8, 0, 0, 255});
+		samples.push_back({8, 8, 1, 0, 255});
+		samples.push_back({16, 8, 2, 0, 255});
+		samples.push_back({24, 8, 15 | (isSRGB ? linearFlag : 0), 0, 255});
+	}
+	else if (format == OutputFormat::BC1)
+	{
+		model = 128; // KHR_DF_MODEL_BC1A
+		blockDimension = 3 | (3 << 8);
+		bytesPlane0 = 8;
+		samples.push_back({0, 64, 0, 0, 0xFFFFFFFF});
+	}
+	else
+	{
+		model = 130; // KHR_DF_MODEL_BC3
+		blockDimension = 3 | (3 << 8);
+		bytesPlane0 = 16;
+		samples.push_back({0, 64, 15 | (isSRGB ? linearFlag : 0), 0, 0xFFFFFFFF});
+		samples.push_back({64, 64, 0, 0, 0xFFFFFFFF});
+	}
+
+	const uint32_t blockSize = 24 + 16 * static_cast<uint32_t>(samples.size());
+
+	std::vector<uint32_t> dfd;
+	dfd.push_back(4 + blockSize);
+	dfd.push_back(0);						// vendorId and descriptorType
+	dfd.push_back(2 | (blockSize << 16));	// versionNumber and descriptorBlockSize
+	dfd.push_back(model | (1 << 8) | ((isSRGB ? 2 : 1) << 16)); // BT709 and a transfer function
+	dfd.push_back(blockDimension);
+	dfd.push_back(bytesPlane0);
+	dfd.push_back(0);
+
+	for (const auto& sample : samples)
+	{
+		dfd.push_back(sample.BitOffset | ((sample.BitLength - 1) << 16) | (sample.Channel << 24));
+		dfd.push_back(0);
+		dfd.push_back(sample.Lower);
+		dfd.push_back(sample.Upper);
+	}
+
+	return dfd;
+}
+
+std::vector<uint8_t> CreateKTX2(const std::vector<std::vector<uint8_t>>& levels, int32_t width, int32_t height, const Option& option)
+{
+	uint32_t vkFormat = 0;
+	uint32_t blockBytes = 0;
+	if (option.Format == OutputFormat::RGBA8)
+	{
+		vkFormat = option.IsSRGB ? 43 : 37;
+		blockBytes = 4;
+	}
+	else if (option.Format == OutputFormat::BC1)
+	{
+		vkFormat = option.IsSRGB ? 134 : 133;
+		blockBytes = 8;
+	}
+	else
+	{
+		vkFormat = option.IsSRGB ? 138 : 137;
+		blockBytes = 16;
+	}
+
+	const auto dfd = CreateDFD(option.Format, option.IsSRGB);
+	const size_t headerSize = 80;
+	const size_t levelIndexSize = 24 * levels.size();
+	const size_t dfdOffset = headerSize + levelIndexSize;
+	const size_t dfdSize = dfd.size() * sizeof(uint32_t);
+
+	// levels are aligned to lcm(blockBytes, 4) and are stored from the smallest level
+	const size_t alignment = blockBytes % 4 == 0 ? blockBytes : blockBytes * 4;
+	auto align = [&](size_t offset) { return (offset + alignment - 1) / alignment * alignment; };
+
+	std::vector<size_t> levelOffsets(levels.size());
+	size_t offset = dfdOffset + dfdSize;
+	for (size_t i = levels.size(); i > 0; i--)
+	{
+		offset = align(offset);
+		levelOffsets[i - 1] = offset;
+		offset += levels[i - 1].size();
+	}
+
+	std::vector<uint8_t> dst(offset, 0);
+
+	const uint8_t identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+	memcpy(dst.data(), identifier, sizeof(identifier));
+	Write<uint32_t>(dst, 12, vkFormat);
+	Write<uint32_t>(dst, 16, 1);
+	Write<uint32_t>(dst, 20, width);
+	Write<uint32_t>(dst, 24, height);
+	Write<uint32_t>(dst, 28, 0);
+	Write<uint32_t>(dst, 32, 0);
+	Write<uint32_t>(dst, 36, 1);
+	Write<uint32_t>(dst, 40, static_cast<uint32_t>(levels.size()));
+	Write<uint32_t>(dst, 44, 0);
+	Write<uint32_t>(dst, 48, static_cast<uint32_t>(dfdOffset));
+	Write<uint32_t>(dst, 52, static_cast<uint32_t>(dfdSize));
+
+	for (size_t i = 0; i < levels.size(); i++)
+	{
+		Write<uint64_t>(dst, headerSize + 24 * i + 0, levelOffsets[i]);
+		Write<uint64_t>(dst, headerSize + 24 * i + 8, levels[i].size());
+		Write<uint64_t>(dst, headerSize + 24 * i + 16, levels[i].size());
+		memcpy(dst.data() + levelOffsets[i], levels[i].data(), levels[i].size());
+	}
+
+	memcpy(dst.data() + dfdOffset, dfd.data(), dfdSize);
+
+	return dst;
+}
+
+bool Convert(const fs::path& input, const fs::path& output, const Option& option)
+{
+	std::vector<uint8_t> data;
+	Image image;
+	if (!ReadFile(input, data) || !LoadImage(data, image))
+	{
+		std::cout << "Error : Failed to load " << input.string() << std::endl;
+		return false;
+	}
+
+	const int32_t width = image.Width;
+	const int32_t height = image.Height;
+
+	std::vector<std::vector<uint8_t>> levels;
+	levels.emplace_back(EncodeLevel(image, option.Format));
+
+	while (option.IsMipEnabled && (image.Width > 1 || image.Height > 1))
+	{
+		image = GenerateNextLevel(image, option.IsSRGB);
+		levels.emplace_back(EncodeLevel(image, option.Format));
+	}
+
+	if (!WriteFile(output, CreateKTX2(levels, width, height, option)))
+	{
+		std::cout << "Error : Failed to save " << output.string() << std::endl;
+		return false;
+	}
+
+	return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+	Option option;
+	if (!ParseOption(argc, argv, option))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	if (!fs::is_directory(option.Input))
+	{
+		return Convert(option.Input, option.Output, option) ? 0 : 1;
+	}
+
+	std::vector<fs::path> inputs;
+	std::error_code ec;
+	for (const auto& entry : fs::recursive_directory_iterator(option.Input, ec))
+	{
+		auto extension = entry.path().extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return static_cast<char>(tolower(c)); });
+
+		if (entry.is_regular_file() && (extension == ".png" || extension == ".tga"))
+		{
+			inputs.emplace_back(entry.path());
+		}
+	}
+
+	if (ec)
+	{
+		std::cout << "Error : Failed to open " << option.Input.string() << std::endl;
+		return 1;
+	}
+
+	int32_t failedCount = 0;
+	for (const auto& input : inputs)
+	{
+		if (!Convert(input, option.Output / fs::relative(input, option.Input), option))
+		{
+			failedCount++;
+		}
+	}
+
+	std::cout << "Converted : " << inputs.size() - failedCount << " / " << inputs.size() << std::endl;
+
+	return failedCount == 0 ? 0 : 1;
+}
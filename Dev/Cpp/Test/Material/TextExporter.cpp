@@ -0,0 +1,149 @@
+#include <efkMat.Models.h>
+#include <efkMat.Parameters.h>
+#include <efkMat.TextExporter.h>
+
+#include "../TestHelper.h"
+
+namespace
+{
+
+int32_t CountString(const std::string& code, const std::string& str)
+{
+	int32_t count = 0;
+	for (auto pos = code.find(str); pos != std::string::npos; pos = code.find(str, pos + str.size()))
+	{
+		count++;
+	}
+	return count;
+}
+
+std::shared_ptr<EffekseerMaterial::Node> CreateOutputNode(std::shared_ptr<EffekseerMaterial::Material> material, bool isLit)
+{
+	auto output = material->CreateNode(std::make_shared<EffekseerMaterial::NodeOutput>(), false);
+	const auto shadingModel = isLit ? EffekseerMaterial::ShadingModelType::Lit : EffekseerMaterial::ShadingModelType::Unlit;
+	material->ChangeValue(output->GetProperty("ShadingModel"), std::array<float, 4>{static_cast<float>(shadingModel), 0.0f, 0.0f, 0.0f});
+	return output;
+}
+
+std::shared_ptr<EffekseerMaterial::Node> CreateConstant(std::shared_ptr<EffekseerMaterial::Material> material, float value)
+{
+	auto node = material->CreateNode(std::make_shared<EffekseerMaterial::NodeConstant1>(), false);
+	material->ChangeValue(node->GetProperty("Value"), std::array<float, 4>{value, 0.0f, 0.0f, 0.0f});
+	return node;
+}
+
+std::shared_ptr<EffekseerMaterial::Node> CreateParameter(std::shared_ptr<EffekseerMaterial::Material> material, const char* name)
+{
+	auto node = material->CreateNode(std::make_shared<EffekseerMaterial::NodeParameter1>(), false);
+	material->ChangeValue(node->GetProperty("Name"), name);
+	return node;
+}
+
+void Connect(std::shared_ptr<EffekseerMaterial::Material> material,
+			 std::shared_ptr<EffekseerMaterial::Node> from,
+			 std::shared_ptr<EffekseerMaterial::Node> to,
+			 const char* inputName)
+{
+	auto result = material->ConnectPin(from->OutputPins[0], to->InputPins[to->GetInputPinIndex(inputName)]);
+	EXPECT_TRUE(result == EffekseerMaterial::ConnectResultType::OK);
+}
+
+std::string Export(std::shared_ptr<EffekseerMaterial::Material> material, std::shared_ptr<EffekseerMaterial::Node> output)
+{
+	EffekseerMaterial::TextExporter exporter;
+	return exporter.Export(material, output).Code;
+}
+
+} // namespace
+
+void TextExporter_FoldConstant()
+{
+	auto material = std::make_shared<EffekseerMaterial::Material>();
+	material->Initialize();
+
+	auto output = CreateOutputNode(material, false);
+	auto add = material->CreateNode(std::make_shared<EffekseerMaterial::NodeAdd>(), false);
+	auto sine = material->CreateNode(std::make_shared<EffekseerMaterial::NodeSine>(), false);
+	Connect(material, CreateConstant(material, 1.25f), add, "Value1");
+	Connect(material, CreateConstant(material, 2.5f), add, "Value2");
+	Connect(material, add, sine, "Value");
+	Connect(material, sine, output, "Opacity");
+
+	const auto code = Export(material, output);
+
+	// sin(3.75) is folded too
+	EXPECT_TRUE(CountString(code, "sin(") == 0);
+	EXPECT_TRUE(CountString(code, "3.75") == 0);
+	EXPECT_TRUE(CountString(code, "1.25") == 0);
+	EXPECT_TRUE(CountString(code, "-0.571561") == 1);
+}
+
+void TextExporter_MergeCommonNodes()
+{
+	auto material = std::make_shared<EffekseerMaterial::Material>();
+	material->Initialize();
+
+	auto output = CreateOutputNode(material, false);
+	auto param = CreateParameter(material, "Param");
+	auto sine1 = material->CreateNode(std::make_shared<EffekseerMaterial::NodeSine>(), false);
+	auto sine2 = material->CreateNode(std::make_shared<EffekseerMaterial::NodeSine>(), false);
+	auto add = material->CreateNode(std::make_shared<EffekseerMaterial::NodeAdd>(), false);
+	Connect(material, param, sine1, "Value");
+	Connect(material, param, sine2, "Value");
+	Connect(material, sine1, add, "Value1");
+	Connect(material, sine2, add, "Value2");
+	Connect(material, add, output, "Opacity");
+
+	EXPECT_TRUE(CountString(Export(material, output), "sin(") == 1);
+}
+
+void TextExporter_NotMergeDifferentValues()
+{
+	auto material = std::make_shared<EffekseerMaterial::Material>();
+	material->Initialize();
+
+	// values which are same in 6 significant digits
+	auto output = CreateOutputNode(material, false);
+	auto param = CreateParameter(material, "Param");
+	auto add1 = material->CreateNode(std::make_shared<EffekseerMaterial::NodeAdd>(), false);
+	auto add2 = material->CreateNode(std::make_shared<EffekseerMaterial::NodeAdd>(), false);
+	auto multiply = material->CreateNode(std::make_shared<EffekseerMaterial::NodeMultiply>(), false);
+	material->ChangeValue(add1->GetProperty("ConstValue2"), std::array<float, 4>{0.1000001f, 0.0f, 0.0f, 0.0f});
+	material->ChangeValue(add2->GetProperty("ConstValue2"), std::array<float, 4>{0.1000002f, 0.0f, 0.0f, 0.0f});
+	Connect(material, param, add1, "Value1");
+	Connect(material, param, add2, "Value1");
+	Connect(material, add1, multiply, "Value1");
+	Connect(material, add2, multiply, "Value2");
+	Connect(material, multiply, output, "Opacity");
+
+	EXPECT_TRUE(CountString(Export(material, output), "+$F1$(") == 2);
+}
+
+void TextExporter_RemoveUnusedNodes()
+{
+	auto material = std::make_shared<EffekseerMaterial::Material>();
+	material->Initialize();
+
+	// metallic is not used in unlit
+	auto output = CreateOutputNode(material, false);
+	auto sine = material->CreateNode(std::make_shared<EffekseerMaterial::NodeSine>(), false);
+	Connect(material, CreateParameter(material, "Param"), sine, "Value");
+	Connect(material, sine, output, "Metallic");
+
+	EXPECT_TRUE(CountString(Export(material, output), "sin(") == 0);
+
+	auto litOutput = CreateOutputNode(material, true);
+	Connect(material, sine, litOutput, "Metallic");
+
+	EXPECT_TRUE(CountString(Export(material, litOutput), "sin(") == 1);
+}
+
+TestRegister TextExporter_FoldConstant_Test("TextExporter.FoldConstant", []() -> void { TextExporter_FoldConstant(); });
+
+TestRegister TextExporter_MergeCommonNodes_Test("TextExporter.MergeCommonNodes", []() -> void { TextExporter_MergeCommonNodes(); });
+
+TestRegister TextExporter_NotMergeDifferentValues_Test("TextExporter.NotMergeDifferentValues", []() -> void {
+	TextExporter_NotMergeDifferentValues();
+});
+
+TestRegister TextExporter_RemoveUnusedNodes_Test("TextExporter.RemoveUnusedNodes", []() -> void { TextExporter_RemoveUnusedNodes(); });
@@ -20,6 +20,29 @@ public:
 	}
 };
 
+class BatchedMockTextureLoader : public MockTextureLoader
+{
+public:
+	std::vector<std::u16string> LoadedPaths;
+	int32_t BatchCount = 0;
+	int32_t UnloadCount = 0;
+
+	void Load(const char16_t* const* paths, const Effekseer::TextureType* textureTypes, int32_t count, Effekseer::TextureRef* textures) override
+	{
+		BatchCount++;
+		for (int32_t i = 0; i < count; i++)
+		{
+			LoadedPaths.emplace_back(paths[i]);
+			textures[i] = std::u16string(paths[i]) == u"Missing" ? nullptr : Effekseer::MakeRefPtr<Effekseer::Texture>();
+		}
+	}
+
+	void Unload(Effekseer::TextureRef data) override
+	{
+		UnloadCount++;
+	}
+};
+
 void ResourceManager_Basic()
 {
 	auto resourceManager = Effekseer::MakeRefPtr<Effekseer::ResourceManager>();
@@ -226,4 +249,81 @@ void ResourceManager_Basic()
 	}
 }
 
+void ResourceManager_LoadTextures()
+{
+	auto resourceManager = Effekseer::MakeRefPtr<Effekseer::ResourceManager>();
+	auto loader = Effekseer::MakeRefPtr<BatchedMockTextureLoader>();
+	resourceManager->SetTextureLoader(loader);
+
+	auto cached = resourceManager->LoadTexture(u"Cached", Effekseer::TextureType::Color);
+
+	const char16_t* paths[] = {u"A", u"Cached", u"B", u"A", u"Missing", u"A"};
+	const Effekseer::TextureType types[] = {Effekseer::TextureType::Color,
+											Effekseer::TextureType::Color,
+											Effekseer::TextureType::Normal,
+											Effekseer::TextureType::Color,
+											Effekseer::TextureType::Color,
+											Effekseer::TextureType::Color};
+	Effekseer::TextureRef textures[6];
+	resourceManager->LoadTextures(paths, types, 6, textures);
+
+	// cached textures are not loaded and a path is loaded only once in a batch
+	if (loader->BatchCount != 1 || loader->LoadedPaths != std::vector<std::u16string>{u"A", u"B", u"Missing"})
+	{
+		throw std::string("Failed.");
+	}
+
+	if (textures[0] == nullptr || textures[0] != textures[3] || textures[0] != textures[5] || textures[1] != cached || textures[2] == nullptr ||
+		textures[4] != nullptr)
+	{
+		throw std::string("Failed.");
+	}
+
+	// loaded textures are cached
+	Effekseer::TextureRef texturesAgain[6];
+	resourceManager->LoadTextures(paths, types, 6, texturesAgain);
+
+	if (loader->BatchCount != 2 || loader->LoadedPaths.size() != 4 || texturesAgain[0] != textures[0] || texturesAgain[2] != textures[2])
+	{
+		throw std::string("Failed.");
+	}
+
+	// each element is counted, so textures are unloaded when all of them are unloaded
+	for (int32_t i = 0; i < 5; i++)
+	{
+		resourceManager->UnloadTexture(textures[0]);
+	}
+
+	if (loader->UnloadCount != 0)
+	{
+		throw std::string("Failed.");
+	}
+
+	resourceManager->UnloadTexture(textures[0]);
+
+	if (loader->UnloadCount != 1)
+	{
+		throw std::string("Failed.");
+	}
+
+	resourceManager->UnloadTexture(textures[2]);
+	resourceManager->UnloadTexture(textures[2]);
+	resourceManager->UnloadTexture(cached);
+	resourceManager->UnloadTexture(cached);
+
+	if (loader->UnloadCount != 2)
+	{
+		throw std::string("Failed.");
+	}
+
+	resourceManager->UnloadTexture(cached);
+
+	if (loader->UnloadCount != 3)
+	{
+		throw std::string("Failed.");
+	}
+}
+
 TestRegister ResourceManager_Basic_Test("ResourceManager.Basic", []() -> void { ResourceManager_Basic(); });
+
+TestRegister ResourceManager_LoadTextures_Test("ResourceManager.LoadTextures", []() -> void { ResourceManager_LoadTextures(); });
@@ -18,10 +18,23 @@
 #include "EffectPlatformVulkan.h"
 #endif
 
+#include "../Effekseer/Effekseer/Culling/Culling3D.DynamicTree.h"
 #include "../Effekseer/Effekseer/Effekseer.Base.h"
+#include "../Effekseer/Effekseer/Effekseer.DepthPyramid.h"
+#include "../Effekseer/Effekseer/Effekseer.EffectNode.h"
+#include "../Effekseer/Effekseer/Model/SplineGenerator.h"
 #include "../Effekseer/Effekseer/Noise/CurlNoise.h"
+#include "../Effekseer/Effekseer/Sound/Effekseer.SoundVoiceManager.h"
+#include "../Effekseer/Effekseer/Utils/Effekseer.FreeList.h"
+#include "../Effekseer/Effekseer/Utils/Profiler.h"
 #include "../TestHelper.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <iostream>
+#include <map>
+#include <set>
+#include <thread>
 
 void BasicRuntimeTestPlatform(EffectPlatform* platform, std::string baseResultPath, std::string suffix)
 {
@@ -490,6 +503,501 @@ void MassPlayTest()
 	}
 }
 
+void FreeListStressTest()
+{
+	// an owner of each element is swapped to detect an element which is popped by multiple threads
+	Effekseer::FreeList<std::atomic<int32_t>> freeList;
+	freeList.Reset(16, 1, 8, [](std::atomic<int32_t>* elements, int32_t count) -> void {
+		for (int32_t i = 0; i < count; i++)
+		{
+			new (&elements[i]) std::atomic<int32_t>(-1);
+		}
+	});
+
+	const int32_t threadCount = 4;
+	const int32_t heldCount = 8;
+	std::atomic<int32_t> errorCount(0);
+
+	std::vector<std::thread> threads;
+	for (int32_t t = 0; t < threadCount; t++)
+	{
+		threads.emplace_back([&, t]() -> void {
+			std::array<std::atomic<int32_t>*, heldCount> held;
+
+			for (int32_t i = 0; i < 20000; i++)
+			{
+				const auto count = 1 + (i + t) % heldCount;
+
+				for (int32_t j = 0; j < count; j++)
+				{
+					held[j] = freeList.Pop();
+					if (held[j] == nullptr || held[j]->exchange(t) != -1)
+					{
+						errorCount++;
+						return;
+					}
+				}
+
+				for (int32_t j = 0; j < count; j++)
+				{
+					if (held[j]->exchange(-1) != t)
+					{
+						errorCount++;
+					}
+					freeList.Push(held[j]);
+				}
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	EXPECT_TRUE(errorCount == 0);
+	EXPECT_TRUE(freeList.GetCount() == freeList.GetCapacity());
+
+	// no element is lost or duplicated
+	std::set<std::atomic<int32_t>*> elements;
+	const auto capacity = freeList.GetCapacity();
+	for (int32_t i = 0; i < capacity; i++)
+	{
+		auto element = freeList.Pop();
+		EXPECT_TRUE(element != nullptr && element->load() == -1);
+		elements.insert(element);
+	}
+
+	EXPECT_TRUE(static_cast<int32_t>(elements.size()) == capacity);
+	EXPECT_TRUE(freeList.GetCapacity() == capacity);
+}
+
+namespace
+{
+std::atomic<int64_t> g_alignedAllocatedSize(0);
+Effekseer::AlignedMallocFunc g_alignedMallocFunc = nullptr;
+Effekseer::AlignedFreeFunc g_alignedFreeFunc = nullptr;
+
+void* EFK_STDCALL CountedAlignedMalloc(unsigned int size, unsigned int alignment)
+{
+	g_alignedAllocatedSize += size;
+	return g_alignedMallocFunc(size, alignment);
+}
+
+void EFK_STDCALL CountedAlignedFree(void* p, unsigned int size)
+{
+	g_alignedAllocatedSize -= size;
+	g_alignedFreeFunc(p, size);
+}
+} // namespace
+
+void MemoryGrowthTest()
+{
+	// elements which are used keep their addresses while segments are added and removed
+	{
+		Effekseer::FreeList<int32_t> freeList;
+		freeList.Reset(4, 1, 4);
+
+		std::vector<int32_t*> held;
+		for (int32_t i = 0; i < 4; i++)
+		{
+			held.push_back(freeList.Pop());
+			*held.back() = i;
+		}
+		EXPECT_TRUE(freeList.GetCapacity() == 4);
+
+		std::vector<int32_t*> added;
+		for (int32_t i = 0; i < 4; i++)
+		{
+			added.push_back(freeList.Pop());
+		}
+		EXPECT_TRUE(freeList.GetCapacity() == 8);
+
+		// the last segment is not removed while it is used
+		EXPECT_TRUE(!freeList.ShrinkLastSegment());
+
+		for (auto element : added)
+		{
+			EXPECT_TRUE(std::find(held.begin(), held.end(), element) == held.end());
+			freeList.Push(element);
+		}
+
+		EXPECT_TRUE(freeList.ShrinkLastSegment());
+		EXPECT_TRUE(freeList.GetCapacity() == 4);
+
+		for (int32_t i = 0; i < 4; i++)
+		{
+			EXPECT_TRUE(*held[i] == i);
+			freeList.Push(held[i]);
+		}
+	}
+
+	// memory of a manager is added and released
+	{
+		g_alignedMallocFunc = Effekseer::GetAlignedMallocFunc();
+		g_alignedFreeFunc = Effekseer::GetAlignedFreeFunc();
+		Effekseer::SetAlignedMallocFunc(CountedAlignedMalloc);
+		Effekseer::SetAlignedFreeFunc(CountedAlignedFree);
+
+		{
+			Effekseer::Manager::MemoryParameter memoryParameter;
+			memoryParameter.InitialInstanceCount = 128;
+			memoryParameter.MaxInstanceCount = 1024;
+			memoryParameter.ShrinkFrameCount = 3;
+
+			auto manager = Effekseer::Manager::Create(memoryParameter);
+			auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+
+			// a manager whose memory is not changed is played as a reference
+			auto referenceManager = Effekseer::Manager::Create(2048);
+			const auto initialSize = g_alignedAllocatedSize.load();
+
+			auto handle = manager->Play(effect, 0, 0, 0);
+			auto referenceHandle = referenceManager->Play(effect, 0, 0, 0);
+			manager->SetRandomSeed(handle, 1);
+			referenceManager->SetRandomSeed(referenceHandle, 1);
+
+			auto update = [&]() -> void {
+				manager->Update();
+				referenceManager->Update();
+				EXPECT_TRUE(manager->GetInstanceCount(handle) == referenceManager->GetInstanceCount(referenceHandle));
+			};
+
+			std::vector<Effekseer::Handle> handles;
+			while (manager->GetTotalInstanceCount() <= memoryParameter.InitialInstanceCount)
+			{
+				handles.push_back(manager->Play(effect, 0, 0, 0));
+				update();
+			}
+
+			EXPECT_TRUE(g_alignedAllocatedSize > initialSize);
+
+			// instances of the first handle are not moved while added memory is released
+			for (auto h : handles)
+			{
+				manager->StopEffect(h);
+			}
+
+			while (manager->Exists(handle))
+			{
+				update();
+			}
+
+			for (int32_t i = 0; i < memoryParameter.ShrinkFrameCount * 3; i++)
+			{
+				manager->Update();
+				referenceManager->Update();
+			}
+
+			EXPECT_TRUE(g_alignedAllocatedSize == initialSize);
+		}
+
+		Effekseer::SetAlignedMallocFunc(g_alignedMallocFunc);
+		Effekseer::SetAlignedFreeFunc(g_alignedFreeFunc);
+	}
+	// a warning is logged if the maximum number is larger than the limit of memory
+	{
+		int32_t warningCount = 0;
+		Effekseer::SetLogger([&warningCount](Effekseer::LogType logType, const std::string&) -> void {
+			if (logType == Effekseer::LogType::Warning)
+			{
+				warningCount++;
+			}
+		});
+
+		Effekseer::Manager::MemoryParameter memoryParameter;
+		memoryParameter.InitialInstanceCount = 128;
+		memoryParameter.MaxInstanceCount = 128 * 64;
+		Effekseer::Manager::Create(memoryParameter);
+		EXPECT_TRUE(warningCount == 0);
+
+		memoryParameter.MaxInstanceCount = 128 * 64 + 1;
+		Effekseer::Manager::Create(memoryParameter);
+		EXPECT_TRUE(warningCount == 1);
+
+		Effekseer::SetLogger(nullptr);
+	}
+}
+
+void SpawnBudgetTest()
+{
+	auto test = [](bool isUpdatedByHandles) {
+		auto manager = Effekseer::Manager::Create(8000);
+		auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+
+		Effekseer::Manager::SpawnBudgetParameter budget;
+		budget.MaxInstanceCount = 300;
+		budget.ThrottlingRatio = 0.5f;
+		manager->SetSpawnBudget(budget);
+
+		std::vector<Effekseer::Handle> handles;
+
+		auto update = [&]() {
+			if (isUpdatedByHandles)
+			{
+				manager->BeginUpdate();
+				for (auto handle : handles)
+				{
+					manager->UpdateHandle(handle);
+				}
+				manager->EndUpdate();
+			}
+			else
+			{
+				manager->Update();
+			}
+		};
+
+		for (int32_t i = 0; i < 20; i++)
+		{
+			handles.push_back(manager->Play(effect, 0.0f, 0.0f, 0.0f));
+			manager->SetSpawnPriority(handles.back(), (i % 2 == 0) ? 1.0f : 0.0f);
+		}
+
+		// instances are not spawned over the budget
+		for (int32_t i = 0; i < 60; i++)
+		{
+			update();
+			EXPECT_TRUE(manager->GetTotalInstanceCount() <= budget.MaxInstanceCount);
+		}
+
+		EXPECT_TRUE(manager->GetTotalDroppedSpawnCount() > 0);
+
+		// spawning of effects with low priorities is throttled earlier
+		int32_t highPriorityCount = 0;
+		int32_t lowPriorityCount = 0;
+		for (size_t i = 0; i < handles.size(); i++)
+		{
+			((i % 2 == 0) ? highPriorityCount : lowPriorityCount) += manager->GetInstanceCount(handles[i]);
+		}
+		EXPECT_TRUE(highPriorityCount > lowPriorityCount);
+
+		// the budget is released when instances are removed
+		for (auto handle : handles)
+		{
+			manager->StopEffect(handle);
+		}
+
+		for (int32_t i = 0; i < 5; i++)
+		{
+			update();
+		}
+
+		EXPECT_TRUE(manager->GetTotalInstanceCount() == 0);
+
+		handles.clear();
+		handles.push_back(manager->Play(effect, 0.0f, 0.0f, 0.0f));
+		const auto droppedCount = manager->GetTotalDroppedSpawnCount();
+
+		for (int32_t i = 0; i < 60; i++)
+		{
+			update();
+		}
+
+		EXPECT_TRUE(manager->GetTotalDroppedSpawnCount() == droppedCount);
+		EXPECT_TRUE(manager->GetInstanceCount(handles[0]) > 0);
+	};
+
+	test(false);
+	test(true);
+}
+
+void ProfilingTest()
+{
+	auto getSum = [](const Effekseer::Manager::ProfiledFrame& frame, int32_t Effekseer::Manager::ProfiledValues::*member) {
+		int32_t sum = 0;
+		for (const auto& node : frame.Nodes)
+		{
+			sum += node.*member;
+		}
+		return sum;
+	};
+
+	// values of a frame are recorded in the next update
+	{
+		const int32_t frameCount = 8;
+		auto manager = Effekseer::Manager::Create(2000);
+		manager->SetProfilingEnabled(true, frameCount);
+
+		auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+		const auto handle = manager->Play(effect, 0.0f, 0.0f, 0.0f);
+
+		// a root instance is created in the first update
+		manager->Update();
+
+		int32_t spawnedCount = 0;
+		int32_t killedCount = 0;
+
+		for (int32_t i = 1; i < 60; i++)
+		{
+			const auto instanceCount = manager->GetInstanceCount(handle);
+			manager->Update();
+
+			Effekseer::Manager::ProfiledFrame frame;
+			EXPECT_TRUE(manager->GetProfiledFrameCount() == std::min(i + 1, frameCount));
+			EXPECT_TRUE(!manager->GetProfiledFrame(manager->GetProfiledFrameCount(), frame));
+			EXPECT_TRUE(manager->GetProfiledFrame(0, frame));
+			EXPECT_TRUE(frame.Handles.size() == 1);
+			EXPECT_TRUE(frame.Handles[0].EffectHandle == handle);
+			EXPECT_TRUE(frame.Handles[0].InstanceCount == instanceCount);
+			EXPECT_TRUE(getSum(frame, &Effekseer::Manager::ProfiledValues::InstanceCount) == instanceCount);
+
+			// a root instance is not counted as a spawned instance
+			spawnedCount += getSum(frame, &Effekseer::Manager::ProfiledValues::SpawnedCount);
+			killedCount += getSum(frame, &Effekseer::Manager::ProfiledValues::KilledCount);
+			EXPECT_TRUE(spawnedCount - killedCount == instanceCount - 1);
+		}
+
+		EXPECT_TRUE(spawnedCount > 0);
+
+		manager->Draw();
+		manager->Update();
+
+		Effekseer::Manager::ProfiledFrame frame;
+		EXPECT_TRUE(manager->GetProfiledFrame(0, frame));
+		EXPECT_TRUE(frame.Handles[0].DrawCallCount > 0);
+		EXPECT_TRUE(frame.Handles[0].DrawCallCount == getSum(frame, &Effekseer::Manager::ProfiledValues::DrawCallCount));
+		EXPECT_TRUE(frame.Handles[0].VertexCount > 0);
+
+		manager->SetProfilingEnabled(false, frameCount);
+		EXPECT_TRUE(manager->GetProfiledFrameCount() == 0);
+		EXPECT_TRUE(!manager->GetProfiledFrame(0, frame));
+	}
+
+	// frames are read while effects are updated on a worker thread
+	{
+		auto manager = Effekseer::Manager::Create(2000);
+		manager->LaunchWorkerThreads(2);
+		manager->SetProfilingEnabled(true, 4);
+
+		auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+		for (int32_t i = 0; i < 10; i++)
+		{
+			manager->Play(effect, 0.0f, 0.0f, 0.0f);
+		}
+
+		Effekseer::Manager::UpdateParameter parameter;
+		parameter.SyncUpdate = false;
+
+		for (int32_t i = 0; i < 100; i++)
+		{
+			if (i % 25 == 24)
+			{
+				manager->SetProfilingEnabled(i % 50 != 24, 4);
+			}
+
+			manager->Update(parameter);
+
+			Effekseer::Manager::ProfiledFrame frame;
+			if (manager->GetProfiledFrame(0, frame))
+			{
+				int32_t instanceCount = 0;
+				for (const auto& handle : frame.Handles)
+				{
+					instanceCount += handle.InstanceCount;
+				}
+				EXPECT_TRUE(instanceCount == getSum(frame, &Effekseer::Manager::ProfiledValues::InstanceCount));
+			}
+		}
+
+		parameter.SyncUpdate = true;
+		manager->Update(parameter);
+	}
+}
+
+void TracerTest()
+{
+#if !defined(BUILD_WITH_EASY_PROFILER) && !defined(__EFFEKSEER_TRACER_DISABLED__)
+	auto countEvents = [](const std::string& json) {
+		int32_t count = 0;
+		for (auto pos = json.find("\"ph\":\"X\""); pos != std::string::npos; pos = json.find("\"ph\":\"X\"", pos + 1))
+		{
+			count++;
+		}
+		return count;
+	};
+
+	auto getDroppedCount = [](const std::string& json) {
+		const std::string key = "\"droppedEventCount\":";
+		const auto pos = json.find(key);
+		EXPECT_TRUE(pos != std::string::npos);
+		return std::stoi(json.substr(pos + key.size()));
+	};
+
+	auto record = [](const char* threadName, int32_t count) {
+		PROFILER_THREAD(threadName);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			PROFILER_BLOCK("Outer \"Block\"", profiler::colors::Red);
+			{
+				PROFILER_BLOCK("Inner\\Block", profiler::colors::Red);
+			}
+		}
+	};
+
+	// nested blocks are recorded on each thread and blocks over the limit are dropped
+	{
+		const int32_t maxEventCount = 16;
+		Effekseer::SetTracingEnabled(true, maxEventCount);
+
+		std::thread thread1(record, "Tracer\tThread1", 4);
+		std::thread thread2(record, "Tracer Thread2", 10);
+		thread1.join();
+		thread2.join();
+
+		Effekseer::SetTracingEnabled(false);
+
+		const auto json = Effekseer::ExportChromeTrace();
+		EXPECT_TRUE(countEvents(json) == 4 * 2 + maxEventCount);
+		EXPECT_TRUE(getDroppedCount(json) == 10 * 2 - maxEventCount);
+
+		// names are escaped and control characters are replaced
+		EXPECT_TRUE(json.find("\"name\":\"Outer \\\"Block\\\"\"") != std::string::npos);
+		EXPECT_TRUE(json.find("\"name\":\"Inner\\\\Block\"") != std::string::npos);
+		EXPECT_TRUE(json.find("\"name\":\"Tracer Thread1\"") != std::string::npos);
+		EXPECT_TRUE(json.find("\"name\":\"Tracer Thread2\"") != std::string::npos);
+		EXPECT_TRUE(json.find('\t') == std::string::npos);
+	}
+
+	// recorded blocks are released and buffers are allocated again
+	{
+		Effekseer::ReleaseTracingBuffers();
+
+		const auto json = Effekseer::ExportChromeTrace();
+		EXPECT_TRUE(countEvents(json) == 0);
+		EXPECT_TRUE(getDroppedCount(json) == 0);
+
+		Effekseer::SetTracingEnabled(true, 16);
+		std::thread thread(record, "Tracer Thread3", 1);
+		thread.join();
+		Effekseer::SetTracingEnabled(false);
+
+		EXPECT_TRUE(countEvents(Effekseer::ExportChromeTrace()) == 2);
+		Effekseer::ReleaseTracingBuffers();
+	}
+#endif
+}
+
+class MatrixRecordingSpriteRenderer : public Effekseer::SpriteRenderer
+{
+public:
+	//! matrices of instances for each node which is rendered
+	std::vector<std::vector<Effekseer::SIMD::Mat43f>> Matrices;
+
+	using Effekseer::SpriteRenderer::Rendering;
+
+	void BeginRendering(const NodeParameter& parameter, int32_t count, void* userData) override
+	{
+		Matrices.emplace_back();
+	}
+
+	void Rendering(const NodeParameter& parameter, const InstanceParameter& instanceParameter, void* userData) override
+	{
+		Matrices.back().push_back(instanceParameter.SRTMatrix43);
+	}
+};
+
 void ReloadTest()
 {
 	{
@@ -531,6 +1039,191 @@ void ReloadTest()
 
 		platform->Terminate();
 	}
+
+	// a delta which cannot be applied is recovered by whole data
+	{
+		auto manager = Effekseer::Manager::Create(100);
+
+		auto dataA = LoadFile((GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+		auto dataB = LoadFile((GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/Ring_Parameters1.efk").c_str());
+
+		const auto termA = Effekseer::Effect::Create(manager, dataA.data(), static_cast<int32_t>(dataA.size()))->CalculateTerm().TermMax;
+		const auto termB = Effekseer::Effect::Create(manager, dataB.data(), static_cast<int32_t>(dataB.size()))->CalculateTerm().TermMax;
+		EXPECT_TRUE(termA != termB);
+
+		const uint16_t port = 60010;
+		auto server = Effekseer::Server::Create();
+		EXPECT_TRUE(server->Start(port));
+
+		auto effect = Effekseer::Effect::Create(manager, dataA.data(), static_cast<int32_t>(dataA.size()));
+		server->Register(u"Reload", effect);
+
+		char host[] = "127.0.0.1";
+		auto client1 = Effekseer::Client::Create();
+		auto client2 = Effekseer::Client::Create();
+		EXPECT_TRUE(client1->Start(host, port));
+		EXPECT_TRUE(client2->Start(host, port));
+
+		const auto updateUntil = [&](int32_t termMax) -> bool {
+			for (int32_t i = 0; i < 200; i++)
+			{
+				server->Update(&manager, 1);
+				if (effect->CalculateTerm().TermMax == termMax)
+				{
+					return true;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			return false;
+		};
+
+		client1->ReloadDelta(u"Reload", dataA.data(), static_cast<int32_t>(dataA.size()));
+		EXPECT_TRUE(updateUntil(termA));
+
+		// another client changes data which client1 calculates a delta from
+		client2->Reload(u"Reload", dataB.data(), static_cast<int32_t>(dataB.size()));
+		EXPECT_TRUE(updateUntil(termB));
+
+		client1->ReloadDelta(u"Reload", dataA.data(), static_cast<int32_t>(dataA.size()));
+		EXPECT_TRUE(updateUntil(termA));
+
+		client1->Stop();
+		client2->Stop();
+		server->Stop();
+		ES_SAFE_DELETE(client1);
+		ES_SAFE_DELETE(client2);
+		ES_SAFE_DELETE(server);
+	}
+
+	// playing instances are kept and refer to parameters changed with a delta
+	{
+		auto manager = Effekseer::Manager::Create(2000);
+		auto renderer = Effekseer::MakeRefPtr<MatrixRecordingSpriteRenderer>();
+		manager->SetSpriteRenderer(renderer);
+
+		auto dataA = LoadFile((GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+		auto effect = Effekseer::Effect::Create(manager, dataA.data(), static_cast<int32_t>(dataA.size()));
+
+		// a fixed scale of a node is changed in data
+		int32_t nodeIndex = -1;
+		Effekseer::Vector3D scale;
+		for (int32_t i = 0; i < effect->GetRoot()->GetChildrenCount(); i++)
+		{
+			auto node = static_cast<Effekseer::EffectNodeImplemented*>(effect->GetRoot()->GetChild(i));
+			if (node->GetType() == Effekseer::EFFECT_NODE_TYPE_SPRITE && node->ScalingType == Effekseer::ParameterScalingType_Fixed &&
+				node->ScalingFixed.RefEq < 0)
+			{
+				nodeIndex = i;
+				scale = node->ScalingFixed.Position;
+				break;
+			}
+		}
+		EXPECT_TRUE(nodeIndex >= 0);
+
+		const auto scaleBytes = reinterpret_cast<const uint8_t*>(&scale);
+		const auto found = std::search(dataA.begin(), dataA.end(), scaleBytes, scaleBytes + sizeof(float) * 3);
+		EXPECT_TRUE(found != dataA.end());
+		EXPECT_TRUE(std::search(found + 1, dataA.end(), scaleBytes, scaleBytes + sizeof(float) * 3) == dataA.end());
+
+		const Effekseer::Vector3D changedScale(scale.X * 2.0f, scale.Y * 2.0f, scale.Z * 2.0f);
+		auto dataB = dataA;
+		memcpy(dataB.data() + std::distance(dataA.begin(), found), &changedScale, sizeof(float) * 3);
+
+		const uint16_t port = 60012;
+		auto server = Effekseer::Server::Create();
+		EXPECT_TRUE(server->Start(port));
+		server->Register(u"Reload", effect);
+
+		char host[] = "127.0.0.1";
+		auto client = Effekseer::Client::Create();
+		EXPECT_TRUE(client->Start(host, port));
+
+		const auto updateUntil = [&](float scaleX) -> bool {
+			for (int32_t i = 0; i < 200; i++)
+			{
+				server->Update(&manager, 1);
+				if (static_cast<Effekseer::EffectNodeImplemented*>(effect->GetRoot()->GetChild(nodeIndex))->ScalingFixed.Position.X == scaleX)
+				{
+					return true;
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+			return false;
+		};
+
+		// whole data is sent first. it is reloaded before the effect is played and later data is sent as deltas
+		client->ReloadDelta(u"Reload", dataB.data(), static_cast<int32_t>(dataB.size()));
+		EXPECT_TRUE(updateUntil(changedScale.X));
+		client->ReloadDelta(u"Reload", dataA.data(), static_cast<int32_t>(dataA.size()));
+		EXPECT_TRUE(updateUntil(scale.X));
+
+		// an effect which is not reloaded is played as a reference
+		auto reference = Effekseer::Effect::Create(manager, dataA.data(), static_cast<int32_t>(dataA.size()));
+		const auto handle = manager->Play(effect, 0.0f, 0.0f, 0.0f);
+		const auto referenceHandle = manager->Play(reference, 0.0f, 0.0f, 0.0f);
+		manager->SetRandomSeed(handle, 1);
+		manager->SetRandomSeed(referenceHandle, 1);
+
+		for (int32_t i = 0; i < 20; i++)
+		{
+			manager->Update();
+		}
+
+		const auto instanceCount = manager->GetInstanceCount(handle);
+		EXPECT_TRUE(instanceCount > 1);
+
+		client->ReloadDelta(u"Reload", dataB.data(), static_cast<int32_t>(dataB.size()));
+		EXPECT_TRUE(updateUntil(changedScale.X));
+
+		EXPECT_TRUE(manager->Exists(handle));
+		EXPECT_TRUE(manager->GetInstanceCount(handle) == instanceCount);
+
+		manager->Update();
+		EXPECT_TRUE(manager->GetInstanceCount(handle) == manager->GetInstanceCount(referenceHandle));
+
+		renderer->Matrices.clear();
+		manager->DrawHandle(handle);
+		const auto matrices = renderer->Matrices;
+
+		renderer->Matrices.clear();
+		manager->DrawHandle(referenceHandle);
+		const auto referenceMatrices = renderer->Matrices;
+
+		// all instances of the changed node are scaled, including instances generated before reloading
+		EXPECT_TRUE(matrices.size() == referenceMatrices.size());
+
+		int32_t scaledNodeCount = 0;
+		for (size_t i = 0; i < matrices.size(); i++)
+		{
+			EXPECT_TRUE(matrices[i].size() == referenceMatrices[i].size());
+
+			const bool isScaled = !matrices[i].empty() && !Effekseer::SIMD::Mat43f::Equal(matrices[i][0], referenceMatrices[i][0], 0.001f);
+			if (isScaled)
+			{
+				scaledNodeCount++;
+			}
+
+			for (size_t j = 0; j < matrices[i].size(); j++)
+			{
+				if (!isScaled)
+				{
+					EXPECT_TRUE(Effekseer::SIMD::Mat43f::Equal(matrices[i][j], referenceMatrices[i][j], 0.001f));
+					continue;
+				}
+
+				const auto actual = matrices[i][j].GetScale();
+				const auto expected = referenceMatrices[i][j].GetScale() * 2.0f;
+				EXPECT_TRUE((actual - expected).GetLength() < 0.001f);
+				EXPECT_TRUE((matrices[i][j].GetTranslation() - referenceMatrices[i][j].GetTranslation()).GetLength() < 0.001f);
+			}
+		}
+		EXPECT_TRUE(scaledNodeCount == 1);
+
+		client->Stop();
+		server->Stop();
+		ES_SAFE_DELETE(client);
+		ES_SAFE_DELETE(server);
+	}
 }
 
 void UpdateToMoveTest()
@@ -588,6 +1281,231 @@ void UpdateToMoveTest()
 	}
 }
 
+void PrewarmTest()
+{
+	auto manager = Effekseer::Manager::Create(8000);
+	auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+	EXPECT_TRUE(effect != nullptr);
+
+	// instance counts in each frame after an effect is fast-forwarded until it is removed
+	auto getInstanceCounts = [&](const Effekseer::Manager::PrewarmParameter* parameter) {
+		const auto handle = manager->Play(effect, 0.0f, 0.0f, 0.0f);
+		manager->SetRandomSeed(handle, 1);
+
+		// a root instance is created in the first update
+		manager->BeginUpdate();
+		manager->UpdateHandle(handle);
+		manager->EndUpdate();
+
+		manager->BeginUpdate();
+		if (parameter != nullptr)
+		{
+			manager->PrewarmHandle(handle, 20.0f, *parameter);
+		}
+		else
+		{
+			manager->UpdateHandleToMoveToFrame(handle, 20.0f);
+		}
+		manager->EndUpdate();
+
+		std::vector<int32_t> counts;
+		for (int32_t i = 0; i < 1000 && manager->Exists(handle); i++)
+		{
+			manager->Update();
+			counts.push_back(manager->GetInstanceCount(handle));
+		}
+		EXPECT_TRUE(!manager->Exists(handle));
+		return counts;
+	};
+
+	const auto expected = getInstanceCounts(nullptr);
+	EXPECT_TRUE(expected.size() > 0 && expected[0] > 1);
+
+	Effekseer::Manager::PrewarmParameter parameter;
+
+	// it is same as UpdateHandleToMoveToFrame if frames are advanced one by one
+	parameter.StepFrame = 1.0f;
+	parameter.IsDeferred = false;
+	EXPECT_TRUE(getInstanceCounts(&parameter) == expected);
+
+	parameter.IsDeferred = true;
+	EXPECT_TRUE(getInstanceCounts(&parameter) == expected);
+
+	// spawning timings are less accurate with larger steps, but the effect is removed at the same time
+	parameter.StepFrame = 4.0f;
+	parameter.IsDeferred = false;
+	const auto stepped = getInstanceCounts(&parameter);
+	EXPECT_TRUE(stepped.size() == expected.size());
+
+	parameter.IsDeferred = true;
+	EXPECT_TRUE(getInstanceCounts(&parameter) == stepped);
+}
+
+void MatrixBatchTest()
+{
+	auto manager = Effekseer::Manager::Create(2000);
+	auto renderer = Effekseer::MakeRefPtr<MatrixRecordingSpriteRenderer>();
+	manager->SetSpriteRenderer(renderer);
+
+	auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+	EXPECT_TRUE(effect != nullptr);
+
+	std::vector<Effekseer::EffectNodeImplemented*> sprites;
+	for (int32_t i = 0; i < effect->GetRoot()->GetChildrenCount(); i++)
+	{
+		auto node = static_cast<Effekseer::EffectNodeImplemented*>(effect->GetRoot()->GetChild(i));
+		if (node->GetType() == Effekseer::EFFECT_NODE_TYPE_SPRITE)
+		{
+			sprites.push_back(node);
+		}
+	}
+	EXPECT_TRUE(sprites.size() > 1);
+
+	for (auto node : sprites)
+	{
+		EXPECT_TRUE(!node->LocalForceField.HasValue && !node->LocalForceField.IsGlobalEnabled);
+
+		node->TranslationFixed.RefEq = -1;
+		node->TranslationFixed.Position = {1.0f, 2.0f, 3.0f};
+		node->TranslationPVA = Effekseer::ParameterTranslationPVA();
+		node->TranslationPVA.location.min = {-1.0f, -1.0f, -1.0f};
+		node->TranslationPVA.location.max = {1.0f, 1.0f, 1.0f};
+		node->TranslationPVA.velocity.min = {-0.1f, -0.1f, -0.1f};
+		node->TranslationPVA.velocity.max = {0.1f, 0.1f, 0.1f};
+		node->TranslationPVA.acceleration.min = {-0.01f, -0.01f, -0.01f};
+		node->TranslationPVA.acceleration.max = {0.01f, 0.01f, 0.01f};
+
+		node->RotationFixed.RefEq = -1;
+		node->RotationFixed.Position = {0.1f, 0.2f, 0.3f};
+		node->RotationPVA = Effekseer::ParameterRotationPVA();
+		node->RotationPVA.rotation.min = {-1.0f, -1.0f, -1.0f};
+		node->RotationPVA.rotation.max = {1.0f, 1.0f, 1.0f};
+		node->RotationPVA.velocity.min = {-0.1f, -0.1f, -0.1f};
+		node->RotationPVA.velocity.max = {0.1f, 0.1f, 0.1f};
+		node->RotationPVA.acceleration.min = {-0.01f, -0.01f, -0.01f};
+		node->RotationPVA.acceleration.max = {0.01f, 0.01f, 0.01f};
+
+		node->ScalingFixed.RefEq = -1;
+		node->ScalingFixed.Position = {1.0f, 2.0f, 3.0f};
+		node->ScalingPVA = Effekseer::ParameterScalingPVA();
+		node->ScalingPVA.Position.min = {0.5f, 0.5f, 0.5f};
+		node->ScalingPVA.Position.max = {1.5f, 1.5f, 1.5f};
+		node->ScalingPVA.Velocity.min = {-0.01f, -0.01f, -0.01f};
+		node->ScalingPVA.Velocity.max = {0.01f, 0.01f, 0.01f};
+		node->ScalingPVA.Acceleration.min = {-0.001f, -0.001f, -0.001f};
+		node->ScalingPVA.Acceleration.max = {0.001f, 0.001f, 0.001f};
+	}
+
+	// matrices of instances drawn in each frame, including frames in which instances are updated first
+	auto getMatrices = [&](bool isBatchable) {
+		// a global force field without fields does not move instances, but CalculateMatrix is used instead of CalculateMatrices
+		for (auto node : sprites)
+		{
+			node->LocalForceField.IsGlobalEnabled = !isBatchable;
+		}
+
+		manager->StopAllEffects();
+		manager->Update();
+		renderer->Matrices.clear();
+
+		const auto handle = manager->Play(effect, 1.0f, 2.0f, 3.0f);
+		manager->SetRandomSeed(handle, 1);
+		manager->SetRotation(handle, 0.1f, 0.2f, 0.3f);
+		manager->SetScale(handle, 1.0f, 2.0f, 3.0f);
+
+		for (int32_t i = 0; i < 30; i++)
+		{
+			manager->Update();
+			manager->Draw();
+		}
+
+		return renderer->Matrices;
+	};
+
+	auto expectSameMatrices = [&]() {
+		const auto batched = getMatrices(true);
+		const auto expected = getMatrices(false);
+		EXPECT_TRUE(expected.size() > 0);
+		EXPECT_TRUE(batched.size() == expected.size());
+
+		for (size_t i = 0; i < expected.size(); i++)
+		{
+			EXPECT_TRUE(batched[i].size() == expected[i].size());
+
+			for (size_t j = 0; j < expected[i].size(); j++)
+			{
+				EXPECT_TRUE(Effekseer::SIMD::Mat43f::Equal(batched[i][j], expected[i][j], 0.001f));
+			}
+		}
+	};
+
+	// all combinations of types which CalculateMatrices is specialized for
+	const std::array<Effekseer::ParameterTranslationType, 3> translationTypes = {
+		Effekseer::ParameterTranslationType_None, Effekseer::ParameterTranslationType_Fixed, Effekseer::ParameterTranslationType_PVA};
+	const std::array<Effekseer::ParameterRotationType, 3> rotationTypes = {
+		Effekseer::ParameterRotationType_None, Effekseer::ParameterRotationType_Fixed, Effekseer::ParameterRotationType_PVA};
+	const std::array<Effekseer::ParameterScalingType, 3> scalingTypes = {
+		Effekseer::ParameterScalingType_None, Effekseer::ParameterScalingType_Fixed, Effekseer::ParameterScalingType_PVA};
+
+	for (auto translationType : translationTypes)
+	{
+		for (auto rotationType : rotationTypes)
+		{
+			for (auto scalingType : scalingTypes)
+			{
+				for (auto node : sprites)
+				{
+					node->TranslationType = translationType;
+					node->RotationType = rotationType;
+					node->ScalingType = scalingType;
+				}
+
+				expectSameMatrices();
+			}
+		}
+	}
+
+	// instances which are excluded from batches are calculated in the same chunks as batched instances
+	auto excluded = sprites[0];
+
+	const auto bindType = excluded->CommonValues.TranslationBindType;
+	excluded->CommonValues.TranslationBindType = Effekseer::TranslationParentBindType::NotBind_FollowParent;
+	excluded->SteeringBehaviorParam.MaxFollowSpeed.min = 0.5f;
+	excluded->SteeringBehaviorParam.MaxFollowSpeed.max = 0.5f;
+	excluded->SteeringBehaviorParam.SteeringSpeed.min = 50.0f;
+	excluded->SteeringBehaviorParam.SteeringSpeed.max = 50.0f;
+	expectSameMatrices();
+	excluded->CommonValues.TranslationBindType = bindType;
+
+	auto& easing = excluded->TranslationEasing;
+	easing.RefEqS = Effekseer::RefMinMax();
+	easing.RefEqE = Effekseer::RefMinMax();
+	easing.start.min = {-1.0f, -1.0f, -1.0f};
+	easing.start.max = {1.0f, 1.0f, 1.0f};
+	easing.end.min = {2.0f, 2.0f, 2.0f};
+	easing.end.max = {3.0f, 3.0f, 3.0f};
+	easing.type_ = Effekseer::Easing3Type::Linear;
+	easing.isMiddleEnabled = false;
+	easing.isIndividualEnabled = false;
+	easing.channelCount = 3;
+	easing.channelIDs = {0, 1, 2};
+	excluded->TranslationType = Effekseer::ParameterTranslationType_Easing;
+	expectSameMatrices();
+
+	if (excluded->TranslationFCurve == nullptr)
+	{
+		excluded->TranslationFCurve = new Effekseer::FCurveVector3D();
+	}
+	excluded->TranslationFCurve->X.SetDefaultValue(1.0f);
+	excluded->TranslationFCurve->Y.SetDefaultValue(2.0f);
+	excluded->TranslationFCurve->Z.SetDefaultValue(3.0f);
+	excluded->TranslationType = Effekseer::ParameterTranslationType_FCurve;
+	expectSameMatrices();
+
+	manager->StopAllEffects();
+	manager->Update();
+}
+
 void BasicRuntimeTest()
 {
 
@@ -810,6 +1728,58 @@ void ProceduralModelCacheTest()
 #endif
 }
 
+void SplineTest()
+{
+	auto isNear = [](const Effekseer::SIMD::Vec3f& v1, const Effekseer::SIMD::Vec3f& v2) { return (v1 - v2).GetLength() < 0.0001f; };
+
+	// a renderer calculates splines of ribbon groups with one generator alternately
+	Effekseer::SplineGenerator shared;
+
+	for (int32_t frame = 0; frame < 4; frame++)
+	{
+		std::array<std::vector<Effekseer::SIMD::Vec3f>, 2> groups;
+		for (int32_t i = 0; i < 6 + frame; i++)
+		{
+			groups[0].emplace_back(static_cast<float>(i + frame), std::sin(static_cast<float>(i + frame)), 0.0f);
+			groups[1].emplace_back(0.0f, static_cast<float>(i * i), static_cast<float>(frame));
+		}
+
+		// the same vertex is added twice
+		groups[1].push_back(groups[1].back());
+
+		for (const auto& points : groups)
+		{
+			Effekseer::SplineGenerator expected;
+			shared.Reset();
+			for (const auto& p : points)
+			{
+				expected.AddVertex(p);
+				shared.AddVertex(p);
+			}
+			expected.Calculate();
+			shared.Calculate();
+
+			for (size_t i = 0; i < points.size(); i++)
+			{
+				EXPECT_TRUE(isNear(shared.GetValue(static_cast<float>(i)), points[i]));
+			}
+
+			for (int32_t division = 1; division < 10; division++)
+			{
+				std::vector<Effekseer::SIMD::Vec3f> values(division);
+				for (int32_t i = 0; i < static_cast<int32_t>(points.size()) - 1; i++)
+				{
+					shared.GetValues(i, division, values.data());
+					for (int32_t j = 0; j < division; j++)
+					{
+						EXPECT_TRUE(isNear(values[j], expected.GetValue(i + j / static_cast<float>(division))));
+					}
+				}
+			}
+		}
+	}
+}
+
 void CullingTest()
 {
 	{
@@ -839,6 +1809,413 @@ void CullingTest()
 	}
 }
 
+void CullingTreeTest()
+{
+	// leaves are found only where they are and they are reinserted only when they move out of fat bounds
+	{
+		Culling3D::DynamicTree tree(0.5f);
+		const int32_t count = 64;
+
+		auto toObject = [](int32_t index) { return reinterpret_cast<Culling3D::Object*>(static_cast<intptr_t>(index + 1)); };
+		auto getBox = [](float x) { return Culling3D::AABB(Culling3D::Vector3DF(x - 0.5f, -0.5f, -0.5f), Culling3D::Vector3DF(x + 0.5f, 0.5f, 0.5f)); };
+
+		std::vector<int32_t> proxies;
+		for (int32_t i = 0; i < count; i++)
+		{
+			proxies.push_back(tree.CreateProxy(getBox(i * 4.0f), toObject(i)));
+		}
+
+		// the tree is balanced
+		EXPECT_TRUE(tree.GetHeight() <= 12);
+
+		std::vector<Culling3D::Object*> objects;
+		tree.QueryAABB(getBox(12.0f), objects);
+		EXPECT_TRUE(objects.size() == 1 && objects[0] == toObject(3));
+
+		EXPECT_TRUE(!tree.MoveProxy(proxies[3], getBox(12.2f)));
+		EXPECT_TRUE(tree.MoveProxy(proxies[3], getBox(-20.0f)));
+
+		objects.clear();
+		tree.QueryAABB(getBox(12.0f), objects);
+		EXPECT_TRUE(objects.empty());
+
+		objects.clear();
+		tree.QueryAABB(getBox(-20.0f), objects);
+		EXPECT_TRUE(objects.size() == 1 && objects[0] == toObject(3));
+
+		for (int32_t i = 0; i < count; i += 2)
+		{
+			tree.DestroyProxy(proxies[i]);
+		}
+
+		objects.clear();
+		tree.QueryAABB(Culling3D::AABB(Culling3D::Vector3DF(-100.0f, -1.0f, -1.0f), Culling3D::Vector3DF(1000.0f, 1.0f, 1.0f)), objects);
+		EXPECT_TRUE(static_cast<int32_t>(objects.size()) == count / 2);
+		EXPECT_TRUE(std::find(objects.begin(), objects.end(), toObject(3)) != objects.end());
+		EXPECT_TRUE(std::find(objects.begin(), objects.end(), toObject(2)) == objects.end());
+	}
+
+	// a tree world culls the same objects as a grid world while objects are added, moved and removed
+	{
+		Culling3D::Matrix44 view;
+		Culling3D::Matrix44 proj;
+		Culling3D::Matrix44 cameraProjMat;
+		view.SetLookAtRH(Culling3D::Vector3DF(0.0f, 0.0f, 0.0f), Culling3D::Vector3DF(0.0f, 0.0f, -1.0f), Culling3D::Vector3DF(0.0f, 1.0f, 0.0f));
+		proj.SetPerspectiveFovRH(3.14f / 4.0f, 1.0f, 1.0f, 100.0f);
+		Culling3D::Matrix44::Mul(cameraProjMat, proj, view);
+
+		struct WorldObjects
+		{
+			Culling3D::World* World;
+			std::vector<Culling3D::Object*> Objects;
+
+			std::set<intptr_t> Cull(const Culling3D::Matrix44& cameraProjMat)
+			{
+				World->Culling(cameraProjMat, false, true);
+
+				std::set<intptr_t> ret;
+				for (int32_t i = 0; i < World->GetObjectCount(); i++)
+				{
+					ret.insert(reinterpret_cast<intptr_t>(World->GetObject(i)->GetUserData()));
+				}
+				return ret;
+			}
+		};
+
+		const int32_t count = 200;
+		const auto getPosition = [](int32_t i, float offset) {
+			return Culling3D::Vector3DF((i % 10 - 5) * 8.0f + offset, (i / 10 % 4 - 2) * 8.0f, (i / 40 - 2) * 30.0f);
+		};
+
+		std::array<WorldObjects, 2> worlds;
+		worlds[0].World = Culling3D::World::CreateDynamicTree(1.0f);
+		worlds[1].World = Culling3D::World::Create(400.0f, 400.0f, 400.0f, 6);
+
+		for (auto& world : worlds)
+		{
+			for (int32_t i = 0; i < count + 1; i++)
+			{
+				auto o = Culling3D::Object::Create();
+				if (i < count)
+				{
+					o->ChangeIntoSphere(1.0f + (i % 3));
+					o->SetPosition(getPosition(i, 0.0f));
+				}
+				else
+				{
+					o->ChangeIntoAll();
+				}
+				o->SetUserData(reinterpret_cast<void*>(static_cast<intptr_t>(i)));
+				world.World->AddObject(o);
+				world.Objects.push_back(o);
+			}
+		}
+
+		auto culled = worlds[0].Cull(cameraProjMat);
+		EXPECT_TRUE(culled == worlds[1].Cull(cameraProjMat));
+
+		// objects in front of a camera are visible and objects behind it are culled
+		EXPECT_TRUE(culled.count(count) == 1);
+		EXPECT_TRUE(culled.count(25) == 1);
+		EXPECT_TRUE(culled.count(185) == 0);
+		EXPECT_TRUE(static_cast<int32_t>(culled.size()) < count);
+
+		for (auto& world : worlds)
+		{
+			for (int32_t i = 0; i < count; i++)
+			{
+				world.Objects[i]->SetPosition(getPosition(i, (i % 2 == 0) ? 0.5f : 40.0f));
+			}
+		}
+
+		culled = worlds[0].Cull(cameraProjMat);
+		EXPECT_TRUE(culled == worlds[1].Cull(cameraProjMat));
+		EXPECT_TRUE(culled.count(24) == 1);
+		EXPECT_TRUE(culled.count(25) == 0);
+
+		for (auto& world : worlds)
+		{
+			for (int32_t i = 0; i < count; i += 3)
+			{
+				world.World->RemoveObject(world.Objects[i]);
+			}
+		}
+
+		culled = worlds[0].Cull(cameraProjMat);
+		EXPECT_TRUE(culled == worlds[1].Cull(cameraProjMat));
+		EXPECT_TRUE(culled.count(24) == 0);
+
+		for (auto& world : worlds)
+		{
+			for (auto o : world.Objects)
+			{
+				o->Release();
+			}
+			world.World->Release();
+		}
+	}
+
+	// effects are culled with a tree world in a manager
+	{
+		auto manager = Effekseer::Manager::Create(2000);
+		manager->SetProfilingEnabled(true, 1);
+		manager->CreateCullingWorldWithTree(1.0f);
+
+		auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/Culling/Sphere.efkefc").c_str());
+
+		Effekseer::Matrix44 camera;
+		Effekseer::Matrix44 projection;
+		Effekseer::Matrix44 cameraProjMat;
+		camera.LookAtRH({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f});
+		projection.PerspectiveFovRH(3.14f / 4.0f, 1.0f, 1.0f, 100.0f);
+		Effekseer::Matrix44::Mul(cameraProjMat, camera, projection);
+
+		// draw calls are recorded into a profiled frame in the next update
+		auto getDrawCallCounts = [&]() {
+			manager->CalcCulling(cameraProjMat, false);
+			manager->Draw();
+			manager->Update();
+
+			std::map<Effekseer::Handle, int32_t> ret;
+			Effekseer::Manager::ProfiledFrame frame;
+			EXPECT_TRUE(manager->GetProfiledFrame(0, frame));
+			for (const auto& handle : frame.Handles)
+			{
+				ret[handle.EffectHandle] = handle.DrawCallCount;
+			}
+			return ret;
+		};
+
+		const auto front = manager->Play(effect, 0.0f, 0.0f, -20.0f);
+		const auto back = manager->Play(effect, 0.0f, 0.0f, 20.0f);
+		manager->Update();
+
+		auto counts = getDrawCallCounts();
+		EXPECT_TRUE(counts[front] > 0);
+		EXPECT_TRUE(counts[back] == 0);
+
+		manager->SetLocation(front, 0.0f, 0.0f, 40.0f);
+		manager->SetLocation(back, 0.0f, 0.0f, -40.0f);
+		manager->Update();
+
+		counts = getDrawCallCounts();
+		EXPECT_TRUE(counts[front] == 0);
+		EXPECT_TRUE(counts[back] > 0);
+
+		manager->StopEffect(back);
+		manager->Update();
+		manager->Update();
+
+		counts = getDrawCallCounts();
+		EXPECT_TRUE(counts.count(back) == 0);
+		EXPECT_TRUE(counts[front] == 0);
+	}
+}
+
+void InstanceCullingTest()
+{
+	auto manager = Effekseer::Manager::Create(2000);
+	manager->SetProfilingEnabled(true, 1);
+
+	auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+	EXPECT_TRUE(effect != nullptr);
+
+	Effekseer::Matrix44 camera;
+	Effekseer::Matrix44 projection;
+	camera.LookAtRH({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f});
+	projection.PerspectiveFovRH(3.14f / 4.0f, 1.0f, 1.0f, 100.0f);
+
+	Effekseer::Manager::DrawParameter drawParameter;
+	drawParameter.CameraFrontDirection = {0.0f, 0.0f, -1.0f};
+	Effekseer::Matrix44::Mul(drawParameter.ViewProjectionMatrix, camera, projection);
+	drawParameter.IsInstanceCullingEnabled = true;
+
+	std::vector<Effekseer::EffectNodeImplemented*> sprites;
+	for (int32_t i = 0; i < effect->GetRoot()->GetChildrenCount(); i++)
+	{
+		auto node = static_cast<Effekseer::EffectNodeImplemented*>(effect->GetRoot()->GetChild(i));
+		if (node->GetType() == Effekseer::EFFECT_NODE_TYPE_SPRITE)
+		{
+			sprites.push_back(node);
+		}
+	}
+	EXPECT_TRUE(sprites.size() > 0);
+
+	// effects in front of and behind a camera are played and their draw calls are recorded in the next update
+	auto getDrawCallCounts = [&]() {
+		manager->StopAllEffects();
+		manager->Update();
+
+		const auto front = manager->Play(effect, 0.0f, 0.0f, -20.0f);
+		const auto back = manager->Play(effect, 0.0f, 0.0f, 20.0f);
+		for (int32_t i = 0; i < 10; i++)
+		{
+			manager->Update();
+		}
+
+		manager->Draw(drawParameter);
+		manager->Update();
+
+		std::map<Effekseer::Handle, int32_t> counts;
+		Effekseer::Manager::ProfiledFrame frame;
+		EXPECT_TRUE(manager->GetProfiledFrame(0, frame));
+		for (const auto& handle : frame.Handles)
+		{
+			counts[handle.EffectHandle] = handle.DrawCallCount;
+		}
+		return std::make_pair(counts[front], counts[back]);
+	};
+
+	auto counts = getDrawCallCounts();
+	EXPECT_TRUE(counts.first > 0);
+	EXPECT_TRUE(counts.second == 0);
+
+	drawParameter.IsInstanceCullingEnabled = false;
+	EXPECT_TRUE(getDrawCallCounts().second == counts.first);
+	drawParameter.IsInstanceCullingEnabled = true;
+
+	// instances with a view offset are drawn near a camera wherever they are
+	std::vector<Effekseer::ParameterTranslationType> translationTypes;
+	for (auto node : sprites)
+	{
+		translationTypes.push_back(node->TranslationType);
+		node->TranslationType = Effekseer::ParameterTranslationType_ViewOffset;
+		node->TranslationViewOffset.distance.max = 5.0f;
+		node->TranslationViewOffset.distance.min = 5.0f;
+	}
+
+	counts = getDrawCallCounts();
+	EXPECT_TRUE(counts.first > 0);
+	EXPECT_TRUE(counts.second == counts.first);
+
+	for (size_t i = 0; i < sprites.size(); i++)
+	{
+		sprites[i]->TranslationType = translationTypes[i];
+	}
+
+	// vertices may be moved by a material file
+	const auto materialType = sprites[0]->RendererCommon.MaterialType;
+	for (auto node : sprites)
+	{
+		EXPECT_TRUE(node->RendererCommon.MaterialType == materialType);
+		node->RendererCommon.MaterialType = Effekseer::RendererMaterialType::File;
+	}
+
+	counts = getDrawCallCounts();
+	EXPECT_TRUE(counts.first > 0);
+	EXPECT_TRUE(counts.second == counts.first);
+
+	for (auto node : sprites)
+	{
+		node->RendererCommon.MaterialType = materialType;
+	}
+
+	counts = getDrawCallCounts();
+	EXPECT_TRUE(counts.first > 0);
+	EXPECT_TRUE(counts.second == 0);
+}
+
+void ScreenCoverageTest()
+{
+	// a texel in an upper level has the farthest depth of texels in a lower level
+	{
+		Effekseer::DepthPyramid pyramid;
+		EXPECT_TRUE(!pyramid.IsValid());
+
+		// only the right column is far
+		std::vector<float> depths(5 * 3, 0.5f);
+		for (int32_t y = 0; y < 3; y++)
+		{
+			depths[4 + y * 5] = 1.0f;
+		}
+
+		pyramid.Build(depths.data(), 5, 3);
+		EXPECT_TRUE(pyramid.IsValid());
+
+		EXPECT_TRUE(pyramid.IsOccluded(0.0f, 0.0f, 0.5f, 1.0f, 0.6f));
+		EXPECT_TRUE(!pyramid.IsOccluded(0.0f, 0.0f, 0.5f, 1.0f, 0.4f));
+		EXPECT_TRUE(!pyramid.IsOccluded(0.0f, 0.0f, 1.0f, 1.0f, 0.6f));
+		EXPECT_TRUE(!pyramid.IsOccluded(0.9f, 0.0f, 1.0f, 0.1f, 0.6f));
+
+		// a rectangle outside of the screen is not tested
+		EXPECT_TRUE(!pyramid.IsOccluded(1.5f, 0.0f, 2.0f, 1.0f, 0.6f));
+
+		pyramid.Build(nullptr, 0, 0);
+		EXPECT_TRUE(!pyramid.IsValid());
+		EXPECT_TRUE(!pyramid.IsOccluded(0.0f, 0.0f, 0.5f, 1.0f, 0.6f));
+	}
+
+	// effects which are small on a screen or behind depths are not drawn
+	{
+		auto manager = Effekseer::Manager::Create(2000);
+		manager->SetProfilingEnabled(true, 1);
+
+		auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+		EXPECT_TRUE(effect != nullptr);
+
+		Effekseer::Matrix44 camera;
+		Effekseer::Matrix44 projection;
+		camera.LookAtRH({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f});
+		projection.PerspectiveFovRH(3.14f / 4.0f, 1.0f, 1.0f, 1000.0f);
+
+		Effekseer::Manager::DrawParameter drawParameter;
+		drawParameter.CameraFrontDirection = {0.0f, 0.0f, -1.0f};
+		Effekseer::Matrix44::Mul(drawParameter.ViewProjectionMatrix, camera, projection);
+		drawParameter.ViewportWidth = 256;
+		drawParameter.ViewportHeight = 256;
+		drawParameter.MinimumScreenCoverage = 64.0f;
+
+		// draw calls are recorded into a profiled frame in the next update
+		auto getDrawCallCounts = [&]() {
+			manager->Draw(drawParameter);
+			manager->Update();
+
+			std::map<Effekseer::Handle, int32_t> ret;
+			Effekseer::Manager::ProfiledFrame frame;
+			EXPECT_TRUE(manager->GetProfiledFrame(0, frame));
+			for (const auto& handle : frame.Handles)
+			{
+				ret[handle.EffectHandle] = handle.DrawCallCount;
+			}
+			return ret;
+		};
+
+		const auto nearHandle = manager->Play(effect, 0.0f, 0.0f, -20.0f);
+		const auto farHandle = manager->Play(effect, 0.0f, 0.0f, -900.0f);
+
+		// a root instance is created in the first update
+		manager->Update();
+
+		std::map<Effekseer::Handle, int32_t> counts;
+		for (int32_t i = 0; i < 10; i++)
+		{
+			counts = getDrawCallCounts();
+			EXPECT_TRUE(counts[farHandle] == 0);
+		}
+		EXPECT_TRUE(counts[nearHandle] > 0);
+
+		drawParameter.MinimumScreenCoverage = 0.0f;
+		counts = getDrawCallCounts();
+		EXPECT_TRUE(counts[nearHandle] > 0);
+		EXPECT_TRUE(counts[farHandle] > 0);
+
+		// the far effect is behind depths and the near effect is in front of them
+		std::vector<float> depths(16 * 16, 0.99f);
+		drawParameter.OcclusionDepth = depths.data();
+		drawParameter.OcclusionDepthWidth = 16;
+		drawParameter.OcclusionDepthHeight = 16;
+
+		counts = getDrawCallCounts();
+		EXPECT_TRUE(counts[nearHandle] > 0);
+		EXPECT_TRUE(counts[farHandle] == 0);
+
+		depths.assign(depths.size(), 1.0f);
+		counts = getDrawCallCounts();
+		EXPECT_TRUE(counts[nearHandle] > 0);
+		EXPECT_TRUE(counts[farHandle] > 0);
+	}
+}
+
 void RenderLimitTest()
 {
 	auto test = [](EffectPlatform* platform)
@@ -922,6 +2299,156 @@ void RenderLimitTest()
 #endif
 }
 
+class MockSoundPlayer : public Effekseer::SoundPlayer
+{
+public:
+	std::set<intptr_t> PlayingHandles;
+	intptr_t NextHandle = 1;
+	int32_t PlayCount = 0;
+
+	Effekseer::SoundHandle Play(Effekseer::SoundTag tag, const InstanceParameter& parameter) override
+	{
+		PlayCount++;
+		PlayingHandles.insert(NextHandle);
+		return reinterpret_cast<Effekseer::SoundHandle>(NextHandle++);
+	}
+
+	void Stop(Effekseer::SoundHandle handle, Effekseer::SoundTag tag) override
+	{
+		PlayingHandles.erase(reinterpret_cast<intptr_t>(handle));
+	}
+
+	void Pause(Effekseer::SoundHandle handle, Effekseer::SoundTag tag, bool pause) override
+	{
+	}
+
+	bool CheckPlaying(Effekseer::SoundHandle handle, Effekseer::SoundTag tag) override
+	{
+		return PlayingHandles.count(reinterpret_cast<intptr_t>(handle)) > 0;
+	}
+
+	void StopTag(Effekseer::SoundTag tag) override
+	{
+	}
+
+	void PauseTag(Effekseer::SoundTag tag, bool pause) override
+	{
+	}
+
+	bool CheckPlayingTag(Effekseer::SoundTag tag) override
+	{
+		return false;
+	}
+
+	void StopAll() override
+	{
+		PlayingHandles.clear();
+	}
+};
+
+void SoundVoiceManagerTest()
+{
+	Effekseer::SoundPlayer::InstanceParameter parameter{};
+	parameter.Volume = 1.0f;
+
+	// new voices are evaluated even if the lifetime of virtual voices is shorter than a frame
+	{
+		auto player = Effekseer::MakeRefPtr<MockSoundPlayer>();
+		auto voiceManager = Effekseer::MakeRefPtr<Effekseer::SoundVoiceManager>();
+		voiceManager->SetSoundPlayer(player);
+		voiceManager->SetMaxVoiceCount(1);
+		voiceManager->SetVirtualVoiceLifetime(0.0f);
+
+		voiceManager->Play(nullptr, parameter);
+		voiceManager->Play(nullptr, parameter);
+		voiceManager->Update(2.0f);
+
+		EXPECT_TRUE(player->PlayCount == 1);
+		EXPECT_TRUE(voiceManager->GetVoiceCount() == 2);
+		EXPECT_TRUE(voiceManager->GetVirtualVoiceCount() == 1);
+
+		voiceManager->Update(2.0f);
+
+		EXPECT_TRUE(player->PlayCount == 1);
+		EXPECT_TRUE(voiceManager->GetVoiceCount() == 1);
+		EXPECT_TRUE(voiceManager->GetVirtualVoiceCount() == 0);
+	}
+
+	// a virtual voice is played when a slot is released before it expires
+	{
+		auto player = Effekseer::MakeRefPtr<MockSoundPlayer>();
+		auto voiceManager = Effekseer::MakeRefPtr<Effekseer::SoundVoiceManager>();
+		voiceManager->SetSoundPlayer(player);
+		voiceManager->SetMaxVoiceCount(1);
+		voiceManager->SetVirtualVoiceLifetime(2.0f);
+
+		voiceManager->Play(nullptr, parameter);
+		voiceManager->Play(nullptr, parameter);
+		voiceManager->Play(nullptr, parameter);
+		voiceManager->Update(1.0f);
+		voiceManager->Update(1.0f);
+
+		EXPECT_TRUE(player->PlayCount == 1);
+		EXPECT_TRUE(voiceManager->GetVirtualVoiceCount() == 2);
+
+		player->StopAll();
+		voiceManager->Update(1.0f);
+
+		EXPECT_TRUE(player->PlayCount == 2);
+		EXPECT_TRUE(voiceManager->GetVoiceCount() == 2);
+		EXPECT_TRUE(voiceManager->GetVirtualVoiceCount() == 1);
+
+		// the last virtual voice has waited for 3 frames
+		voiceManager->Update(1.0f);
+
+		EXPECT_TRUE(voiceManager->GetVoiceCount() == 1);
+		EXPECT_TRUE(voiceManager->GetVirtualVoiceCount() == 0);
+	}
+}
+
+void SnapshotTest()
+{
+	auto manager = Effekseer::Manager::Create(2000);
+	auto effect = Effekseer::Effect::Create(manager, (GetDirectoryPathAsU16(__FILE__) + u"../../../../TestData/Effects/10/SimpleLaser.efk").c_str());
+
+	auto handle = manager->Play(effect, 0, 0, 0);
+	for (int32_t i = 0; i < 20; i++)
+	{
+		manager->Update();
+	}
+
+	Effekseer::Manager::Snapshot snapshot;
+	EXPECT_TRUE(manager->SaveSnapshot(handle, snapshot));
+	const auto savedCount = manager->GetInstanceCount(handle);
+
+	std::vector<int32_t> counts;
+	for (int32_t i = 0; i < 30; i++)
+	{
+		manager->Update();
+		counts.push_back(manager->GetInstanceCount(handle));
+	}
+
+	// data is copied as if it is written into a file
+	Effekseer::Manager::Snapshot copied;
+	copied.Data.resize(snapshot.Data.size());
+	memcpy(copied.Data.data(), snapshot.Data.data(), snapshot.Data.size());
+	copied.Effects = snapshot.Effects;
+
+	EXPECT_TRUE(manager->LoadSnapshot(handle, copied));
+	EXPECT_TRUE(manager->GetInstanceCount(handle) == savedCount);
+
+	// all states are restored if the same data is saved again
+	Effekseer::Manager::Snapshot resaved;
+	EXPECT_TRUE(manager->SaveSnapshot(handle, resaved));
+	EXPECT_TRUE(resaved.Data == snapshot.Data);
+
+	for (int32_t i = 0; i < 30; i++)
+	{
+		manager->Update();
+		EXPECT_TRUE(manager->GetInstanceCount(handle) == counts[i]);
+	}
+}
+
 #if defined(__linux__) || defined(__APPLE__) || defined(WIN32)
 
 TestRegister Runtime_StringAndPathHelperTest("Runtime.StringAndPathHelperTest", []() -> void { StringAndPathHelperTest(); });
@@ -934,8 +2461,22 @@ TestRegister Runtime_ReloadTest("Runtime.ReloadTest", []() -> void { ReloadTest(
 
 TestRegister Runtime_UpdateToMoveTest("Runtime.UpdateToMoveTest", []() -> void { UpdateToMoveTest(); });
 
+TestRegister Runtime_PrewarmTest("Runtime.PrewarmTest", []() -> void { PrewarmTest(); });
+
+TestRegister Runtime_MatrixBatchTest("Runtime.MatrixBatchTest", []() -> void { MatrixBatchTest(); });
+
 TestRegister Runtime_MassPlayTest("Runtime.MassPlayTest", []() -> void { MassPlayTest(); });
 
+TestRegister Runtime_FreeListStressTest("Runtime.FreeListStressTest", []() -> void { FreeListStressTest(); });
+
+TestRegister Runtime_MemoryGrowthTest("Runtime.MemoryGrowthTest", []() -> void { MemoryGrowthTest(); });
+
+TestRegister Runtime_SpawnBudgetTest("Runtime.SpawnBudgetTest", []() -> void { SpawnBudgetTest(); });
+
+TestRegister Runtime_ProfilingTest("Runtime.ProfilingTest", []() -> void { ProfilingTest(); });
+
+TestRegister Runtime_TracerTest("Runtime.TracerTest", []() -> void { TracerTest(); });
+
 TestRegister Runtime_PlaybackSpeedTest("Runtime.PlaybackSpeedTest", []() -> void { PlaybackSpeedTest(); });
 
 TestRegister Runtime_PlaybackRandomSeedTest("Runtime.PlaybackRandomSeedTest", []() -> void { PlaybackRandomSeedTest(); });
@@ -952,8 +2493,20 @@ TestRegister Runtime_BasicRuntimeDeviceLostTest("Runtime.BasicRuntimeDeviceLostT
 
 TestRegister Runtime_ProceduralModelCacheTest("Runtime.ProceduralModelCacheTest", []() -> void { ProceduralModelCacheTest(); });
 
+TestRegister Runtime_SplineTest("Runtime.SplineTest", []() -> void { SplineTest(); });
+
 TestRegister Runtime_CullingTest("Runtime.CullingTest", []() -> void { CullingTest(); });
 
+TestRegister Runtime_CullingTreeTest("Runtime.CullingTreeTest", []() -> void { CullingTreeTest(); });
+
+TestRegister Runtime_InstanceCullingTest("Runtime.InstanceCullingTest", []() -> void { InstanceCullingTest(); });
+
+TestRegister Runtime_ScreenCoverageTest("Runtime.ScreenCoverageTest", []() -> void { ScreenCoverageTest(); });
+
 TestRegister Runtime_RenderLimitTest("Runtime.RenderLimitTest", []() -> void { RenderLimitTest(); });
 
+TestRegister Runtime_SoundVoiceManagerTest("Runtime.SoundVoiceManagerTest", []() -> void { SoundVoiceManagerTest(); });
+
+TestRegister Runtime_SnapshotTest("Runtime.SnapshotTest", []() -> void { SnapshotTest(); });
+
 #endif
\ No newline at end of file
@@ -18,9 +18,12 @@
 #include "EffectPlatformVulkan.h"
 #endif
 
+#include "../../EffekseerRendererCommon/EffekseerRenderer.DDSTextureLoader.h"
+#include "../../EffekseerRendererCommon/EffekseerRenderer.KTX2TextureLoader.h"
 #include "../Effekseer/Effekseer/Effekseer.Base.h"
 #include "../TestHelper.h"
 #include <iostream>
+#include <string.h>
 
 void TextureFormatsPlatform(EffectPlatform* platform, std::string baseResultPath, std::string suffix)
 {
@@ -126,3 +129,188 @@ void TextureFormatsTest()
 }
 
 TestRegister Runtime_TextureFormatsTest("Runtime.TextureFormatsTest", []() -> void { TextureFormatsTest(); });
+
+template <typename T>
+void AppendValue(std::vector<uint8_t>& dst, T value)
+{
+	const auto offset = dst.size();
+	dst.resize(offset + sizeof(T));
+	memcpy(dst.data() + offset, &value, sizeof(T));
+}
+
+//! R8G8B8A8 levels of 4x4, 2x2 and 1x1. each byte has an index of it in all levels
+std::vector<uint8_t> CreateLevels()
+{
+	std::vector<uint8_t> levels((16 + 4 + 1) * 4);
+	for (size_t i = 0; i < levels.size(); i++)
+	{
+		levels[i] = static_cast<uint8_t>(i);
+	}
+	return levels;
+}
+
+std::vector<uint8_t> CreateDDS(uint32_t mipMapCount)
+{
+	std::vector<uint8_t> data;
+	AppendValue<uint32_t>(data, 0x20534444); // DDS
+
+	// DDS_HEADER
+	AppendValue<uint32_t>(data, 124);
+	AppendValue<uint32_t>(data, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000);
+	AppendValue<uint32_t>(data, 4);
+	AppendValue<uint32_t>(data, 4);
+	AppendValue<uint32_t>(data, 16);
+	AppendValue<uint32_t>(data, 0);
+	AppendValue<uint32_t>(data, mipMapCount);
+	for (int i = 0; i < 11; i++)
+	{
+		AppendValue<uint32_t>(data, 0);
+	}
+
+	// DDS_PIXELFORMAT
+	AppendValue<uint32_t>(data, 32);
+	AppendValue<uint32_t>(data, 0x41 /* DDPF_RGB | DDPF_ALPHAPIXELS */);
+	AppendValue<uint32_t>(data, 0);
+	AppendValue<uint32_t>(data, 32);
+	AppendValue<uint32_t>(data, 0x000000FF);
+	AppendValue<uint32_t>(data, 0x0000FF00);
+	AppendValue<uint32_t>(data, 0x00FF0000);
+	AppendValue<uint32_t>(data, 0xFF000000);
+
+	for (int i = 0; i < 5; i++)
+	{
+		AppendValue<uint32_t>(data, 0);
+	}
+
+	const auto levels = CreateLevels();
+	data.insert(data.end(), levels.begin(), levels.end());
+	return data;
+}
+
+std::vector<uint8_t> CreateKTX2(uint32_t levelCount)
+{
+	const uint8_t identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+	const uint32_t indexCount = levelCount == 0 ? 1 : levelCount;
+
+	std::vector<uint8_t> data(identifier, identifier + 12);
+	AppendValue<uint32_t>(data, 37); // VK_FORMAT_R8G8B8A8_UNORM
+	AppendValue<uint32_t>(data, 1);
+	AppendValue<uint32_t>(data, 4);
+	AppendValue<uint32_t>(data, 4);
+	AppendValue<uint32_t>(data, 0);
+	AppendValue<uint32_t>(data, 0);
+	AppendValue<uint32_t>(data, 1);
+	AppendValue<uint32_t>(data, levelCount);
+	AppendValue<uint32_t>(data, 0);
+	for (int i = 0; i < 4; i++)
+	{
+		AppendValue<uint32_t>(data, 0);
+	}
+	AppendValue<uint64_t>(data, 0);
+	AppendValue<uint64_t>(data, 0);
+
+	// levels are stored from the smallest level. levels over 1x1 are also 1x1
+	const auto levels = CreateLevels();
+	const auto getLevelOffset = [](uint32_t level) -> uint64_t { return level == 0 ? 0 : (level == 1 ? 16 * 4 : (16 + 4) * 4); };
+	const auto getLevelSize = [](uint32_t level) -> uint64_t { return level == 0 ? 16 * 4 : (level == 1 ? 4 * 4 : 1 * 4); };
+	const uint64_t dataOffset = data.size() + 24 * indexCount;
+
+	for (uint32_t level = 0; level < indexCount; level++)
+	{
+		uint64_t levelOffset = dataOffset;
+		for (uint32_t smaller = level + 1; smaller < indexCount; smaller++)
+		{
+			levelOffset += getLevelSize(smaller);
+		}
+
+		AppendValue<uint64_t>(data, levelOffset);
+		AppendValue<uint64_t>(data, getLevelSize(level));
+		AppendValue<uint64_t>(data, getLevelSize(level));
+	}
+
+	for (int32_t level = static_cast<int32_t>(indexCount) - 1; level >= 0; level--)
+	{
+		const auto begin = levels.begin() + static_cast<size_t>(getLevelOffset(level));
+		data.insert(data.end(), begin, begin + static_cast<size_t>(getLevelSize(level)));
+	}
+
+	return data;
+}
+
+void TextureFormatsLoaderTest()
+{
+	const auto levels = CreateLevels();
+
+	{
+		const auto dds = CreateDDS(3);
+
+		EffekseerRenderer::DDSTextureLoader loader;
+		EXPECT_TRUE(loader.Load(dds.data(), static_cast<int32_t>(dds.size())));
+		EXPECT_TRUE(loader.GetMipLevelCount() == 3);
+		EXPECT_TRUE(loader.GetTextures().size() == 3);
+		EXPECT_TRUE(loader.GetTextures()[1].Width == 2 && loader.GetTextures()[1].Height == 2);
+		EXPECT_TRUE(loader.GetTextures()[1].Data.size() == 16);
+		EXPECT_TRUE(memcmp(loader.GetTextures()[1].Data.data(), levels.data() + 64, 16) == 0);
+		EXPECT_TRUE(memcmp(loader.GetTextures()[2].Data.data(), levels.data() + 80, 4) == 0);
+
+		Effekseer::CustomVector<uint8_t> dst;
+		EXPECT_TRUE(loader.Load(dds.data(), static_cast<int32_t>(dds.size()), dst));
+		EXPECT_TRUE(loader.GetBackendTextureFormat() == Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM);
+		EXPECT_TRUE(dst.size() == levels.size());
+		EXPECT_TRUE(memcmp(dst.data(), levels.data(), levels.size()) == 0);
+
+		// levels are lacked
+		EXPECT_TRUE(!loader.Load(dds.data(), static_cast<int32_t>(dds.size() - 1), dst));
+	}
+
+	{
+		const auto ktx2 = CreateKTX2(3);
+
+		EffekseerRenderer::KTX2TextureLoader loader;
+		Effekseer::CustomVector<uint8_t> dst;
+		EXPECT_TRUE(loader.Load(ktx2.data(), static_cast<int32_t>(ktx2.size()), dst));
+		EXPECT_TRUE(loader.GetWidth() == 4 && loader.GetHeight() == 4);
+		EXPECT_TRUE(loader.GetMipLevelCount() == 3);
+		EXPECT_TRUE(loader.GetBackendTextureFormat() == Effekseer::Backend::TextureFormatType::R8G8B8A8_UNORM);
+		EXPECT_TRUE(dst.size() == levels.size());
+		EXPECT_TRUE(memcmp(dst.data(), levels.data(), levels.size()) == 0);
+
+		EXPECT_TRUE(!loader.Load(ktx2.data(), static_cast<int32_t>(ktx2.size() - 1), dst));
+	}
+
+	{
+		// mipmaps should be generated
+		const auto ktx2 = CreateKTX2(0);
+
+		EffekseerRenderer::KTX2TextureLoader loader;
+		Effekseer::CustomVector<uint8_t> dst;
+		EXPECT_TRUE(loader.Load(ktx2.data(), static_cast<int32_t>(ktx2.size()), dst));
+		EXPECT_TRUE(loader.GetMipLevelCount() == 0);
+		EXPECT_TRUE(dst.size() == 64);
+	}
+
+	{
+		// 4x4 has only 3 levels
+		const auto ktx2 = CreateKTX2(4);
+
+		EffekseerRenderer::KTX2TextureLoader loader;
+		Effekseer::CustomVector<uint8_t> dst;
+		EXPECT_TRUE(!loader.Load(ktx2.data(), static_cast<int32_t>(ktx2.size()), dst));
+	}
+
+	{
+		// 4x4 has only 3 levels
+		for (const auto mipMapCount : {4u, 0xFFFFFFFFu})
+		{
+			const auto dds = CreateDDS(mipMapCount);
+
+			EffekseerRenderer::DDSTextureLoader loader;
+			EXPECT_TRUE(!loader.Load(dds.data(), static_cast<int32_t>(dds.size())));
+
+			Effekseer::CustomVector<uint8_t> dst;
+			EXPECT_TRUE(!loader.Load(dds.data(), static_cast<int32_t>(dds.size()), dst));
+		}
+	}
+}
+
+TestRegister Runtime_TextureFormatsLoaderTest("Runtime.TextureFormatsLoaderTest", []() -> void { TextureFormatsLoaderTest(); });
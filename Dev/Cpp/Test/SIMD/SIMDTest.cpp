@@ -1,4 +1,7 @@
+#include <array>
 #include <cassert>
+#include <random>
+#include <vector>
 #include "SIMD/Float4.h"
 #include "SIMD/Int4.h"
 #include "SIMD/Bridge.h"
@@ -8,6 +11,11 @@
 #include "SIMD/Mat43f.h"
 #include "SIMD/Mat44f.h"
 #include "SIMD/Utils.h"
+#include "SIMD/Float8.h"
+#include "SIMD/Int8.h"
+#include "SIMD/Bridge8.h"
+#include "SIMD/Kernels.h"
+#include "Noise/PerlinNoise.h"
 #include "Effekseer.Vector2D.h"
 #include "Effekseer.Vector3D.h"
 #include "Effekseer.Matrix43.h"
@@ -513,6 +521,207 @@ void test_Int4()
 	}
 }
 
+void test_Float8()
+{
+	{
+		float a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+		Float8 ret = Float8::Load8(a);
+		ASSERT(ret == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+	}
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		float ret[8];
+		Float8::Store8(ret, a);
+		ASSERT(ret[0] == 1.0f && ret[3] == 4.0f && ret[4] == 5.0f && ret[7] == 8.0f);
+	}
+	{
+		Float8 a(Float4(1, 2, 3, 4), Float4(5, 6, 7, 8));
+		ASSERT(a == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+		ASSERT(a.GetLow() == Float4(1, 2, 3, 4));
+		ASSERT(a.GetHigh() == Float4(5, 6, 7, 8));
+	}
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		Float8 b(8, 7, 6, 5, 4, 3, 2, 1);
+		ASSERT(a + b == Float8(9));
+		ASSERT(a - b == Float8(-7, -5, -3, -1, 1, 3, 5, 7));
+		ASSERT(a * b == Float8(8, 14, 18, 20, 20, 18, 14, 8));
+		ASSERT(a * 2.0f == Float8(2, 4, 6, 8, 10, 12, 14, 16));
+		ASSERT(a / Float8(2) == Float8(0.5f, 1, 1.5f, 2, 2.5f, 3, 3.5f, 4));
+		ASSERT(Float8::Min(a, b) == Float8(1, 2, 3, 4, 4, 3, 2, 1));
+		ASSERT(Float8::Max(a, b) == Float8(8, 7, 6, 5, 5, 6, 7, 8));
+		ASSERT(Float8::MulAdd(a, b, Float8(2)) == Float8(17, 16, 15, 14, 13, 12, 11, 10));
+		ASSERT(Float8::MulSub(a, b, Float8(2)) == Float8(-15, -12, -9, -6, -3, 0, 3, 6));
+	}
+	{
+		Float8 a(1, 4, 9, 16, 25, 36, 49, 64);
+		ASSERT(Float8::Sqrt(a) == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+		ASSERT(Float8::MoveMask(Float8::NearEqual(Float8::Rsqrt(a), Float8(1.0f / 1, 1.0f / 2, 1.0f / 3, 1.0f / 4, 1.0f / 5, 1.0f / 6, 1.0f / 7, 1.0f / 8), 1e-3f)) == 0xff);
+	}
+	{
+		Float8 a(-1.5f, -0.5f, 0.5f, 1.5f, -2.0f, 2.0f, -2.5f, 2.5f);
+		ASSERT(Float8::Abs(a) == Float8(1.5f, 0.5f, 0.5f, 1.5f, 2.0f, 2.0f, 2.5f, 2.5f));
+		ASSERT(Float8::Floor(a) == Float8(-2, -1, 0, 1, -2, 2, -3, 2));
+		ASSERT(Float8::Ceil(a) == Float8(-1, 0, 1, 2, -2, 2, -2, 3));
+	}
+	{
+		Float8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		Float8 b(1, 3, 2, 4, 6, 5, 7, 9);
+		ASSERT(Float8::MoveMask(Float8::Equal(a, b)) == 0x49);
+		ASSERT(Float8::MoveMask(Float8::NotEqual(a, b)) == 0xb6);
+		ASSERT(Float8::MoveMask(Float8::LessThan(a, b)) == 0x92);
+		ASSERT(Float8::MoveMask(Float8::LessEqual(a, b)) == 0xdb);
+		ASSERT(Float8::MoveMask(Float8::GreaterThan(a, b)) == 0x24);
+		ASSERT(Float8::MoveMask(Float8::GreaterEqual(a, b)) == 0x6d);
+		ASSERT(Float8::Select(Float8::LessThan(a, b), a, b) == Float8(1, 2, 2, 4, 5, 5, 7, 8));
+	}
+	{
+		Float8 a(1.5f, 2.5f, -1.0f, 4.0f, 5.0f, -6.0f, 7.0f, 8.0f);
+		ASSERT(a.Convert8i() == Int8(2, 2, -1, 4, 5, -6, 7, 8));
+		ASSERT(a.Cast8i().Cast8f() == a);
+	}
+}
+
+void test_Int8()
+{
+	{
+		int32_t a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+		Int8 ret = Int8::Load8(a);
+		ASSERT(ret == Int8(1, 2, 3, 4, 5, 6, 7, 8));
+
+		int32_t stored[8];
+		Int8::Store8(stored, ret);
+		ASSERT(stored[0] == 1 && stored[7] == 8);
+	}
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		Int8 b(8, 7, 6, 5, 4, 3, 2, 1);
+		ASSERT(a + b == Int8(9));
+		ASSERT(a - b == Int8(-7, -5, -3, -1, 1, 3, 5, 7));
+		ASSERT(a * b == Int8(8, 14, 18, 20, 20, 18, 14, 8));
+		ASSERT((a & Int8(1)) == Int8(1, 0, 1, 0, 1, 0, 1, 0));
+		ASSERT((a | Int8(1)) == Int8(1, 3, 3, 5, 5, 7, 7, 9));
+		ASSERT(Int8::Min(a, b) == Int8(1, 2, 3, 4, 4, 3, 2, 1));
+		ASSERT(Int8::Max(a, b) == Int8(8, 7, 6, 5, 5, 6, 7, 8));
+		ASSERT(Int8::Abs(a - b) == Int8(7, 5, 3, 1, 1, 3, 5, 7));
+	}
+	{
+		Int8 a(1, 2, 3, 4, -5, -6, -7, -8);
+		ASSERT(Int8::ShiftL<1>(a) == Int8(2, 4, 6, 8, -10, -12, -14, -16));
+		ASSERT(Int8::ShiftRA<1>(a) == Int8(0, 1, 1, 2, -3, -3, -4, -4));
+		ASSERT(Int8::ShiftR<28>(a) == Int8(0, 0, 0, 0, 15, 15, 15, 15));
+	}
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		Int8 b(1, 3, 2, 4, 6, 5, 7, 9);
+		ASSERT(Int8::MoveMask(Int8::Equal(a, b)) == 0x49);
+		ASSERT(Int8::MoveMask(Int8::NotEqual(a, b)) == 0xb6);
+		ASSERT(Int8::MoveMask(Int8::LessThan(a, b)) == 0x92);
+		ASSERT(Int8::MoveMask(Int8::LessEqual(a, b)) == 0xdb);
+		ASSERT(Int8::MoveMask(Int8::GreaterThan(a, b)) == 0x24);
+		ASSERT(Int8::MoveMask(Int8::GreaterEqual(a, b)) == 0x6d);
+	}
+	{
+		Int8 a(1, 2, 3, 4, 5, 6, 7, 8);
+		ASSERT(a.Convert8f() == Float8(1, 2, 3, 4, 5, 6, 7, 8));
+		ASSERT(a == a.Convert8f().Convert8i());
+	}
+}
+
+void test_Kernels(const Kernels& kernels)
+{
+	const int32_t count = 13;
+
+	std::mt19937 mt(1);
+	std::uniform_real_distribution<float> dist(-4.0f, 4.0f);
+
+	{
+		std::vector<Mat43f> lhs(count);
+		std::vector<Mat43f> rhs(count);
+		for (int32_t i = 0; i < count; i++)
+		{
+			lhs[i] = Mat43f::SRT(Vec3f(dist(mt), dist(mt), dist(mt)), Mat43f::RotationXYZ(dist(mt), dist(mt), dist(mt)), Vec3f(dist(mt), dist(mt), dist(mt)));
+			rhs[i] = Mat43f::SRT(Vec3f(dist(mt), dist(mt), dist(mt)), Mat43f::RotationZXY(dist(mt), dist(mt), dist(mt)), Vec3f(dist(mt), dist(mt), dist(mt)));
+		}
+
+		std::vector<Mat43f> dst(count);
+		kernels.MultiplyMat43(reinterpret_cast<float*>(dst.data()), reinterpret_cast<const float*>(lhs.data()), reinterpret_cast<const float*>(rhs.data()), count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			ASSERT(Mat43f::Equal(dst[i], lhs[i] * rhs[i]));
+		}
+
+		// in place
+		kernels.MultiplyMat43(reinterpret_cast<float*>(lhs.data()), reinterpret_cast<const float*>(lhs.data()), reinterpret_cast<const float*>(rhs.data()), count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			ASSERT(Mat43f::Equal(dst[i], lhs[i]));
+		}
+	}
+
+	{
+		std::vector<Vec3f> location(count);
+		std::vector<Vec3f> velocity(count);
+		std::vector<Vec3f> acceleration(count);
+		std::vector<float> time(count);
+		for (int32_t i = 0; i < count; i++)
+		{
+			location[i] = Vec3f(dist(mt), dist(mt), dist(mt));
+			velocity[i] = Vec3f(dist(mt), dist(mt), dist(mt));
+			acceleration[i] = Vec3f(dist(mt), dist(mt), dist(mt));
+			time[i] = dist(mt) + 4.0f;
+		}
+
+		std::vector<Vec3f> dst(count);
+		kernels.IntegratePVA(reinterpret_cast<float*>(dst.data()), reinterpret_cast<const float*>(location.data()), reinterpret_cast<const float*>(velocity.data()), reinterpret_cast<const float*>(acceleration.data()), time.data(), count);
+
+		for (int32_t i = 0; i < count; i++)
+		{
+			const Vec3f expected = location[i] + (velocity[i] * time[i]) + (acceleration[i] * (time[i] * time[i] * 0.5f));
+			ASSERT(Vec3f::Equal(dst[i], expected, 1e-4f));
+		}
+	}
+
+	{
+		PerlinNoise noise(3);
+
+		std::vector<Vec3f> positions(count);
+		for (int32_t i = 0; i < count; i++)
+		{
+			positions[i] = Vec3f(dist(mt), dist(mt), dist(mt));
+		}
+
+		for (int32_t octaves = 1; octaves <= 3; octaves++)
+		{
+			std::vector<float> dst(count);
+			kernels.OctaveNoise(dst.data(), reinterpret_cast<const float*>(positions.data()), count, octaves, noise.GetPermutation());
+
+			for (int32_t i = 0; i < count; i++)
+			{
+				ASSERT(std::abs(dst[i] - noise.OctaveNoise(octaves, positions[i])) < 1e-5f);
+			}
+		}
+	}
+}
+
+void test_Kernels()
+{
+	ASSERT(IsSupported(InstructionSet::Generic));
+	ASSERT(GetKernels(InstructionSet::Generic)->Set == InstructionSet::Generic);
+	ASSERT(IsSupported(GetKernels().Set));
+
+	const InstructionSet sets[] = {InstructionSet::Generic, InstructionSet::AVX2};
+	for (auto set : sets)
+	{
+		if (auto kernels = GetKernels(set))
+		{
+			test_Kernels(*kernels);
+		}
+	}
+}
+
 int main(int argc, char *argv[])
 {
 	test_Float4();
@@ -522,6 +731,9 @@ int main(int argc, char *argv[])
 	test_Mat43f();
 	test_Mat44f();
 	test_Int4();
+	test_Float8();
+	test_Int8();
+	test_Kernels();
 
 	return 0;
 }